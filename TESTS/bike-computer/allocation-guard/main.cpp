@@ -0,0 +1,177 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/****************************************************************************
+ * @file main.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Bike computer test suite: steady-state allocation guard
+ *
+ * @date 2026-10-19
+ * @version 0.1.0
+ ***************************************************************************/
+
+#include <new>
+
+#include "allocation_guard.hpp"
+#include "greentea-client/test_env.h"
+#include "mbed.h"
+#include "unity/unity.h"
+#include "utest/utest.h"
+
+using namespace utest::v1;
+
+using bike_computer::AllocationGuard;
+
+static constexpr uint8_t kNbrOfBlocks = 4;
+static constexpr size_t kBlockSize    = 40;
+static const char* const kThreadName  = "allocator";
+
+// blocks allocated by the allocator thread (the operator is called directly, so that
+// the allocations cannot be elided)
+static void* gBlocks[kNbrOfBlocks] = {nullptr};
+
+static void allocateBlocks() {
+    for (uint8_t index = 0; index < kNbrOfBlocks; index++) {
+        gBlocks[index] = ::operator new(kBlockSize);
+    }
+}
+
+static void freeBlocks() {
+    for (uint8_t index = 0; index < kNbrOfBlocks; index++) {
+        ::operator delete(gBlocks[index]);
+        gBlocks[index] = nullptr;
+    }
+}
+
+static void allocateAndFreeBlocks() {
+    allocateBlocks();
+    freeBlocks();
+}
+
+// runs the function in the allocator thread, returns its statistics
+static AllocationGuard::ThreadStats runInAllocatorThread(
+    mbed::Callback<void()> function) {
+    Thread thread(osPriorityNormal, OS_STACK_SIZE, nullptr, kThreadName);
+    thread.start(function);
+    thread.join();
+
+    AllocationGuard::ThreadStats stats = {nullptr, nullptr, 0, 0, 0};
+    for (uint8_t threadIndex = 0; threadIndex < AllocationGuard::getNbrOfThreads();
+         threadIndex++) {
+        const AllocationGuard::ThreadStats threadStats =
+            AllocationGuard::getThreadStats(threadIndex);
+        if (threadStats.threadName != nullptr &&
+            strcmp(threadStats.threadName, kThreadName) == 0) {
+            stats = threadStats;
+        }
+    }
+    return stats;
+}
+
+// test that the allocations and frees are accounted to the allocating thread
+static control_t test_thread_stats(const size_t call_count) {
+    AllocationGuard::start();
+    AllocationGuard::resetStats();
+    const uint32_t nbrOfAllocations = AllocationGuard::getNbrOfAllocations();
+
+    const AllocationGuard::ThreadStats stats =
+        runInAllocatorThread(callback(allocateAndFreeBlocks));
+    TEST_ASSERT_TRUE(stats.threadName != nullptr);
+    TEST_ASSERT_EQUAL_UINT32(kNbrOfBlocks, stats.nbrOfAllocations);
+    TEST_ASSERT_EQUAL_UINT32(kNbrOfBlocks, stats.nbrOfFrees);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.nbrOfSealedAllocations);
+    TEST_ASSERT_TRUE(AllocationGuard::getNbrOfAllocations() >=
+                     nbrOfAllocations + kNbrOfBlocks);
+    TEST_ASSERT_FALSE(AllocationGuard::isSealed());
+
+    return CaseNext;
+}
+
+// test that the call sites of the last allocations are recorded
+static control_t test_call_sites(const size_t call_count) {
+    AllocationGuard::resetStats();
+    const AllocationGuard::ThreadStats stats =
+        runInAllocatorThread(callback(allocateBlocks));
+    TEST_ASSERT_EQUAL_UINT32(kNbrOfBlocks, stats.nbrOfAllocations);
+
+    // the blocks are the most recent allocations, made from the same call site
+    TEST_ASSERT_TRUE(AllocationGuard::getNbrOfCallSites() >= kNbrOfBlocks);
+    const AllocationGuard::CallSite lastCallSite = AllocationGuard::getCallSite(0);
+    TEST_ASSERT_TRUE(lastCallSite.caller != nullptr);
+    for (uint8_t index = 0; index < kNbrOfBlocks; index++) {
+        const AllocationGuard::CallSite callSite = AllocationGuard::getCallSite(index);
+        TEST_ASSERT_EQUAL_UINT32(kBlockSize, callSite.size);
+        TEST_ASSERT_TRUE(callSite.threadId == stats.threadId);
+        TEST_ASSERT_TRUE(callSite.caller == lastCallSite.caller);
+        TEST_ASSERT_FALSE(callSite.isSealed);
+    }
+    freeBlocks();
+
+    return CaseNext;
+}
+
+// test that the allocations made while sealed are logged, the frees being allowed
+static control_t test_sealed_mode(const size_t call_count) {
+    AllocationGuard::resetStats();
+    // the allocator thread runs while sealed (starting it may also allocate)
+    Thread thread(osPriorityNormal, OS_STACK_SIZE, nullptr, kThreadName);
+    AllocationGuard::seal(AllocationGuard::SealMode::Log);
+    TEST_ASSERT_TRUE(AllocationGuard::isSealed());
+    TEST_ASSERT_EQUAL_UINT32(0, AllocationGuard::getNbrOfSealedAllocations());
+    thread.start(callback(allocateBlocks));
+    thread.join();
+    AllocationGuard::unseal();
+    TEST_ASSERT_FALSE(AllocationGuard::isSealed());
+
+    // the last allocations, made by the thread, were made while sealed
+    TEST_ASSERT_TRUE(AllocationGuard::getNbrOfSealedAllocations() >= kNbrOfBlocks);
+    for (uint8_t index = 0; index < kNbrOfBlocks; index++) {
+        TEST_ASSERT_TRUE(AllocationGuard::getCallSite(index).isSealed);
+    }
+    AllocationGuard::printStats();
+
+    // frees made while sealed are allowed
+    AllocationGuard::seal(AllocationGuard::SealMode::Log);
+    TEST_ASSERT_EQUAL_UINT32(0, AllocationGuard::getNbrOfSealedAllocations());
+    freeBlocks();
+    TEST_ASSERT_EQUAL_UINT32(0, AllocationGuard::getNbrOfSealedAllocations());
+    AllocationGuard::unseal();
+
+    // allocations made once unsealed are not counted
+    allocateAndFreeBlocks();
+    TEST_ASSERT_EQUAL_UINT32(0, AllocationGuard::getNbrOfSealedAllocations());
+
+    return CaseNext;
+}
+
+static utest::v1::status_t greentea_setup(const size_t number_of_cases) {
+    // Here, we specify the timeout (60s) and the host test (a built-in host test or the
+    // name of our Python file)
+    GREENTEA_SETUP(60, "default_auto");
+
+    return greentea_test_setup_handler(number_of_cases);
+}
+
+// List of test cases in this file
+static Case cases[] = {
+    Case("test thread stats", test_thread_stats),
+    Case("test call sites", test_call_sites),
+    Case("test sealed mode", test_sealed_mode),
+};
+
+static Specification specification(greentea_setup, cases);
+
+int main() { return !Harness::run(specification); }
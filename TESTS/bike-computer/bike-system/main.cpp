@@ -24,6 +24,7 @@
 
 #include <chrono>
 
+#include "allocation_guard.hpp"
 #include "constants.hpp"
 #include "greentea-client/test_env.h"
 #include "mbed.h"
@@ -36,6 +37,9 @@
 
 using namespace utest::v1;
 
+using bike_computer::AllocationGuard;
+using bike_computer::DisplayRenderer;
+
 // test_bike_system handler function
 static void test_bike_system() {
     // create the BikeSystem instance
@@ -48,14 +52,24 @@ static void test_bike_system() {
     // let the bike system run for 20 secs
     ThisThread::sleep_for(20s);
 
-    // stop the bike system
+    // the steady state starts at the end of the first major cycle
+    TEST_ASSERT_TRUE(AllocationGuard::isSealed());
+
+    // stop the bike system (the renderer completes the pending frame before the
+    // bike system thread exits)
     bikeSystem.stop();
+    thread.join();
+
+    // check that the steady state did not allocate from the heap
+    TEST_ASSERT_EQUAL_UINT32(0, AllocationGuard::getNbrOfSealedAllocations());
 
     // check whether scheduling was correct
     // Order is kGearTaskIndex, kSpeedTaskIndex, kTemperatureTaskIndex,
     //          kResetTaskIndex, kDisplayTask1Index, kDisplayTask2Index
+    // The display tasks only hand their frame over to the renderer: their computation
+    // time is spent by the renderer thread
     constexpr std::chrono::microseconds taskComputationTimes[] = {
-        100000us, 200000us, 100000us, 100000us, 200000us, 100000us};
+        100000us, 200000us, 100000us, 100000us, 0us, 0us};
     constexpr std::chrono::microseconds taskPeriods[] = {
         800000us, 400000us, 1600000us, 800000us, 1600000us, 1600000us};
 
@@ -72,24 +86,47 @@ static void test_bike_system() {
             taskComputationTimes[taskIndex].count(),
             bikeSystem.getTaskLogger().getComputationTime(taskIndex).count());
     }
+
+    // check that the renderer kept up with the display tasks
+    // (200 msecs for redrawing the fields of display task 1, 100 msecs for the
+    // temperature field of display task 2)
+    const DisplayRenderer& displayRenderer = bikeSystem.getDisplayRenderer();
+    TEST_ASSERT_TRUE(displayRenderer.getNbrOfSubmittedFrames() > 0);
+    TEST_ASSERT_EQUAL_UINT32(displayRenderer.getNbrOfSubmittedFrames(),
+                             displayRenderer.getNbrOfRenderedFrames());
+    TEST_ASSERT_EQUAL_UINT32(0, displayRenderer.getNbrOfDroppedFrames());
+    // the first frame redraws all fields of display task 1 (3 x 66 msecs)
+    constexpr uint64_t kMinMaxRenderTimeUs = 198000;
+    constexpr uint64_t kMaxMaxRenderTimeUs = 300000;
+    const uint64_t maxRenderTimeUs = displayRenderer.getMaxRenderTime().count();
+    TEST_ASSERT_TRUE(maxRenderTimeUs + deltaUs >= kMinMaxRenderTimeUs);
+    TEST_ASSERT_TRUE(maxRenderTimeUs <= kMaxMaxRenderTimeUs + deltaUs);
+    TEST_ASSERT_TRUE(displayRenderer.getAverageRenderTime() <=
+                     displayRenderer.getMaxRenderTime());
 }
 
 // test_bike_system_event_queue handler function
 static void test_bike_system_event_queue() {
     // create the BikeSystem instance
-    static_scheduling::BikeSystem bikeSystem;
+    static_scheduling::BikeSystemWithEventQueue bikeSystem;
 
     // run the bike system in a separate thread
     Thread thread;
     thread.start(
-        callback(&bikeSystem, &static_scheduling::BikeSystem::startWithEventQueue));
+        callback(&bikeSystem, &static_scheduling::BikeSystemWithEventQueue::start));
 
     // let the bike system run for 20 secs
     ThisThread::sleep_for(20s);
 
+    // the steady state starts at the end of the first major cycle
+    TEST_ASSERT_TRUE(AllocationGuard::isSealed());
+
     // stop the bike system
     bikeSystem.stop();
 
+    // check that the steady state did not allocate from the heap
+    TEST_ASSERT_EQUAL_UINT32(0, AllocationGuard::getNbrOfSealedAllocations());
+
     // check whether scheduling was correct
     // Order is kGearTaskIndex, kSpeedTaskIndex, kTemperatureTaskIndex,
     //          kResetTaskIndex, kDisplayTask1Index, kDisplayTask2Index
@@ -120,9 +157,15 @@ static void test_bike_system_with_event() {
     // let the bike system run for 20 secs
     ThisThread::sleep_for(20s);
 
+    // the steady state starts at the end of the first major cycle
+    TEST_ASSERT_TRUE(AllocationGuard::isSealed());
+
     // stop the bike system
     bikeSystem.stop();
 
+    // check that the steady state did not allocate from the heap
+    TEST_ASSERT_EQUAL_UINT32(0, AllocationGuard::getNbrOfSealedAllocations());
+
     // check whether scheduling was correct
     // Order is kGearTaskIndex, kSpeedTaskIndex, kTemperatureTaskIndex,
     //          kResetTaskIndex, kDisplayTask1Index, kDisplayTask2Index
@@ -153,9 +196,15 @@ static void test_multi_tasking_bike_system() {
     // let the bike system run for 20 secs
     ThisThread::sleep_for(20s);
 
+    // the steady state starts at the end of the first major cycle
+    TEST_ASSERT_TRUE(AllocationGuard::isSealed());
+
     // stop the bike system
     bikeSystem.stop();
 
+    // check that the steady state did not allocate from the heap
+    TEST_ASSERT_EQUAL_UINT32(0, AllocationGuard::getNbrOfSealedAllocations());
+
     // check whether scheduling was correct
     // Order is kGearTaskIndex, kSpeedTaskIndex, kTemperatureTaskIndex,
     //          kResetTaskIndex, kDisplayTask1Index, kDisplayTask2Index
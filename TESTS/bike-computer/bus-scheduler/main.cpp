@@ -0,0 +1,303 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/****************************************************************************
+ * @file main.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Bike computer test suite: bus transaction scheduler
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include <chrono>
+
+#include "bus_scheduler.hpp"
+#include "greentea-client/test_env.h"
+#include "mbed.h"
+#include "mock_transaction_bus.hpp"
+#include "unity/unity.h"
+#include "utest/utest.h"
+
+using namespace utest::v1;
+
+using bike_computer::BusPriority;
+using bike_computer::BusScheduler;
+using bike_computer::BusTransaction;
+using bike_computer::MockTransactionBus;
+
+static constexpr std::chrono::microseconds kByteTime = 20us;
+static constexpr uint8_t kAddress                    = 0x80;
+
+// records the order in which transactions complete
+class CompletionRecorder {
+   public:
+    static constexpr uint8_t kMaxNbrOfCompletions = 16;
+
+    void record(uint8_t id) {
+        _ids[_nbrOfCompletions] = id;
+        _nbrOfCompletions++;
+        _semaphore.release();
+    }
+    void waitFor(uint8_t nbrOfCompletions) {
+        for (uint8_t index = 0; index < nbrOfCompletions; index++) {
+            _semaphore.acquire();
+        }
+    }
+    uint8_t getId(uint8_t index) const { return _ids[index]; }
+
+   private:
+    uint8_t _ids[kMaxNbrOfCompletions] = {0};
+    uint8_t _nbrOfCompletions          = 0;
+    Semaphore _semaphore;
+};
+
+struct Completion {
+    CompletionRecorder* recorder;
+    uint8_t id;
+};
+
+static void onCompleted(Completion* completion, int result) {
+    completion->recorder->record(completion->id);
+}
+
+// test that the queued transactions are served by priority, then in submission order
+static control_t test_priority_order(const size_t call_count) {
+    MockTransactionBus bus(kByteTime);
+    BusScheduler scheduler(bus);
+    CompletionRecorder recorder;
+
+    static constexpr uint8_t kNbrOfTransactions                  = 7;
+    static constexpr BusPriority kPriorities[kNbrOfTransactions] = {
+        BusPriority::Low,
+        BusPriority::Normal,
+        BusPriority::High,
+        BusPriority::Low,
+        BusPriority::High,
+        BusPriority::Normal,
+        BusPriority::Low};
+    static constexpr uint8_t kExpectedIds[kNbrOfTransactions] = {2, 4, 1, 5, 0, 3, 6};
+    static constexpr uint8_t kLength                          = 2;
+    char writeData[kLength]                                   = {0x01, 0x02};
+    Completion completions[kNbrOfTransactions];
+    BusTransaction* transactions[kNbrOfTransactions] = {nullptr};
+    for (uint8_t id = 0; id < kNbrOfTransactions; id++) {
+        completions[id].recorder = &recorder;
+        completions[id].id       = id;
+        transactions[id]         = new BusTransaction(kAddress,
+                                              writeData,
+                                              kLength,
+                                              nullptr,
+                                              0,
+                                              kPriorities[id],
+                                              callback(onCompleted, &completions[id]));
+        // the bus thread is not started: the transactions are queued
+        TEST_ASSERT_TRUE(scheduler.submit(*transactions[id]));
+    }
+    // a pending transaction cannot be submitted twice
+    TEST_ASSERT_FALSE(scheduler.submit(*transactions[0]));
+    TEST_ASSERT_EQUAL_UINT32(kNbrOfTransactions, scheduler.getQueueLength());
+
+    scheduler.start();
+    recorder.waitFor(kNbrOfTransactions);
+    for (uint8_t index = 0; index < kNbrOfTransactions; index++) {
+        TEST_ASSERT_EQUAL_UINT8(kExpectedIds[index], recorder.getId(index));
+    }
+    scheduler.stop();
+
+    TEST_ASSERT_EQUAL_UINT32(0, scheduler.getQueueLength());
+    TEST_ASSERT_EQUAL_UINT32(2, scheduler.getNbrOfTransactions(BusPriority::High));
+    TEST_ASSERT_EQUAL_UINT32(2, scheduler.getNbrOfTransactions(BusPriority::Normal));
+    TEST_ASSERT_EQUAL_UINT32(3, scheduler.getNbrOfTransactions(BusPriority::Low));
+    for (uint8_t id = 0; id < kNbrOfTransactions; id++) {
+        TEST_ASSERT_FALSE(transactions[id]->isPending());
+        TEST_ASSERT_EQUAL_INT(0, transactions[id]->getResult());
+        delete transactions[id];
+    }
+
+    return CaseNext;
+}
+
+// test a blocking transaction with a write followed by a read
+static control_t test_blocking_transfer(const size_t call_count) {
+    MockTransactionBus bus(kByteTime);
+    BusScheduler scheduler(bus);
+    scheduler.start();
+
+    static constexpr uint8_t kReadLength = 4;
+    const char reg                       = 0x00;
+    char readData[kReadLength]           = {0};
+    TEST_ASSERT_EQUAL_INT(
+        0,
+        scheduler.transfer(
+            kAddress, &reg, 1, readData, kReadLength, BusPriority::Normal));
+    for (uint8_t index = 0; index < kReadLength; index++) {
+        TEST_ASSERT_EQUAL_UINT8(static_cast<uint8_t>(kAddress + index),
+                                static_cast<uint8_t>(readData[index]));
+    }
+    TEST_ASSERT_EQUAL_UINT32(1, bus.getNbrOfTransactions());
+    TEST_ASSERT_EQUAL_UINT32(1 + kReadLength, bus.getNbrOfBytes());
+    TEST_ASSERT_EQUAL_UINT32(1, scheduler.getNbrOfTransactions(BusPriority::Normal));
+
+    return CaseNext;
+}
+
+// threads running blocking transactions concurrently
+static constexpr uint8_t kNbrOfClientThreads               = 4;
+static constexpr uint16_t kNbrOfTransactionsPerClientThread = 50;
+
+static void runClientThread(BusScheduler* scheduler) {
+    char readData[2] = {0};
+    for (uint16_t index = 0; index < kNbrOfTransactionsPerClientThread; index++) {
+        scheduler->transfer(kAddress, nullptr, 0, readData, 2, BusPriority::Normal);
+    }
+}
+
+// test that the transactions submitted by several threads are serialized on the bus
+static control_t test_serialized_threads(const size_t call_count) {
+    MockTransactionBus bus(kByteTime);
+    BusScheduler scheduler(bus);
+    scheduler.start();
+
+    Thread* threads[kNbrOfClientThreads] = {nullptr};
+    for (uint8_t index = 0; index < kNbrOfClientThreads; index++) {
+        threads[index] = new Thread();
+        threads[index]->start(callback(runClientThread, &scheduler));
+    }
+    for (uint8_t index = 0; index < kNbrOfClientThreads; index++) {
+        threads[index]->join();
+        delete threads[index];
+    }
+
+    static constexpr uint32_t kNbrOfTransactions =
+        kNbrOfClientThreads * kNbrOfTransactionsPerClientThread;
+    TEST_ASSERT_EQUAL_UINT32(kNbrOfTransactions, bus.getNbrOfTransactions());
+    TEST_ASSERT_EQUAL_UINT32(kNbrOfTransactions,
+                             scheduler.getNbrOfTransactions(BusPriority::Normal));
+    TEST_ASSERT_EQUAL_UINT8(1, bus.getMaxNbrOfConcurrentTransactions());
+    TEST_ASSERT_TRUE(scheduler.getMaxQueueLength() <= kNbrOfClientThreads);
+    scheduler.printStats();
+
+    return CaseNext;
+}
+
+// sensor traffic: a low priority transaction submitted again as soon as it completes
+class SensorTraffic {
+   public:
+    static constexpr uint8_t kReadLength = 8;
+
+    SensorTraffic()
+        : _transaction(kAddress,
+                       &_reg,
+                       1,
+                       _readData,
+                       kReadLength,
+                       BusPriority::Low,
+                       callback(this, &SensorTraffic::onCompleted)) {}
+
+    void start(BusScheduler& scheduler) {  // NOLINT(runtime/references)
+        _scheduler = &scheduler;
+        _scheduler->submit(_transaction);
+    }
+    void stop() {
+        core_util_atomic_store_bool(&_isStopped, true);
+        while (_transaction.isPending()) {
+            ThisThread::sleep_for(1ms);
+        }
+    }
+
+   private:
+    void onCompleted(int result) {
+        if (!core_util_atomic_load_bool(&_isStopped)) {
+            _scheduler->submit(_transaction);
+        }
+    }
+
+    const char _reg             = 0x00;
+    char _readData[kReadLength] = {0};
+    BusScheduler* _scheduler    = nullptr;
+    volatile bool _isStopped    = false;
+    BusTransaction _transaction;
+};
+
+// test that a display refresh (high priority) does not wait behind the queued sensor
+// reads (low priority): it waits at most for the running transaction
+static control_t test_high_priority_latency(const size_t call_count) {
+    MockTransactionBus bus(kByteTime);
+    BusScheduler scheduler(bus);
+    scheduler.start();
+
+    static constexpr uint8_t kNbrOfSensors = 8;
+    SensorTraffic sensorTraffic[kNbrOfSensors];
+    for (uint8_t index = 0; index < kNbrOfSensors; index++) {
+        sensorTraffic[index].start(scheduler);
+    }
+
+    static constexpr uint8_t kNbrOfRefreshes = 50;
+    static constexpr uint8_t kRefreshLength  = 32;
+    char frame[kRefreshLength]               = {0};
+    for (uint8_t refresh = 0; refresh < kNbrOfRefreshes; refresh++) {
+        TEST_ASSERT_EQUAL_INT(
+            0,
+            scheduler.transfer(
+                kAddress, frame, kRefreshLength, nullptr, 0, BusPriority::High));
+        ThisThread::sleep_for(2ms);
+    }
+    for (uint8_t index = 0; index < kNbrOfSensors; index++) {
+        sensorTraffic[index].stop();
+    }
+    scheduler.printStats();
+
+    const std::chrono::microseconds sensorReadTime =
+        bus.getTransferTime(1, SensorTraffic::kReadLength);
+    const std::chrono::microseconds averageHighWait =
+        scheduler.getAverageQueueWait(BusPriority::High);
+    const std::chrono::microseconds averageLowWait =
+        scheduler.getAverageQueueWait(BusPriority::Low);
+    printf("Sensor read %" PRIu64 " us, average wait: refresh %" PRIu64
+           " us, sensor read %" PRIu64 " us\n",
+           static_cast<uint64_t>(sensorReadTime.count()),
+           static_cast<uint64_t>(averageHighWait.count()),
+           static_cast<uint64_t>(averageLowWait.count()));
+    TEST_ASSERT_EQUAL_UINT32(kNbrOfRefreshes,
+                             scheduler.getNbrOfTransactions(BusPriority::High));
+    // the sensor reads queue behind each other, a refresh only behind the running one
+    // (with some margin for the scheduling of the host)
+    TEST_ASSERT_TRUE(averageLowWait >= sensorReadTime * (kNbrOfSensors - 2));
+    TEST_ASSERT_TRUE(averageHighWait < sensorReadTime * 2);
+    TEST_ASSERT_EQUAL_UINT8(1, bus.getMaxNbrOfConcurrentTransactions());
+
+    return CaseNext;
+}
+
+static utest::v1::status_t greentea_setup(const size_t number_of_cases) {
+    // Here, we specify the timeout (60s) and the host test (a built-in host test or the
+    // name of our Python file)
+    GREENTEA_SETUP(60, "default_auto");
+
+    return greentea_test_setup_handler(number_of_cases);
+}
+
+// List of test cases in this file
+static Case cases[] = {
+    Case("test priority order", test_priority_order),
+    Case("test blocking transfer", test_blocking_transfer),
+    Case("test serialized threads", test_serialized_threads),
+    Case("test high priority latency", test_high_priority_latency)};
+
+static Specification specification(greentea_setup, cases);
+
+int main() { return !Harness::run(specification); }
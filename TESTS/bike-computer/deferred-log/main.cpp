@@ -0,0 +1,272 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file main.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Bike computer test suite: binary deferred logging
+ *
+ * @date 2026-10-19
+ * @version 0.1.0
+ ***************************************************************************/
+
+#include <chrono>
+#include <cstring>
+
+#include "deferred_log.hpp"
+#include "greentea-client/test_env.h"
+#include "mbed.h"
+#include "unity/unity.h"
+#include "utest/utest.h"
+#if defined(BIKE_COMPUTER_HOST)
+#include "deferred_log_decoder.hpp"
+#endif  // defined(BIKE_COMPUTER_HOST)
+
+using namespace utest::v1;
+
+using bike_computer::DeferredLog;
+using bike_computer::deferredLog;
+using bike_computer::LogFormatId;
+
+// frames sent by the deferred log
+static uint8_t gFrames[8192];
+static size_t gFramesSize = 0;
+
+static void captureFrame(const uint8_t* data, size_t size) {
+    if (gFramesSize + size <= sizeof(gFrames)) {
+        memcpy(&gFrames[gFramesSize], data, size);
+        gFramesSize += size;
+    }
+}
+
+// the pending records of the previous cases are discarded
+static DeferredLog& getEmptyLog() {
+    DeferredLog& log = DeferredLog::getInstance();
+    log.setSink(callback(captureFrame));
+    log.flush();
+    gFramesSize = 0;
+    return log;
+}
+
+static uint8_t computeChecksum(const uint8_t* frame, size_t frameSize) {
+    uint8_t checksum = 0;
+    for (size_t index = 1; index < frameSize - 1; index++) {
+        checksum += frame[index];
+    }
+    return checksum;
+}
+
+// test that a record is sent as a frame holding the raw arguments
+static control_t test_frame_layout(const size_t call_count) {
+    DeferredLog& log = getEmptyLog();
+
+    const uint32_t nbrOfSentFrames = log.getNbrOfSentFrames();
+    deferredLog<LogFormatId::ResetResponseTime>(0x12345678u);
+    // nothing is sent before the log is drained
+    TEST_ASSERT_EQUAL_UINT32(0, gFramesSize);
+    log.flush();
+
+    static constexpr size_t kFrameSize = DeferredLog::kFrameHeaderSize + 4 + 1;
+    TEST_ASSERT_EQUAL_UINT32(kFrameSize, gFramesSize);
+    TEST_ASSERT_EQUAL_UINT32(nbrOfSentFrames + 1, log.getNbrOfSentFrames());
+    TEST_ASSERT_EQUAL_UINT8(DeferredLog::kSyncByte, gFrames[0]);
+    TEST_ASSERT_EQUAL_UINT8(static_cast<uint8_t>(LogFormatId::ResetResponseTime),
+                            gFrames[1]);
+    TEST_ASSERT_EQUAL_UINT8(0, gFrames[2]);
+    TEST_ASSERT_EQUAL_UINT8(4, gFrames[DeferredLog::kFrameHeaderSize - 1]);
+    TEST_ASSERT_EQUAL_UINT8(0x78, gFrames[DeferredLog::kFrameHeaderSize]);
+    TEST_ASSERT_EQUAL_UINT8(0x56, gFrames[DeferredLog::kFrameHeaderSize + 1]);
+    TEST_ASSERT_EQUAL_UINT8(0x34, gFrames[DeferredLog::kFrameHeaderSize + 2]);
+    TEST_ASSERT_EQUAL_UINT8(0x12, gFrames[DeferredLog::kFrameHeaderSize + 3]);
+    TEST_ASSERT_EQUAL_UINT8(computeChecksum(gFrames, kFrameSize),
+                            gFrames[kFrameSize - 1]);
+
+    // float arguments are sent as their bit pattern
+    gFramesSize = 0;
+    deferredLog<LogFormatId::SpeedometerSpeed>(26.5f);
+    log.flush();
+    float speed = 0.0f;
+    memcpy(&speed, &gFrames[DeferredLog::kFrameHeaderSize], sizeof(speed));
+    TEST_ASSERT_EQUAL_UINT32(kFrameSize, gFramesSize);
+    TEST_ASSERT_FLOAT_WITHIN(0.0f, 26.5f, speed);
+
+    return CaseNext;
+}
+
+// test that the records that do not fit in the ring are dropped without blocking
+static control_t test_ring_overflow(const size_t call_count) {
+    DeferredLog& log = getEmptyLog();
+
+    static constexpr uint32_t kNbrOfExtraRecords = 5;
+    const uint32_t nbrOfDroppedRecords           = log.getNbrOfDroppedRecords();
+    for (uint32_t index = 0; index < DeferredLog::kNbrOfRecords + kNbrOfExtraRecords;
+         index++) {
+        deferredLog<LogFormatId::ResetResponseTime>(index);
+    }
+    TEST_ASSERT_EQUAL_UINT32(nbrOfDroppedRecords + kNbrOfExtraRecords,
+                             log.getNbrOfDroppedRecords());
+
+    // the oldest records are kept
+    log.flush();
+    static constexpr size_t kFrameSize = DeferredLog::kFrameHeaderSize + 4 + 1;
+    TEST_ASSERT_EQUAL_UINT32(DeferredLog::kNbrOfRecords * kFrameSize, gFramesSize);
+    TEST_ASSERT_EQUAL_UINT8(0, gFrames[DeferredLog::kFrameHeaderSize]);
+    const size_t lastPayloadOffset =
+        gFramesSize - kFrameSize + DeferredLog::kFrameHeaderSize;
+    TEST_ASSERT_EQUAL_UINT8(DeferredLog::kNbrOfRecords - 1, gFrames[lastPayloadOffset]);
+
+    // the ring is usable again once drained
+    gFramesSize = 0;
+    deferredLog<LogFormatId::ResetResponseTime>(7u);
+    log.flush();
+    TEST_ASSERT_EQUAL_UINT32(kFrameSize, gFramesSize);
+
+    return CaseNext;
+}
+
+#if defined(BIKE_COMPUTER_HOST)
+static host::DeferredLogDecoder::Record gRecords[8];
+static uint8_t gNbrOfRecords = 0;
+
+static void onRecord(const host::DeferredLogDecoder::Record& record) {
+    if (gNbrOfRecords < sizeof(gRecords) / sizeof(gRecords[0])) {
+        gRecords[gNbrOfRecords++] = record;
+    }
+}
+
+// test that the host decoder skips the bytes that do not belong to valid frames and
+// formats the records (host only)
+static control_t test_decoder(const size_t call_count) {
+    DeferredLog& log = getEmptyLog();
+
+    deferredLog<LogFormatId::ResetResponseTime>(1234u);
+    deferredLog<LogFormatId::SpeedometerSpeed>(26.5f);
+    deferredLog<LogFormatId::CpuUsage>(97u, 3u);
+    log.flush();
+    static constexpr size_t kFrameSize = DeferredLog::kFrameHeaderSize + 4 + 1;
+
+    // text traces before the frames and a corrupted second frame
+    uint8_t stream[256];
+    const char kText[] = "[INFO][main]: text trace\n";
+    size_t streamSize  = sizeof(kText) - 1;
+    memcpy(stream, kText, streamSize);
+    memcpy(&stream[streamSize], gFrames, gFramesSize);
+    stream[streamSize + kFrameSize + DeferredLog::kFrameHeaderSize] ^= 0x01;
+    streamSize += gFramesSize;
+
+    gNbrOfRecords = 0;
+    host::DeferredLogDecoder decoder(callback(onRecord));
+    // the frames are split across chunks
+    static constexpr size_t kChunkSize = 3;
+    for (size_t index = 0; index < streamSize; index += kChunkSize) {
+        const size_t chunkSize =
+            (streamSize - index < kChunkSize) ? streamSize - index : kChunkSize;
+        decoder.decode(&stream[index], chunkSize);
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(2, decoder.getNbrOfRecords());
+    TEST_ASSERT_EQUAL_UINT32(1, decoder.getNbrOfChecksumErrors());
+    TEST_ASSERT_TRUE(decoder.getNbrOfSkippedBytes() >= sizeof(kText) - 1 + kFrameSize);
+    TEST_ASSERT_EQUAL_UINT8(2, gNbrOfRecords);
+
+    char text[128];
+    host::DeferredLogDecoder::format(gRecords[0], text, sizeof(text));
+    TEST_ASSERT_EQUAL_STRING("Reset task: response time is 1234 usecs", text);
+    host::DeferredLogDecoder::format(gRecords[1], text, sizeof(text));
+    TEST_ASSERT_EQUAL_STRING("Idle: 97% Usage: 3%", text);
+    TEST_ASSERT_TRUE(gRecords[0].timestamp <= gRecords[1].timestamp);
+
+    // float formatting
+    host::DeferredLogDecoder::Record record = gRecords[0];
+    record.formatId                         = LogFormatId::SpeedometerSpeed;
+    const float speed                       = 26.5f;
+    memcpy(&record.arguments[0], &speed, sizeof(speed));
+    host::DeferredLogDecoder::format(record, text, sizeof(text));
+    TEST_ASSERT_EQUAL_STRING("New speed is 26.500000", text);
+
+    return CaseNext;
+}
+#endif  // defined(BIKE_COMPUTER_HOST)
+
+// records written by each writer thread
+static constexpr uint32_t kNbrOfRecordsPerWriter = 200;
+
+static void writerFunction(uint32_t* firstValue) {
+    for (uint32_t index = 0; index < kNbrOfRecordsPerWriter; index++) {
+        deferredLog<LogFormatId::ResetResponseTime>(*firstValue + index);
+        // the ring is drained every kDrainPeriod
+        if ((index % 8) == 7) {
+            ThisThread::sleep_for(5ms);
+        }
+    }
+}
+
+// test that the log thread drains the records written by concurrent writers, the
+// records of each writer being kept in order (this case stops the log thread)
+static control_t test_concurrent_writers(const size_t call_count) {
+    DeferredLog& log = getEmptyLog();
+    const uint32_t nbrOfWrittenRecords = log.getNbrOfWrittenRecords();
+    const uint32_t nbrOfDroppedRecords = log.getNbrOfDroppedRecords();
+    log.start();
+
+    uint32_t firstValues[] = {0, 10000};
+    Thread writer1(osPriorityNormal, OS_STACK_SIZE, nullptr, "writer1");
+    Thread writer2(osPriorityAboveNormal, OS_STACK_SIZE, nullptr, "writer2");
+    writer1.start(callback(writerFunction, &firstValues[0]));
+    writer2.start(callback(writerFunction, &firstValues[1]));
+    writer1.join();
+    writer2.join();
+    // the pending records are sent before the thread terminates
+    log.stop();
+
+    static constexpr size_t kFrameSize = DeferredLog::kFrameHeaderSize + 4 + 1;
+    TEST_ASSERT_EQUAL_UINT32(nbrOfWrittenRecords + 2 * kNbrOfRecordsPerWriter,
+                             log.getNbrOfWrittenRecords());
+    TEST_ASSERT_EQUAL_UINT32(nbrOfDroppedRecords, log.getNbrOfDroppedRecords());
+    TEST_ASSERT_EQUAL_UINT32(2 * kNbrOfRecordsPerWriter * kFrameSize, gFramesSize);
+
+    uint32_t nextValues[] = {firstValues[0], firstValues[1]};
+    for (size_t offset = 0; offset < gFramesSize; offset += kFrameSize) {
+        uint32_t value = 0;
+        memcpy(&value, &gFrames[offset + DeferredLog::kFrameHeaderSize], sizeof(value));
+        const uint8_t writerIndex = (value >= firstValues[1]) ? 1 : 0;
+        TEST_ASSERT_EQUAL_UINT32(nextValues[writerIndex], value);
+        nextValues[writerIndex]++;
+    }
+
+    return CaseNext;
+}
+
+static utest::v1::status_t greentea_setup(const size_t number_of_cases) {
+    // Here, we specify the timeout (60s) and the host test (a built-in host test or the
+    // name of our Python file)
+    GREENTEA_SETUP(60, "default_auto");
+
+    return greentea_test_setup_handler(number_of_cases);
+}
+
+// List of test cases in this file
+static Case cases[] = {
+    Case("test frame layout", test_frame_layout),
+    Case("test ring overflow", test_ring_overflow),
+#if defined(BIKE_COMPUTER_HOST)
+    Case("test decoder", test_decoder),
+#endif  // defined(BIKE_COMPUTER_HOST)
+    Case("test concurrent writers", test_concurrent_writers),
+};
+
+static Specification specification(greentea_setup, cases);
+
+int main() { return !Harness::run(specification); }
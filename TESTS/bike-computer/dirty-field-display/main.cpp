@@ -0,0 +1,167 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/****************************************************************************
+ * @file main.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Bike computer test suite: dirty-field display rendering
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include <chrono>
+
+#include "dirty_field_display.hpp"
+#include "display_device.hpp"
+#include "display_device_adapter.hpp"
+#include "display_renderer.hpp"
+#include "greentea-client/test_env.h"
+#include "mbed.h"
+#include "static_scheduling/bike_system.hpp"
+#include "task_logger.hpp"
+#include "unity/unity.h"
+#include "utest/utest.h"
+
+using namespace utest::v1;
+
+using bike_computer::DirtyFieldDisplay;
+using bike_computer::DisplayDeviceAdapter;
+using bike_computer::DisplayRenderer;
+
+// test that a field is redrawn only when its displayed text changes
+static control_t test_redraw_on_text_change(const size_t call_count) {
+    advembsof::DisplayDevice displayDevice;
+    DisplayDeviceAdapter displayDeviceAdapter(displayDevice);
+    DirtyFieldDisplay dirtyFieldDisplay(displayDeviceAdapter);
+
+    // the first update draws the field
+    TEST_ASSERT_TRUE(dirtyFieldDisplay.updateSpeed(25.04f));
+    TEST_ASSERT_EQUAL_STRING("25.0",
+                             dirtyFieldDisplay.getText(DirtyFieldDisplay::Field::Speed));
+
+    // a change below the displayed resolution is skipped
+    TEST_ASSERT_FALSE(dirtyFieldDisplay.updateSpeed(25.01f));
+    TEST_ASSERT_FALSE(dirtyFieldDisplay.updateSpeed(24.96f));
+    TEST_ASSERT_FLOAT_WITHIN(
+        0.001f,
+        25.04f,
+        dirtyFieldDisplay.getRenderedValue(DirtyFieldDisplay::Field::Speed));
+
+    // a visible change is redrawn
+    TEST_ASSERT_TRUE(dirtyFieldDisplay.updateSpeed(25.1f));
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 25.1f, displayDevice.getDisplayedSpeed());
+
+    TEST_ASSERT_EQUAL_UINT32(
+        2, dirtyFieldDisplay.getNbrOfRedrawnFields(DirtyFieldDisplay::Field::Speed));
+    TEST_ASSERT_EQUAL_UINT32(
+        2, dirtyFieldDisplay.getNbrOfSkippedFields(DirtyFieldDisplay::Field::Speed));
+
+    return CaseNext;
+}
+
+// test that the fields are tracked independently and redrawn after invalidation
+static control_t test_fields_and_invalidation(const size_t call_count) {
+    advembsof::DisplayDevice displayDevice;
+    DisplayDeviceAdapter displayDeviceAdapter(displayDevice);
+    DirtyFieldDisplay dirtyFieldDisplay(displayDeviceAdapter);
+
+    TEST_ASSERT_TRUE(dirtyFieldDisplay.updateGear(3));
+    TEST_ASSERT_TRUE(dirtyFieldDisplay.updateDistance(1.234f));
+    TEST_ASSERT_TRUE(dirtyFieldDisplay.updateTemperature(22.0f));
+    TEST_ASSERT_FALSE(dirtyFieldDisplay.updateGear(3));
+    TEST_ASSERT_TRUE(dirtyFieldDisplay.updateDistance(1.236f));
+    TEST_ASSERT_FALSE(dirtyFieldDisplay.updateTemperature(22.04f));
+    TEST_ASSERT_EQUAL_UINT8(3, displayDevice.getDisplayedGear());
+
+    // the screen content is lost: all fields are redrawn
+    dirtyFieldDisplay.invalidate();
+    TEST_ASSERT_TRUE(dirtyFieldDisplay.updateGear(3));
+    TEST_ASSERT_TRUE(dirtyFieldDisplay.updateTemperature(22.04f));
+
+    TEST_ASSERT_EQUAL_UINT32(6, dirtyFieldDisplay.getNbrOfRedrawnFields());
+    TEST_ASSERT_EQUAL_UINT32(2, dirtyFieldDisplay.getNbrOfSkippedFields());
+
+    return CaseNext;
+}
+
+// test that the display computation time drops when the rider coasts at constant
+// speed (gear, speed and temperature unchanged)
+static control_t test_coasting_computation_time(const size_t call_count) {
+    // create the BikeSystem instance (super-loop, computation times are simulated)
+    static_scheduling::BikeSystem bikeSystem;
+
+    // run the bike system in a separate thread for 3 major cycles (no input, constant
+    // speed)
+    Thread thread;
+    thread.start(callback(&bikeSystem, &static_scheduling::BikeSystem::start));
+    ThisThread::sleep_for(5s);
+    bikeSystem.stop();
+    thread.join();
+
+    const DirtyFieldDisplay& dirtyFieldDisplay = bikeSystem.getDirtyFieldDisplay();
+    dirtyFieldDisplay.printStats();
+    // only the first refresh draws gear, speed and temperature
+    TEST_ASSERT_EQUAL_UINT32(
+        1, dirtyFieldDisplay.getNbrOfRedrawnFields(DirtyFieldDisplay::Field::Gear));
+    TEST_ASSERT_EQUAL_UINT32(
+        1, dirtyFieldDisplay.getNbrOfRedrawnFields(DirtyFieldDisplay::Field::Speed));
+    TEST_ASSERT_EQUAL_UINT32(
+        1,
+        dirtyFieldDisplay.getNbrOfRedrawnFields(DirtyFieldDisplay::Field::Temperature));
+    TEST_ASSERT_TRUE(dirtyFieldDisplay.getNbrOfSkippedFields() >= 6);
+
+    // the display tasks only hand the frame over to the renderer thread
+    const advembsof::TaskLogger& taskLogger = bikeSystem.getTaskLogger();
+    const std::chrono::microseconds display1Time =
+        taskLogger.getComputationTime(advembsof::TaskLogger::kDisplayTask1Index);
+    const std::chrono::microseconds display2Time =
+        taskLogger.getComputationTime(advembsof::TaskLogger::kDisplayTask2Index);
+    printf("Coasting computation time: display1 %" PRIu64 " us, display2 %" PRIu64
+           " us\n",
+           static_cast<uint64_t>(display1Time.count()),
+           static_cast<uint64_t>(display2Time.count()));
+    static constexpr std::chrono::microseconds kMargin = 10ms;
+    TEST_ASSERT_TRUE(display1Time < kMargin);
+    TEST_ASSERT_TRUE(display2Time < kMargin);
+
+    // the first frame renders gear, speed and distance, each for a third of the 200 ms
+    // budget of the first display task, the last frames render the distance at most
+    const DisplayRenderer& displayRenderer = bikeSystem.getDisplayRenderer();
+    displayRenderer.printStats();
+    TEST_ASSERT_TRUE(displayRenderer.getMaxRenderTime() >= 3 * (200ms / 3));
+    TEST_ASSERT_TRUE(displayRenderer.getLastRenderTime() < 200ms / 3 + kMargin);
+
+    return CaseNext;
+}
+
+static utest::v1::status_t greentea_setup(const size_t number_of_cases) {
+    // Here, we specify the timeout (60s) and the host test (a built-in host test or the
+    // name of our Python file)
+    GREENTEA_SETUP(60, "default_auto");
+
+    return greentea_test_setup_handler(number_of_cases);
+}
+
+// List of test cases in this file
+static Case cases[] = {
+    Case("test redraw on text change", test_redraw_on_text_change),
+    Case("test fields and invalidation", test_fields_and_invalidation),
+    Case("test coasting computation time", test_coasting_computation_time)};
+
+static Specification specification(greentea_setup, cases);
+
+int main() { return !Harness::run(specification); }
@@ -0,0 +1,206 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/****************************************************************************
+ * @file main.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Bike computer test suite: asynchronous display renderer
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include <chrono>
+
+#include "dirty_field_display.hpp"
+#include "display_device.hpp"
+#include "display_device_adapter.hpp"
+#include "display_renderer.hpp"
+#include "greentea-client/test_env.h"
+#include "mbed.h"
+#include "unity/unity.h"
+#include "utest/utest.h"
+
+using namespace utest::v1;
+
+using bike_computer::DirtyFieldDisplay;
+using bike_computer::DisplayDeviceAdapter;
+using bike_computer::DisplayFrame;
+using bike_computer::DisplayRenderer;
+
+// simulated time for drawing a field
+static constexpr std::chrono::milliseconds kFieldRenderingTime = 20ms;
+
+static void setRenderingTimes(DisplayRenderer& displayRenderer) {
+    for (uint8_t index = 0; index < DirtyFieldDisplay::kNbrOfFields; index++) {
+        displayRenderer.setFieldRenderingTime(
+            static_cast<DirtyFieldDisplay::Field>(index), kFieldRenderingTime);
+    }
+}
+
+// test that frames submitted faster than they are rendered are dropped, the newest
+// frame being always rendered and the producer never waiting on the display
+static control_t test_latest_frame_wins(const size_t call_count) {
+    advembsof::DisplayDevice displayDevice;
+    DisplayDeviceAdapter displayDeviceAdapter(displayDevice);
+    DirtyFieldDisplay dirtyFieldDisplay(displayDeviceAdapter);
+    DisplayRenderer displayRenderer(dirtyFieldDisplay);
+    setRenderingTimes(displayRenderer);
+    displayRenderer.start();
+
+    // each frame redraws the gear, the speed and the distance (60 ms)
+    static constexpr uint8_t kNbrOfFrames = 10;
+    Timer timer;
+    timer.start();
+    std::chrono::microseconds maxSubmitTime = 0us;
+    for (uint8_t index = 0; index < kNbrOfFrames; index++) {
+        DisplayFrame frame;
+        frame.gear     = index + 1;
+        frame.speed    = 10.0f + index;
+        frame.distance = 0.1f * index;
+        const std::chrono::microseconds startTime = timer.elapsed_time();
+        displayRenderer.submit(frame);
+        const std::chrono::microseconds submitTime = timer.elapsed_time() - startTime;
+        if (submitTime > maxSubmitTime) {
+            maxSubmitTime = submitTime;
+        }
+    }
+    // the pending frame is rendered before the renderer is stopped
+    displayRenderer.stop();
+    displayRenderer.printStats();
+
+    TEST_ASSERT_TRUE(maxSubmitTime < 5ms);
+    TEST_ASSERT_EQUAL_UINT32(kNbrOfFrames, displayRenderer.getNbrOfSubmittedFrames());
+    TEST_ASSERT_TRUE(displayRenderer.getNbrOfRenderedFrames() <= 2);
+    TEST_ASSERT_EQUAL_UINT32(kNbrOfFrames,
+                             displayRenderer.getNbrOfRenderedFrames() +
+                                 displayRenderer.getNbrOfDroppedFrames());
+
+    // the screen shows the last frame
+    TEST_ASSERT_EQUAL_UINT8(kNbrOfFrames, displayDevice.getDisplayedGear());
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 19.0f, displayDevice.getDisplayedSpeed());
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0.9f, displayDevice.getDisplayedDistance());
+
+    return CaseNext;
+}
+
+// test that frames submitted slower than they are rendered are all rendered
+static control_t test_no_drop_when_idle(const size_t call_count) {
+    advembsof::DisplayDevice displayDevice;
+    DisplayDeviceAdapter displayDeviceAdapter(displayDevice);
+    DirtyFieldDisplay dirtyFieldDisplay(displayDeviceAdapter);
+    DisplayRenderer displayRenderer(dirtyFieldDisplay);
+    displayRenderer.start();
+
+    static constexpr uint8_t kNbrOfFrames = 5;
+    for (uint8_t index = 0; index < kNbrOfFrames; index++) {
+        DisplayFrame frame;
+        frame.speed = 20.0f + index;
+        displayRenderer.submit(frame);
+        ThisThread::sleep_for(20ms);
+    }
+    displayRenderer.stop();
+
+    TEST_ASSERT_EQUAL_UINT32(kNbrOfFrames, displayRenderer.getNbrOfRenderedFrames());
+    TEST_ASSERT_EQUAL_UINT32(0, displayRenderer.getNbrOfDroppedFrames());
+    TEST_ASSERT_EQUAL_UINT32(
+        kNbrOfFrames,
+        dirtyFieldDisplay.getNbrOfRedrawnFields(DirtyFieldDisplay::Field::Speed));
+
+    return CaseNext;
+}
+
+// test that the temperature is rendered only once flagged as valid
+static control_t test_temperature_flag(const size_t call_count) {
+    advembsof::DisplayDevice displayDevice;
+    DisplayDeviceAdapter displayDeviceAdapter(displayDevice);
+    DirtyFieldDisplay dirtyFieldDisplay(displayDeviceAdapter);
+    DisplayRenderer displayRenderer(dirtyFieldDisplay);
+    displayRenderer.start();
+
+    DisplayFrame frame;
+    frame.temperature = 21.5f;
+    displayRenderer.submit(frame);
+    ThisThread::sleep_for(20ms);
+    TEST_ASSERT_EQUAL_UINT32(
+        0,
+        dirtyFieldDisplay.getNbrOfRedrawnFields(DirtyFieldDisplay::Field::Temperature));
+
+    frame.flags |= DisplayFrame::kTemperatureValidFlag;
+    displayRenderer.submit(frame);
+    displayRenderer.stop();
+    TEST_ASSERT_EQUAL_UINT32(
+        1,
+        dirtyFieldDisplay.getNbrOfRedrawnFields(DirtyFieldDisplay::Field::Temperature));
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 21.5f, displayDevice.getDisplayedTemperature());
+
+    return CaseNext;
+}
+
+// test that the render time accounts for the redrawn fields only
+static control_t test_render_time(const size_t call_count) {
+    advembsof::DisplayDevice displayDevice;
+    DisplayDeviceAdapter displayDeviceAdapter(displayDevice);
+    DirtyFieldDisplay dirtyFieldDisplay(displayDeviceAdapter);
+    DisplayRenderer displayRenderer(dirtyFieldDisplay);
+    setRenderingTimes(displayRenderer);
+    displayRenderer.start();
+
+    // the first frame redraws the gear, the speed and the distance
+    DisplayFrame frame;
+    frame.gear  = 2;
+    frame.speed = 30.0f;
+    displayRenderer.submit(frame);
+    ThisThread::sleep_for(100ms);
+    // the second one redraws the speed only, the third one nothing
+    frame.speed = 31.0f;
+    displayRenderer.submit(frame);
+    ThisThread::sleep_for(100ms);
+    displayRenderer.submit(frame);
+    displayRenderer.stop();
+    displayRenderer.printStats();
+
+    static constexpr std::chrono::microseconds kMargin = 10ms;
+    TEST_ASSERT_EQUAL_UINT32(3, displayRenderer.getNbrOfRenderedFrames());
+    TEST_ASSERT_TRUE(displayRenderer.getMaxRenderTime() >= 3 * kFieldRenderingTime);
+    TEST_ASSERT_TRUE(displayRenderer.getMaxRenderTime() <
+                     3 * kFieldRenderingTime + kMargin);
+    TEST_ASSERT_TRUE(displayRenderer.getLastRenderTime() < kMargin);
+    TEST_ASSERT_TRUE(displayRenderer.getAverageRenderTime() >=
+                     (4 * kFieldRenderingTime) / 3);
+    TEST_ASSERT_TRUE(displayRenderer.getAverageRenderTime() <
+                     (4 * kFieldRenderingTime) / 3 + kMargin);
+
+    return CaseNext;
+}
+
+static utest::v1::status_t greentea_setup(const size_t number_of_cases) {
+    // Here, we specify the timeout (60s) and the host test (a built-in host test or the
+    // name of our Python file)
+    GREENTEA_SETUP(60, "default_auto");
+
+    return greentea_test_setup_handler(number_of_cases);
+}
+
+// List of test cases in this file
+static Case cases[] = {Case("test latest frame wins", test_latest_frame_wins),
+                       Case("test no drop when idle", test_no_drop_when_idle),
+                       Case("test temperature flag", test_temperature_flag),
+                       Case("test render time", test_render_time)};
+
+static Specification specification(greentea_setup, cases);
+
+int main() { return !Harness::run(specification); }
@@ -0,0 +1,331 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/****************************************************************************
+ * @file main.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Bike computer test suite: fixed-point number formatting
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include <cinttypes>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+
+#include "fixed_point_format.hpp"
+#include "greentea-client/test_env.h"
+#include "mbed.h"
+#include "unity/unity.h"
+#include "utest/utest.h"
+
+using namespace utest::v1;
+
+using bike_computer::formatFixedPoint;
+using bike_computer::formatFloat;
+using bike_computer::formatInteger;
+using bike_computer::kMaxFormattedSize;
+using bike_computer::kMaxNbrOfDecimals;
+
+// the exhaustive ranges and the sweeps are reduced on the target, so that the suite
+// runs within the timeout
+#if defined(BIKE_COMPUTER_HOST)
+// stride used for sweeping the full int32_t range (prime, so that all digits vary)
+static constexpr int64_t kRangeStride = 65521;
+// values around 0 that are all tested
+static constexpr int32_t kExhaustiveRange = 1000000;
+// number of float bit patterns tested
+static constexpr uint32_t kNbrOfPatterns = 200000;
+#else
+static constexpr int64_t kRangeStride     = 1048573;
+static constexpr int32_t kExhaustiveRange = 20000;
+static constexpr uint32_t kNbrOfPatterns  = 20000;
+#endif  // defined(BIKE_COMPUTER_HOST)
+
+static constexpr int32_t kPowersOfTen[kMaxNbrOfDecimals + 1] = {
+    1, 10, 100, 1000, 10000, 100000, 1000000};
+
+// builds the reference text of magnitude / 10^nbrOfDecimals digit by digit, with
+// integer division and modulo: printf cannot be used since minimal-printf (target)
+// ignores flags, width and precision
+static uint8_t buildReference(char* buffer,
+                              bool isNegative,
+                              uint64_t magnitude,
+                              uint8_t nbrOfDecimals) {
+    // digits in reverse order, with at least one digit before the decimal point
+    char digits[24];
+    uint8_t nbrOfDigits = 0;
+    do {
+        digits[nbrOfDigits++] = static_cast<char>('0' + magnitude % 10);
+        magnitude /= 10;
+    } while (magnitude != 0 || nbrOfDigits <= nbrOfDecimals);
+
+    uint8_t length = 0;
+    if (isNegative) {
+        buffer[length++] = '-';
+    }
+    for (uint8_t index = nbrOfDigits; index > 0; index--) {
+        if (index == nbrOfDecimals) {
+            buffer[length++] = '.';
+        }
+        buffer[length++] = digits[index - 1];
+    }
+    buffer[length] = '\0';
+    return length;
+}
+
+static bool checkInteger(int32_t value) {
+    char expected[kMaxFormattedSize + 1];
+    char text[kMaxFormattedSize];
+    const uint64_t magnitude =
+        (value < 0) ? -static_cast<int64_t>(value) : static_cast<int64_t>(value);
+    const uint8_t expectedLength = buildReference(expected, value < 0, magnitude, 0);
+    const uint8_t length         = formatInteger(text, sizeof(text), value);
+    if (length != expectedLength || strcmp(text, expected) != 0) {
+        printf("Integer %" PRId32 ": \"%s\" instead of \"%s\"\n", value, text, expected);
+        return false;
+    }
+    return true;
+}
+
+static bool checkFixedPoint(int32_t value, uint8_t nbrOfDecimals) {
+    char expected[kMaxFormattedSize + 1];
+    const uint64_t magnitude =
+        (value < 0) ? -static_cast<int64_t>(value) : static_cast<int64_t>(value);
+    const uint8_t expectedLength =
+        buildReference(expected, value < 0, magnitude, nbrOfDecimals);
+    char text[kMaxFormattedSize];
+    const uint8_t length = formatFixedPoint(text, sizeof(text), value, nbrOfDecimals);
+    if (length != expectedLength || strcmp(text, expected) != 0) {
+        printf("Fixed-point %" PRId32 " (%u decimals): \"%s\" instead of \"%s\"\n",
+               value,
+               nbrOfDecimals,
+               text,
+               expected);
+        return false;
+    }
+    return true;
+}
+
+// values are rounded as printf does, except ties that are rounded half away from zero:
+// the scaled magnitude is exact in double (24-bit mantissa times at most 10^6)
+static bool checkFloat(float value, uint8_t nbrOfDecimals) {
+    const double scaled = std::fabs(static_cast<double>(value)) *
+                          kPowersOfTen[nbrOfDecimals];
+    const uint64_t magnitude = static_cast<uint64_t>(std::floor(scaled + 0.5));
+    char expected[kMaxFormattedSize + 1];
+    // as printf, negative values rounding to zero keep their sign
+    const uint8_t expectedLength =
+        buildReference(expected, std::signbit(value), magnitude, nbrOfDecimals);
+    char text[kMaxFormattedSize];
+    const uint8_t length = formatFloat(text, sizeof(text), value, nbrOfDecimals);
+    if (length != expectedLength || strcmp(text, expected) != 0) {
+        uint32_t bits = 0;
+        memcpy(&bits, &value, sizeof(bits));
+        printf("Float 0x%" PRIx32 " (%u decimals): \"%s\" instead of \"%s\"\n",
+               bits,
+               nbrOfDecimals,
+               text,
+               expected);
+        return false;
+    }
+    return true;
+}
+
+// test all integers around 0 and a sweep of the full range
+static control_t test_integer(const size_t call_count) {
+    uint32_t nbrOfErrors = 0;
+    for (int32_t value = -kExhaustiveRange; value <= kExhaustiveRange; value++) {
+        nbrOfErrors += checkInteger(value) ? 0 : 1;
+    }
+    for (int64_t value = std::numeric_limits<int32_t>::min();
+         value <= std::numeric_limits<int32_t>::max();
+         value += kRangeStride) {
+        nbrOfErrors += checkInteger(static_cast<int32_t>(value)) ? 0 : 1;
+    }
+    nbrOfErrors += checkInteger(std::numeric_limits<int32_t>::min()) ? 0 : 1;
+    nbrOfErrors += checkInteger(std::numeric_limits<int32_t>::max()) ? 0 : 1;
+    TEST_ASSERT_EQUAL_UINT32(0, nbrOfErrors);
+
+    return CaseNext;
+}
+
+// test all fixed-point values around 0 and a sweep of the full range, for all
+// numbers of decimals
+static control_t test_fixed_point(const size_t call_count) {
+    uint32_t nbrOfErrors = 0;
+    for (uint8_t nbrOfDecimals = 0; nbrOfDecimals <= kMaxNbrOfDecimals; nbrOfDecimals++) {
+        for (int32_t value = -kExhaustiveRange / 10; value <= kExhaustiveRange / 10;
+             value++) {
+            nbrOfErrors += checkFixedPoint(value, nbrOfDecimals) ? 0 : 1;
+        }
+        for (int64_t value = std::numeric_limits<int32_t>::min();
+             value <= std::numeric_limits<int32_t>::max();
+             value += kRangeStride) {
+            nbrOfErrors += checkFixedPoint(static_cast<int32_t>(value), nbrOfDecimals)
+                               ? 0
+                               : 1;
+        }
+        nbrOfErrors +=
+            checkFixedPoint(std::numeric_limits<int32_t>::min(), nbrOfDecimals) ? 0 : 1;
+        nbrOfErrors +=
+            checkFixedPoint(std::numeric_limits<int32_t>::max(), nbrOfDecimals) ? 0 : 1;
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, nbrOfErrors);
+
+    return CaseNext;
+}
+
+// test all values of the display fields at their resolution (gear, speed, distance
+// and temperature)
+static control_t test_display_ranges(const size_t call_count) {
+    uint32_t nbrOfErrors = 0;
+    for (int32_t gear = 0; gear <= 99; gear++) {
+        nbrOfErrors += checkFloat(static_cast<float>(gear), 0) ? 0 : 1;
+    }
+    for (int32_t speed = 0; speed <= 9999; speed++) {
+        nbrOfErrors += checkFloat(speed / 10.0f, 1) ? 0 : 1;
+    }
+    for (int32_t distance = 0; distance <= 99999; distance++) {
+        nbrOfErrors += checkFloat(distance / 100.0f, 2) ? 0 : 1;
+    }
+    for (int32_t temperature = -400; temperature <= 850; temperature++) {
+        nbrOfErrors += checkFloat(temperature / 10.0f, 1) ? 0 : 1;
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, nbrOfErrors);
+
+    return CaseNext;
+}
+
+// test floats of arbitrary bit patterns, at all numbers of decimals
+static control_t test_float_bit_patterns(const size_t call_count) {
+    uint32_t nbrOfErrors          = 0;
+    uint32_t nbrOfFormattedValues = 0;
+    uint32_t pattern              = 12345;
+    for (uint32_t index = 0; index < kNbrOfPatterns; index++) {
+        // linear congruential generator
+        pattern = pattern * 1664525U + 1013904223U;
+        float value;
+        memcpy(&value, &pattern, sizeof(value));
+        const uint8_t nbrOfDecimals = index % (kMaxNbrOfDecimals + 1);
+        const double scaled =
+            std::fabs(static_cast<double>(value)) * kPowersOfTen[nbrOfDecimals];
+        // the magnitude of INT32_MIN is valid for negative values only
+        const double maxRounded = (value < 0.0f) ? 2147483649.0 : 2147483648.0;
+        if (std::isnan(value) || !(scaled + 0.5 < maxRounded)) {
+            // values that cannot be formatted
+            char text[kMaxFormattedSize] = "x";
+            nbrOfErrors += (formatFloat(text, sizeof(text), value, nbrOfDecimals) == 0 &&
+                            text[0] == '\0')
+                               ? 0
+                               : 1;
+            continue;
+        }
+        nbrOfFormattedValues++;
+        nbrOfErrors += checkFloat(value, nbrOfDecimals) ? 0 : 1;
+    }
+    printf("%" PRIu32 " formatted values out of %" PRIu32 " patterns\n",
+           nbrOfFormattedValues,
+           kNbrOfPatterns);
+    TEST_ASSERT_EQUAL_UINT32(0, nbrOfErrors);
+    TEST_ASSERT_TRUE(nbrOfFormattedValues > 0);
+
+    return CaseNext;
+}
+
+// test rounding of ties, signs and special values
+static control_t test_rounding_and_special_values(const size_t call_count) {
+    char text[kMaxFormattedSize];
+    TEST_ASSERT_EQUAL_UINT8(3, formatFloat(text, sizeof(text), 0.25f, 1));
+    TEST_ASSERT_EQUAL_STRING("0.3", text);
+    TEST_ASSERT_EQUAL_UINT8(4, formatFloat(text, sizeof(text), -0.25f, 1));
+    TEST_ASSERT_EQUAL_STRING("-0.3", text);
+    TEST_ASSERT_EQUAL_UINT8(1, formatFloat(text, sizeof(text), 2.5f, 0));
+    TEST_ASSERT_EQUAL_STRING("3", text);
+    TEST_ASSERT_EQUAL_UINT8(4, formatFloat(text, sizeof(text), 9.96f, 1));
+    TEST_ASSERT_EQUAL_STRING("10.0", text);
+    // as printf, negative values rounding to zero keep their sign
+    TEST_ASSERT_EQUAL_UINT8(4, formatFloat(text, sizeof(text), -0.04f, 1));
+    TEST_ASSERT_EQUAL_STRING("-0.0", text);
+
+    TEST_ASSERT_EQUAL_UINT8(
+        0, formatFloat(text, sizeof(text), std::numeric_limits<float>::infinity(), 1));
+    TEST_ASSERT_EQUAL_STRING("", text);
+    TEST_ASSERT_EQUAL_UINT8(
+        0, formatFloat(text, sizeof(text), std::numeric_limits<float>::quiet_NaN(), 1));
+    TEST_ASSERT_EQUAL_UINT8(0, formatFloat(text, sizeof(text), 1e10f, 0));
+    TEST_ASSERT_EQUAL_UINT8(0, formatFloat(text, sizeof(text), 3000.0f, 6));
+    TEST_ASSERT_EQUAL_UINT8(
+        0, formatFloat(text, sizeof(text), 1.0f, kMaxNbrOfDecimals + 1));
+    TEST_ASSERT_EQUAL_UINT8(
+        0, formatFixedPoint(text, sizeof(text), 1, kMaxNbrOfDecimals + 1));
+
+    return CaseNext;
+}
+
+// test that the buffer is never overrun
+static control_t test_buffer_size(const size_t call_count) {
+    char text[kMaxFormattedSize + 1];
+    memset(text, 'x', sizeof(text));
+
+    // "-12.345" needs 8 characters
+    TEST_ASSERT_EQUAL_UINT8(0, formatFixedPoint(text, 7, -12345, 3));
+    TEST_ASSERT_EQUAL_STRING("", text);
+    TEST_ASSERT_EQUAL_UINT8('x', text[1]);
+    TEST_ASSERT_EQUAL_UINT8(7, formatFixedPoint(text, 8, -12345, 3));
+    TEST_ASSERT_EQUAL_STRING("-12.345", text);
+    TEST_ASSERT_EQUAL_UINT8('x', text[8]);
+
+    // an empty buffer is left untouched
+    TEST_ASSERT_EQUAL_UINT8(0, formatInteger(text, 0, 1));
+    TEST_ASSERT_EQUAL_UINT8('-', text[0]);
+
+    // the longest texts fit in kMaxFormattedSize characters
+    TEST_ASSERT_EQUAL_UINT8(
+        kMaxFormattedSize - 1,
+        formatFixedPoint(
+            text, kMaxFormattedSize, std::numeric_limits<int32_t>::min(), 1));
+    TEST_ASSERT_EQUAL_STRING("-214748364.8", text);
+    TEST_ASSERT_EQUAL_UINT8(
+        11, formatInteger(text, kMaxFormattedSize, std::numeric_limits<int32_t>::min()));
+    TEST_ASSERT_EQUAL_STRING("-2147483648", text);
+
+    return CaseNext;
+}
+
+static utest::v1::status_t greentea_setup(const size_t number_of_cases) {
+    // Here, we specify the timeout (60s) and the host test (a built-in host test or the
+    // name of our Python file)
+    GREENTEA_SETUP(60, "default_auto");
+
+    return greentea_test_setup_handler(number_of_cases);
+}
+
+// List of test cases in this file
+static Case cases[] = {
+    Case("test integer", test_integer),
+    Case("test fixed point", test_fixed_point),
+    Case("test display ranges", test_display_ranges),
+    Case("test float bit patterns", test_float_bit_patterns),
+    Case("test rounding and special values", test_rounding_and_special_values),
+    Case("test buffer size", test_buffer_size)};
+
+static Specification specification(greentea_setup, cases);
+
+int main() { return !Harness::run(specification); }
@@ -0,0 +1,212 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/****************************************************************************
+ * @file main.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Bike computer test suite: off-screen frame buffer
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include <chrono>
+
+#include "frame_buffer.hpp"
+#include "greentea-client/test_env.h"
+#include "mbed.h"
+#include "memory_display_backend.hpp"
+#include "unity/unity.h"
+#include "utest/utest.h"
+
+using namespace utest::v1;
+
+using bike_computer::FrameBuffer;
+using bike_computer::MemoryDisplayBackend;
+using bike_computer::Rectangle;
+
+static constexpr uint16_t kWidth      = 120;
+static constexpr uint16_t kHeight     = 80;
+static constexpr uint16_t kBlack      = 0x0000;
+static constexpr uint16_t kWhite      = 0xFFFF;
+static constexpr uint16_t kBackground = 0x001F;
+
+static uint16_t gPixels[kWidth * kHeight];
+static uint16_t gScreen[kWidth * kHeight];
+
+static Rectangle makeRectangle(uint16_t x, uint16_t y, uint16_t width, uint16_t height) {
+    Rectangle rectangle;
+    rectangle.x      = x;
+    rectangle.y      = y;
+    rectangle.width  = width;
+    rectangle.height = height;
+    return rectangle;
+}
+
+// test the union and the adjacency of rectangles
+static control_t test_rectangles(const size_t call_count) {
+    const Rectangle first  = makeRectangle(10, 10, 20, 10);
+    const Rectangle second = makeRectangle(30, 15, 10, 10);
+    const Rectangle far    = makeRectangle(60, 60, 5, 5);
+
+    TEST_ASSERT_TRUE(first.isAdjacent(second));
+    TEST_ASSERT_FALSE(first.isAdjacent(far));
+    const Rectangle united = first.unite(second);
+    TEST_ASSERT_EQUAL_INT(10, united.x);
+    TEST_ASSERT_EQUAL_INT(10, united.y);
+    TEST_ASSERT_EQUAL_INT(30, united.width);
+    TEST_ASSERT_EQUAL_INT(15, united.height);
+    TEST_ASSERT_EQUAL_UINT32(450, united.getArea());
+    TEST_ASSERT_TRUE(Rectangle().isEmpty());
+    TEST_ASSERT_EQUAL_UINT32(far.getArea(), Rectangle().unite(far).getArea());
+
+    return CaseNext;
+}
+
+// test that the display only changes upon flush and receives the dirty regions only
+static control_t test_flush_dirty_regions(const size_t call_count) {
+    MemoryDisplayBackend backend(gScreen, kWidth, kHeight);
+    FrameBuffer frameBuffer(gPixels, kWidth, kHeight, backend);
+
+    // the first frame is fully flushed
+    frameBuffer.fillRectangle(makeRectangle(0, 0, kWidth, kHeight), kBackground);
+    TEST_ASSERT_EQUAL_UINT32(kWidth * kHeight, frameBuffer.flush());
+    TEST_ASSERT_EQUAL_UINT16(kBackground, backend.getPixel(kWidth - 1, kHeight - 1));
+
+    // the drawing of a frame is not visible before the flush (no partial frame)
+    frameBuffer.fillRectangle(makeRectangle(10, 10, 20, 10), kWhite);
+    frameBuffer.fillRectangle(makeRectangle(80, 50, 10, 10), kBlack);
+    TEST_ASSERT_EQUAL_UINT16(kBackground, backend.getPixel(15, 15));
+    TEST_ASSERT_EQUAL_UINT8(2, frameBuffer.getNbrOfDirtyRectangles());
+    TEST_ASSERT_EQUAL_UINT32(300, frameBuffer.flush());
+    TEST_ASSERT_EQUAL_UINT16(kWhite, backend.getPixel(15, 15));
+    TEST_ASSERT_EQUAL_UINT16(kBlack, backend.getPixel(85, 55));
+    TEST_ASSERT_EQUAL_UINT16(kBackground, backend.getPixel(50, 50));
+    TEST_ASSERT_EQUAL_UINT32(300, backend.getNbrOfPixelsInLastFrame());
+    TEST_ASSERT_EQUAL_UINT32(3, backend.getNbrOfRectangles());
+
+    // nothing is sent when nothing was drawn
+    TEST_ASSERT_EQUAL_UINT32(0, frameBuffer.flush());
+    TEST_ASSERT_EQUAL_UINT32(2, backend.getNbrOfFrames());
+    TEST_ASSERT_EQUAL_UINT32(2, frameBuffer.getNbrOfFlushes());
+
+    // drawing is clipped to the frame buffer
+    frameBuffer.fillRectangle(makeRectangle(kWidth - 5, kHeight - 5, 20, 20), kWhite);
+    TEST_ASSERT_EQUAL_UINT32(25, frameBuffer.flush());
+
+    return CaseNext;
+}
+
+// test the merging of the dirty rectangles
+static control_t test_dirty_rectangle_merging(const size_t call_count) {
+    MemoryDisplayBackend backend(gScreen, kWidth, kHeight);
+    FrameBuffer frameBuffer(gPixels, kWidth, kHeight, backend);
+
+    // overlapping rectangles are merged into their union
+    frameBuffer.fillRectangle(makeRectangle(10, 10, 20, 10), kWhite);
+    frameBuffer.fillRectangle(makeRectangle(25, 15, 10, 10), kWhite);
+    TEST_ASSERT_EQUAL_UINT8(1, frameBuffer.getNbrOfDirtyRectangles());
+    TEST_ASSERT_EQUAL_UINT32(25 * 15, frameBuffer.getDirtyRectangle(0).getArea());
+    frameBuffer.flush();
+
+    // distant rectangles are kept apart while slots are available
+    for (uint8_t index = 0; index < FrameBuffer::kMaxNbrOfDirtyRectangles; index++) {
+        frameBuffer.fillRectangle(makeRectangle(index * 30, 0, 10, 10), kWhite);
+    }
+    TEST_ASSERT_EQUAL_UINT8(FrameBuffer::kMaxNbrOfDirtyRectangles,
+                            frameBuffer.getNbrOfDirtyRectangles());
+
+    // then a new rectangle is merged with the one whose union grows the least
+    frameBuffer.fillRectangle(makeRectangle(95, 20, 10, 10), kWhite);
+    TEST_ASSERT_EQUAL_UINT8(FrameBuffer::kMaxNbrOfDirtyRectangles,
+                            frameBuffer.getNbrOfDirtyRectangles());
+    TEST_ASSERT_EQUAL_UINT32(3 * 100 + 15 * 30, frameBuffer.flush());
+
+    return CaseNext;
+}
+
+// test the drawing of a 1 bit per pixel bitmap
+static control_t test_bitmap(const size_t call_count) {
+    MemoryDisplayBackend backend(gScreen, kWidth, kHeight);
+    FrameBuffer frameBuffer(gPixels, kWidth, kHeight, backend);
+
+    // 10 x 2 bitmap: rows of 2 bytes
+    static constexpr uint8_t kBitmap[] = {0b10000000, 0b01000000, 0b00000001, 0b10000000};
+    frameBuffer.drawBitmap(5, 5, kBitmap, 10, 2, kWhite, kBlack);
+    TEST_ASSERT_EQUAL_UINT32(20, frameBuffer.flush());
+    TEST_ASSERT_EQUAL_UINT16(kWhite, backend.getPixel(5, 5));
+    TEST_ASSERT_EQUAL_UINT16(kBlack, backend.getPixel(6, 5));
+    TEST_ASSERT_EQUAL_UINT16(kWhite, backend.getPixel(14, 5));
+    TEST_ASSERT_EQUAL_UINT16(kWhite, backend.getPixel(12, 6));
+    TEST_ASSERT_EQUAL_UINT16(kWhite, backend.getPixel(13, 6));
+    TEST_ASSERT_EQUAL_UINT16(kBlack, backend.getPixel(14, 6));
+
+    return CaseNext;
+}
+
+// test the traffic of a dashboard refresh: only the updated fields are flushed
+static control_t test_refresh_traffic(const size_t call_count) {
+    MemoryDisplayBackend backend(gScreen, kWidth, kHeight);
+    FrameBuffer frameBuffer(gPixels, kWidth, kHeight, backend);
+    frameBuffer.fillRectangle(makeRectangle(0, 0, kWidth, kHeight), kBackground);
+    frameBuffer.flush();
+
+    // gear, speed, distance and temperature fields of 40 x 16 pixels
+    static constexpr uint8_t kNbrOfFields    = 4;
+    static constexpr uint8_t kNbrOfRefreshes = 10;
+    static constexpr uint16_t kFieldWidth    = 40;
+    static constexpr uint16_t kFieldHeight   = 16;
+    for (uint8_t refresh = 0; refresh < kNbrOfRefreshes; refresh++) {
+        for (uint8_t field = 0; field < kNbrOfFields; field++) {
+            const uint16_t x = (field % 2) * 60 + 10;
+            const uint16_t y = (field / 2) * 40 + 10;
+            frameBuffer.fillRectangle(makeRectangle(x, y, kFieldWidth, kFieldHeight),
+                                      refresh);
+        }
+        TEST_ASSERT_EQUAL_UINT32(kNbrOfFields * kFieldWidth * kFieldHeight,
+                                 frameBuffer.flush());
+    }
+    frameBuffer.printStats();
+    TEST_ASSERT_EQUAL_UINT32(
+        kWidth * kHeight + kNbrOfRefreshes * kNbrOfFields * kFieldWidth * kFieldHeight,
+        backend.getNbrOfPixels());
+
+    // the whole screen is flushed after an invalidation
+    frameBuffer.invalidate();
+    TEST_ASSERT_EQUAL_UINT32(kWidth * kHeight, frameBuffer.flush());
+
+    return CaseNext;
+}
+
+static utest::v1::status_t greentea_setup(const size_t number_of_cases) {
+    // Here, we specify the timeout (60s) and the host test (a built-in host test or the
+    // name of our Python file)
+    GREENTEA_SETUP(60, "default_auto");
+
+    return greentea_test_setup_handler(number_of_cases);
+}
+
+// List of test cases in this file
+static Case cases[] = {
+    Case("test rectangles", test_rectangles),
+    Case("test flush of the dirty regions", test_flush_dirty_regions),
+    Case("test dirty rectangle merging", test_dirty_rectangle_merging),
+    Case("test bitmap", test_bitmap),
+    Case("test refresh traffic", test_refresh_traffic)};
+
+static Specification specification(greentea_setup, cases);
+
+int main() { return !Harness::run(specification); }
@@ -0,0 +1,196 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/****************************************************************************
+ * @file main.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Bike computer test suite: glyph atlas of the numeric fields
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include <chrono>
+
+#include "dirty_field_display.hpp"
+#include "display_renderer.hpp"
+#include "frame_buffer.hpp"
+#include "frame_buffer_display_device.hpp"
+#include "glyph_atlas.hpp"
+#include "greentea-client/test_env.h"
+#include "lcd_display_backend.hpp"
+#include "mbed.h"
+#include "memory_display_backend.hpp"
+#include "stm32h747i_discovery_lcd.h"
+#include "unity/unity.h"
+#include "utest/utest.h"
+
+using namespace utest::v1;
+
+using bike_computer::BaseFont;
+using bike_computer::DirtyFieldDisplay;
+using bike_computer::DisplayFrame;
+using bike_computer::DisplayRenderer;
+using bike_computer::FrameBuffer;
+using bike_computer::FrameBufferDisplayDevice;
+using bike_computer::kLargeGlyphAtlas;
+using bike_computer::kSmallGlyphAtlas;
+using bike_computer::LargeGlyphAtlas;
+using bike_computer::LcdDisplayBackend;
+using bike_computer::MemoryDisplayBackend;
+using bike_computer::SmallGlyphAtlas;
+
+static constexpr uint16_t kWidth      = 160;
+static constexpr uint16_t kHeight     = 64;
+static constexpr uint16_t kForeground = 0xFFFF;
+static constexpr uint16_t kBackground = 0x0000;
+
+static uint16_t gPixels[kWidth * kHeight];
+static uint16_t gScreen[kWidth * kHeight];
+static uint16_t gDisplayPixels[FrameBufferDisplayDevice::kWidth *
+                               FrameBufferDisplayDevice::kHeight];
+
+// pixel of the base font scaled at runtime (reference)
+static bool isBaseFontPixelSet(char character, uint8_t scale, uint16_t x, uint16_t y) {
+    if (x >= BaseFont::kWidth * scale) {
+        return false;
+    }
+    const uint8_t row = BaseFont::kRows[BaseFont::getGlyphIndex(character)][y / scale];
+    return (row & (0x10 >> (x / scale))) != 0;
+}
+
+template <typename Atlas>
+static void checkAtlas(const Atlas& atlas, uint8_t scale) {
+    for (uint8_t index = 0; index < BaseFont::kNbrOfGlyphs; index++) {
+        const char character = BaseFont::kCharacters[index];
+        for (uint16_t y = 0; y < Atlas::kGlyphHeight; y++) {
+            for (uint16_t x = 0; x < Atlas::kGlyphWidth; x++) {
+                TEST_ASSERT_TRUE(atlas.isPixelSet(character, x, y) ==
+                                 isBaseFontPixelSet(character, scale, x, y));
+            }
+        }
+    }
+}
+
+// test that the atlases hold the scaled glyphs of the base font
+static control_t test_rasterized_glyphs(const size_t call_count) {
+    TEST_ASSERT_EQUAL_INT(12, SmallGlyphAtlas::kGlyphWidth);
+    TEST_ASSERT_EQUAL_INT(14, SmallGlyphAtlas::kGlyphHeight);
+    TEST_ASSERT_EQUAL_INT(24, LargeGlyphAtlas::kGlyphWidth);
+    TEST_ASSERT_EQUAL_INT(28, LargeGlyphAtlas::kGlyphHeight);
+    checkAtlas(kSmallGlyphAtlas, 2);
+    checkAtlas(kLargeGlyphAtlas, 4);
+
+    // characters that are not in the font are rendered as spaces
+    TEST_ASSERT_TRUE(kSmallGlyphAtlas.getGlyph('x') == kSmallGlyphAtlas.getGlyph(' '));
+
+    return CaseNext;
+}
+
+// test the rendering of a numeric field into the frame buffer
+static control_t test_draw_text(const size_t call_count) {
+    MemoryDisplayBackend backend(gScreen, kWidth, kHeight);
+    FrameBuffer frameBuffer(gPixels, kWidth, kHeight, backend);
+
+    static constexpr uint16_t kX = 4;
+    static constexpr uint16_t kY = 8;
+    const char* text             = "25.3km/h";
+    const uint16_t width =
+        kSmallGlyphAtlas.drawText(frameBuffer, kX, kY, text, kForeground, kBackground);
+    TEST_ASSERT_EQUAL_INT(SmallGlyphAtlas::getTextWidth(text), width);
+    TEST_ASSERT_EQUAL_INT(8 * SmallGlyphAtlas::kGlyphWidth, width);
+
+    // the text box is the only dirty region
+    TEST_ASSERT_EQUAL_UINT8(1, frameBuffer.getNbrOfDirtyRectangles());
+    TEST_ASSERT_EQUAL_UINT32(width * SmallGlyphAtlas::kGlyphHeight, frameBuffer.flush());
+
+    for (uint8_t index = 0; text[index] != '\0'; index++) {
+        for (uint16_t y = 0; y < SmallGlyphAtlas::kGlyphHeight; y++) {
+            for (uint16_t x = 0; x < SmallGlyphAtlas::kGlyphWidth; x++) {
+                const uint16_t expectedColor =
+                    isBaseFontPixelSet(text[index], 2, x, y) ? kForeground : kBackground;
+                TEST_ASSERT_EQUAL_UINT16(
+                    expectedColor,
+                    backend.getPixel(kX + index * SmallGlyphAtlas::kGlyphWidth + x,
+                                     kY + y));
+            }
+        }
+    }
+
+    return CaseNext;
+}
+
+// test that the speed field rendered by the display renderer, as in the bike system,
+// is drawn with the glyphs of the large atlas on the LCD
+static control_t test_rendered_field(const size_t call_count) {
+    LcdDisplayBackend lcdDisplayBackend(FrameBufferDisplayDevice::kWidth,
+                                        FrameBufferDisplayDevice::kHeight);
+    FrameBufferDisplayDevice displayDevice(gDisplayPixels, lcdDisplayBackend);
+    TEST_ASSERT_TRUE(displayDevice.init() == disco::ReturnCode::Ok);
+    DirtyFieldDisplay dirtyFieldDisplay(displayDevice);
+    DisplayRenderer displayRenderer(dirtyFieldDisplay);
+    displayRenderer.start();
+
+    DisplayFrame frame;
+    frame.gear  = 3;
+    frame.speed = 25.3f;
+    displayRenderer.submit(frame);
+    // the pending frame is rendered before the renderer is stopped
+    displayRenderer.stop();
+    TEST_ASSERT_EQUAL_UINT32(1, displayRenderer.getNbrOfRenderedFrames());
+
+    // position of the speed field on the LCD
+    const uint16_t fieldX = lcdDisplayBackend.getXPosition() + 16;
+    const uint16_t fieldY = lcdDisplayBackend.getYPosition() + 64;
+    const uint32_t foregroundColor =
+        lcdDisplayBackend.toLcdColor(FrameBufferDisplayDevice::kForegroundColor);
+    const uint32_t backgroundColor =
+        lcdDisplayBackend.toLcdColor(FrameBufferDisplayDevice::kBackgroundColor);
+    const char* text = "25.3";
+    for (uint8_t index = 0; text[index] != '\0'; index++) {
+        for (uint16_t y = 0; y < LargeGlyphAtlas::kGlyphHeight; y++) {
+            for (uint16_t x = 0; x < LargeGlyphAtlas::kGlyphWidth; x++) {
+                const bool isSet = kLargeGlyphAtlas.isPixelSet(text[index], x, y);
+                const uint32_t expectedColor = isSet ? foregroundColor : backgroundColor;
+                uint32_t color = 0;
+                BSP_LCD_ReadPixel(LcdDisplayBackend::kLcdInstance,
+                                  fieldX + index * LargeGlyphAtlas::kGlyphWidth + x,
+                                  fieldY + y,
+                                  &color);
+                TEST_ASSERT_EQUAL_UINT32(expectedColor, color);
+            }
+        }
+    }
+
+    return CaseNext;
+}
+
+static utest::v1::status_t greentea_setup(const size_t number_of_cases) {
+    // Here, we specify the timeout (60s) and the host test (a built-in host test or the
+    // name of our Python file)
+    GREENTEA_SETUP(60, "default_auto");
+
+    return greentea_test_setup_handler(number_of_cases);
+}
+
+// List of test cases in this file
+static Case cases[] = {Case("test rasterized glyphs", test_rasterized_glyphs),
+                       Case("test draw text", test_draw_text),
+                       Case("test rendered field", test_rendered_field)};
+
+static Specification specification(greentea_setup, cases);
+
+int main() { return !Harness::run(specification); }
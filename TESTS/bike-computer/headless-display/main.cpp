@@ -0,0 +1,301 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/****************************************************************************
+ * @file main.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Bike computer test suite: headless display rendering
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+
+#include "dirty_field_display.hpp"
+#include "display_renderer.hpp"
+#include "greentea-client/test_env.h"
+#include "headless_display_device.hpp"
+#include "mbed.h"
+#include "unity/unity.h"
+#include "utest/utest.h"
+
+using namespace utest::v1;
+
+using bike_computer::DirtyFieldDisplay;
+using bike_computer::DisplayFrame;
+using bike_computer::DisplayRenderer;
+using bike_computer::HeadlessDisplayDevice;
+
+static constexpr uint16_t kWidth       = HeadlessDisplayDevice::kWidth;
+static constexpr uint16_t kHeight      = HeadlessDisplayDevice::kHeight;
+static constexpr uint32_t kNbrOfPixels = kWidth * kHeight;
+static uint16_t gPixels[kNbrOfPixels];
+static uint16_t gScreen[kNbrOfPixels];
+
+// sizes of the fields (large glyphs are 24 x 28 pixels, small ones 12 x 14)
+static constexpr uint32_t kGearFieldArea        = 2 * 24 * 28;
+static constexpr uint32_t kSpeedFieldArea       = 5 * 24 * 28;
+static constexpr uint32_t kDistanceFieldArea    = 8 * 12 * 14;
+static constexpr uint32_t kTemperatureFieldArea = 5 * 12 * 14;
+
+// FNV-1a hash of the golden image of the layout (gear 3, 25.3 km/h, 12.34 km, 21.5 C)
+static constexpr uint32_t kGoldenLayoutHash = 0x3874864D;
+
+static uint32_t hashScreen(const HeadlessDisplayDevice& displayDevice) {
+    uint32_t hash = 2166136261U;
+    for (uint16_t y = 0; y < kHeight; y++) {
+        for (uint16_t x = 0; x < kWidth; x++) {
+            const uint16_t pixel = displayDevice.getPixel(x, y);
+            hash                 = (hash ^ (pixel & 0xFF)) * 16777619U;
+            hash                 = (hash ^ (pixel >> 8)) * 16777619U;
+        }
+    }
+    return hash;
+}
+
+static uint32_t countPixels(const HeadlessDisplayDevice& displayDevice,
+                            uint16_t color,
+                            uint16_t x,
+                            uint16_t y,
+                            uint16_t width,
+                            uint16_t height) {
+    uint32_t nbrOfPixels = 0;
+    for (uint16_t row = y; row < y + height; row++) {
+        for (uint16_t column = x; column < x + width; column++) {
+            nbrOfPixels += (displayDevice.getPixel(column, row) == color) ? 1 : 0;
+        }
+    }
+    return nbrOfPixels;
+}
+
+static void renderLayout(
+    HeadlessDisplayDevice& displayDevice) {  // NOLINT(runtime/references)
+    displayDevice.init();
+    displayDevice.displayGear(3);
+    displayDevice.displaySpeed(25.3f);
+    displayDevice.displayDistance(12.34f);
+    displayDevice.displayTemperature(21.5f);
+    displayDevice.endFrame();
+}
+
+// test that the rendered layout matches the golden image pixel by pixel
+static control_t test_golden_layout(const size_t call_count) {
+    HeadlessDisplayDevice displayDevice(gPixels, gScreen);
+    renderLayout(displayDevice);
+
+    const uint32_t hash = hashScreen(displayDevice);
+    if (hash != kGoldenLayoutHash) {
+        // the image is dumped for inspection
+        static constexpr const char* kPath = "headless_display_layout.ppm";
+        printf("Layout hash 0x%08" PRIx32 ", image %s%s\n",
+               hash,
+               kPath,
+               displayDevice.dumpPpm(kPath) ? "" : " not written");
+    }
+    TEST_ASSERT_EQUAL_UINT32(kGoldenLayoutHash, hash);
+
+    // values and units are drawn in their fields, nothing below the last field
+    TEST_ASSERT_TRUE(countPixels(displayDevice,
+                                 HeadlessDisplayDevice::kForegroundColor,
+                                 16,
+                                 64,
+                                 5 * 24,
+                                 28) > 0);
+    TEST_ASSERT_TRUE(countPixels(displayDevice,
+                                 HeadlessDisplayDevice::kLabelColor,
+                                 16 + 5 * 24,
+                                 78,
+                                 4 * 12,
+                                 14) > 0);
+    TEST_ASSERT_EQUAL_UINT32(kWidth * 72,
+                             countPixels(displayDevice,
+                                         HeadlessDisplayDevice::kBackgroundColor,
+                                         0,
+                                         kHeight - 72,
+                                         kWidth,
+                                         72));
+
+    return CaseNext;
+}
+
+// test that the layout rendered from a frame model by the display renderer, as in the
+// bike system, matches the golden image
+static control_t test_rendered_golden_layout(const size_t call_count) {
+    HeadlessDisplayDevice displayDevice(gPixels, gScreen);
+    displayDevice.init();
+    DirtyFieldDisplay dirtyFieldDisplay(displayDevice);
+    DisplayRenderer displayRenderer(dirtyFieldDisplay);
+    displayRenderer.start();
+
+    DisplayFrame frame;
+    frame.gear        = 3;
+    frame.speed       = 25.3f;
+    frame.distance    = 12.34f;
+    frame.temperature = 21.5f;
+    frame.flags       = DisplayFrame::kTemperatureValidFlag;
+    displayRenderer.submit(frame);
+    ThisThread::sleep_for(50ms);
+    // the same frame again: no field is redrawn
+    displayRenderer.submit(frame);
+    // the pending frame is rendered before the renderer is stopped
+    displayRenderer.stop();
+
+    TEST_ASSERT_EQUAL_UINT32(2, displayRenderer.getNbrOfRenderedFrames());
+    TEST_ASSERT_EQUAL_UINT32(2, displayDevice.getNbrOfFrames());
+    TEST_ASSERT_EQUAL_UINT32(kGoldenLayoutHash, hashScreen(displayDevice));
+    TEST_ASSERT_EQUAL_UINT32(0, displayDevice.getLastFrameStats().nbrOfDrawCalls);
+    TEST_ASSERT_EQUAL_UINT32(0, displayDevice.getLastFrameStats().nbrOfFlushedPixels);
+
+    return CaseNext;
+}
+
+// test that a shorter text clears the rest of its field
+static control_t test_field_clearing(const size_t call_count) {
+    HeadlessDisplayDevice displayDevice(gPixels, gScreen);
+    displayDevice.init();
+    displayDevice.displaySpeed(25.3f);
+    displayDevice.endFrame();
+    // "9.8" is one character shorter than "25.3"
+    displayDevice.displaySpeed(9.8f);
+    displayDevice.endFrame();
+    const uint32_t hash = hashScreen(displayDevice);
+
+    // the screen is the same as when drawing "9.8" only
+    HeadlessDisplayDevice otherDisplayDevice(gPixels, gScreen);
+    otherDisplayDevice.init();
+    otherDisplayDevice.displaySpeed(9.8f);
+    otherDisplayDevice.endFrame();
+    TEST_ASSERT_EQUAL_UINT32(hash, hashScreen(otherDisplayDevice));
+
+    return CaseNext;
+}
+
+// test the draw calls, touched and flushed pixels of the frames
+static control_t test_frame_stats(const size_t call_count) {
+    HeadlessDisplayDevice displayDevice(gPixels, gScreen);
+    displayDevice.init();
+
+    // the first frame draws the background and the units, and flushes the screen
+    displayDevice.endFrame();
+    HeadlessDisplayDevice::FrameStats frameStats = displayDevice.getLastFrameStats();
+    TEST_ASSERT_EQUAL_UINT32(4, frameStats.nbrOfDrawCalls);
+    TEST_ASSERT_EQUAL_UINT32(kNbrOfPixels, frameStats.nbrOfFlushedPixels);
+
+    // a speed update touches and flushes the speed field only
+    displayDevice.displaySpeed(30.1f);
+    displayDevice.endFrame();
+    frameStats = displayDevice.getLastFrameStats();
+    TEST_ASSERT_EQUAL_UINT32(1, frameStats.nbrOfDrawCalls);
+    TEST_ASSERT_EQUAL_UINT32(kSpeedFieldArea, frameStats.nbrOfTouchedPixels);
+    TEST_ASSERT_EQUAL_UINT32(kSpeedFieldArea, frameStats.nbrOfFlushedPixels);
+
+    // all fields
+    displayDevice.displayGear(4);
+    displayDevice.displaySpeed(30.2f);
+    displayDevice.displayDistance(1.5f);
+    displayDevice.displayTemperature(-2.0f);
+    displayDevice.endFrame();
+    frameStats = displayDevice.getLastFrameStats();
+    TEST_ASSERT_EQUAL_UINT32(4, frameStats.nbrOfDrawCalls);
+    TEST_ASSERT_EQUAL_UINT32(
+        kGearFieldArea + kSpeedFieldArea + kDistanceFieldArea + kTemperatureFieldArea,
+        frameStats.nbrOfTouchedPixels);
+    TEST_ASSERT_TRUE(frameStats.nbrOfFlushedPixels >= frameStats.nbrOfTouchedPixels);
+
+    // an empty frame
+    displayDevice.endFrame();
+    frameStats = displayDevice.getLastFrameStats();
+    TEST_ASSERT_EQUAL_UINT32(0, frameStats.nbrOfDrawCalls);
+    TEST_ASSERT_EQUAL_UINT32(0, frameStats.nbrOfFlushedPixels);
+
+    TEST_ASSERT_EQUAL_UINT32(4, displayDevice.getNbrOfFrames());
+    TEST_ASSERT_TRUE(displayDevice.getMaxFrameTime() >=
+                     displayDevice.getAverageFrameTime());
+    displayDevice.printStats();
+
+    return CaseNext;
+}
+
+// part of a PPM image kept while it is written: header, size and one pixel
+struct PpmCapture {
+    char header[32]    = {0};
+    size_t size        = 0;
+    size_t pixelOffset = 0;
+    uint8_t pixel[3]   = {0};
+};
+
+static void capturePpm(PpmCapture* capture, const uint8_t* data, size_t size) {
+    if (capture->size == 0) {
+        memcpy(capture->header, data, (size < 31) ? size : 31);
+    }
+    for (size_t index = 0; index < size; index++) {
+        const size_t offset = capture->size + index;
+        if (offset >= capture->pixelOffset && offset < capture->pixelOffset + 3) {
+            capture->pixel[offset - capture->pixelOffset] = data[index];
+        }
+    }
+    capture->size += size;
+}
+
+// test the PPM image of the screen
+static control_t test_ppm_image(const size_t call_count) {
+    HeadlessDisplayDevice displayDevice(gPixels, gScreen);
+    renderLayout(displayDevice);
+
+    // first pixel of the speed unit
+    uint16_t x = 16 + 5 * 24;
+    uint16_t y = 78;
+    while (displayDevice.getPixel(x, y) != HeadlessDisplayDevice::kLabelColor) {
+        x++;
+    }
+
+    static constexpr const char* kHeader = "P6\n320 240\n255\n";
+    PpmCapture capture;
+    capture.pixelOffset = strlen(kHeader) + (static_cast<size_t>(y) * kWidth + x) * 3;
+    displayDevice.writePpm(callback(capturePpm, &capture));
+
+    TEST_ASSERT_EQUAL_STRING(kHeader, capture.header);
+    TEST_ASSERT_EQUAL_UINT32(strlen(kHeader) + kNbrOfPixels * 3, capture.size);
+    // 0x7BEF expanded to 24 bits
+    TEST_ASSERT_EQUAL_UINT8(123, capture.pixel[0]);
+    TEST_ASSERT_EQUAL_UINT8(125, capture.pixel[1]);
+    TEST_ASSERT_EQUAL_UINT8(123, capture.pixel[2]);
+
+    return CaseNext;
+}
+
+static utest::v1::status_t greentea_setup(const size_t number_of_cases) {
+    // Here, we specify the timeout (60s) and the host test (a built-in host test or the
+    // name of our Python file)
+    GREENTEA_SETUP(60, "default_auto");
+
+    return greentea_test_setup_handler(number_of_cases);
+}
+
+// List of test cases in this file
+static Case cases[] = {
+    Case("test golden layout", test_golden_layout),
+    Case("test rendered golden layout", test_rendered_golden_layout),
+    Case("test field clearing", test_field_clearing),
+    Case("test frame stats", test_frame_stats),
+    Case("test ppm image", test_ppm_image)};
+
+static Specification specification(greentea_setup, cases);
+
+int main() { return !Harness::run(specification); }
@@ -0,0 +1,247 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/****************************************************************************
+ * @file main.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Bike computer test suite: heap fragmentation analyzer
+ *
+ * @date 2026-10-19
+ * @version 0.1.0
+ ***************************************************************************/
+
+#include <cstdlib>
+
+#include "greentea-client/test_env.h"
+#include "heap_analyzer.hpp"
+#include "mbed.h"
+#include "unity/unity.h"
+#include "utest/utest.h"
+
+#if defined(BIKE_COMPUTER_HOST)
+#include "mbed_port/simulated_heap.hpp"
+#endif  // defined(BIKE_COMPUTER_HOST)
+
+using namespace utest::v1;
+
+using bike_computer::HeapAnalyzer;
+
+static constexpr uint8_t kNbrOfBlocks  = 8;
+static constexpr uint16_t kMarginSpace = 1024;
+
+// the analyzer walks the heap of the simulated target on the host
+static void* allocateBlock(size_t size) {
+#if defined(BIKE_COMPUTER_HOST)
+    return host::SimulatedHeap::getInstance().allocate(size);
+#else
+    return malloc(size);
+#endif  // defined(BIKE_COMPUTER_HOST)
+}
+
+static void freeBlock(void* block) {
+#if defined(BIKE_COMPUTER_HOST)
+    host::SimulatedHeap::getInstance().free(block);
+#else
+    free(block);
+#endif  // defined(BIKE_COMPUTER_HOST)
+}
+
+// test the scenario of demo/memory_fragmenter.hpp: once every other block is freed,
+// half of the heap is free but a slightly bigger block cannot be allocated, which is
+// reported by the analyzer before the allocation fails
+static control_t test_fragmenter_scenario(const size_t call_count) {
+    HeapAnalyzer probe(0);
+    probe.analyze();
+    const HeapAnalyzer::Report initialReport = probe.getLastReport();
+    TEST_ASSERT_FALSE(probe.isWarningRaised());
+
+    // divide the largest free block into blocks that we allocate
+    uint32_t blockSize =
+        ((initialReport.largestFreeBlock - kMarginSpace) / kNbrOfBlocks) & ~7U;
+    void* blocks[kNbrOfBlocks] = {nullptr};
+    for (uint8_t index = 0; index < kNbrOfBlocks; index++) {
+        blocks[index] = allocateBlock(blockSize);
+        TEST_ASSERT_TRUE(blocks[index] != nullptr);
+    }
+    // free only the even blocks
+    for (uint8_t index = 0; index < kNbrOfBlocks; index += 2) {
+        freeBlock(blocks[index]);
+        blocks[index] = nullptr;
+    }
+
+    blockSize += 8;
+    HeapAnalyzer heapAnalyzer(blockSize);
+    heapAnalyzer.analyze();
+    const HeapAnalyzer::Report& report = heapAnalyzer.getLastReport();
+    heapAnalyzer.printStats();
+    TEST_ASSERT_TRUE(heapAnalyzer.isWarningRaised());
+    TEST_ASSERT_EQUAL_UINT32(1, heapAnalyzer.getNbrOfWarnings());
+    TEST_ASSERT_FALSE(heapAnalyzer.canAllocate(blockSize));
+    TEST_ASSERT_TRUE(heapAnalyzer.canAllocate(blockSize - 8));
+    TEST_ASSERT_TRUE(report.nbrOfFreeBlocks >= kNbrOfBlocks / 2);
+    TEST_ASSERT_TRUE(report.freeSize >= (kNbrOfBlocks / 2) * (blockSize - 8));
+    // most of the free memory is outside of the largest free block
+    TEST_ASSERT_TRUE(report.fragmentationIndex > 50);
+    TEST_ASSERT_TRUE(report.fragmentationIndex > initialReport.fragmentationIndex);
+
+    // the warning was right: the slightly bigger block cannot be allocated
+    void* biggerBlock = allocateBlock(blockSize);
+    TEST_ASSERT_TRUE(biggerBlock == nullptr);
+
+    // the free blocks are coalesced once all blocks are freed
+    for (uint8_t index = 1; index < kNbrOfBlocks; index += 2) {
+        freeBlock(blocks[index]);
+    }
+    heapAnalyzer.analyze();
+    TEST_ASSERT_FALSE(heapAnalyzer.isWarningRaised());
+    TEST_ASSERT_TRUE(heapAnalyzer.canAllocate(blockSize));
+    TEST_ASSERT_EQUAL_UINT32(1, heapAnalyzer.getNbrOfWarnings());
+    TEST_ASSERT_EQUAL_UINT32(2, heapAnalyzer.getNbrOfAnalyses());
+
+    return CaseNext;
+}
+
+// test that the free blocks of the allocator are walked: once every other small block
+// is freed, the free memory is spread over several blocks and the largest free block is
+// smaller than the free memory (which cannot be observed from the heap statistics)
+static control_t test_fragmented_heap(const size_t call_count) {
+    static constexpr uint8_t kNbrOfSmallBlocks = 16;
+    static constexpr uint32_t kSmallBlockSize  = 64;
+    void* blocks[kNbrOfSmallBlocks]            = {nullptr};
+    for (uint8_t index = 0; index < kNbrOfSmallBlocks; index++) {
+        blocks[index] = allocateBlock(kSmallBlockSize);
+        TEST_ASSERT_TRUE(blocks[index] != nullptr);
+    }
+    HeapAnalyzer heapAnalyzer(0);
+    heapAnalyzer.analyze();
+    const uint32_t nbrOfFreeBlocks = heapAnalyzer.getLastReport().nbrOfFreeBlocks;
+
+    // free the even blocks, the odd blocks keep them apart
+    for (uint8_t index = 0; index < kNbrOfSmallBlocks; index += 2) {
+        freeBlock(blocks[index]);
+        blocks[index] = nullptr;
+    }
+    heapAnalyzer.analyze();
+    const HeapAnalyzer::Report& report = heapAnalyzer.getLastReport();
+    heapAnalyzer.printStats();
+    // a freed block may be coalesced with a neighbouring free block of the heap
+    const uint32_t nbrOfFragmentedBlocks = report.nbrOfFreeBlocks;
+    TEST_ASSERT_TRUE(nbrOfFragmentedBlocks > nbrOfFreeBlocks);
+    TEST_ASSERT_TRUE(report.largestFreeBlock < report.freeSize);
+    TEST_ASSERT_TRUE(report.freeSize - report.largestFreeBlock >=
+                     (kNbrOfSmallBlocks / 2 - 1) * kSmallBlockSize);
+
+    // the free blocks are coalesced once all blocks are freed
+    for (uint8_t index = 1; index < kNbrOfSmallBlocks; index += 2) {
+        freeBlock(blocks[index]);
+    }
+    heapAnalyzer.analyze();
+    const uint32_t nbrOfCoalescedBlocks = heapAnalyzer.getLastReport().nbrOfFreeBlocks;
+    TEST_ASSERT_TRUE(nbrOfCoalescedBlocks < nbrOfFragmentedBlocks);
+
+    return CaseNext;
+}
+
+#if defined(BIKE_COMPUTER_HOST)
+
+// test that a heap made of a single free block is not fragmented
+static control_t test_single_free_block(const size_t call_count) {
+    HeapAnalyzer heapAnalyzer(host::SimulatedHeap::kSize);
+    heapAnalyzer.analyze();
+    const HeapAnalyzer::Report& report = heapAnalyzer.getLastReport();
+    TEST_ASSERT_EQUAL_UINT32(1, report.nbrOfFreeBlocks);
+    TEST_ASSERT_EQUAL_UINT32(report.freeSize, report.largestFreeBlock);
+    TEST_ASSERT_EQUAL_UINT8(0, report.fragmentationIndex);
+    TEST_ASSERT_EQUAL_UINT32(1, report.histogram[HeapAnalyzer::kNbrOfBuckets - 1]);
+    // the header of the free block is not usable
+    TEST_ASSERT_TRUE(heapAnalyzer.isWarningRaised());
+    TEST_ASSERT_FALSE(heapAnalyzer.canAllocate(host::SimulatedHeap::kSize));
+
+    return CaseNext;
+}
+
+// test that the free blocks are counted in the bucket of their size
+static control_t test_histogram(const size_t call_count) {
+    // sizes of the blocks, each block being followed by a guard block that remains
+    // allocated (block sizes are multiple of 8 for not being rounded up)
+    static constexpr uint8_t kNbrOfSizes           = 3;
+    static constexpr uint32_t kSizes[kNbrOfSizes]  = {24, 104, 1000};
+    static constexpr uint8_t kBuckets[kNbrOfSizes] = {0, 2, 5};
+    static constexpr uint32_t kGuardSize           = 8;
+    void* blocks[kNbrOfSizes]                      = {nullptr};
+    void* guards[kNbrOfSizes]                      = {nullptr};
+    for (uint8_t index = 0; index < kNbrOfSizes; index++) {
+        blocks[index] = allocateBlock(kSizes[index]);
+        guards[index] = allocateBlock(kGuardSize);
+        TEST_ASSERT_TRUE(blocks[index] != nullptr);
+        TEST_ASSERT_TRUE(guards[index] != nullptr);
+    }
+    HeapAnalyzer heapAnalyzer(0);
+    heapAnalyzer.analyze();
+    const uint32_t remainingSize = heapAnalyzer.getLastReport().freeSize;
+    for (uint8_t index = 0; index < kNbrOfSizes; index++) {
+        freeBlock(blocks[index]);
+    }
+
+    heapAnalyzer.analyze();
+    const HeapAnalyzer::Report& report = heapAnalyzer.getLastReport();
+    TEST_ASSERT_EQUAL_UINT32(kNbrOfSizes + 1, report.nbrOfFreeBlocks);
+    TEST_ASSERT_EQUAL_UINT32(remainingSize + 24 + 104 + 1000, report.freeSize);
+    TEST_ASSERT_EQUAL_UINT32(remainingSize, report.largestFreeBlock);
+    uint32_t expectedHistogram[HeapAnalyzer::kNbrOfBuckets] = {0};
+    expectedHistogram[HeapAnalyzer::kNbrOfBuckets - 1]      = 1;
+    for (uint8_t index = 0; index < kNbrOfSizes; index++) {
+        TEST_ASSERT_TRUE(kSizes[index] < HeapAnalyzer::getBucketBound(kBuckets[index]));
+        expectedHistogram[kBuckets[index]]++;
+    }
+    for (uint8_t bucket = 0; bucket < HeapAnalyzer::kNbrOfBuckets; bucket++) {
+        TEST_ASSERT_EQUAL_UINT32(expectedHistogram[bucket], report.histogram[bucket]);
+    }
+    TEST_ASSERT_EQUAL_UINT8((24 + 104 + 1000) * 100 / report.freeSize,
+                            report.fragmentationIndex);
+
+    for (uint8_t index = 0; index < kNbrOfSizes; index++) {
+        freeBlock(guards[index]);
+    }
+    heapAnalyzer.analyze();
+    TEST_ASSERT_EQUAL_UINT32(1, heapAnalyzer.getLastReport().nbrOfFreeBlocks);
+
+    return CaseNext;
+}
+
+#endif  // defined(BIKE_COMPUTER_HOST)
+
+static utest::v1::status_t greentea_setup(const size_t number_of_cases) {
+    // Here, we specify the timeout (60s) and the host test (a built-in host test or the
+    // name of our Python file)
+    GREENTEA_SETUP(60, "default_auto");
+
+    return greentea_test_setup_handler(number_of_cases);
+}
+
+// List of test cases in this file
+static Case cases[] = {
+#if defined(BIKE_COMPUTER_HOST)
+    Case("test single free block", test_single_free_block),
+    Case("test histogram", test_histogram),
+#endif  // defined(BIKE_COMPUTER_HOST)
+    Case("test fragmenter scenario", test_fragmenter_scenario),
+    Case("test fragmented heap", test_fragmented_heap),
+};
+
+static Specification specification(greentea_setup, cases);
+
+int main() { return !Harness::run(specification); }
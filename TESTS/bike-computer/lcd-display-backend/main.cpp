@@ -0,0 +1,186 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file main.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Bike computer test suite: LCD display backend
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include "dirty_field_display.hpp"
+#include "display_renderer.hpp"
+#include "frame_buffer_display_device.hpp"
+#include "greentea-client/test_env.h"
+#include "headless_display_device.hpp"
+#include "lcd_display_backend.hpp"
+#include "mbed.h"
+#include "stm32h747i_discovery_lcd.h"
+#include "unity/unity.h"
+#include "utest/utest.h"
+
+using namespace utest::v1;
+
+using bike_computer::DirtyFieldDisplay;
+using bike_computer::DisplayFrame;
+using bike_computer::DisplayRenderer;
+using bike_computer::FrameBufferDisplayDevice;
+using bike_computer::HeadlessDisplayDevice;
+using bike_computer::LcdDisplayBackend;
+
+static constexpr uint16_t kWidth       = FrameBufferDisplayDevice::kWidth;
+static constexpr uint16_t kHeight      = FrameBufferDisplayDevice::kHeight;
+static constexpr uint32_t kNbrOfPixels = kWidth * kHeight;
+static uint16_t gPixels[kNbrOfPixels];
+static uint16_t gHeadlessPixels[kNbrOfPixels];
+static uint16_t gHeadlessScreen[kNbrOfPixels];
+
+// size of the speed field (large glyphs are 24 x 28 pixels)
+static constexpr uint32_t kSpeedFieldArea = 5 * 24 * 28;
+
+static uint32_t readLcdPixel(uint32_t x, uint32_t y) {
+    uint32_t color = 0;
+    const int32_t rc = BSP_LCD_ReadPixel(LcdDisplayBackend::kLcdInstance, x, y, &color);
+    TEST_ASSERT_EQUAL_INT(BSP_ERROR_NONE, rc);
+    return color;
+}
+
+// returns the number of pixels of the frame buffer area of the LCD that differ from
+// the screen of the headless display device
+static uint32_t countDifferentPixels(const LcdDisplayBackend& lcdDisplayBackend,
+                                     const HeadlessDisplayDevice& displayDevice) {
+    uint32_t nbrOfPixels = 0;
+    for (uint16_t y = 0; y < kHeight; y++) {
+        for (uint16_t x = 0; x < kWidth; x++) {
+            const uint32_t color = readLcdPixel(lcdDisplayBackend.getXPosition() + x,
+                                                lcdDisplayBackend.getYPosition() + y);
+            const uint32_t expectedColor =
+                lcdDisplayBackend.toLcdColor(displayDevice.getPixel(x, y));
+            nbrOfPixels += (color != expectedColor) ? 1 : 0;
+        }
+    }
+    return nbrOfPixels;
+}
+
+// test that the LCD is cleared and that the frame buffer is centered on it
+static control_t test_lcd_initialization(const size_t call_count) {
+    LcdDisplayBackend lcdDisplayBackend(kWidth, kHeight);
+    TEST_ASSERT_TRUE(lcdDisplayBackend.init() == disco::ReturnCode::Ok);
+
+    uint32_t xSize = 0;
+    uint32_t ySize = 0;
+    BSP_LCD_GetXSize(LcdDisplayBackend::kLcdInstance, &xSize);
+    BSP_LCD_GetYSize(LcdDisplayBackend::kLcdInstance, &ySize);
+    TEST_ASSERT_EQUAL_UINT32(xSize, 2 * lcdDisplayBackend.getXPosition() + kWidth);
+    TEST_ASSERT_EQUAL_UINT32(ySize, 2 * lcdDisplayBackend.getYPosition() + kHeight);
+
+    const uint32_t backgroundColor =
+        lcdDisplayBackend.toLcdColor(FrameBufferDisplayDevice::kBackgroundColor);
+    TEST_ASSERT_EQUAL_UINT32(backgroundColor, readLcdPixel(0, 0));
+    TEST_ASSERT_EQUAL_UINT32(backgroundColor, readLcdPixel(xSize - 1, ySize - 1));
+
+    // RGB565 colors are expanded with their high bits replicated in the low ones
+    uint32_t format = 0;
+    BSP_LCD_GetFormat(LcdDisplayBackend::kLcdInstance, &format);
+    if (format == LCD_PIXEL_FORMAT_ARGB8888) {
+        TEST_ASSERT_EQUAL_UINT32(0xFFFFFFFF, lcdDisplayBackend.toLcdColor(0xFFFF));
+        TEST_ASSERT_EQUAL_UINT32(0xFF7B7D7B, lcdDisplayBackend.toLcdColor(0x7BEF));
+    }
+
+    return CaseNext;
+}
+
+// test that the fields rendered from a frame model by the display renderer, as in the
+// bike system, are written to the LCD as on the headless display
+static control_t test_rendered_frame(const size_t call_count) {
+    LcdDisplayBackend lcdDisplayBackend(kWidth, kHeight);
+    FrameBufferDisplayDevice displayDevice(gPixels, lcdDisplayBackend);
+    TEST_ASSERT_TRUE(displayDevice.init() == disco::ReturnCode::Ok);
+    DirtyFieldDisplay dirtyFieldDisplay(displayDevice);
+    DisplayRenderer displayRenderer(dirtyFieldDisplay);
+    displayRenderer.start();
+
+    DisplayFrame frame;
+    frame.gear        = 3;
+    frame.speed       = 25.3f;
+    frame.distance    = 12.34f;
+    frame.temperature = 21.5f;
+    frame.flags       = DisplayFrame::kTemperatureValidFlag;
+    displayRenderer.submit(frame);
+    // the pending frame is rendered before the renderer is stopped
+    displayRenderer.stop();
+
+    TEST_ASSERT_EQUAL_UINT32(1, displayRenderer.getNbrOfRenderedFrames());
+    TEST_ASSERT_EQUAL_UINT32(1, lcdDisplayBackend.getNbrOfFrames());
+    // the first frame is flushed entirely
+    TEST_ASSERT_EQUAL_UINT32(kNbrOfPixels, lcdDisplayBackend.getNbrOfPixelsInLastFrame());
+
+    HeadlessDisplayDevice headlessDisplayDevice(gHeadlessPixels, gHeadlessScreen);
+    headlessDisplayDevice.init();
+    headlessDisplayDevice.displayGear(3);
+    headlessDisplayDevice.displaySpeed(25.3f);
+    headlessDisplayDevice.displayDistance(12.34f);
+    headlessDisplayDevice.displayTemperature(21.5f);
+    headlessDisplayDevice.endFrame();
+    TEST_ASSERT_EQUAL_UINT32(
+        0, countDifferentPixels(lcdDisplayBackend, headlessDisplayDevice));
+
+    return CaseNext;
+}
+
+// test that only the dirty regions of a frame are written to the LCD
+static control_t test_region_writes(const size_t call_count) {
+    LcdDisplayBackend lcdDisplayBackend(kWidth, kHeight);
+    FrameBufferDisplayDevice displayDevice(gPixels, lcdDisplayBackend);
+    TEST_ASSERT_TRUE(displayDevice.init() == disco::ReturnCode::Ok);
+    displayDevice.endFrame();
+    const uint32_t nbrOfRectangles = lcdDisplayBackend.getNbrOfRectangles();
+
+    displayDevice.displaySpeed(30.1f);
+    displayDevice.endFrame();
+    TEST_ASSERT_EQUAL_UINT32(2, lcdDisplayBackend.getNbrOfFrames());
+    TEST_ASSERT_EQUAL_UINT32(nbrOfRectangles + 1, lcdDisplayBackend.getNbrOfRectangles());
+    TEST_ASSERT_EQUAL_UINT32(kSpeedFieldArea,
+                             lcdDisplayBackend.getNbrOfPixelsInLastFrame());
+
+    // the LCD shows the same screen as the headless display
+    HeadlessDisplayDevice headlessDisplayDevice(gHeadlessPixels, gHeadlessScreen);
+    headlessDisplayDevice.init();
+    headlessDisplayDevice.displaySpeed(30.1f);
+    headlessDisplayDevice.endFrame();
+    TEST_ASSERT_EQUAL_UINT32(
+        0, countDifferentPixels(lcdDisplayBackend, headlessDisplayDevice));
+
+    return CaseNext;
+}
+
+static utest::v1::status_t greentea_setup(const size_t number_of_cases) {
+    // Here, we specify the timeout (60s) and the host test (a built-in host test or the
+    // name of our Python file)
+    GREENTEA_SETUP(60, "default_auto");
+
+    return greentea_test_setup_handler(number_of_cases);
+}
+
+// List of test cases in this file
+static Case cases[] = {Case("test lcd initialization", test_lcd_initialization),
+                       Case("test rendered frame", test_rendered_frame),
+                       Case("test region writes", test_region_writes)};
+
+static Specification specification(greentea_setup, cases);
+
+int main() { return !Harness::run(specification); }
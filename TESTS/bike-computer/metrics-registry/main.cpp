@@ -0,0 +1,288 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file main.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Bike computer test suite: metrics registry and binary export
+ *
+ * @date 2026-10-19
+ * @version 0.1.0
+ ***************************************************************************/
+
+#include <cstring>
+
+#include "greentea-client/test_env.h"
+#include "mbed.h"
+#include "metrics_exporter.hpp"
+#include "metrics_registry.hpp"
+#include "unity/unity.h"
+#include "utest/utest.h"
+#if defined(BIKE_COMPUTER_HOST)
+#include "metrics_decoder.hpp"
+#endif  // defined(BIKE_COMPUTER_HOST)
+
+using namespace utest::v1;
+
+using bike_computer::incrementMetric;
+using bike_computer::MetricDefinitions;
+using bike_computer::MetricId;
+using bike_computer::MetricsExporter;
+using bike_computer::MetricsRegistry;
+using bike_computer::recordMetric;
+using bike_computer::setMetric;
+
+// slots of the metrics used by the test cases
+static constexpr uint8_t kMajorCyclesSlot =
+    MetricDefinitions::getFirstSlot(MetricId::MajorCycles);
+static constexpr uint8_t kGearSlot = MetricDefinitions::getFirstSlot(MetricId::Gear);
+static constexpr uint8_t kResetResponseTimeSlot =
+    MetricDefinitions::getFirstSlot(MetricId::ResetResponseTime);
+
+// frames sent by the exporter
+static uint8_t gFrames[1024];
+static size_t gFramesSize = 0;
+
+static void captureFrame(const uint8_t* data, size_t size) {
+    if (gFramesSize + size <= sizeof(gFrames)) {
+        memcpy(&gFrames[gFramesSize], data, size);
+        gFramesSize += size;
+    }
+}
+
+// the deltas of the previous cases are exported and discarded
+static MetricsExporter& getSyncedExporter() {
+    MetricsExporter& exporter = MetricsExporter::getInstance();
+    exporter.setSink(callback(captureFrame));
+    exporter.exportDeltas();
+    gFramesSize = 0;
+    return exporter;
+}
+
+static uint16_t readSequence(const uint8_t* frame) {
+    return static_cast<uint16_t>(frame[1] | (static_cast<uint16_t>(frame[2]) << 8));
+}
+
+// test that counters and gauges are updated in their slot
+static control_t test_counters_and_gauges(const size_t call_count) {
+    const uint32_t majorCycles = MetricsRegistry::load(kMajorCyclesSlot);
+    incrementMetric<MetricId::MajorCycles>();
+    incrementMetric<MetricId::MajorCycles>(4);
+    TEST_ASSERT_EQUAL_UINT32(majorCycles + 5, MetricsRegistry::load(kMajorCyclesSlot));
+
+    // gauges hold the last value, stored as a signed value
+    setMetric<MetricId::Gear>(7);
+    setMetric<MetricId::Gear>(-3);
+    TEST_ASSERT_EQUAL_INT(-3, static_cast<int32_t>(MetricsRegistry::load(kGearSlot)));
+
+    // the slots of all metrics are contiguous
+    TEST_ASSERT_EQUAL_UINT8(0, kMajorCyclesSlot);
+    TEST_ASSERT_EQUAL_UINT8(MetricDefinitions::kNbrOfBuckets,
+                            MetricDefinitions::getFirstSlot(MetricId::RenderTime) -
+                                kResetResponseTimeSlot);
+
+    return CaseNext;
+}
+
+// test that histogram values are counted in the bucket of their bound
+static control_t test_histogram_buckets(const size_t call_count) {
+    // buckets of the reset response time: < 64, < 256, < 1024, ..., >= 262144
+    static constexpr uint32_t kValues[] = {0, 63, 64, 255, 256, 262143, 262144, 5000000};
+    static constexpr uint8_t kBuckets[] = {0, 0, 1, 1, 2, 6, 7, 7};
+    uint32_t counts[MetricDefinitions::kNbrOfBuckets];
+    for (uint8_t bucket = 0; bucket < MetricDefinitions::kNbrOfBuckets; bucket++) {
+        counts[bucket] = MetricsRegistry::load(kResetResponseTimeSlot + bucket);
+    }
+
+    for (uint8_t index = 0; index < sizeof(kValues) / sizeof(kValues[0]); index++) {
+        recordMetric<MetricId::ResetResponseTime>(kValues[index]);
+        counts[kBuckets[index]]++;
+    }
+
+    for (uint8_t bucket = 0; bucket < MetricDefinitions::kNbrOfBuckets; bucket++) {
+        TEST_ASSERT_EQUAL_UINT32(counts[bucket],
+                                 MetricsRegistry::load(kResetResponseTimeSlot + bucket));
+    }
+
+    return CaseNext;
+}
+
+// updates made by each updater thread
+static constexpr uint32_t kNbrOfUpdates = 20000;
+
+static void updaterFunction() {
+    for (uint32_t index = 0; index < kNbrOfUpdates; index++) {
+        incrementMetric<MetricId::MajorCycles>();
+        // half of the values are recorded in the first bucket
+        recordMetric<MetricId::ResetResponseTime>(((index % 2) == 0) ? 0 : 64);
+    }
+}
+
+// test that concurrent updates are not lost
+static control_t test_concurrent_updates(const size_t call_count) {
+    const uint32_t majorCycles = MetricsRegistry::load(kMajorCyclesSlot);
+    const uint32_t firstBucket = MetricsRegistry::load(kResetResponseTimeSlot);
+
+    Thread updater1(osPriorityNormal, OS_STACK_SIZE, nullptr, "updater1");
+    Thread updater2(osPriorityNormal, OS_STACK_SIZE, nullptr, "updater2");
+    Thread updater3(osPriorityAboveNormal, OS_STACK_SIZE, nullptr, "updater3");
+    updater1.start(callback(updaterFunction));
+    updater2.start(callback(updaterFunction));
+    updater3.start(callback(updaterFunction));
+    updater1.join();
+    updater2.join();
+    updater3.join();
+
+    TEST_ASSERT_EQUAL_UINT32(majorCycles + 3 * kNbrOfUpdates,
+                             MetricsRegistry::load(kMajorCyclesSlot));
+    TEST_ASSERT_EQUAL_UINT32(firstBucket + 3 * kNbrOfUpdates / 2,
+                             MetricsRegistry::load(kResetResponseTimeSlot));
+
+    return CaseNext;
+}
+
+// test that only the slots that changed are exported, as variable-length deltas
+static control_t test_export_frame(const size_t call_count) {
+    MetricsExporter& exporter = getSyncedExporter();
+
+    // a frame is sent even when no slot changed
+    const uint32_t nbrOfSentFrames = exporter.getNbrOfSentFrames();
+    exporter.exportDeltas();
+    TEST_ASSERT_EQUAL_UINT32(nbrOfSentFrames + 1, exporter.getNbrOfSentFrames());
+    TEST_ASSERT_EQUAL_UINT32(MetricsExporter::kFrameHeaderSize + 1, gFramesSize);
+    TEST_ASSERT_EQUAL_UINT8(MetricsExporter::kSyncByte, gFrames[0]);
+    TEST_ASSERT_EQUAL_UINT8(0, gFrames[MetricsExporter::kFrameHeaderSize - 1]);
+    const uint16_t sequence = readSequence(gFrames);
+
+    // 300 is encoded on two bytes, a gauge decreased by 2 is zigzag encoded as 3
+    gFramesSize = 0;
+    incrementMetric<MetricId::MajorCycles>(300);
+    setMetric<MetricId::Gear>(static_cast<int32_t>(MetricsRegistry::load(kGearSlot)) - 2);
+    exporter.exportDeltas();
+    static constexpr uint8_t kPayload[] = {kMajorCyclesSlot, 0xAC, 0x02, kGearSlot, 0x03};
+    static constexpr size_t kFrameSize =
+        MetricsExporter::kFrameHeaderSize + sizeof(kPayload) + 1;
+    TEST_ASSERT_EQUAL_UINT32(kFrameSize, gFramesSize);
+    TEST_ASSERT_EQUAL_UINT16(static_cast<uint16_t>(sequence + 1), readSequence(gFrames));
+    TEST_ASSERT_EQUAL_UINT8(sizeof(kPayload),
+                            gFrames[MetricsExporter::kFrameHeaderSize - 1]);
+    for (uint8_t index = 0; index < sizeof(kPayload); index++) {
+        TEST_ASSERT_EQUAL_UINT8(kPayload[index],
+                                gFrames[MetricsExporter::kFrameHeaderSize + index]);
+    }
+    uint8_t checksum = 0;
+    for (size_t index = 1; index < kFrameSize - 1; index++) {
+        checksum += gFrames[index];
+    }
+    TEST_ASSERT_EQUAL_UINT8(checksum, gFrames[kFrameSize - 1]);
+
+    return CaseNext;
+}
+
+#if defined(BIKE_COMPUTER_HOST)
+static uint32_t gNbrOfDecodedFrames = 0;
+
+static void onFrame(const host::MetricsDecoder& decoder) { gNbrOfDecodedFrames++; }
+
+// test that the host decoder rebuilds the values of the metrics from the deltas,
+// skips the bytes that do not belong to valid frames and detects lost frames (host
+// only)
+static control_t test_decoder(const size_t call_count) {
+    MetricsExporter& exporter = getSyncedExporter();
+    uint32_t firstValues[MetricsRegistry::kNbrOfSlots];
+    for (uint8_t slot = 0; slot < MetricsRegistry::kNbrOfSlots; slot++) {
+        firstValues[slot] = MetricsRegistry::load(slot);
+    }
+
+    // three frames, the second one being corrupted in a copy of the stream
+    size_t frameOffsets[3] = {0};
+    for (uint8_t frame = 0; frame < 3; frame++) {
+        frameOffsets[frame] = gFramesSize;
+        incrementMetric<MetricId::MajorCycles>(1000 * (frame + 1));
+        setMetric<MetricId::Gear>(frame - 1);
+        recordMetric<MetricId::ResetResponseTime>(100);
+        exporter.exportDeltas();
+    }
+
+    host::MetricsDecoder decoder(callback(onFrame));
+    gNbrOfDecodedFrames = 0;
+    // the frames are split across chunks
+    static constexpr size_t kChunkSize = 5;
+    for (size_t index = 0; index < gFramesSize; index += kChunkSize) {
+        const size_t chunkSize =
+            (gFramesSize - index < kChunkSize) ? gFramesSize - index : kChunkSize;
+        decoder.decode(&gFrames[index], chunkSize);
+    }
+    TEST_ASSERT_EQUAL_UINT32(3, gNbrOfDecodedFrames);
+    TEST_ASSERT_EQUAL_UINT32(0, decoder.getNbrOfLostFrames());
+    for (uint8_t slot = 0; slot < MetricsRegistry::kNbrOfSlots; slot++) {
+        TEST_ASSERT_EQUAL_UINT32(MetricsRegistry::load(slot) - firstValues[slot],
+                                 static_cast<uint32_t>(decoder.getValue(slot)));
+    }
+    TEST_ASSERT_EQUAL_INT64(1000 + 2000 + 3000, decoder.getValue(kMajorCyclesSlot));
+    TEST_ASSERT_EQUAL_INT64(3, decoder.getValue(kResetResponseTimeSlot + 1));
+
+    // text traces before the frames and a corrupted second frame
+    uint8_t stream[sizeof(gFrames) + 32];
+    const char kText[] = "[INFO][main]: text trace\n";
+    size_t streamSize  = sizeof(kText) - 1;
+    memcpy(stream, kText, streamSize);
+    memcpy(&stream[streamSize], gFrames, gFramesSize);
+    stream[streamSize + frameOffsets[1] + MetricsExporter::kFrameHeaderSize] ^= 0x01;
+    streamSize += gFramesSize;
+
+    host::MetricsDecoder corruptedDecoder(callback(onFrame));
+    gNbrOfDecodedFrames = 0;
+    corruptedDecoder.decode(stream, streamSize);
+    TEST_ASSERT_EQUAL_UINT32(2, gNbrOfDecodedFrames);
+    TEST_ASSERT_EQUAL_UINT32(1, corruptedDecoder.getNbrOfLostFrames());
+    TEST_ASSERT_EQUAL_UINT32(1, corruptedDecoder.getNbrOfChecksumErrors());
+    TEST_ASSERT_TRUE(corruptedDecoder.getNbrOfSkippedBytes() >= sizeof(kText) - 1);
+
+    // csv time series
+    char text[1024];
+    host::MetricsDecoder::formatCsvHeader(text, sizeof(text));
+    TEST_ASSERT_TRUE(strncmp(text, "time_ms,major_cycles,deadline_misses,", 37) == 0);
+    TEST_ASSERT_TRUE(strstr(text, ",reset_response_time_us_lt64,") != nullptr);
+    TEST_ASSERT_TRUE(strstr(text, ",reset_response_time_us_ge262144,") != nullptr);
+    decoder.formatCsvRow(text, sizeof(text));
+    TEST_ASSERT_TRUE(strstr(text, ",6000,") != nullptr);
+
+    return CaseNext;
+}
+#endif  // defined(BIKE_COMPUTER_HOST)
+
+static utest::v1::status_t greentea_setup(const size_t number_of_cases) {
+    // Here, we specify the timeout (60s) and the host test (a built-in host test or the
+    // name of our Python file)
+    GREENTEA_SETUP(60, "default_auto");
+
+    return greentea_test_setup_handler(number_of_cases);
+}
+
+// List of test cases in this file
+static Case cases[] = {
+    Case("test counters and gauges", test_counters_and_gauges),
+    Case("test histogram buckets", test_histogram_buckets),
+    Case("test concurrent updates", test_concurrent_updates),
+    Case("test export frame", test_export_frame),
+#if defined(BIKE_COMPUTER_HOST)
+    Case("test decoder", test_decoder),
+#endif  // defined(BIKE_COMPUTER_HOST)
+};
+
+static Specification specification(greentea_setup, cases);
+
+int main() { return !Harness::run(specification); }
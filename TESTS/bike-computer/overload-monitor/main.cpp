@@ -0,0 +1,215 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file main.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Bike computer test suite: overload monitor (mixed-criticality)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include <chrono>
+
+#include "greentea-client/test_env.h"
+#include "mbed.h"
+#include "overload_monitor.hpp"
+#include "static_scheduling_with_event/bike_system.hpp"
+#include "task_logger.hpp"
+#include "unity/unity.h"
+#include "utest/utest.h"
+
+using namespace utest::v1;
+
+using bike_computer::OverloadMonitor;
+
+// loads used for simulating the different situations
+static constexpr uint8_t kOverloadCpuLoad    = 95;
+static constexpr uint8_t kIntermediateCpuLoad = 70;
+static constexpr uint8_t kRecoveredCpuLoad    = 40;
+
+// test that a high cpu load or a deadline miss switches to the degraded mode
+static control_t test_enter_degraded_mode(const size_t call_count) {
+    Timer timer;
+    timer.start();
+
+    OverloadMonitor overloadMonitor(timer);
+    TEST_ASSERT_TRUE(overloadMonitor.getMode() == OverloadMonitor::Mode::Normal);
+
+    // a load below the threshold does not change the mode
+    overloadMonitor.update(kIntermediateCpuLoad, false);
+    TEST_ASSERT_TRUE(overloadMonitor.getMode() == OverloadMonitor::Mode::Normal);
+
+    // a load above the threshold switches to the degraded mode
+    overloadMonitor.update(kOverloadCpuLoad, false);
+    TEST_ASSERT_TRUE(overloadMonitor.getMode() == OverloadMonitor::Mode::Degraded);
+    TEST_ASSERT_EQUAL_UINT32(1, overloadMonitor.getNbrOfTransitions());
+
+    // a deadline miss switches to the degraded mode, whatever the load
+    OverloadMonitor otherOverloadMonitor(timer);
+    otherOverloadMonitor.update(kRecoveredCpuLoad, true);
+    TEST_ASSERT_TRUE(otherOverloadMonitor.getMode() == OverloadMonitor::Mode::Degraded);
+
+    return CaseNext;
+}
+
+// test that the system switches back only after recovery with hysteresis
+static control_t test_hysteresis(const size_t call_count) {
+    Timer timer;
+    timer.start();
+
+    OverloadMonitor overloadMonitor(timer);
+    overloadMonitor.update(kOverloadCpuLoad, false);
+    TEST_ASSERT_TRUE(overloadMonitor.getMode() == OverloadMonitor::Mode::Degraded);
+
+    // a load between the exit and enter thresholds keeps the degraded mode
+    for (uint8_t cycle = 0; cycle < 2 * OverloadMonitor::kRecoveryCycles; cycle++) {
+        overloadMonitor.update(kIntermediateCpuLoad, false);
+        TEST_ASSERT_TRUE(overloadMonitor.getMode() == OverloadMonitor::Mode::Degraded);
+    }
+
+    // an overloaded cycle restarts the recovery period
+    for (uint8_t cycle = 0; cycle < OverloadMonitor::kRecoveryCycles - 1; cycle++) {
+        overloadMonitor.update(kRecoveredCpuLoad, false);
+    }
+    overloadMonitor.update(kRecoveredCpuLoad, true);
+    TEST_ASSERT_TRUE(overloadMonitor.getMode() == OverloadMonitor::Mode::Degraded);
+
+    // kRecoveryCycles consecutive recovered cycles switch back to the normal mode
+    for (uint8_t cycle = 0; cycle < OverloadMonitor::kRecoveryCycles - 1; cycle++) {
+        overloadMonitor.update(kRecoveredCpuLoad, false);
+        TEST_ASSERT_TRUE(overloadMonitor.getMode() == OverloadMonitor::Mode::Degraded);
+    }
+    overloadMonitor.update(kRecoveredCpuLoad, false);
+    TEST_ASSERT_TRUE(overloadMonitor.getMode() == OverloadMonitor::Mode::Normal);
+    TEST_ASSERT_EQUAL_UINT32(2, overloadMonitor.getNbrOfTransitions());
+
+    return CaseNext;
+}
+
+// test that low-criticality tasks are stretched in degraded mode
+static control_t test_low_criticality_stretch(const size_t call_count) {
+    Timer timer;
+    timer.start();
+
+    OverloadMonitor overloadMonitor(timer);
+    TEST_ASSERT_TRUE(overloadMonitor.isLowCriticalityReleased());
+
+    overloadMonitor.update(kOverloadCpuLoad, false);
+    static constexpr uint8_t kNbrOfCycles = 4 * OverloadMonitor::kRecoveryCycles;
+    uint8_t nbrOfReleases                 = 0;
+    for (uint8_t cycle = 0; cycle < kNbrOfCycles; cycle++) {
+        overloadMonitor.update(kOverloadCpuLoad, false);
+        if (overloadMonitor.isLowCriticalityReleased()) {
+            nbrOfReleases++;
+        }
+    }
+    const uint8_t expectedNbrOfReleases =
+        (OverloadMonitor::kLowCriticalityStretchFactor == 0)
+            ? 0
+            : kNbrOfCycles / OverloadMonitor::kLowCriticalityStretchFactor;
+    TEST_ASSERT_EQUAL_UINT8(expectedNbrOfReleases, nbrOfReleases);
+
+    return CaseNext;
+}
+
+// test the time accounted in each mode
+static control_t test_time_in_mode(const size_t call_count) {
+    Timer timer;
+    timer.start();
+
+    OverloadMonitor overloadMonitor(timer);
+
+    static constexpr std::chrono::milliseconds kTimeInMode = 500ms;
+    ThisThread::sleep_for(kTimeInMode);
+    overloadMonitor.update(kOverloadCpuLoad, false);
+    ThisThread::sleep_for(kTimeInMode);
+
+    // allow for 2 msecs offset
+    static constexpr uint64_t kDeltaUs = 2000;
+    TEST_ASSERT_UINT64_WITHIN(
+        kDeltaUs,
+        std::chrono::microseconds(kTimeInMode).count(),
+        overloadMonitor.getTimeInMode(OverloadMonitor::Mode::Normal).count());
+    TEST_ASSERT_UINT64_WITHIN(
+        kDeltaUs,
+        std::chrono::microseconds(kTimeInMode).count(),
+        overloadMonitor.getTimeInMode(OverloadMonitor::Mode::Degraded).count());
+    overloadMonitor.printStats();
+
+    return CaseNext;
+}
+
+// test the bike system under a simulated overload
+static control_t test_simulated_overload(const size_t call_count) {
+    // create the BikeSystem instance and simulate an overloaded cpu
+    static_scheduling_with_event::BikeSystem bikeSystem;
+    bikeSystem.getOverloadMonitor().simulateCpuLoad(kOverloadCpuLoad);
+
+    // run the bike system in a separate thread
+    Thread thread;
+    thread.start(callback(&bikeSystem, &static_scheduling_with_event::BikeSystem::start));
+
+    // let the bike system run for 20 secs
+    ThisThread::sleep_for(20s);
+
+    // stop the bike system
+    bikeSystem.stop();
+    thread.join();
+
+    TEST_ASSERT_TRUE(bikeSystem.getOverloadMonitor().getMode() ==
+                     OverloadMonitor::Mode::Degraded);
+
+    // high-criticality tasks keep their periods, low-criticality tasks are stretched
+    // Order is kGearTaskIndex, kSpeedTaskIndex, kTemperatureTaskIndex,
+    //          kResetTaskIndex, kDisplayTask1Index, kDisplayTask2Index
+    constexpr std::chrono::microseconds kStretchedPeriod =
+        1600000us * OverloadMonitor::kLowCriticalityStretchFactor;
+    constexpr std::chrono::microseconds taskPeriods[] = {
+        800000us, 400000us, kStretchedPeriod, 800000us, 1600000us, kStretchedPeriod};
+
+    // allow for 2 msecs offset (with EventQueue)
+    constexpr uint64_t kDeltaUs = 2000;
+    for (uint8_t taskIndex = 0; taskIndex < advembsof::TaskLogger::kNbrOfTasks;
+         taskIndex++) {
+        TEST_ASSERT_UINT64_WITHIN(
+            kDeltaUs,
+            taskPeriods[taskIndex].count(),
+            bikeSystem.getTaskLogger().getPeriod(taskIndex).count());
+    }
+
+    return CaseNext;
+}
+
+static utest::v1::status_t greentea_setup(const size_t number_of_cases) {
+    // Here, we specify the timeout (60s) and the host test (a built-in host test or the
+    // name of our Python file)
+    GREENTEA_SETUP(60, "default_auto");
+
+    return greentea_test_setup_handler(number_of_cases);
+}
+
+// List of test cases in this file
+static Case cases[] = {
+    Case("test enter degraded mode", test_enter_degraded_mode),
+    Case("test overload hysteresis", test_hysteresis),
+    Case("test low-criticality stretch", test_low_criticality_stretch),
+    Case("test time in mode", test_time_in_mode),
+    Case("test bike system under simulated overload", test_simulated_overload)};
+
+static Specification specification(greentea_setup, cases);
+
+int main() { return !Harness::run(specification); }
@@ -0,0 +1,262 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file main.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Bike computer test suite: fixed-block pool allocator
+ *
+ * @date 2026-10-19
+ * @version 0.1.0
+ ***************************************************************************/
+
+#include <cstring>
+
+#include "greentea-client/test_env.h"
+#include "mbed.h"
+#include "pool_allocator.hpp"
+#include "unity/unity.h"
+#include "utest/utest.h"
+
+using namespace utest::v1;
+
+using bike_computer::poolDelete;
+using bike_computer::PoolAllocator;
+using bike_computer::PoolDefinition;
+using bike_computer::PoolDefinitions;
+using bike_computer::poolNew;
+
+static constexpr uint8_t kLargestPoolIndex = PoolDefinitions::kNbrOfPools - 1;
+static constexpr uint16_t kNbrOfUpdates    = 1000;
+
+static uint16_t getNbrOfUsedBlocks(uint8_t poolIndex) {
+    return PoolAllocator::getPoolStats(poolIndex).nbrOfUsedBlocks;
+}
+
+// test that each request is served by the smallest pool with large enough blocks
+static control_t test_size_classes(const size_t call_count) {
+    PoolAllocator::resetStats();
+    for (uint8_t poolIndex = 0; poolIndex < PoolDefinitions::kNbrOfPools; poolIndex++) {
+        const PoolDefinition& definition = PoolDefinitions::kDefinitions[poolIndex];
+        const uint16_t smallestSize =
+            (poolIndex == 0) ? 1
+                             : PoolDefinitions::kDefinitions[poolIndex - 1].blockSize + 1;
+        void* smallestBlock = PoolAllocator::allocate(smallestSize);
+        void* largestBlock  = PoolAllocator::allocate(definition.blockSize);
+        TEST_ASSERT_TRUE(smallestBlock != nullptr);
+        TEST_ASSERT_TRUE(largestBlock != nullptr);
+        TEST_ASSERT_TRUE(PoolAllocator::owns(smallestBlock));
+        TEST_ASSERT_EQUAL_UINT32(
+            0, reinterpret_cast<uintptr_t>(largestBlock) % PoolDefinitions::kAlignment);
+        TEST_ASSERT_EQUAL_UINT16(2, getNbrOfUsedBlocks(poolIndex));
+        PoolAllocator::free(smallestBlock);
+        PoolAllocator::free(largestBlock);
+        TEST_ASSERT_EQUAL_UINT16(0, getNbrOfUsedBlocks(poolIndex));
+        TEST_ASSERT_EQUAL_UINT16(2, PoolAllocator::getPoolStats(poolIndex).highWaterMark);
+    }
+
+    // larger than the largest block
+    const uint16_t largestBlockSize = PoolDefinitions::getLargestBlockSize();
+    TEST_ASSERT_TRUE(PoolAllocator::allocate(largestBlockSize + 1) == nullptr);
+    TEST_ASSERT_EQUAL_UINT32(
+        1, PoolAllocator::getPoolStats(kLargestPoolIndex).nbrOfFailures);
+    int local = 0;
+    TEST_ASSERT_FALSE(PoolAllocator::owns(&local));
+
+    return CaseNext;
+}
+
+// test that an exhausted pool spills to the larger pools and that the allocation fails
+// once all larger pools are exhausted
+static control_t test_spills_and_failures(const size_t call_count) {
+    PoolAllocator::resetStats();
+    const uint16_t blockSize = PoolDefinitions::getLargestBlockSize();
+    const uint16_t nbrOfBlocks =
+        PoolDefinitions::kDefinitions[kLargestPoolIndex].nbrOfBlocks;
+    const PoolDefinition& smallerDefinition =
+        PoolDefinitions::kDefinitions[kLargestPoolIndex - 1];
+    const uint16_t nbrOfSmallerBlocks = smallerDefinition.nbrOfBlocks;
+    static void* blocks[UINT8_MAX];
+    TEST_ASSERT_TRUE(nbrOfBlocks + nbrOfSmallerBlocks <= UINT8_MAX);
+
+    for (uint16_t index = 0; index < nbrOfBlocks; index++) {
+        blocks[index] = PoolAllocator::allocate(blockSize);
+        TEST_ASSERT_TRUE(blocks[index] != nullptr);
+    }
+    TEST_ASSERT_TRUE(PoolAllocator::allocate(blockSize) == nullptr);
+
+    // the blocks of the second largest pool spill to the (exhausted) largest pool
+    for (uint16_t index = 0; index < nbrOfSmallerBlocks; index++) {
+        void* block = PoolAllocator::allocate(smallerDefinition.blockSize);
+        TEST_ASSERT_TRUE(block != nullptr);
+        blocks[nbrOfBlocks + index] = block;
+    }
+    TEST_ASSERT_TRUE(PoolAllocator::allocate(smallerDefinition.blockSize) == nullptr);
+
+    PoolAllocator::PoolStats stats = PoolAllocator::getPoolStats(kLargestPoolIndex);
+    TEST_ASSERT_EQUAL_UINT16(nbrOfBlocks, stats.nbrOfUsedBlocks);
+    TEST_ASSERT_EQUAL_UINT16(nbrOfBlocks, stats.highWaterMark);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.nbrOfFailures);
+    stats = PoolAllocator::getPoolStats(kLargestPoolIndex - 1);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.nbrOfFailures);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.nbrOfSpills);
+
+    // freeing one block of the largest pool lets a smaller request spill to it
+    PoolAllocator::free(blocks[0]);
+    blocks[0] = PoolAllocator::allocate(smallerDefinition.blockSize);
+    TEST_ASSERT_TRUE(blocks[0] != nullptr);
+    TEST_ASSERT_EQUAL_UINT32(
+        1, PoolAllocator::getPoolStats(kLargestPoolIndex - 1).nbrOfSpills);
+
+    PoolAllocator::printStats();
+    for (uint16_t index = 0; index < nbrOfBlocks + nbrOfSmallerBlocks; index++) {
+        PoolAllocator::free(blocks[index]);
+    }
+    TEST_ASSERT_EQUAL_UINT16(0, getNbrOfUsedBlocks(kLargestPoolIndex));
+    TEST_ASSERT_EQUAL_UINT16(0, getNbrOfUsedBlocks(kLargestPoolIndex - 1));
+
+    return CaseNext;
+}
+
+// test the scenario of demo/memory_fragmenter.hpp with a pool: once every other block
+// is freed, a slightly larger block can still be allocated, without spill
+static control_t test_fragmenter_scenario(const size_t call_count) {
+    PoolAllocator::resetStats();
+    static constexpr uint8_t kPoolIndex = 2;
+    static constexpr PoolDefinition kDefinition =
+        PoolDefinitions::kDefinitions[kPoolIndex];
+    uint16_t blockSize = kDefinition.blockSize - 8;
+    void* blocks[kDefinition.nbrOfBlocks];
+    for (uint16_t index = 0; index < kDefinition.nbrOfBlocks; index++) {
+        blocks[index] = PoolAllocator::allocate(blockSize);
+        TEST_ASSERT_TRUE(blocks[index] != nullptr);
+    }
+    for (uint16_t index = 0; index < kDefinition.nbrOfBlocks; index += 2) {
+        PoolAllocator::free(blocks[index]);
+        blocks[index] = nullptr;
+    }
+
+    blockSize += 8;
+    for (uint16_t index = 0; index < kDefinition.nbrOfBlocks; index += 2) {
+        blocks[index] = PoolAllocator::allocate(blockSize);
+        TEST_ASSERT_TRUE(blocks[index] != nullptr);
+    }
+    const PoolAllocator::PoolStats stats = PoolAllocator::getPoolStats(kPoolIndex);
+    TEST_ASSERT_EQUAL_UINT16(kDefinition.nbrOfBlocks, stats.nbrOfUsedBlocks);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.nbrOfSpills);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.nbrOfFailures);
+
+    for (uint16_t index = 0; index < kDefinition.nbrOfBlocks; index++) {
+        PoolAllocator::free(blocks[index]);
+    }
+    TEST_ASSERT_EQUAL_UINT16(0, getNbrOfUsedBlocks(kPoolIndex));
+
+    return CaseNext;
+}
+
+class Payload {
+   public:
+    Payload(uint32_t value, uint8_t* nbrOfDestructions)
+        : _value(value), _nbrOfDestructions(nbrOfDestructions) {}
+    ~Payload() { (*_nbrOfDestructions)++; }
+
+    uint32_t getValue() const { return _value; }
+
+   private:
+    uint32_t _value;
+    uint8_t* _nbrOfDestructions;
+};
+
+// test that objects are constructed in and destroyed from the pools
+static control_t test_pool_new_delete(const size_t call_count) {
+    uint8_t nbrOfDestructions = 0;
+    Payload* payload          = poolNew<Payload>(42, &nbrOfDestructions);
+    TEST_ASSERT_TRUE(payload != nullptr);
+    TEST_ASSERT_TRUE(PoolAllocator::owns(payload));
+    TEST_ASSERT_EQUAL_UINT32(42, payload->getValue());
+    TEST_ASSERT_EQUAL_UINT16(1, getNbrOfUsedBlocks(0));
+    poolDelete(payload);
+    TEST_ASSERT_EQUAL_UINT8(1, nbrOfDestructions);
+    TEST_ASSERT_EQUAL_UINT16(0, getNbrOfUsedBlocks(0));
+    poolDelete<Payload>(nullptr);
+
+    return CaseNext;
+}
+
+// allocations that failed in the allocator threads
+static volatile uint32_t gNbrOfFailedAllocations = 0;
+
+static void allocatorFunction() {
+    void* blocks[4] = {nullptr};
+    for (uint16_t index = 0; index < kNbrOfUpdates; index++) {
+        for (uint8_t blockIndex = 0; blockIndex < 4; blockIndex++) {
+            // one block of each of the four smallest pools
+            blocks[blockIndex] = PoolAllocator::allocate(16 << blockIndex);
+            if (blocks[blockIndex] == nullptr) {
+                core_util_atomic_incr_u32(&gNbrOfFailedAllocations, 1);
+            } else {
+                memset(blocks[blockIndex], index, 8);
+            }
+        }
+        for (uint8_t blockIndex = 0; blockIndex < 4; blockIndex++) {
+            PoolAllocator::free(blocks[blockIndex]);
+        }
+    }
+}
+
+// test that concurrent allocations never hand out a block twice
+static control_t test_concurrent_allocations(const size_t call_count) {
+    PoolAllocator::resetStats();
+    Thread allocator1(osPriorityNormal, OS_STACK_SIZE, nullptr, "allocator1");
+    Thread allocator2(osPriorityNormal, OS_STACK_SIZE, nullptr, "allocator2");
+    Thread allocator3(osPriorityAboveNormal, OS_STACK_SIZE, nullptr, "allocator3");
+    allocator1.start(callback(allocatorFunction));
+    allocator2.start(callback(allocatorFunction));
+    allocator3.start(callback(allocatorFunction));
+    allocator1.join();
+    allocator2.join();
+    allocator3.join();
+    TEST_ASSERT_EQUAL_UINT32(0, gNbrOfFailedAllocations);
+
+    for (uint8_t poolIndex = 0; poolIndex < PoolDefinitions::kNbrOfPools; poolIndex++) {
+        const PoolAllocator::PoolStats stats = PoolAllocator::getPoolStats(poolIndex);
+        TEST_ASSERT_EQUAL_UINT16(0, stats.nbrOfUsedBlocks);
+        TEST_ASSERT_TRUE(stats.highWaterMark <= 3);
+        TEST_ASSERT_EQUAL_UINT32(0, stats.nbrOfFailures);
+    }
+
+    return CaseNext;
+}
+
+static utest::v1::status_t greentea_setup(const size_t number_of_cases) {
+    // Here, we specify the timeout (60s) and the host test (a built-in host test or the
+    // name of our Python file)
+    GREENTEA_SETUP(60, "default_auto");
+
+    return greentea_test_setup_handler(number_of_cases);
+}
+
+// List of test cases in this file
+static Case cases[] = {
+    Case("test size classes", test_size_classes),
+    Case("test spills and failures", test_spills_and_failures),
+    Case("test fragmenter scenario", test_fragmenter_scenario),
+    Case("test pool new and delete", test_pool_new_delete),
+    Case("test concurrent allocations", test_concurrent_allocations),
+};
+
+static Specification specification(greentea_setup, cases);
+
+int main() { return !Harness::run(specification); }
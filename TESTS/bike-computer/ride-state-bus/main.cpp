@@ -0,0 +1,220 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file main.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Bike computer test suite: lock-free ride-state bus
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include <chrono>
+
+#include "greentea-client/test_env.h"
+#include "mbed.h"
+#include "ride_state_bus.hpp"
+#include "static_scheduling_with_event/bike_system.hpp"
+#include "triple_buffer.hpp"
+#include "unity/unity.h"
+#include "utest/utest.h"
+
+using namespace utest::v1;
+
+using bike_computer::RideStateBus;
+using bike_computer::SpeedState;
+using bike_computer::Topic;
+
+// test that a subscriber always reads the newest published value
+static control_t test_newest_value(const size_t call_count) {
+    Topic<int> topic(0);
+    Topic<int>::Subscriber subscriber = topic.subscribe();
+    TEST_ASSERT_TRUE(subscriber.isValid());
+
+    // no value published yet: the initial value is read
+    TEST_ASSERT_FALSE(subscriber.update());
+    TEST_ASSERT_EQUAL_INT(0, subscriber.getValue());
+
+    // intermediate values are overwritten
+    for (int value = 1; value <= 3; value++) {
+        topic.publish(value, std::chrono::microseconds(value));
+    }
+    TEST_ASSERT_TRUE(subscriber.update());
+    TEST_ASSERT_EQUAL_INT(3, subscriber.getValue());
+    TEST_ASSERT_EQUAL_UINT32(3, subscriber.getSample().sequence);
+    TEST_ASSERT_EQUAL_INT64(3, subscriber.getSample().timestamp.count());
+
+    // the value remains available until a new one is published
+    TEST_ASSERT_FALSE(subscriber.update());
+    TEST_ASSERT_EQUAL_INT(3, subscriber.getValue());
+    TEST_ASSERT_EQUAL_UINT32(3, topic.getNbrOfUpdates());
+
+    return CaseNext;
+}
+
+// test that subscribers read the topic independently of each other
+static control_t test_independent_subscribers(const size_t call_count) {
+    Topic<int> topic(0);
+    Topic<int>::Subscriber subscriber1 = topic.subscribe();
+    Topic<int>::Subscriber subscriber2 = topic.subscribe();
+
+    topic.publish(1, 1us);
+    TEST_ASSERT_TRUE(subscriber1.update());
+    TEST_ASSERT_EQUAL_INT(1, subscriber1.getValue());
+
+    topic.publish(2, 2us);
+    TEST_ASSERT_TRUE(subscriber2.update());
+    TEST_ASSERT_EQUAL_INT(2, subscriber2.getValue());
+    // the first subscriber still reads its last value until it updates
+    TEST_ASSERT_EQUAL_INT(1, subscriber1.getValue());
+    TEST_ASSERT_TRUE(subscriber1.update());
+    TEST_ASSERT_EQUAL_INT(2, subscriber1.getValue());
+
+    return CaseNext;
+}
+
+// test that subscriptions beyond the maximal number of subscribers fail
+static control_t test_subscriber_overflow(const size_t call_count) {
+    static constexpr uint8_t kMaxNbrOfSubscribers = 4;
+    Topic<int, kMaxNbrOfSubscribers> topic(0);
+    for (uint8_t index = 0; index < kMaxNbrOfSubscribers; index++) {
+        TEST_ASSERT_TRUE(topic.subscribe().isValid());
+    }
+    TEST_ASSERT_FALSE(topic.subscribe().isValid());
+    TEST_ASSERT_EQUAL_UINT8(kMaxNbrOfSubscribers, topic.getNbrOfSubscribers());
+
+    // publishing still works with all subscribers registered
+    topic.publish(1, 1us);
+    TEST_ASSERT_EQUAL_UINT32(1, topic.getNbrOfUpdates());
+
+    return CaseNext;
+}
+
+// test that the samples published on the bus are stamped with the bus time
+static control_t test_sample_age(const size_t call_count) {
+    Timer timer;
+    timer.start();
+    RideStateBus rideStateBus(timer);
+    RideStateBus::TemperatureTopic::Subscriber subscriber =
+        rideStateBus.subscribeTemperature();
+
+    rideStateBus.publishTemperature(21.5f);
+    ThisThread::sleep_for(100ms);
+    TEST_ASSERT_TRUE(subscriber.update());
+    TEST_ASSERT_EQUAL_FLOAT(21.5f, subscriber.getValue());
+
+    // allow for 2 msecs offset
+    constexpr uint64_t kDeltaUs = 2000;
+    TEST_ASSERT_UINT64_WITHIN(
+        kDeltaUs, 100000, subscriber.getAge(rideStateBus.getTime()).count());
+
+    return CaseNext;
+}
+
+// producer publishing consistent speed and distance pairs (distance = 2 * speed)
+static constexpr uint32_t kNbrOfPublications = 20000;
+static void producer(Topic<SpeedState>* topic) {
+    for (uint32_t index = 1; index <= kNbrOfPublications; index++) {
+        SpeedState speedState;
+        speedState.speed    = static_cast<float>(index);
+        speedState.distance = 2.0f * speedState.speed;
+        topic->publish(speedState, std::chrono::microseconds(index));
+    }
+}
+
+// test that a consumer never reads a torn sample while a producer publishes
+static control_t test_concurrent_access(const size_t call_count) {
+    static Topic<SpeedState> topic{SpeedState()};
+    Topic<SpeedState>::Subscriber subscriber = topic.subscribe();
+
+    // the producer runs at a lower priority and is preempted by the consumer
+    Thread producerThread(osPriorityBelowNormal);
+    producerThread.start(callback(producer, &topic));
+
+    uint32_t lastSequence = 0;
+    uint32_t nbrOfReads   = 0;
+    while (lastSequence < kNbrOfPublications) {
+        if (subscriber.update()) {
+            const Topic<SpeedState>::Sample& sample = subscriber.getSample();
+            TEST_ASSERT_EQUAL_FLOAT(2.0f * sample.value.speed, sample.value.distance);
+            TEST_ASSERT_EQUAL_INT64(sample.sequence, sample.timestamp.count());
+            TEST_ASSERT_TRUE(sample.sequence > lastSequence);
+            lastSequence = sample.sequence;
+            nbrOfReads++;
+        }
+        ThisThread::yield();
+    }
+    producerThread.join();
+
+    printf("Read %" PRIu32 " samples out of %" PRIu32 " publications\n",
+           nbrOfReads,
+           kNbrOfPublications);
+    TEST_ASSERT_EQUAL_UINT32(kNbrOfPublications, topic.getNbrOfUpdates());
+
+    return CaseNext;
+}
+
+// test that the tasks of a running bike system publish on the bus
+static control_t test_bike_system_publications(const size_t call_count) {
+    // create the BikeSystem instance
+    static_scheduling_with_event::BikeSystem bikeSystem;
+    RideStateBus& rideStateBus = bikeSystem.getRideStateBus();
+    RideStateBus::SpeedTopic::Subscriber speedSubscriber = rideStateBus.subscribeSpeed();
+    RideStateBus::TemperatureTopic::Subscriber temperatureSubscriber =
+        rideStateBus.subscribeTemperature();
+    TEST_ASSERT_TRUE(speedSubscriber.isValid());
+    TEST_ASSERT_TRUE(temperatureSubscriber.isValid());
+    // the gear topic, also read by the tests of the bike system, accepts a telemetry
+    // consumer
+    TEST_ASSERT_TRUE(rideStateBus.subscribeGear().isValid());
+
+    // run the bike system in a separate thread for 5 secs
+    Thread thread;
+    thread.start(callback(&bikeSystem, &static_scheduling_with_event::BikeSystem::start));
+    ThisThread::sleep_for(5s);
+    bikeSystem.stop();
+    thread.join();
+
+    // the temperature task runs at 1.1, 2.7 and 4.3 secs
+    TEST_ASSERT_TRUE(temperatureSubscriber.update());
+    TEST_ASSERT_EQUAL_UINT32(3, temperatureSubscriber.getSample().sequence);
+    // the speed task runs every 400 msecs
+    TEST_ASSERT_TRUE(speedSubscriber.update());
+    TEST_ASSERT_UINT32_WITHIN(1, 13, speedSubscriber.getSample().sequence);
+
+    return CaseNext;
+}
+
+static utest::v1::status_t greentea_setup(const size_t number_of_cases) {
+    // Here, we specify the timeout (60s) and the host test (a built-in host test or the
+    // name of our Python file)
+    GREENTEA_SETUP(60, "default_auto");
+
+    return greentea_test_setup_handler(number_of_cases);
+}
+
+// List of test cases in this file
+static Case cases[] = {
+    Case("test newest value", test_newest_value),
+    Case("test independent subscribers", test_independent_subscribers),
+    Case("test subscriber overflow", test_subscriber_overflow),
+    Case("test sample age", test_sample_age),
+    Case("test concurrent access", test_concurrent_access),
+    Case("test bike system publications", test_bike_system_publications)};
+
+static Specification specification(greentea_setup, cases);
+
+int main() { return !Harness::run(specification); }
@@ -0,0 +1,127 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file main.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Bike computer test suite: comparison of the scheduling and input policies
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include <chrono>
+
+#include "greentea-client/test_env.h"
+#include "mbed.h"
+#include "multi_tasking/bike_system.hpp"
+#include "static_scheduling/bike_system.hpp"
+#include "static_scheduling_with_event/bike_system.hpp"
+#include "task_logger.hpp"
+#include "unity/unity.h"
+#include "utest/utest.h"
+
+using namespace utest::v1;
+
+// duration of each run
+static constexpr std::chrono::milliseconds kRunDuration = 10s;
+
+// run a BikeSystem variant, print its cpu load and check the periods of the tasks
+// common to all variants (identical task code)
+template <typename System>
+static void benchmark(const char* variantName) {
+    // create the BikeSystem instance
+    System bikeSystem;
+
+    mbed_stats_cpu_t startStats;
+    mbed_stats_cpu_get(&startStats);
+
+    // run the bike system in a separate thread
+    Thread thread;
+    thread.start(callback(&bikeSystem, &System::start));
+
+    // let the bike system run
+    ThisThread::sleep_for(kRunDuration);
+
+    // stop the bike system
+    bikeSystem.stop();
+    thread.join();
+
+    mbed_stats_cpu_t endStats;
+    mbed_stats_cpu_get(&endStats);
+    const uint64_t uptime   = endStats.uptime - startStats.uptime;
+    const uint64_t idleTime = endStats.idle_time - startStats.idle_time;
+    const uint64_t cpuLoad  = (uptime == 0) ? 0 : 100 - ((idleTime * 100) / uptime);
+
+    const advembsof::TaskLogger& taskLogger = bikeSystem.getTaskLogger();
+    printf("%-36s cpu load %3" PRIu64 "%%, display1 %7" PRIu64
+           " us (period %7" PRIu64 " us)\n",
+           variantName,
+           cpuLoad,
+           taskLogger.getComputationTime(advembsof::TaskLogger::kDisplayTask1Index)
+               .count(),
+           taskLogger.getPeriod(advembsof::TaskLogger::kDisplayTask1Index).count());
+
+    // allow for 2 msecs offset
+    constexpr uint64_t kDeltaUs                         = 2000;
+    constexpr std::chrono::microseconds kExpectedPeriod = 1600000us;
+    TEST_ASSERT_UINT64_WITHIN(
+        kDeltaUs,
+        kExpectedPeriod.count(),
+        taskLogger.getPeriod(advembsof::TaskLogger::kTemperatureTaskIndex).count());
+    TEST_ASSERT_UINT64_WITHIN(
+        kDeltaUs,
+        kExpectedPeriod.count(),
+        taskLogger.getPeriod(advembsof::TaskLogger::kDisplayTask1Index).count());
+}
+
+static control_t test_super_loop_polling(const size_t call_count) {
+    benchmark<static_scheduling::BikeSystem>("super-loop, polling");
+    return CaseNext;
+}
+
+static control_t test_event_queue_polling(const size_t call_count) {
+    benchmark<static_scheduling::BikeSystemWithEventQueue>("event queue, polling");
+    return CaseNext;
+}
+
+static control_t test_event_queue_interrupt(const size_t call_count) {
+    benchmark<static_scheduling_with_event::BikeSystem>("event queue, interrupt");
+    return CaseNext;
+}
+
+static control_t test_event_queue_event_driven(const size_t call_count) {
+    benchmark<multi_tasking::BikeSystem>("event queue, event-driven");
+    return CaseNext;
+}
+
+static utest::v1::status_t greentea_setup(const size_t number_of_cases) {
+    // Here, we specify the timeout (60s) and the host test (a built-in host test or the
+    // name of our Python file)
+    GREENTEA_SETUP(60, "default_auto");
+
+    return greentea_test_setup_handler(number_of_cases);
+}
+
+// List of test cases in this file
+static Case cases[] = {
+    Case("test super-loop with polling input", test_super_loop_polling),
+    Case("test event queue with polling input", test_event_queue_polling),
+    Case("test event queue with interrupt input", test_event_queue_interrupt),
+    Case("test event queue with event-driven input", test_event_queue_event_driven)};
+
+static Specification specification(greentea_setup, cases);
+
+int main() { return !Harness::run(specification); }
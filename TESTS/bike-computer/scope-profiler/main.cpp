@@ -0,0 +1,214 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file main.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Bike computer test suite: scope profiler
+ *
+ * @date 2026-10-19
+ * @version 0.1.0
+ ***************************************************************************/
+
+#include <chrono>
+
+#include "constants.hpp"
+#include "greentea-client/test_env.h"
+#include "mbed.h"
+#include "scope_profiler.hpp"
+#include "speedometer.hpp"
+#include "unity/unity.h"
+#include "utest/utest.h"
+
+using namespace utest::v1;
+
+using bike_computer::ScopeProfiler;
+
+// busy waits in a profiled zone
+static void busyWait(uint32_t waitTime) {
+    PROFILE_SCOPE("test::busyWait");
+    wait_us(static_cast<int>(waitTime));
+}
+
+// another declaration of the same zone
+static void busyWaitOtherDeclaration(uint32_t waitTime) {
+    PROFILE_SCOPE("test::busyWait");
+    wait_us(static_cast<int>(waitTime));
+}
+
+static void emptyScope() { PROFILE_SCOPE("test::emptyScope"); }
+
+// test that the calls, total, min and max ticks of a zone are accumulated
+static control_t test_zone_statistics(const size_t call_count) {
+    ScopeProfiler& profiler = ScopeProfiler::getInstance();
+    profiler.reset();
+
+    static constexpr uint32_t kWaitTimes[] = {1000, 3000, 2000};
+    for (uint32_t waitTime : kWaitTimes) {
+        busyWait(waitTime);
+    }
+
+    ScopeProfiler::ZoneStats zoneStats;
+    TEST_ASSERT_TRUE(profiler.findZoneStats("test::busyWait", zoneStats));
+    TEST_ASSERT_EQUAL_UINT32(3, zoneStats.nbrOfCalls);
+    // the scope lasts at least the wait time (the thread may be preempted)
+    const uint32_t ticksPerUs = ScopeProfiler::getTicksPerUs();
+    TEST_ASSERT_TRUE(zoneStats.minTicks >= 1000 * ticksPerUs);
+    TEST_ASSERT_TRUE(zoneStats.maxTicks >= 3000 * ticksPerUs);
+    TEST_ASSERT_TRUE(zoneStats.minTicks <= zoneStats.maxTicks);
+    TEST_ASSERT_TRUE(zoneStats.totalTicks >= 6000 * ticksPerUs);
+    TEST_ASSERT_UINT64_WITHIN(6000 * ticksPerUs, 6000 * ticksPerUs, zoneStats.totalTicks);
+    TEST_ASSERT_UINT32_WITHIN(1500 * ticksPerUs, 1000 * ticksPerUs, zoneStats.minTicks);
+
+    // the zones are kept upon reset
+    profiler.reset();
+    TEST_ASSERT_TRUE(profiler.findZoneStats("test::busyWait", zoneStats));
+    TEST_ASSERT_EQUAL_UINT32(0, zoneStats.nbrOfCalls);
+    TEST_ASSERT_EQUAL_UINT32(0, zoneStats.minTicks);
+    TEST_ASSERT_FALSE(profiler.findZoneStats("test::unknown", zoneStats));
+
+    return CaseNext;
+}
+
+// test that zones declared at different places with the same name share an entry
+static control_t test_shared_zone(const size_t call_count) {
+    ScopeProfiler& profiler = ScopeProfiler::getInstance();
+    profiler.reset();
+    const uint8_t nbrOfZones = profiler.getNbrOfZones();
+
+    busyWait(100);
+    busyWaitOtherDeclaration(100);
+
+    ScopeProfiler::ZoneStats zoneStats;
+    TEST_ASSERT_TRUE(profiler.findZoneStats("test::busyWait", zoneStats));
+    TEST_ASSERT_EQUAL_UINT32(2, zoneStats.nbrOfCalls);
+    TEST_ASSERT_EQUAL_UINT8(nbrOfZones, profiler.getNbrOfZones());
+
+    return CaseNext;
+}
+
+// calls made by each caller thread
+static constexpr uint32_t kNbrOfCalls = 20000;
+
+static void callerFunction() {
+    for (uint32_t index = 0; index < kNbrOfCalls; index++) {
+        emptyScope();
+    }
+}
+
+// test that the scopes entered concurrently are all accounted for
+static control_t test_concurrent_scopes(const size_t call_count) {
+    ScopeProfiler& profiler = ScopeProfiler::getInstance();
+    profiler.reset();
+
+    Thread caller1(osPriorityNormal, OS_STACK_SIZE, nullptr, "caller1");
+    Thread caller2(osPriorityNormal, OS_STACK_SIZE, nullptr, "caller2");
+    Thread caller3(osPriorityAboveNormal, OS_STACK_SIZE, nullptr, "caller3");
+    caller1.start(callback(callerFunction));
+    caller2.start(callback(callerFunction));
+    caller3.start(callback(callerFunction));
+    caller1.join();
+    caller2.join();
+    caller3.join();
+
+    ScopeProfiler::ZoneStats zoneStats;
+    TEST_ASSERT_TRUE(profiler.findZoneStats("test::emptyScope", zoneStats));
+    TEST_ASSERT_EQUAL_UINT32(3 * kNbrOfCalls, zoneStats.nbrOfCalls);
+    TEST_ASSERT_TRUE(zoneStats.minTicks <= zoneStats.maxTicks);
+    TEST_ASSERT_TRUE(zoneStats.totalTicks >= zoneStats.maxTicks);
+
+    return CaseNext;
+}
+
+// test that the speedometer computations are profiled and that the profiler commands
+// are recognized
+static control_t test_speedometer_zones(const size_t call_count) {
+    ScopeProfiler& profiler = ScopeProfiler::getInstance();
+    profiler.reset();
+
+    Timer timer;
+    timer.start();
+    bike_computer::Speedometer speedometer(timer);
+    for (uint8_t gearSize = bike_computer::kMinGearSize;
+         gearSize <= bike_computer::kMaxGearSize;
+         gearSize++) {
+        speedometer.setGearSize(gearSize);
+    }
+    speedometer.getDistance();
+
+    ScopeProfiler::ZoneStats zoneStats;
+    TEST_ASSERT_TRUE(profiler.findZoneStats("Speedometer::computeSpeed", zoneStats));
+    TEST_ASSERT_TRUE(zoneStats.nbrOfCalls > 0);
+    TEST_ASSERT_TRUE(profiler.findZoneStats("Speedometer::computeDistance", zoneStats));
+    TEST_ASSERT_TRUE(zoneStats.nbrOfCalls > 0);
+
+    TEST_ASSERT_TRUE(profiler.executeCommand("profile\n"));
+    TEST_ASSERT_FALSE(profiler.executeCommand("tasks\n"));
+    TEST_ASSERT_TRUE(profiler.executeCommand("profile reset\n"));
+    TEST_ASSERT_TRUE(profiler.findZoneStats("Speedometer::computeSpeed", zoneStats));
+    TEST_ASSERT_EQUAL_UINT32(0, zoneStats.nbrOfCalls);
+
+    return CaseNext;
+}
+
+// test that the zones that do not fit in the table are ignored (this case fills the
+// table)
+static control_t test_full_table(const size_t call_count) {
+    ScopeProfiler& profiler = ScopeProfiler::getInstance();
+    static char names[ScopeProfiler::kMaxNbrOfZones][16];
+    const uint8_t nbrOfFreeZones =
+        ScopeProfiler::kMaxNbrOfZones - profiler.getNbrOfZones();
+    for (uint8_t index = 0; index < nbrOfFreeZones; index++) {
+        snprintf(names[index], sizeof(names[index]), "test::zone%u", index);
+        const uint8_t zoneIndex = profiler.registerZone(names[index]);
+        TEST_ASSERT_TRUE(zoneIndex != ScopeProfiler::kInvalidZone);
+    }
+    TEST_ASSERT_EQUAL_UINT8(ScopeProfiler::kMaxNbrOfZones, profiler.getNbrOfZones());
+
+    const uint32_t nbrOfIgnoredZones = profiler.getNbrOfIgnoredZones();
+    TEST_ASSERT_EQUAL_UINT8(ScopeProfiler::kInvalidZone,
+                            profiler.registerZone("test::extraZone"));
+    TEST_ASSERT_EQUAL_UINT32(nbrOfIgnoredZones + 1, profiler.getNbrOfIgnoredZones());
+    // already registered zones can still be found
+    const uint8_t zoneIndex = profiler.registerZone("test::busyWait");
+    TEST_ASSERT_TRUE(zoneIndex != ScopeProfiler::kInvalidZone);
+
+    // recording an ignored zone has no effect
+    profiler.record(ScopeProfiler::kInvalidZone, 100);
+    profiler.print();
+
+    return CaseNext;
+}
+
+static utest::v1::status_t greentea_setup(const size_t number_of_cases) {
+    // Here, we specify the timeout (60s) and the host test (a built-in host test or the
+    // name of our Python file)
+    GREENTEA_SETUP(60, "default_auto");
+
+    return greentea_test_setup_handler(number_of_cases);
+}
+
+// List of test cases in this file
+static Case cases[] = {
+    Case("test zone statistics", test_zone_statistics),
+    Case("test shared zone", test_shared_zone),
+    Case("test concurrent scopes", test_concurrent_scopes),
+    Case("test speedometer zones", test_speedometer_zones),
+    Case("test full table", test_full_table),
+};
+
+static Specification specification(greentea_setup, cases);
+
+int main() { return !Harness::run(specification); }
@@ -18,16 +18,21 @@
  *
  * @brief Bike computer test suite: sensor device
  *
- * @date 2023-08-26
+ * @date 2026-10-19
  * @version 0.1.0
  ***************************************************************************/
 
+#include <chrono>
+
 #include "greentea-client/test_env.h"
 #include "hdc1000.hpp"
 #include "mbed.h"
 #include "sensor_device.hpp"
 #include "unity/unity.h"
 #include "utest/utest.h"
+#if defined(BIKE_COMPUTER_HOST)
+#include "simulated_hdc1000.hpp"
+#endif  // defined(BIKE_COMPUTER_HOST)
 
 using namespace utest::v1;
 
@@ -53,6 +58,154 @@ static control_t test_sensor_device(const size_t call_count) {
     return CaseNext;
 }
 
+// test_split_phase test handler function
+static control_t test_split_phase(const size_t call_count) {
+    bike_computer::SensorDevice sensorDevice;
+    bool rc = sensorDevice.init();
+    TEST_ASSERT_TRUE(rc);
+    const uint32_t nbrOfResults = sensorDevice.getNbrOfResults();
+
+    // starting the conversion does not wait for it
+    Timer timer;
+    timer.start();
+    rc = sensorDevice.startConversion();
+    const std::chrono::microseconds startTime = timer.elapsed_time();
+    TEST_ASSERT_TRUE(rc);
+    static constexpr std::chrono::microseconds kMaxTransferTime = 1000us;
+    TEST_ASSERT_TRUE(startTime < kMaxTransferTime);
+    TEST_ASSERT_FALSE(sensorDevice.isConversionCompleted());
+
+    // the result is not available before the end of the conversion
+    TEST_ASSERT_FALSE(sensorDevice.fetchResult());
+    TEST_ASSERT_EQUAL_UINT32(nbrOfResults, sensorDevice.getNbrOfResults());
+
+    // the timeout signals the end of the conversion and the result is then fetched
+    ThisThread::sleep_for(bike_computer::SensorDevice::kConversionTime + 5ms);
+    TEST_ASSERT_TRUE(sensorDevice.isConversionCompleted());
+    timer.reset();
+    rc = sensorDevice.fetchResult();
+    const std::chrono::microseconds fetchTime = timer.elapsed_time();
+    TEST_ASSERT_TRUE(rc);
+    TEST_ASSERT_TRUE(fetchTime < kMaxTransferTime);
+    TEST_ASSERT_EQUAL_UINT32(nbrOfResults + 1, sensorDevice.getNbrOfResults());
+
+    static constexpr float kTemperatureRange = 20.0f;
+    static constexpr float kMeanTemperature  = 15.0f;
+    TEST_ASSERT_FLOAT_WITHIN(
+        kTemperatureRange, kMeanTemperature, sensorDevice.getTemperature());
+    static constexpr float kHumidityRange = 40.0f;
+    static constexpr float kMeanHumidity  = 50.0f;
+    TEST_ASSERT_FLOAT_WITHIN(kHumidityRange, kMeanHumidity, sensorDevice.getHumidity());
+
+    // a result is fetched only once
+    TEST_ASSERT_FALSE(sensorDevice.fetchResult());
+
+    return CaseNext;
+}
+
+// test_result_cache test handler function
+static control_t test_result_cache(const size_t call_count) {
+    bike_computer::SensorDevice sensorDevice;
+    bool rc = sensorDevice.init();
+    TEST_ASSERT_TRUE(rc);
+    static constexpr std::chrono::milliseconds kTimeToLive = 500ms;
+    sensorDevice.setTimeToLive(kTimeToLive);
+    const uint32_t nbrOfResults         = sensorDevice.getNbrOfResults();
+    const uint32_t nbrOfBusTransactions = sensorDevice.getNbrOfBusTransactions();
+    const uint32_t nbrOfCacheHits       = sensorDevice.getNbrOfCacheHits();
+
+    // fresh values are served from the cache, both values of a single acquisition
+    const bike_computer::SensorDevice::Measurement measurement =
+        sensorDevice.getMeasurement();
+    TEST_ASSERT_EQUAL_FLOAT(measurement.temperature, sensorDevice.readTemperature());
+    TEST_ASSERT_EQUAL_FLOAT(measurement.humidity, sensorDevice.readHumidity());
+    TEST_ASSERT_EQUAL_UINT32(nbrOfResults, sensorDevice.getNbrOfResults());
+    TEST_ASSERT_EQUAL_UINT32(nbrOfBusTransactions,
+                             sensorDevice.getNbrOfBusTransactions());
+    TEST_ASSERT_EQUAL_UINT32(nbrOfCacheHits + 3, sensorDevice.getNbrOfCacheHits());
+
+    // stale values are acquired again: one trigger and one result read
+    ThisThread::sleep_for(kTimeToLive + 100ms);
+    TEST_ASSERT_TRUE(sensorDevice.getAge() > kTimeToLive);
+    sensorDevice.readHumidity();
+    TEST_ASSERT_EQUAL_UINT32(nbrOfResults + 1, sensorDevice.getNbrOfResults());
+    TEST_ASSERT_EQUAL_UINT32(nbrOfBusTransactions + 2,
+                             sensorDevice.getNbrOfBusTransactions());
+    TEST_ASSERT_TRUE(sensorDevice.getAge() < kTimeToLive);
+    TEST_ASSERT_TRUE(sensorDevice.getNbrOfBusTransactionsPerMinute() > 0);
+
+    return CaseNext;
+}
+
+static void acquire(bike_computer::SensorDevice* sensorDevice) {
+    sensorDevice->getMeasurement();
+}
+
+// test_shared_acquisition test handler function
+static control_t test_shared_acquisition(const size_t call_count) {
+    bike_computer::SensorDevice sensorDevice;
+    bool rc = sensorDevice.init();
+    TEST_ASSERT_TRUE(rc);
+    static constexpr std::chrono::milliseconds kTimeToLive = 100ms;
+    sensorDevice.setTimeToLive(kTimeToLive);
+    ThisThread::sleep_for(kTimeToLive + 50ms);
+    const uint32_t nbrOfResults = sensorDevice.getNbrOfResults();
+
+    // two consumers reading stale values at the same time share one acquisition
+    Thread thread;
+    thread.start(callback(acquire, &sensorDevice));
+    acquire(&sensorDevice);
+    thread.join();
+    TEST_ASSERT_EQUAL_UINT32(nbrOfResults + 1, sensorDevice.getNbrOfResults());
+
+    return CaseNext;
+}
+
+#if defined(BIKE_COMPUTER_HOST)
+// test_slow_conversion test handler function (simulated sensor only)
+static control_t test_slow_conversion(const size_t call_count) {
+    host::SimulatedHDC1000& simulatedHDC1000 = host::SimulatedHDC1000::getInstance();
+    simulatedHDC1000.setTemperature(31.5f);
+    simulatedHDC1000.setHumidity(62.0f);
+
+    bike_computer::SensorDevice sensorDevice;
+    bool rc = sensorDevice.init();
+    TEST_ASSERT_TRUE(rc);
+    // 14 bit resolution
+    static constexpr float kTemperatureResolution = 0.02f;
+    static constexpr float kHumidityResolution    = 0.01f;
+    TEST_ASSERT_FLOAT_WITHIN(
+        kTemperatureResolution, 31.5f, sensorDevice.getTemperature());
+    TEST_ASSERT_FLOAT_WITHIN(kHumidityResolution, 62.0f, sensorDevice.getHumidity());
+
+    // the conversion lasts longer than the timeout: the result is fetched once
+    // the sensor acknowledges the read, the cached values being kept until then
+    static constexpr std::chrono::milliseconds kSlowConversionTime = 20ms;
+    simulatedHDC1000.setConversionTime(kSlowConversionTime);
+    simulatedHDC1000.setTemperature(18.0f);
+    rc = sensorDevice.startConversion();
+    TEST_ASSERT_TRUE(rc);
+    ThisThread::sleep_for(bike_computer::SensorDevice::kConversionTime + 5ms);
+    TEST_ASSERT_TRUE(sensorDevice.isConversionCompleted());
+    TEST_ASSERT_FALSE(sensorDevice.fetchResult());
+    TEST_ASSERT_FLOAT_WITHIN(
+        kTemperatureResolution, 31.5f, sensorDevice.getTemperature());
+    // an acquisition measures both values in sequence
+    ThisThread::sleep_for(2 * kSlowConversionTime -
+                          bike_computer::SensorDevice::kConversionTime);
+    TEST_ASSERT_TRUE(sensorDevice.fetchResult());
+    TEST_ASSERT_FLOAT_WITHIN(
+        kTemperatureResolution, 18.0f, sensorDevice.getTemperature());
+
+    // restore the default simulated sensor
+    simulatedHDC1000.setConversionTime(host::SimulatedHDC1000::kDefaultConversionTime);
+    simulatedHDC1000.setTemperature(22.0f);
+    simulatedHDC1000.setHumidity(45.0f);
+
+    return CaseNext;
+}
+#endif  // defined(BIKE_COMPUTER_HOST)
+
 static utest::v1::status_t greentea_setup(const size_t number_of_cases) {
     // Here, we specify the timeout (60s) and the host test (a built-in host test or the
     // name of our Python file)
@@ -62,7 +215,15 @@ static utest::v1::status_t greentea_setup(const size_t number_of_cases) {
 }
 
 // List of test cases in this file
-static Case cases[] = {Case("test sensor device", test_sensor_device)};
+static Case cases[] = {
+    Case("test sensor device", test_sensor_device),
+    Case("test split-phase acquisition", test_split_phase),
+    Case("test result cache", test_result_cache),
+    Case("test shared acquisition", test_shared_acquisition),
+#if defined(BIKE_COMPUTER_HOST)
+    Case("test slow conversion", test_slow_conversion),
+#endif  // defined(BIKE_COMPUTER_HOST)
+};
 
 static Specification specification(greentea_setup, cases);
 
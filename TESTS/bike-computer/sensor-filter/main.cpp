@@ -0,0 +1,192 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file main.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Bike computer test suite: sensor filtering pipeline
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include <chrono>
+
+#include "greentea-client/test_env.h"
+#include "mbed.h"
+#include "sensor_filter.hpp"
+#include "unity/unity.h"
+#include "utest/utest.h"
+
+using namespace utest::v1;
+
+using bike_computer::IirFilter;
+using bike_computer::MedianFilter;
+using bike_computer::SensorPipeline;
+
+// test that the IIR filter follows a step without truncation bias
+static control_t test_iir_step(const size_t call_count) {
+    IirFilter<2> filter;
+    filter.reset(0);
+
+    // the floating point reference of y[n] = y[n-1] + (x[n] - y[n-1]) / 4
+    float reference                  = 0.0f;
+    static constexpr int32_t kStep   = 1000;
+    static constexpr int kNbrOfSteps = 40;
+    int32_t output                   = 0;
+    for (int step = 0; step < kNbrOfSteps; step++) {
+        output = filter.filter(kStep);
+        reference += (kStep - reference) / 4.0f;
+        TEST_ASSERT_INT_WITHIN(1, static_cast<int32_t>(reference + 0.5f), output);
+    }
+    // the step is reached exactly
+    TEST_ASSERT_EQUAL_INT(kStep, output);
+
+    return CaseNext;
+}
+
+// test that the IIR filter attenuates the noise of the samples
+static control_t test_iir_noise(const size_t call_count) {
+    IirFilter<3> filter;
+    static constexpr int32_t kMean  = 2250;
+    static constexpr int32_t kNoise = 10;
+    filter.reset(kMean);
+    for (int sample = 0; sample < 100; sample++) {
+        const int32_t noisySample = (sample % 2 == 0) ? kMean + kNoise : kMean - kNoise;
+        const int32_t output      = filter.filter(noisySample);
+        TEST_ASSERT_INT_WITHIN(kNoise / 4, kMean, output);
+    }
+
+    return CaseNext;
+}
+
+// test that the median filter removes outliers and follows steps
+static control_t test_median(const size_t call_count) {
+    MedianFilter<5> filter;
+    filter.reset(100);
+
+    // isolated outliers are removed
+    TEST_ASSERT_EQUAL_INT(100, filter.filter(5000));
+    TEST_ASSERT_EQUAL_INT(100, filter.filter(-3000));
+
+    // a step is followed once it fills half of the window
+    filter.reset(100);
+    TEST_ASSERT_EQUAL_INT(100, filter.filter(200));
+    TEST_ASSERT_EQUAL_INT(100, filter.filter(200));
+    TEST_ASSERT_EQUAL_INT(200, filter.filter(200));
+
+    // windows larger than 128 samples are sorted (decreasing samples are moved
+    // across the whole sorted copy)
+    static MedianFilter<255> largeFilter;
+    largeFilter.reset(0);
+    for (int32_t sample = -1; sample > -128; sample--) {
+        TEST_ASSERT_EQUAL_INT(0, largeFilter.filter(sample));
+    }
+    TEST_ASSERT_EQUAL_INT(-1, largeFilter.filter(-128));
+
+    return CaseNext;
+}
+
+// test the decimation of the oversampled samples
+static control_t test_decimation(const size_t call_count) {
+    SensorPipeline<IirFilter<1>, 8> pipeline(4);
+    TEST_ASSERT_EQUAL_UINT8(4, pipeline.getOversamplingRatio());
+
+    // the first output is the rounded average of the first samples
+    TEST_ASSERT_FALSE(pipeline.push(10));
+    TEST_ASSERT_FALSE(pipeline.push(11));
+    TEST_ASSERT_FALSE(pipeline.push(11));
+    TEST_ASSERT_TRUE(pipeline.push(11));
+    TEST_ASSERT_EQUAL_INT(11, pipeline.getOutput());
+
+    // the next outputs are filtered
+    for (int sample = 0; sample < 4; sample++) {
+        pipeline.push(31);
+    }
+    TEST_ASSERT_EQUAL_INT(21, pipeline.getOutput());
+    TEST_ASSERT_EQUAL_UINT32(8, pipeline.getNbrOfInputs());
+    TEST_ASSERT_EQUAL_UINT32(2, pipeline.getNbrOfOutputs());
+
+    // the ratio is limited to the preallocated range
+    TEST_ASSERT_FALSE(pipeline.setOversamplingRatio(0));
+    TEST_ASSERT_FALSE(pipeline.setOversamplingRatio(9));
+    TEST_ASSERT_EQUAL_UINT8(4, pipeline.getOversamplingRatio());
+    TEST_ASSERT_TRUE(pipeline.setOversamplingRatio(1));
+    TEST_ASSERT_TRUE(pipeline.push(-11));
+    TEST_ASSERT_EQUAL_INT(5, pipeline.getOutput());
+
+    return CaseNext;
+}
+
+// measure and report the cost per sample of the pipeline stages
+template <typename Pipeline>
+static std::chrono::nanoseconds measureCostPerSample(Pipeline& pipeline) {
+    static constexpr int kNbrOfSamples = 10000;
+    // all outputs are used, so that the pipeline is not optimized away
+    int32_t sum = 0;
+    Timer timer;
+    timer.start();
+    for (int sample = 0; sample < kNbrOfSamples; sample++) {
+        if (pipeline.push(2200 + (sample % 7) - 3)) {
+            sum += pipeline.getOutput() - 2200;
+        }
+    }
+    timer.stop();
+    TEST_ASSERT_INT_WITHIN(3 * kNbrOfSamples, 0, sum);
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(timer.elapsed_time()) /
+           kNbrOfSamples;
+}
+
+static control_t test_cost_per_sample(const size_t call_count) {
+    SensorPipeline<IirFilter<2>, 16> iirPipeline(1);
+    SensorPipeline<MedianFilter<5>, 16> medianPipeline(1);
+    SensorPipeline<IirFilter<2>, 16> oversamplingPipeline(16);
+    const std::chrono::nanoseconds iirCost    = measureCostPerSample(iirPipeline);
+    const std::chrono::nanoseconds medianCost = measureCostPerSample(medianPipeline);
+    const std::chrono::nanoseconds oversamplingCost =
+        measureCostPerSample(oversamplingPipeline);
+    printf("Cost per sample: IIR %lld ns, median %lld ns, oversampled IIR %lld ns\n",
+           static_cast<long long>(iirCost.count()),
+           static_cast<long long>(medianCost.count()),
+           static_cast<long long>(oversamplingCost.count()));
+
+    // filtering must be negligible compared to an acquisition
+    static constexpr std::chrono::nanoseconds kMaxCostPerSample = 5000ns;
+    TEST_ASSERT_TRUE(iirCost < kMaxCostPerSample);
+    TEST_ASSERT_TRUE(medianCost < kMaxCostPerSample);
+    TEST_ASSERT_TRUE(oversamplingCost < kMaxCostPerSample);
+
+    return CaseNext;
+}
+
+static utest::v1::status_t greentea_setup(const size_t number_of_cases) {
+    // Here, we specify the timeout (60s) and the host test (a built-in host test or the
+    // name of our Python file)
+    GREENTEA_SETUP(60, "default_auto");
+
+    return greentea_test_setup_handler(number_of_cases);
+}
+
+// List of test cases in this file
+static Case cases[] = {
+    Case("test IIR filter step", test_iir_step),
+    Case("test IIR filter noise", test_iir_noise),
+    Case("test median filter", test_median),
+    Case("test decimation", test_decimation),
+    Case("test cost per sample", test_cost_per_sample)};
+
+static Specification specification(greentea_setup, cases);
+
+int main() { return !Harness::run(specification); }
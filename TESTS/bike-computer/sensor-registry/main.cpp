@@ -0,0 +1,275 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/****************************************************************************
+ * @file main.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Bike computer test suite: sensor registry and polling scheduler
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include <chrono>
+#include <cstdio>
+
+#include "greentea-client/test_env.h"
+#include "mbed.h"
+#include "polling_scheduler.hpp"
+#include "sensor_registry.hpp"
+#include "simulated_sensor.hpp"
+#include "unity/unity.h"
+#include "utest/utest.h"
+
+using namespace utest::v1;
+
+using bike_computer::PollingScheduler;
+using bike_computer::SensorRegistry;
+using bike_computer::SimulatedSensor;
+using bike_computer::SimulatedSensorBus;
+
+static constexpr std::chrono::microseconds kTransactionTime = 20us;
+static constexpr std::chrono::milliseconds kFramePeriod     = 10ms;
+
+// load-test configuration: 60 sensors on 4 buses
+static constexpr uint8_t kNbrOfBuses                        = 4;
+static constexpr uint8_t kNbrOfKinds                        = 4;
+static constexpr uint8_t kNbrOfSensorsPerKind[kNbrOfKinds]  = {12, 12, 18, 18};
+static constexpr uint8_t kNbrOfSensors                      = 60;
+static constexpr SimulatedSensor::Kind kKinds[kNbrOfKinds] = {
+    SimulatedSensor::Kind::Cadence,
+    SimulatedSensor::Kind::HeartRate,
+    SimulatedSensor::Kind::Barometer,
+    SimulatedSensor::Kind::Battery};
+static constexpr std::chrono::milliseconds kSamplingPeriods[kNbrOfKinds] = {
+    10ms, 50ms, 100ms, 600ms};
+
+// simulated sensors of the load test, spread over the buses
+class SensorFarm {
+   public:
+    SensorFarm() {
+        for (uint8_t busIndex = 0; busIndex < kNbrOfBuses; busIndex++) {
+            _buses[busIndex] = new SimulatedSensorBus(kTransactionTime);
+        }
+        uint8_t index = 0;
+        for (uint8_t kind = 0; kind < kNbrOfKinds; kind++) {
+            for (uint8_t count = 0; count < kNbrOfSensorsPerKind[kind]; count++) {
+                snprintf(_names[index], kNameSize, "sensor-%d-%d", kind, count);
+                _sensors[index] = new SimulatedSensor(_names[index],
+                                                      kKinds[kind],
+                                                      *_buses[index % kNbrOfBuses],
+                                                      kSamplingPeriods[kind]);
+                index++;
+            }
+        }
+    }
+    ~SensorFarm() {
+        for (uint8_t index = 0; index < kNbrOfSensors; index++) {
+            delete _sensors[index];
+        }
+        for (uint8_t busIndex = 0; busIndex < kNbrOfBuses; busIndex++) {
+            delete _buses[busIndex];
+        }
+    }
+
+    // make the class non copyable
+    SensorFarm(SensorFarm&)            = delete;
+    SensorFarm& operator=(SensorFarm&) = delete;
+
+    SimulatedSensor& getSensor(uint8_t index) { return *_sensors[index]; }
+    SimulatedSensorBus& getBus(uint8_t busIndex) { return *_buses[busIndex]; }
+
+   private:
+    static constexpr uint8_t kNameSize = 16;
+
+    SimulatedSensorBus* _buses[kNbrOfBuses]   = {nullptr};
+    SimulatedSensor* _sensors[kNbrOfSensors] = {nullptr};
+    char _names[kNbrOfSensors][kNameSize]    = {{0}};
+};
+
+// test that the registry finds the sensors by name and rejects duplicates
+static control_t test_registry(const size_t call_count) {
+    SimulatedSensorBus bus(kTransactionTime);
+    SimulatedSensor cadence("cadence", SimulatedSensor::Kind::Cadence, bus, 100ms);
+    SimulatedSensor heartRate("heart-rate", SimulatedSensor::Kind::HeartRate, bus, 1s);
+    SimulatedSensor duplicate("cadence", SimulatedSensor::Kind::Cadence, bus, 100ms);
+
+    SensorRegistry registry;
+    TEST_ASSERT_TRUE(registry.add(cadence));
+    TEST_ASSERT_TRUE(registry.add(heartRate));
+    TEST_ASSERT_FALSE(registry.add(duplicate));
+    TEST_ASSERT_EQUAL_UINT8(2, registry.getNbrOfSensors());
+
+    TEST_ASSERT_TRUE(registry.find("cadence") == &cadence);
+    TEST_ASSERT_TRUE(registry.find("heart-rate") == &heartRate);
+    TEST_ASSERT_TRUE(registry.find("barometer") == nullptr);
+    TEST_ASSERT_EQUAL_UINT8(2, registry.initAll());
+
+    return CaseNext;
+}
+
+// test that a sample is only available once its conversion time has elapsed
+static control_t test_asynchronous_sample(const size_t call_count) {
+    SimulatedSensorBus bus(kTransactionTime);
+    SimulatedSensor barometer("barometer", SimulatedSensor::Kind::Barometer, bus, 1s);
+
+    float value = 0.0f;
+    bus.lock();
+    TEST_ASSERT_FALSE(barometer.fetchSample(value));
+    TEST_ASSERT_TRUE(barometer.startSample());
+    TEST_ASSERT_FALSE(barometer.fetchSample(value));
+    bus.unlock();
+    TEST_ASSERT_EQUAL_UINT32(1, barometer.getNbrOfEarlyFetches());
+
+    ThisThread::sleep_for(
+        std::chrono::duration_cast<std::chrono::milliseconds>(
+            barometer.getConversionTime()) +
+        1ms);
+    bus.lock();
+    TEST_ASSERT_TRUE(barometer.fetchSample(value));
+    bus.unlock();
+    TEST_ASSERT_FLOAT_WITHIN(2.0f, 950.0f, value);
+    TEST_ASSERT_EQUAL_UINT32(4, bus.getNbrOfTransactions());
+    TEST_ASSERT_EQUAL_UINT32(2, bus.getNbrOfBatches());
+
+    return CaseNext;
+}
+
+// test that the plan spreads the samples of 60 sensors across the frames
+static control_t test_planned_spreading(const size_t call_count) {
+    SensorFarm farm;
+    SensorRegistry registry;
+    for (uint8_t index = 0; index < kNbrOfSensors; index++) {
+        TEST_ASSERT_TRUE(registry.add(farm.getSensor(index)));
+    }
+    PollingScheduler scheduler(registry, kFramePeriod);
+    TEST_ASSERT_TRUE(scheduler.plan());
+
+    // all sensors of a kind would be sampled in the same frame with null phases (60
+    // samples in the first frame): with spreading, each frame starts the sensors
+    // sampled at every frame plus 12/5 + 18/10 + 18/60 samples
+    printf("Planned max load: %d samples per frame\n", scheduler.getPlannedMaxLoad());
+    TEST_ASSERT_TRUE(scheduler.getPlannedMaxLoad() <= 17);
+
+    uint8_t index = 0;
+    for (uint8_t kind = 0; kind < kNbrOfKinds; kind++) {
+        for (uint8_t count = 0; count < kNbrOfSensorsPerKind[kind]; count++) {
+            const uint16_t periodInFrames = scheduler.getPeriodInFrames(index);
+            TEST_ASSERT_EQUAL_INT(kSamplingPeriods[kind] / kFramePeriod, periodInFrames);
+            TEST_ASSERT_TRUE(scheduler.getPhase(index) < periodInFrames);
+            index++;
+        }
+    }
+
+    return CaseNext;
+}
+
+// test that the periods too long to be planned are saturated
+static control_t test_long_period(const size_t call_count) {
+    SimulatedSensorBus bus(kTransactionTime);
+    // 65536 frames would be truncated to a null period
+    SimulatedSensor battery(
+        "battery", SimulatedSensor::Kind::Battery, bus, 65536 * kFramePeriod);
+    SimulatedSensor cadence("cadence", SimulatedSensor::Kind::Cadence, bus, kFramePeriod);
+
+    SensorRegistry registry;
+    TEST_ASSERT_TRUE(registry.add(battery));
+    TEST_ASSERT_TRUE(registry.add(cadence));
+    PollingScheduler scheduler(registry, kFramePeriod);
+    TEST_ASSERT_TRUE(scheduler.plan());
+    TEST_ASSERT_EQUAL_UINT16(UINT16_MAX, scheduler.getPeriodInFrames(0));
+    TEST_ASSERT_TRUE(scheduler.getPhase(0) < UINT16_MAX);
+    TEST_ASSERT_EQUAL_UINT16(1, scheduler.getPeriodInFrames(1));
+
+    // the frames are polled without dividing by a null period
+    scheduler.poll(0us);
+    scheduler.poll(std::chrono::microseconds(kFramePeriod));
+
+    return CaseNext;
+}
+
+// test the polling of 60 sensors in real time: one batch per bus and per frame at
+// most, all samples fetched before the next one is due
+static control_t test_batched_polling(const size_t call_count) {
+    SensorFarm farm;
+    SensorRegistry registry;
+    for (uint8_t index = 0; index < kNbrOfSensors; index++) {
+        TEST_ASSERT_TRUE(registry.add(farm.getSensor(index)));
+    }
+    TEST_ASSERT_EQUAL_UINT8(kNbrOfSensors, registry.initAll());
+    PollingScheduler scheduler(registry, kFramePeriod);
+    TEST_ASSERT_TRUE(scheduler.plan());
+
+    static constexpr uint32_t kNbrOfFrames = 121;
+    Timer timer;
+    timer.start();
+    for (uint32_t frame = 0; frame < kNbrOfFrames; frame++) {
+        scheduler.poll(timer.elapsed_time());
+        ThisThread::sleep_for(kFramePeriod);
+    }
+    scheduler.printStats();
+
+    TEST_ASSERT_EQUAL_UINT32(kNbrOfFrames, scheduler.getNbrOfFrames());
+    TEST_ASSERT_EQUAL_UINT32(0, scheduler.getNbrOfOverruns());
+    TEST_ASSERT_TRUE(scheduler.getNbrOfBatches() <= kNbrOfFrames * kNbrOfBuses);
+    TEST_ASSERT_TRUE(scheduler.getMaxNbrOfStartsPerFrame() <=
+                     scheduler.getPlannedMaxLoad());
+
+    // each sensor is sampled at its period (the last sample may still be pending)
+    uint8_t index = 0;
+    for (uint8_t kind = 0; kind < kNbrOfKinds; kind++) {
+        const uint32_t periodInFrames = kSamplingPeriods[kind] / kFramePeriod;
+        for (uint8_t count = 0; count < kNbrOfSensorsPerKind[kind]; count++) {
+            SimulatedSensor& sensor = farm.getSensor(index);
+            const uint32_t nbrOfStarts =
+                (kNbrOfFrames - 1 - scheduler.getPhase(index)) / periodInFrames + 1;
+            TEST_ASSERT_UINT32_WITHIN(1, nbrOfStarts, sensor.getNbrOfSamples());
+            TEST_ASSERT_EQUAL_UINT32(0, sensor.getNbrOfEarlyFetches());
+            index++;
+        }
+    }
+    TEST_ASSERT_FLOAT_WITHIN(5.0f, 80.0f, farm.getSensor(0).getValue());
+
+    // the transactions of a bus in a frame are batched: each batch runs the
+    // transactions of several sensors
+    for (uint8_t busIndex = 0; busIndex < kNbrOfBuses; busIndex++) {
+        SimulatedSensorBus& bus = farm.getBus(busIndex);
+        TEST_ASSERT_TRUE(bus.getNbrOfBatches() <= kNbrOfFrames);
+        TEST_ASSERT_TRUE(bus.getMaxNbrOfTransactionsPerBatch() > 1);
+    }
+
+    return CaseNext;
+}
+
+static utest::v1::status_t greentea_setup(const size_t number_of_cases) {
+    // Here, we specify the timeout (60s) and the host test (a built-in host test or the
+    // name of our Python file)
+    GREENTEA_SETUP(60, "default_auto");
+
+    return greentea_test_setup_handler(number_of_cases);
+}
+
+// List of test cases in this file
+static Case cases[] = {
+    Case("test registry", test_registry),
+    Case("test asynchronous sample", test_asynchronous_sample),
+    Case("test planned spreading", test_planned_spreading),
+    Case("test long period", test_long_period),
+    Case("test batched polling", test_batched_polling)};
+
+static Specification specification(greentea_setup, cases);
+
+int main() { return !Harness::run(specification); }
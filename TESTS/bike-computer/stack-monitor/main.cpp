@@ -0,0 +1,215 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/****************************************************************************
+ * @file main.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Bike computer test suite: per-thread stack high-water marks
+ *
+ * @date 2026-10-19
+ * @version 0.1.0
+ ***************************************************************************/
+
+#include <chrono>
+
+#include "greentea-client/test_env.h"
+#include "mbed.h"
+#include "multi_tasking/bike_system.hpp"
+#include "stack_monitor.hpp"
+#include "unity/unity.h"
+#include "utest/utest.h"
+
+using namespace utest::v1;
+
+using bike_computer::StackMonitor;
+
+static constexpr uint8_t kMarginPercent = 25;
+
+// the thread uses its stack on request, then waits for the stack to be sampled
+static Semaphore gUseRequest(0);
+static Semaphore gUseDone(0);
+static volatile size_t gUseSize = 0;
+
+static volatile uint32_t gChecksum = 0;
+
+template <size_t kSize>
+MBED_NOINLINE static void useStack() {
+    volatile uint8_t buffer[kSize];
+    for (size_t index = 0; index < kSize; index++) {
+        buffer[index] = static_cast<uint8_t>(index);
+    }
+    // read back to prevent the buffer from being optimized away
+    gChecksum = buffer[kSize - 1];
+}
+
+static void stackUserThreadFunction() {
+    while (true) {
+        gUseRequest.acquire();
+        const size_t useSize = gUseSize;
+        if (useSize == 1024) {
+            useStack<1024>();
+        } else if (useSize == 2048) {
+            useStack<2048>();
+        } else if (useSize == 3072) {
+            useStack<3072>();
+        } else {
+            gUseDone.release();
+            return;
+        }
+        gUseDone.release();
+    }
+}
+
+static void requestStackUse(size_t useSize) {
+    gUseSize = useSize;
+    gUseRequest.release();
+    gUseDone.acquire();
+}
+
+// test that the recommended sizes include the margin and are aligned
+static control_t test_recommended_size(const size_t call_count) {
+    TEST_ASSERT_EQUAL_UINT32(0, StackMonitor::getRecommendedSize(0, kMarginPercent));
+    TEST_ASSERT_EQUAL_UINT32(1280,
+                             StackMonitor::getRecommendedSize(1024, kMarginPercent));
+    // 1000 bytes + 250 bytes, rounded up to 1256 bytes
+    TEST_ASSERT_EQUAL_UINT32(1256,
+                             StackMonitor::getRecommendedSize(1000, kMarginPercent));
+    // the margin is rounded up
+    TEST_ASSERT_EQUAL_UINT32(16, StackMonitor::getRecommendedSize(9, 1));
+    TEST_ASSERT_EQUAL_UINT32(1024, StackMonitor::getRecommendedSize(1024, 0));
+
+    return CaseNext;
+}
+
+// test that the high-water mark of a thread follows its deepest stack use
+static control_t test_high_water_mark(const size_t call_count) {
+    StackMonitor stackMonitor(kMarginPercent);
+
+    Thread stackUserThread(osPriorityNormal, OS_STACK_SIZE, nullptr, "stackUser");
+    stackUserThread.start(callback(stackUserThreadFunction));
+    requestStackUse(1024);
+    stackMonitor.sample();
+    const StackMonitor::ThreadStack* threadStack =
+        stackMonitor.findThreadStack("stackUser");
+    TEST_ASSERT_TRUE(threadStack != nullptr);
+    TEST_ASSERT_TRUE(stackMonitor.findThreadStack("unknown") == nullptr);
+    TEST_ASSERT_EQUAL_UINT32(OS_STACK_SIZE, threadStack->stackSize);
+    TEST_ASSERT_TRUE(threadStack->usedSize >= 1024);
+    TEST_ASSERT_TRUE(threadStack->usedSize < OS_STACK_SIZE);
+    const uint32_t usedSize = threadStack->usedSize;
+    TEST_ASSERT_EQUAL_UINT32(
+        StackMonitor::getRecommendedSize(threadStack->usedSize, kMarginPercent),
+        threadStack->recommendedSize);
+
+    // the high-water mark does not decrease with shallower uses
+    requestStackUse(1024);
+    stackMonitor.sample();
+    threadStack = stackMonitor.findThreadStack("stackUser");
+    TEST_ASSERT_TRUE(threadStack != nullptr);
+    TEST_ASSERT_EQUAL_UINT32(usedSize, threadStack->usedSize);
+
+    requestStackUse(2048);
+    stackMonitor.sample();
+    stackMonitor.printStats();
+    threadStack = stackMonitor.findThreadStack("stackUser");
+    TEST_ASSERT_TRUE(threadStack != nullptr);
+    TEST_ASSERT_TRUE(threadStack->usedSize >= 2048);
+    TEST_ASSERT_TRUE(threadStack->usedSize >= usedSize);
+
+    // terminated threads are removed from the table
+    requestStackUse(0);
+    stackUserThread.join();
+    stackMonitor.sample();
+    TEST_ASSERT_TRUE(stackMonitor.findThreadStack("stackUser") == nullptr);
+    TEST_ASSERT_EQUAL_UINT32(4, stackMonitor.getNbrOfSamples());
+    TEST_ASSERT_EQUAL_UINT32(0, stackMonitor.getNbrOfIgnoredThreads());
+
+    return CaseNext;
+}
+
+// test that the warning is raised once for a thread whose stack is too small for its
+// high-water mark with the margin
+static control_t test_stack_warning(const size_t call_count) {
+    // 3072 bytes with a margin of 50% do not fit in the default stack size
+    StackMonitor stackMonitor(50);
+
+    Thread stackUserThread(osPriorityNormal, OS_STACK_SIZE, nullptr, "stackUser");
+    stackUserThread.start(callback(stackUserThreadFunction));
+    requestStackUse(3072);
+    stackMonitor.sample();
+    stackMonitor.sample();
+    stackMonitor.printStats();
+    const StackMonitor::ThreadStack* threadStack =
+        stackMonitor.findThreadStack("stackUser");
+    TEST_ASSERT_TRUE(threadStack != nullptr);
+    TEST_ASSERT_TRUE(threadStack->usedSize >= 3072);
+    TEST_ASSERT_TRUE(threadStack->recommendedSize > threadStack->stackSize);
+    TEST_ASSERT_TRUE(stackMonitor.isWarningRaised());
+    TEST_ASSERT_EQUAL_UINT32(1, stackMonitor.getNbrOfWarnings());
+
+    requestStackUse(0);
+    stackUserThread.join();
+
+    return CaseNext;
+}
+
+// test that the threads of the multi-tasking bike system are monitored
+static control_t test_bike_system_stacks(const size_t call_count) {
+    multi_tasking::BikeSystem bikeSystem;
+
+    Thread thread(osPriorityNormal, OS_STACK_SIZE, nullptr, "bikeSystem");
+    thread.start(callback(&bikeSystem, &multi_tasking::BikeSystem::start));
+    // the stacks are sampled at the end of each major cycle (1600 ms)
+    ThisThread::sleep_for(4s);
+    bikeSystem.stop();
+    thread.join();
+
+    const StackMonitor& stackMonitor = bikeSystem.getStackMonitor();
+    stackMonitor.printStats();
+    TEST_ASSERT_TRUE(stackMonitor.getNbrOfSamples() >= 2);
+    TEST_ASSERT_EQUAL_UINT32(0, stackMonitor.getNbrOfIgnoredThreads());
+    static constexpr const char* kThreadNames[] = {
+        "bikeSystem", "DisplayRenderer", "deferredISRThread"};
+    for (const char* threadName : kThreadNames) {
+        const StackMonitor::ThreadStack* threadStack =
+            stackMonitor.findThreadStack(threadName);
+        TEST_ASSERT_TRUE(threadStack != nullptr);
+        TEST_ASSERT_TRUE(threadStack->usedSize > 0);
+        TEST_ASSERT_TRUE(threadStack->recommendedSize > threadStack->usedSize);
+    }
+
+    return CaseNext;
+}
+
+static utest::v1::status_t greentea_setup(const size_t number_of_cases) {
+    // Here, we specify the timeout (60s) and the host test (a built-in host test or the
+    // name of our Python file)
+    GREENTEA_SETUP(60, "default_auto");
+
+    return greentea_test_setup_handler(number_of_cases);
+}
+
+// List of test cases in this file
+static Case cases[] = {
+    Case("test recommended size", test_recommended_size),
+    Case("test high water mark", test_high_water_mark),
+    Case("test stack warning", test_stack_warning),
+    Case("test bike system stacks", test_bike_system_stacks),
+};
+
+static Specification specification(greentea_setup, cases);
+
+int main() { return !Harness::run(specification); }
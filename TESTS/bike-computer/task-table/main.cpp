@@ -0,0 +1,234 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file main.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Bike computer test suite: runtime reconfigurable task table
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include <chrono>
+
+#include "greentea-client/test_env.h"
+#include "mbed.h"
+#include "static_scheduling_with_event/bike_system.hpp"
+#include "task_logger.hpp"
+#include "task_table.hpp"
+#include "unity/unity.h"
+#include "utest/utest.h"
+
+using namespace utest::v1;
+
+using bike_computer::TaskTable;
+
+// register the tasks of the static scheduling (same values as in the BikeSystem)
+static void initTaskTable(TaskTable& taskTable) {
+    taskTable.setTask(advembsof::TaskLogger::kGearTaskIndex, "gear", 800ms, 0ms, 100ms);
+    taskTable.setTask(
+        advembsof::TaskLogger::kSpeedTaskIndex, "speed", 400ms, 100ms, 200ms);
+    taskTable.setTask(advembsof::TaskLogger::kTemperatureTaskIndex,
+                      "temperature",
+                      1600ms,
+                      1100ms,
+                      100ms);
+    taskTable.setTask(
+        advembsof::TaskLogger::kResetTaskIndex, "reset", 800ms, 700ms, 100ms);
+    taskTable.setTask(
+        advembsof::TaskLogger::kDisplayTask1Index, "display1", 1600ms, 300ms, 200ms);
+    taskTable.setTask(
+        advembsof::TaskLogger::kDisplayTask2Index, "display2", 1600ms, 1200ms, 100ms);
+}
+
+// test that the cyclic schedule built from the table matches the static schedule
+static control_t test_cyclic_schedule(const size_t call_count) {
+    TaskTable taskTable;
+    initTaskTable(taskTable);
+
+    TEST_ASSERT_EQUAL_INT64(1600, taskTable.getMajorCycle().count());
+    TEST_ASSERT_EQUAL_UINT32(1000, taskTable.getUtilization());
+
+    // expected order of the jobs within the major cycle
+    static constexpr uint8_t kNbrOfJobs                      = 11;
+    static constexpr uint8_t expectedTaskIndices[kNbrOfJobs] = {
+        advembsof::TaskLogger::kGearTaskIndex,
+        advembsof::TaskLogger::kSpeedTaskIndex,
+        advembsof::TaskLogger::kDisplayTask1Index,
+        advembsof::TaskLogger::kSpeedTaskIndex,
+        advembsof::TaskLogger::kResetTaskIndex,
+        advembsof::TaskLogger::kGearTaskIndex,
+        advembsof::TaskLogger::kSpeedTaskIndex,
+        advembsof::TaskLogger::kTemperatureTaskIndex,
+        advembsof::TaskLogger::kDisplayTask2Index,
+        advembsof::TaskLogger::kSpeedTaskIndex,
+        advembsof::TaskLogger::kResetTaskIndex};
+    static constexpr uint32_t expectedReleaseTimes[kNbrOfJobs] = {
+        0, 100, 300, 500, 700, 800, 900, 1100, 1200, 1300, 1500};
+
+    TaskTable::Job jobs[TaskTable::kMaxNbrOfJobs];
+    const uint8_t nbrOfJobs = taskTable.buildCyclicSchedule(jobs);
+    TEST_ASSERT_EQUAL_UINT8(kNbrOfJobs, nbrOfJobs);
+    for (uint8_t jobIndex = 0; jobIndex < nbrOfJobs; jobIndex++) {
+        TEST_ASSERT_EQUAL_UINT8(expectedTaskIndices[jobIndex], jobs[jobIndex].taskIndex);
+        TEST_ASSERT_EQUAL_UINT32(expectedReleaseTimes[jobIndex],
+                                 jobs[jobIndex].releaseTime.count());
+    }
+
+    return CaseNext;
+}
+
+// test that change requests are validated before being accepted
+static control_t test_change_validation(const size_t call_count) {
+    TaskTable taskTable;
+    initTaskTable(taskTable);
+
+    // unknown task
+    TEST_ASSERT_TRUE(taskTable.requestChange(TaskTable::kMaxNbrOfTasks - 1, 800ms, 0ms) ==
+                     TaskTable::ChangeStatus::UnknownTask);
+    TEST_ASSERT_TRUE(taskTable.executeCommand("period brake 800") ==
+                     TaskTable::ChangeStatus::UnknownTask);
+
+    // invalid parameters (phase larger than period, computation time larger than
+    // period, malformed command)
+    TEST_ASSERT_TRUE(
+        taskTable.requestChange(advembsof::TaskLogger::kGearTaskIndex, 800ms, 800ms) ==
+        TaskTable::ChangeStatus::InvalidParameters);
+    TEST_ASSERT_TRUE(
+        taskTable.requestChange(advembsof::TaskLogger::kSpeedTaskIndex, 100ms, 0ms) ==
+        TaskTable::ChangeStatus::InvalidParameters);
+    TEST_ASSERT_TRUE(taskTable.executeCommand("period") ==
+                     TaskTable::ChangeStatus::InvalidParameters);
+
+    // periods longer than the maximal major cycle, or whose least common multiple
+    // exceeds it (a prime period), are rejected without overflowing
+    TEST_ASSERT_TRUE(taskTable.requestChange(advembsof::TaskLogger::kTemperatureTaskIndex,
+                                             std::chrono::milliseconds(INT64_MAX / 3),
+                                             0ms) ==
+                     TaskTable::ChangeStatus::InvalidParameters);
+    TEST_ASSERT_TRUE(taskTable.executeCommand("period temperature 9973") ==
+                     TaskTable::ChangeStatus::InvalidParameters);
+
+    // a shorter period of the speed task overloads the processor
+    TEST_ASSERT_TRUE(taskTable.executeCommand("period speed 300") ==
+                     TaskTable::ChangeStatus::UtilizationExceeded);
+
+    // a valid utilization may still lead to jobs completing after the major cycle
+    TEST_ASSERT_TRUE(taskTable.requestChange(
+                         advembsof::TaskLogger::kDisplayTask2Index, 1600ms, 1500ms) ==
+                     TaskTable::ChangeStatus::NotSchedulable);
+
+    // a longer period of the temperature task is accepted
+    TEST_ASSERT_TRUE(taskTable.executeCommand("period temperature 3200") ==
+                     TaskTable::ChangeStatus::Accepted);
+
+    return CaseNext;
+}
+
+// test that accepted changes are only applied at the safe point
+static control_t test_safe_point(const size_t call_count) {
+    TaskTable taskTable;
+    initTaskTable(taskTable);
+
+    // nothing to apply
+    TEST_ASSERT_FALSE(taskTable.applyPendingChanges());
+
+    TEST_ASSERT_TRUE(taskTable.requestChange(
+                         advembsof::TaskLogger::kTemperatureTaskIndex, 3200ms, 1100ms) ==
+                     TaskTable::ChangeStatus::Accepted);
+
+    // the current table is unchanged until the change is applied
+    TEST_ASSERT_EQUAL_INT64(
+        1600,
+        taskTable.getTask(advembsof::TaskLogger::kTemperatureTaskIndex).period.count());
+    TEST_ASSERT_EQUAL_INT64(1600, taskTable.getMajorCycle().count());
+
+    TEST_ASSERT_TRUE(taskTable.applyPendingChanges());
+    TEST_ASSERT_EQUAL_INT64(
+        3200,
+        taskTable.getTask(advembsof::TaskLogger::kTemperatureTaskIndex).period.count());
+    TEST_ASSERT_EQUAL_INT64(3200, taskTable.getMajorCycle().count());
+
+    // changes are applied only once
+    TEST_ASSERT_FALSE(taskTable.applyPendingChanges());
+
+    return CaseNext;
+}
+
+// test a period change on a running bike system
+static control_t test_bike_system_period_change(const size_t call_count) {
+    // create the BikeSystem instance
+    static_scheduling_with_event::BikeSystem bikeSystem;
+
+    // run the bike system in a separate thread
+    Thread thread;
+    thread.start(callback(&bikeSystem, &static_scheduling_with_event::BikeSystem::start));
+
+    // let the bike system run for 2 secs and change the temperature period
+    ThisThread::sleep_for(2s);
+    TaskTable& taskTable = bikeSystem.getTaskTable();
+    TEST_ASSERT_TRUE(taskTable.executeCommand("period temperature 3200") ==
+                     TaskTable::ChangeStatus::Accepted);
+
+    // let the bike system run for 20 secs with the new period
+    ThisThread::sleep_for(20s);
+
+    // stop the bike system
+    bikeSystem.stop();
+    thread.join();
+
+    // the new period is applied to the temperature task only
+    // Order is kGearTaskIndex, kSpeedTaskIndex, kTemperatureTaskIndex,
+    //          kResetTaskIndex, kDisplayTask1Index, kDisplayTask2Index
+    constexpr std::chrono::microseconds taskPeriods[] = {
+        800000us, 400000us, 3200000us, 800000us, 1600000us, 1600000us};
+
+    // allow for 2 msecs offset (with EventQueue)
+    constexpr uint64_t kDeltaUs = 2000;
+    for (uint8_t taskIndex = 0; taskIndex < advembsof::TaskLogger::kNbrOfTasks;
+         taskIndex++) {
+        TEST_ASSERT_UINT64_WITHIN(
+            kDeltaUs,
+            taskPeriods[taskIndex].count(),
+            bikeSystem.getTaskLogger().getPeriod(taskIndex).count());
+    }
+
+    // the major cycle (safe point) follows the new period of the temperature task
+    const std::chrono::microseconds majorCycle =
+        bikeSystem.getThreadCpuMonitor().getSamplePeriod();
+    TEST_ASSERT_UINT64_WITHIN(100000, 3200000, majorCycle.count());
+
+    return CaseNext;
+}
+
+static utest::v1::status_t greentea_setup(const size_t number_of_cases) {
+    // Here, we specify the timeout (60s) and the host test (a built-in host test or the
+    // name of our Python file)
+    GREENTEA_SETUP(60, "default_auto");
+
+    return greentea_test_setup_handler(number_of_cases);
+}
+
+// List of test cases in this file
+static Case cases[] = {
+    Case("test cyclic schedule", test_cyclic_schedule),
+    Case("test change validation", test_change_validation),
+    Case("test changes applied at safe point", test_safe_point),
+    Case("test bike system period change", test_bike_system_period_change)};
+
+static Specification specification(greentea_setup, cases);
+
+int main() { return !Harness::run(specification); }
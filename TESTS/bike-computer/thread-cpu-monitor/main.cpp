@@ -0,0 +1,223 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file main.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Bike computer test suite: per-thread cpu accounting
+ *
+ * @date 2026-10-19
+ * @version 0.1.0
+ ***************************************************************************/
+
+#include <chrono>
+
+#include "greentea-client/test_env.h"
+#include "mbed.h"
+#include "multi_tasking/bike_system.hpp"
+#include "thread_cpu_monitor.hpp"
+#include "unity/unity.h"
+#include "utest/utest.h"
+#if defined(BIKE_COMPUTER_HOST)
+#include "mbed_port/simulated_pins.hpp"
+#endif  // defined(BIKE_COMPUTER_HOST)
+
+using namespace utest::v1;
+
+using bike_computer::ThreadCpuMonitor;
+
+// the busy thread computes for 20 ms every 100 ms (20% of the cpu)
+static constexpr std::chrono::milliseconds kBusyTime   = 20ms;
+static constexpr std::chrono::milliseconds kBusyPeriod = 100ms;
+// interrupt handlers simulated with an IsrScope last 5 ms
+static constexpr std::chrono::milliseconds kIsrTime = 5ms;
+static constexpr uint8_t kNbrOfIsrs                 = 10;
+
+static volatile bool gIsStopping = false;
+
+static void busyThreadFunction() {
+    while (!core_util_atomic_load_bool(&gIsStopping)) {
+        wait_us(std::chrono::duration_cast<std::chrono::microseconds>(kBusyTime).count());
+        ThisThread::sleep_for(kBusyPeriod - kBusyTime);
+    }
+}
+
+static void idleThreadFunction() {
+    while (!core_util_atomic_load_bool(&gIsStopping)) {
+        ThisThread::sleep_for(kBusyPeriod);
+    }
+}
+
+static void simulateIsr() {
+    ThreadCpuMonitor::IsrScope isrScope;
+    // nested scopes are accounted once
+    ThreadCpuMonitor::IsrScope nestedIsrScope;
+    wait_us(std::chrono::duration_cast<std::chrono::microseconds>(kIsrTime).count());
+}
+
+static void isrSourceThreadFunction() {
+    for (uint8_t index = 0; index < kNbrOfIsrs; index++) {
+        simulateIsr();
+        ThisThread::sleep_for(20ms);
+    }
+}
+
+// test that the load of each thread is measured and can be checked against a budget
+static control_t test_thread_budgets(const size_t call_count) {
+    Timer timer;
+    timer.start();
+    ThreadCpuMonitor threadCpuMonitor(timer);
+
+    core_util_atomic_store_bool(&gIsStopping, false);
+    Thread busyThread(osPriorityNormal, OS_STACK_SIZE, nullptr, "busy");
+    Thread idleThread(osPriorityNormal, OS_STACK_SIZE, nullptr, "idle");
+    busyThread.start(callback(busyThreadFunction));
+    idleThread.start(callback(idleThreadFunction));
+    ThisThread::sleep_for(10 * kBusyPeriod);
+    threadCpuMonitor.sample();
+    core_util_atomic_store_bool(&gIsStopping, true);
+    busyThread.join();
+    idleThread.join();
+    threadCpuMonitor.printStats();
+
+    TEST_ASSERT_EQUAL_UINT32(1, threadCpuMonitor.getNbrOfSamples());
+    TEST_ASSERT_EQUAL_UINT32(0, threadCpuMonitor.getNbrOfIgnoredThreads());
+    TEST_ASSERT_TRUE(threadCpuMonitor.getSamplePeriod() >= 10 * kBusyPeriod);
+    const ThreadCpuMonitor::ThreadLoad* busyLoad =
+        threadCpuMonitor.findThreadLoad("busy");
+    const ThreadCpuMonitor::ThreadLoad* idleLoad =
+        threadCpuMonitor.findThreadLoad("idle");
+    TEST_ASSERT_TRUE(busyLoad != nullptr);
+    TEST_ASSERT_TRUE(idleLoad != nullptr);
+    TEST_ASSERT_TRUE(threadCpuMonitor.findThreadLoad("unknown") == nullptr);
+    // budgets in per mille of the sample period (20% expected for the busy thread)
+    TEST_ASSERT_TRUE(busyLoad->load >= 120);
+    TEST_ASSERT_TRUE(busyLoad->load <= 300);
+    TEST_ASSERT_TRUE(idleLoad->load <= 20);
+    TEST_ASSERT_TRUE(threadCpuMonitor.getIsrLoad() <= 20);
+
+    return CaseNext;
+}
+
+// test that the time spent in interrupt handlers is not charged to the threads
+static control_t test_isr_time(const size_t call_count) {
+    Timer timer;
+    timer.start();
+    ThreadCpuMonitor threadCpuMonitor(timer);
+
+    Thread isrSourceThread(osPriorityNormal, OS_STACK_SIZE, nullptr, "isrSource");
+    isrSourceThread.start(callback(isrSourceThreadFunction));
+    isrSourceThread.join();
+    threadCpuMonitor.sample();
+    threadCpuMonitor.printStats();
+
+    static constexpr std::chrono::microseconds kExpectedIsrTime = kNbrOfIsrs * kIsrTime;
+    TEST_ASSERT_TRUE(threadCpuMonitor.getIsrTime() >= kExpectedIsrTime / 2);
+    TEST_ASSERT_TRUE(threadCpuMonitor.getIsrTime() <= kExpectedIsrTime + 10ms);
+    const ThreadCpuMonitor::ThreadLoad* isrSourceLoad =
+        threadCpuMonitor.findThreadLoad("isrSource");
+    TEST_ASSERT_TRUE(isrSourceLoad != nullptr);
+    TEST_ASSERT_TRUE(isrSourceLoad->cpuTime < 10ms);
+
+    return CaseNext;
+}
+
+#if defined(BIKE_COMPUTER_HOST)
+static void onSimulatedEdge() {
+    wait_us(std::chrono::duration_cast<std::chrono::microseconds>(kIsrTime).count());
+}
+
+// test that the simulated interrupt handlers are accounted as interrupt time (host
+// port only)
+static control_t test_simulated_interrupts(const size_t call_count) {
+    Timer timer;
+    timer.start();
+    ThreadCpuMonitor threadCpuMonitor(timer);
+
+    InterruptIn button(BUTTON1);
+    button.rise(callback(onSimulatedEdge));
+    for (uint8_t index = 0; index < kNbrOfIsrs; index++) {
+        host::SimulatedPins::getInstance().write(BUTTON1, 1);
+        host::SimulatedPins::getInstance().write(BUTTON1, 0);
+    }
+    threadCpuMonitor.sample();
+
+    static constexpr std::chrono::microseconds kExpectedIsrTime = kNbrOfIsrs * kIsrTime;
+    TEST_ASSERT_TRUE(threadCpuMonitor.getIsrTime() >= kExpectedIsrTime / 2);
+    const ThreadCpuMonitor::ThreadLoad* mainLoad =
+        threadCpuMonitor.findThreadLoad("main");
+    TEST_ASSERT_TRUE(mainLoad != nullptr);
+    TEST_ASSERT_TRUE(mainLoad->cpuTime < threadCpuMonitor.getIsrTime());
+
+    return CaseNext;
+}
+#endif  // defined(BIKE_COMPUTER_HOST)
+
+// test that the threads of the multi-tasking bike system stay within their budgets
+static control_t test_bike_system_budgets(const size_t call_count) {
+    multi_tasking::BikeSystem bikeSystem;
+
+    Thread thread(osPriorityNormal, OS_STACK_SIZE, nullptr, "bikeSystem");
+    thread.start(callback(&bikeSystem, &multi_tasking::BikeSystem::start));
+    // the loads are sampled at the end of each major cycle (1600 ms)
+    ThisThread::sleep_for(4s);
+    bikeSystem.stop();
+    thread.join();
+
+    const ThreadCpuMonitor& threadCpuMonitor = bikeSystem.getThreadCpuMonitor();
+    threadCpuMonitor.printStats();
+    TEST_ASSERT_TRUE(threadCpuMonitor.getNbrOfSamples() >= 2);
+    TEST_ASSERT_EQUAL_UINT32(0, threadCpuMonitor.getNbrOfIgnoredThreads());
+    TEST_ASSERT_TRUE(threadCpuMonitor.getSamplePeriod() >= 1500ms);
+    TEST_ASSERT_TRUE(threadCpuMonitor.getSamplePeriod() <= 1700ms);
+
+    // budgets in per mille of the major cycle
+    static constexpr struct {
+        const char* name;
+        uint16_t budget;
+    } kThreadBudgets[] = {
+        {"bikeSystem", 100}, {"DisplayRenderer", 50}, {"deferredISRThread", 50}};
+    for (const auto& threadBudget : kThreadBudgets) {
+        const ThreadCpuMonitor::ThreadLoad* threadLoad =
+            threadCpuMonitor.findThreadLoad(threadBudget.name);
+        TEST_ASSERT_TRUE(threadLoad != nullptr);
+        TEST_ASSERT_TRUE(threadLoad->load <= threadBudget.budget);
+    }
+    TEST_ASSERT_TRUE(threadCpuMonitor.getIsrLoad() <= 50);
+
+    return CaseNext;
+}
+
+static utest::v1::status_t greentea_setup(const size_t number_of_cases) {
+    // Here, we specify the timeout (60s) and the host test (a built-in host test or the
+    // name of our Python file)
+    GREENTEA_SETUP(60, "default_auto");
+
+    return greentea_test_setup_handler(number_of_cases);
+}
+
+// List of test cases in this file
+static Case cases[] = {
+    Case("test thread budgets", test_thread_budgets),
+    Case("test isr time", test_isr_time),
+#if defined(BIKE_COMPUTER_HOST)
+    Case("test simulated interrupts", test_simulated_interrupts),
+#endif  // defined(BIKE_COMPUTER_HOST)
+    Case("test bike system budgets", test_bike_system_budgets),
+};
+
+static Specification specification(greentea_setup, cases);
+
+int main() { return !Harness::run(specification); }
@@ -0,0 +1,268 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file allocation_guard.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Steady-state allocation guard implementation
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include "allocation_guard.hpp"
+
+#include <cinttypes>
+#include <cstdarg>
+
+#include "mbed_trace.h"
+#if MBED_CONF_MBED_TRACE_ENABLE
+#define TRACE_GROUP "AllocationGuard"
+#endif  // MBED_CONF_MBED_TRACE_ENABLE
+
+#if defined(BIKE_COMPUTER_HOST)
+
+// the host port records the identifier and the name of the threads it starts
+static const void* getCurrentThreadId() { return host::getCurrentThreadId(); }
+
+static const char* getCurrentThreadName() { return host::getCurrentThreadName(); }
+
+#else
+
+static const void* getCurrentThreadId() { return ThisThread::get_id(); }
+
+static const char* getCurrentThreadName() {
+    return osThreadGetName(ThisThread::get_id());
+}
+
+#endif  // defined(BIKE_COMPUTER_HOST)
+
+namespace bike_computer {
+
+// definitions required when the constants are odr-used (C++14)
+constexpr uint8_t AllocationGuard::kMaxNbrOfThreads;
+constexpr uint8_t AllocationGuard::kNbrOfCallSites;
+
+// zero-initialized before any constructor runs
+bool AllocationGuard::_isStarted;
+bool AllocationGuard::_isSealed;
+AllocationGuard::SealMode AllocationGuard::_sealMode;
+uint32_t AllocationGuard::_nbrOfAllocations;
+uint32_t AllocationGuard::_nbrOfFrees;
+uint32_t AllocationGuard::_nbrOfSealedAllocations;
+uint8_t AllocationGuard::_nbrOfThreads;
+AllocationGuard::ThreadStats AllocationGuard::_threadStats[kMaxNbrOfThreads];
+uint8_t AllocationGuard::_nbrOfCallSites;
+uint8_t AllocationGuard::_nextCallSiteIndex;
+AllocationGuard::CallSite AllocationGuard::_callSites[kNbrOfCallSites];
+
+void AllocationGuard::start() {
+#if MBED_CONF_PLATFORM_MEMORY_TRACING_ENABLED
+    core_util_critical_section_enter();
+    const bool isStarted = _isStarted;
+    _isStarted           = true;
+    core_util_critical_section_exit();
+    if (!isStarted) {
+        mbed_mem_trace_set_callback(onMemoryTrace);
+    }
+#else
+    tr_warn("Memory tracing is disabled, allocations cannot be guarded");
+#endif  // MBED_CONF_PLATFORM_MEMORY_TRACING_ENABLED
+}
+
+void AllocationGuard::seal(SealMode mode) {
+    core_util_critical_section_enter();
+    _sealMode               = mode;
+    _nbrOfSealedAllocations = 0;
+    _isSealed               = true;
+    core_util_critical_section_exit();
+}
+
+void AllocationGuard::unseal() {
+    core_util_critical_section_enter();
+    _isSealed = false;
+    core_util_critical_section_exit();
+}
+
+bool AllocationGuard::isSealed() { return core_util_atomic_load_bool(&_isSealed); }
+
+uint32_t AllocationGuard::getNbrOfAllocations() {
+    return core_util_atomic_load_u32(&_nbrOfAllocations);
+}
+
+uint32_t AllocationGuard::getNbrOfFrees() {
+    return core_util_atomic_load_u32(&_nbrOfFrees);
+}
+
+uint32_t AllocationGuard::getNbrOfSealedAllocations() {
+    return core_util_atomic_load_u32(&_nbrOfSealedAllocations);
+}
+
+uint8_t AllocationGuard::getNbrOfThreads() {
+    return core_util_atomic_load_u8(&_nbrOfThreads);
+}
+
+AllocationGuard::ThreadStats AllocationGuard::getThreadStats(uint8_t threadIndex) {
+    MBED_ASSERT(threadIndex < getNbrOfThreads());
+    core_util_critical_section_enter();
+    const ThreadStats stats = _threadStats[threadIndex];
+    core_util_critical_section_exit();
+    return stats;
+}
+
+uint8_t AllocationGuard::getNbrOfCallSites() {
+    return core_util_atomic_load_u8(&_nbrOfCallSites);
+}
+
+AllocationGuard::CallSite AllocationGuard::getCallSite(uint8_t index) {
+    MBED_ASSERT(index < getNbrOfCallSites());
+    core_util_critical_section_enter();
+    const CallSite callSite =
+        _callSites[(_nextCallSiteIndex + kNbrOfCallSites - 1 - index) % kNbrOfCallSites];
+    core_util_critical_section_exit();
+    return callSite;
+}
+
+void AllocationGuard::printStats() {
+    tr_info("Heap: %" PRIu32 " allocations, %" PRIu32 " frees (%s)",
+            getNbrOfAllocations(),
+            getNbrOfFrees(),
+            isSealed() ? "sealed" : "not sealed");
+    const uint8_t nbrOfThreads = getNbrOfThreads();
+    for (uint8_t threadIndex = 0; threadIndex < nbrOfThreads; threadIndex++) {
+        const ThreadStats stats = getThreadStats(threadIndex);
+        tr_info("Heap use of thread %s: %" PRIu32 " allocations (%" PRIu32
+                " sealed), %" PRIu32 " frees",
+                (stats.threadName != nullptr) ? stats.threadName : "unnamed",
+                stats.nbrOfAllocations,
+                stats.nbrOfSealedAllocations,
+                stats.nbrOfFrees);
+    }
+    const uint32_t nbrOfSealedAllocations = getNbrOfSealedAllocations();
+    if (nbrOfSealedAllocations == 0) {
+        return;
+    }
+    tr_warn("%" PRIu32 " allocations in the steady state", nbrOfSealedAllocations);
+    const uint8_t nbrOfCallSites = getNbrOfCallSites();
+    for (uint8_t index = 0; index < nbrOfCallSites; index++) {
+        const CallSite callSite = getCallSite(index);
+        if (callSite.isSealed) {
+            tr_warn("Allocation of %" PRIu32 " bytes called from 0x%08" PRIxPTR,
+                    callSite.size,
+                    reinterpret_cast<uintptr_t>(callSite.caller));
+        }
+    }
+}
+
+#if defined(MBED_TEST_MODE)
+void AllocationGuard::resetStats() {
+    core_util_critical_section_enter();
+    _nbrOfAllocations       = 0;
+    _nbrOfFrees             = 0;
+    _nbrOfSealedAllocations = 0;
+    _nbrOfThreads           = 0;
+    _nbrOfCallSites         = 0;
+    _nextCallSiteIndex      = 0;
+    core_util_critical_section_exit();
+}
+#endif  // defined(MBED_TEST_MODE)
+
+void AllocationGuard::onMemoryTrace(uint8_t operation, void* result, void* caller, ...) {
+    uint32_t size     = 0;
+    bool isAllocation = true;
+    bool isFree       = false;
+    va_list arguments;
+    va_start(arguments, caller);
+    switch (operation) {
+        case MBED_MEM_TRACE_MALLOC:
+            size = static_cast<uint32_t>(va_arg(arguments, size_t));
+            break;
+        case MBED_MEM_TRACE_REALLOC:
+            // the previous block is freed
+            isFree = va_arg(arguments, void*) != nullptr;
+            size   = static_cast<uint32_t>(va_arg(arguments, size_t));
+            break;
+        case MBED_MEM_TRACE_CALLOC: {
+            const size_t nbrOfMembers = va_arg(arguments, size_t);
+            size = static_cast<uint32_t>(nbrOfMembers * va_arg(arguments, size_t));
+            break;
+        }
+        case MBED_MEM_TRACE_FREE:
+            // freeing nullptr has no effect
+            isAllocation = false;
+            isFree       = va_arg(arguments, void*) != nullptr;
+            break;
+        default:
+            isAllocation = false;
+            break;
+    }
+    va_end(arguments);
+    if (!isAllocation && !isFree) {
+        return;
+    }
+
+    // the thread is identified out of the critical section
+    const void* threadId   = getCurrentThreadId();
+    const char* threadName = getCurrentThreadName();
+    core_util_critical_section_enter();
+    ThreadStats* threadStats = findThreadStats(threadId, threadName);
+    if (isFree) {
+        _nbrOfFrees++;
+        if (threadStats != nullptr) {
+            threadStats->nbrOfFrees++;
+        }
+    }
+    if (isAllocation) {
+        _nbrOfAllocations++;
+        if (threadStats != nullptr) {
+            threadStats->nbrOfAllocations++;
+        }
+        if (_isSealed) {
+            _nbrOfSealedAllocations++;
+            if (threadStats != nullptr) {
+                threadStats->nbrOfSealedAllocations++;
+            }
+        }
+        _callSites[_nextCallSiteIndex] = {caller, threadId, size, _isSealed};
+        _nextCallSiteIndex             = (_nextCallSiteIndex + 1) % kNbrOfCallSites;
+        if (_nbrOfCallSites < kNbrOfCallSites) {
+            _nbrOfCallSites++;
+        }
+    }
+    const bool isTrapped = isAllocation && _isSealed && _sealMode == SealMode::Trap;
+    core_util_critical_section_exit();
+
+    if (isTrapped) {
+        // the assertion fails out of the critical section
+        MBED_ASSERT(!isTrapped);
+    }
+}
+
+AllocationGuard::ThreadStats* AllocationGuard::findThreadStats(const void* threadId,
+                                                               const char* threadName) {
+    for (uint8_t threadIndex = 0; threadIndex < _nbrOfThreads; threadIndex++) {
+        if (_threadStats[threadIndex].threadId == threadId) {
+            return &_threadStats[threadIndex];
+        }
+    }
+    if (_nbrOfThreads == kMaxNbrOfThreads) {
+        return nullptr;
+    }
+    ThreadStats& threadStats = _threadStats[_nbrOfThreads++];
+    threadStats              = {threadId, threadName, 0, 0, 0};
+    return &threadStats;
+}
+
+}  // namespace bike_computer
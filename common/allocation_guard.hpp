@@ -0,0 +1,116 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file allocation_guard.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Steady-state allocation guard based on the memory tracing hook
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include "mbed.h"
+
+namespace bike_computer {
+
+// Guard of the steady state of the system, in which the heap must not be used. The
+// allocations and frees are counted per thread through the memory tracing hook of
+// mbed OS (platform.memory-tracing-enabled) and the return addresses of the last
+// allocations are recorded. Once the guard is sealed, after the initialization of the
+// system, any allocation is either logged or trapped. The hook runs in the context of
+// the allocating thread, in a short critical section.
+class AllocationGuard {
+   public:
+    static constexpr uint8_t kMaxNbrOfThreads = 16;
+    static constexpr uint8_t kNbrOfCallSites  = 8;
+
+    // an allocation made while sealed is counted and reported by printStats() (Log) or
+    // makes an assertion fail (Trap, assertions being disabled in release builds)
+    enum class SealMode : uint8_t { Log = 0, Trap = 1 };
+
+    struct ThreadStats {
+        const void* threadId;
+        const char* threadName;
+        uint32_t nbrOfAllocations;
+        uint32_t nbrOfFrees;
+        // allocations made while sealed
+        uint32_t nbrOfSealedAllocations;
+    };
+
+    struct CallSite {
+        // return address in the caller of the allocator
+        const void* caller;
+        const void* threadId;
+        uint32_t size;
+        bool isSealed;
+    };
+
+    // method installing the memory tracing hook (no effect if already started)
+    static void start();
+
+    // method entering the sealed mode, the sealed allocations being counted from 0
+    static void seal(SealMode mode);
+    static void unseal();
+    static bool isSealed();
+
+    static uint32_t getNbrOfAllocations();
+    static uint32_t getNbrOfFrees();
+    // allocations made while sealed since the last call to seal()
+    static uint32_t getNbrOfSealedAllocations();
+
+    // threads that allocated or freed memory, in the order of their first allocation
+    // (the threads beyond kMaxNbrOfThreads are only accounted in the totals)
+    static uint8_t getNbrOfThreads();
+    static ThreadStats getThreadStats(uint8_t threadIndex);
+
+    // call sites of the last allocations, index 0 being the most recent one
+    static uint8_t getNbrOfCallSites();
+    static CallSite getCallSite(uint8_t index);
+
+    // method called for printing the statistics of each thread and the sealed
+    // allocations
+    static void printStats();
+
+    // methods used for tests only
+#if defined(MBED_TEST_MODE)
+    // clears the counters and the call sites (the hook and the mode are unchanged)
+    static void resetStats();
+#endif  // defined(MBED_TEST_MODE)
+
+   private:
+    // private methods
+    static void onMemoryTrace(uint8_t operation, void* result, void* caller, ...);
+    // must be called in a critical section, returns nullptr if the table is full
+    static ThreadStats* findThreadStats(const void* threadId, const char* threadName);
+
+    // data members
+    static bool _isStarted;
+    static bool _isSealed;
+    static SealMode _sealMode;
+    static uint32_t _nbrOfAllocations;
+    static uint32_t _nbrOfFrees;
+    static uint32_t _nbrOfSealedAllocations;
+    static uint8_t _nbrOfThreads;
+    static ThreadStats _threadStats[kMaxNbrOfThreads];
+    // circular buffer of the call sites, _nbrOfCallSites being saturated
+    static uint8_t _nbrOfCallSites;
+    static uint8_t _nextCallSiteIndex;
+    static CallSite _callSites[kNbrOfCallSites];
+};
+
+}  // namespace bike_computer
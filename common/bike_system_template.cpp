@@ -0,0 +1,574 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file bike_system_template.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Bike System implementation (policy-based, shared by all variants)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include "bike_system_template.hpp"
+
+#include <chrono>
+#include <cmath>
+
+#include "deferred_log.hpp"
+#include "fixed_point_format.hpp"
+#include "metrics_exporter.hpp"
+#include "pool_allocator.hpp"
+#include "scope_profiler.hpp"
+
+// all variants are instantiated side by side in this translation unit
+#include "multi_tasking/bike_system.hpp"
+#include "static_scheduling/bike_system.hpp"
+#include "static_scheduling_with_event/bike_system.hpp"
+
+#include "mbed_trace.h"
+#if MBED_CONF_MBED_TRACE_ENABLE
+#define TRACE_GROUP "BikeSystem"
+#endif  // MBED_CONF_MBED_TRACE_ENABLE
+
+namespace bike_computer {
+
+static constexpr std::chrono::milliseconds kGearTaskPeriod                   = 800ms;
+static constexpr std::chrono::milliseconds kGearTaskDelay                    = 0ms;
+static constexpr std::chrono::milliseconds kGearTaskComputationTime          = 100ms;
+static constexpr std::chrono::milliseconds kSpeedDistanceTaskPeriod          = 400ms;
+static constexpr std::chrono::milliseconds kSpeedDistanceTaskDelay           = 100ms;
+static constexpr std::chrono::milliseconds kSpeedDistanceTaskComputationTime = 200ms;
+static constexpr std::chrono::milliseconds kDisplayTask1Period               = 1600ms;
+static constexpr std::chrono::milliseconds kDisplayTask1Delay                = 300ms;
+static constexpr std::chrono::milliseconds kDisplayTask1ComputationTime      = 200ms;
+static constexpr std::chrono::milliseconds kResetTaskPeriod                  = 800ms;
+static constexpr std::chrono::milliseconds kResetTaskDelay                   = 700ms;
+static constexpr std::chrono::milliseconds kResetTaskComputationTime         = 100ms;
+static constexpr std::chrono::milliseconds kTemperatureTaskPeriod            = 1600ms;
+static constexpr std::chrono::milliseconds kTemperatureTaskDelay             = 1100ms;
+static constexpr std::chrono::milliseconds kTemperatureTaskComputationTime   = 100ms;
+static constexpr std::chrono::milliseconds kDisplayTask2Period               = 1600ms;
+static constexpr std::chrono::milliseconds kDisplayTask2Delay                = 1200ms;
+static constexpr std::chrono::milliseconds kDisplayTask2ComputationTime      = 100ms;
+
+// pixels of the frame buffer of the display, shared by the variants since a single
+// bike system runs at a time (a bike system may live on a thread stack)
+static uint16_t gFrameBufferPixels[FrameBufferDisplayDevice::kWidth *
+                                   FrameBufferDisplayDevice::kHeight];
+
+// conversion of an acquired temperature to a sample of the temperature pipeline
+static int32_t toTemperatureSample(float temperature) {
+    return static_cast<int32_t>(lroundf(temperature * kTemperatureScale));
+}
+
+template <typename SchedulingPolicy, typename InputPolicy>
+BikeSystem<SchedulingPolicy, InputPolicy>::BikeSystem()
+    : _input(_timer,
+             _scheduler.getEventQueue(),
+             callback(this, &BikeSystem::onReset),
+             callback(this, &BikeSystem::onInputChanged)),
+      _rideStateBus(_timer),
+      _lcdDisplayBackend(FrameBufferDisplayDevice::kWidth,
+                         FrameBufferDisplayDevice::kHeight),
+      _fieldDisplayDevice(gFrameBufferPixels, _lcdDisplayBackend),
+      _dirtyFieldDisplay(_fieldDisplayDevice),
+      _displayRenderer(_dirtyFieldDisplay),
+      _speedometer(_timer),
+      _threadCpuMonitor(_timer),
+      _overloadMonitor(_timer),
+      _heapAnalyzer(kHeapWarningSize),
+      _stackMonitor(kStackMarginPercent) {
+    // subscribe the consumers of the ride state
+    _speedTaskGearSubscriber      = _rideStateBus.subscribeGear();
+    _displayGearSubscriber        = _rideStateBus.subscribeGear();
+    _displaySpeedSubscriber       = _rideStateBus.subscribeSpeed();
+    _displayTemperatureSubscriber = _rideStateBus.subscribeTemperature();
+    _loggerGearSubscriber         = _rideStateBus.subscribeGear();
+    _loggerSpeedSubscriber        = _rideStateBus.subscribeSpeed();
+    _loggerTemperatureSubscriber  = _rideStateBus.subscribeTemperature();
+#if defined(MBED_TEST_MODE)
+    _testGearSubscriber = _rideStateBus.subscribeGear();
+#endif  // defined(MBED_TEST_MODE)
+
+    // register the tasks in the task table (periods may be changed at runtime)
+    // with event-driven inputs, gear, speed and reset are not periodic tasks
+    if (!InputPolicy::kIsEventDriven) {
+        _taskTable.setTask(advembsof::TaskLogger::kGearTaskIndex,
+                           "gear",
+                           kGearTaskPeriod,
+                           kGearTaskDelay,
+                           kGearTaskComputationTime);
+        _taskTable.setTask(advembsof::TaskLogger::kSpeedTaskIndex,
+                           "speed",
+                           kSpeedDistanceTaskPeriod,
+                           kSpeedDistanceTaskDelay,
+                           kSpeedDistanceTaskComputationTime);
+        _taskTable.setTask(advembsof::TaskLogger::kResetTaskIndex,
+                           "reset",
+                           kResetTaskPeriod,
+                           kResetTaskDelay,
+                           kResetTaskComputationTime);
+    }
+    _taskTable.setTask(advembsof::TaskLogger::kTemperatureTaskIndex,
+                       "temperature",
+                       kTemperatureTaskPeriod,
+                       kTemperatureTaskDelay,
+                       kTemperatureTaskComputationTime);
+    _taskTable.setTask(advembsof::TaskLogger::kDisplayTask1Index,
+                       "display1",
+                       kDisplayTask1Period,
+                       kDisplayTask1Delay,
+                       kDisplayTask1ComputationTime);
+    _taskTable.setTask(advembsof::TaskLogger::kDisplayTask2Index,
+                       "display2",
+                       kDisplayTask2Period,
+                       kDisplayTask2Delay,
+                       kDisplayTask2ComputationTime);
+
+    // the computation time of the display tasks is spent on rendering their fields
+    if (ComputationPolicy<SchedulingPolicy, InputPolicy>::kSimulateComputationTime) {
+        _displayRenderer.setFieldRenderingTime(DirtyFieldDisplay::Field::Gear,
+                                               kDisplayTask1ComputationTime / 3);
+        _displayRenderer.setFieldRenderingTime(DirtyFieldDisplay::Field::Speed,
+                                               kDisplayTask1ComputationTime / 3);
+        _displayRenderer.setFieldRenderingTime(DirtyFieldDisplay::Field::Distance,
+                                               kDisplayTask1ComputationTime / 3);
+        _displayRenderer.setFieldRenderingTime(DirtyFieldDisplay::Field::Temperature,
+                                               kDisplayTask2ComputationTime);
+    }
+}
+
+template <typename SchedulingPolicy, typename InputPolicy>
+void BikeSystem<SchedulingPolicy, InputPolicy>::start() {
+    // the allocations are accounted from the initialization
+    AllocationGuard::start();
+#if !defined(MBED_TEST_MODE)
+    // the log and export threads run for the lifetime of the application
+    DeferredLog::getInstance().start();
+    MetricsExporter::getInstance().start();
+#endif  // !defined(MBED_TEST_MODE)
+    _displayRenderer.start();
+    // will return only once the scheduling policy is stopped
+    _scheduler.start(*this);
+    _displayRenderer.stop();
+}
+
+template <typename SchedulingPolicy, typename InputPolicy>
+void BikeSystem<SchedulingPolicy, InputPolicy>::stop() {
+    // leaving the steady state
+    AllocationGuard::unseal();
+    _scheduler.stop();
+}
+
+template <typename SchedulingPolicy, typename InputPolicy>
+TaskTable& BikeSystem<SchedulingPolicy, InputPolicy>::getTaskTable() {
+    return _taskTable;
+}
+
+template <typename SchedulingPolicy, typename InputPolicy>
+RideStateBus& BikeSystem<SchedulingPolicy, InputPolicy>::getRideStateBus() {
+    return _rideStateBus;
+}
+
+template <typename SchedulingPolicy, typename InputPolicy>
+TemperaturePipeline& BikeSystem<SchedulingPolicy, InputPolicy>::getTemperaturePipeline() {
+    return _temperaturePipeline;
+}
+
+#if defined(MBED_TEST_MODE)
+template <typename SchedulingPolicy, typename InputPolicy>
+const advembsof::TaskLogger& BikeSystem<SchedulingPolicy, InputPolicy>::getTaskLogger()
+    const {
+    return _taskLogger;
+}
+
+template <typename SchedulingPolicy, typename InputPolicy>
+OverloadMonitor& BikeSystem<SchedulingPolicy, InputPolicy>::getOverloadMonitor() {
+    return _overloadMonitor;
+}
+
+template <typename SchedulingPolicy, typename InputPolicy>
+Speedometer& BikeSystem<SchedulingPolicy, InputPolicy>::getSpeedometer() {
+    return _speedometer;
+}
+
+template <typename SchedulingPolicy, typename InputPolicy>
+DirtyFieldDisplay& BikeSystem<SchedulingPolicy, InputPolicy>::getDirtyFieldDisplay() {
+    return _dirtyFieldDisplay;
+}
+
+template <typename SchedulingPolicy, typename InputPolicy>
+DisplayRenderer& BikeSystem<SchedulingPolicy, InputPolicy>::getDisplayRenderer() {
+    return _displayRenderer;
+}
+
+template <typename SchedulingPolicy, typename InputPolicy>
+ThreadCpuMonitor& BikeSystem<SchedulingPolicy, InputPolicy>::getThreadCpuMonitor() {
+    return _threadCpuMonitor;
+}
+
+template <typename SchedulingPolicy, typename InputPolicy>
+HeapAnalyzer& BikeSystem<SchedulingPolicy, InputPolicy>::getHeapAnalyzer() {
+    return _heapAnalyzer;
+}
+
+template <typename SchedulingPolicy, typename InputPolicy>
+StackMonitor& BikeSystem<SchedulingPolicy, InputPolicy>::getStackMonitor() {
+    return _stackMonitor;
+}
+
+template <typename SchedulingPolicy, typename InputPolicy>
+typename InputPolicy::GearDevice&
+BikeSystem<SchedulingPolicy, InputPolicy>::getGearDevice() {
+    return _input.getGearDevice();
+}
+
+template <typename SchedulingPolicy, typename InputPolicy>
+uint8_t BikeSystem<SchedulingPolicy, InputPolicy>::getCurrentGear() {
+    _testGearSubscriber.update();
+    return _testGearSubscriber.getValue().gear;
+}
+#endif  // defined(MBED_TEST_MODE)
+
+template <typename SchedulingPolicy, typename InputPolicy>
+void BikeSystem<SchedulingPolicy, InputPolicy>::onReset() {
+    ThreadCpuMonitor::IsrScope isrScope;
+    _resetTime = _timer.elapsed_time();
+    core_util_atomic_store_bool(&_resetFlag, true);
+    // event-driven inputs serve the reset without waiting for the reset task period
+    _input.serveReset(callback(this, &BikeSystem::resetTask));
+}
+
+template <typename SchedulingPolicy, typename InputPolicy>
+void BikeSystem<SchedulingPolicy, InputPolicy>::init() {
+    // start the timer
+    _timer.start();
+
+    // initialize the lcd display
+    disco::ReturnCode rc = _fieldDisplayDevice.init();
+    if (rc != disco::ReturnCode::Ok) {
+        tr_error("Failed to initialized the lcd display: %d", static_cast<int>(rc));
+    }
+    _dirtyFieldDisplay.invalidate();
+
+    // initialize the sensor device
+    bool present = _sensorDevice.init();
+    if (!present) {
+        tr_error("Sensor not present or initialization failed");
+    } else {
+        _temperaturePipeline.reset(toTemperatureSample(_sensorDevice.getTemperature()));
+    }
+
+    // enable/disable task logging
+    _taskLogger.enable(true);
+}
+
+template <typename SchedulingPolicy, typename InputPolicy>
+void BikeSystem<SchedulingPolicy, InputPolicy>::onInputChanged() {
+    // called by event-driven inputs, in the context of the scheduler
+    updateGear();
+    updateSpeedAndDistance();
+}
+
+template <typename SchedulingPolicy, typename InputPolicy>
+void BikeSystem<SchedulingPolicy, InputPolicy>::updateGear() {
+    const uint8_t gear = _input.getCurrentGear();
+    _rideStateBus.publishGear(gear, _input.getCurrentGearSize());
+    setMetric<MetricId::Gear>(gear);
+}
+
+template <typename SchedulingPolicy, typename InputPolicy>
+void BikeSystem<SchedulingPolicy, InputPolicy>::updateSpeedAndDistance() {
+    const auto pedalRotationTime = _input.getCurrentRotationTime();
+    _speedometer.setCurrentRotationTime(pedalRotationTime);
+    _speedTaskGearSubscriber.update();
+    _speedometer.setGearSize(_speedTaskGearSubscriber.getValue().gearSize);
+    publishSpeedAndDistance();
+}
+
+template <typename SchedulingPolicy, typename InputPolicy>
+void BikeSystem<SchedulingPolicy, InputPolicy>::publishSpeedAndDistance() {
+    const float speed = _speedometer.getCurrentSpeed();
+    _rideStateBus.publishSpeed(speed, _speedometer.getDistance());
+}
+
+template <typename SchedulingPolicy, typename InputPolicy>
+void BikeSystem<SchedulingPolicy, InputPolicy>::gearTask() {
+    PROFILE_SCOPE("BikeSystem::gearTask");
+    // gear task
+    auto taskStartTime = _timer.elapsed_time();
+
+    updateGear();
+
+    _taskLogger.logPeriodAndExecutionTime(
+        _timer, advembsof::TaskLogger::kGearTaskIndex, taskStartTime);
+}
+
+template <typename SchedulingPolicy, typename InputPolicy>
+void BikeSystem<SchedulingPolicy, InputPolicy>::speedDistanceTask() {
+    PROFILE_SCOPE("BikeSystem::speedDistanceTask");
+    // speed and distance task
+    auto taskStartTime = _timer.elapsed_time();
+
+    updateSpeedAndDistance();
+
+    _taskLogger.logPeriodAndExecutionTime(
+        _timer, advembsof::TaskLogger::kSpeedTaskIndex, taskStartTime);
+}
+
+template <typename SchedulingPolicy, typename InputPolicy>
+void BikeSystem<SchedulingPolicy, InputPolicy>::temperatureTask() {
+    PROFILE_SCOPE("BikeSystem::temperatureTask");
+    auto taskStartTime = _timer.elapsed_time();
+
+    // low-criticality task: stretched or dropped in degraded mode
+    if (!_overloadMonitor.isLowCriticalityReleased()) {
+        // the slot is left idle when computation time is simulated
+        simulateComputationTime(advembsof::TaskLogger::kTemperatureTaskIndex,
+                                taskStartTime);
+        return;
+    }
+
+    // split-phase acquisition: the result of the conversion started by the previous
+    // release is fetched and the next conversion is started without waiting for it
+    if (_sensorDevice.isConversionCompleted() && _sensorDevice.fetchResult()) {
+        _temperaturePipeline.push(toTemperatureSample(_sensorDevice.getTemperature()));
+    }
+    _sensorDevice.startConversion();
+    // the last filtered temperature is published upon each release
+    const float temperature =
+        static_cast<float>(_temperaturePipeline.getOutput()) / kTemperatureScale;
+    _rideStateBus.publishTemperature(temperature);
+
+    simulateComputationTime(advembsof::TaskLogger::kTemperatureTaskIndex, taskStartTime);
+
+    _taskLogger.logPeriodAndExecutionTime(
+        _timer, advembsof::TaskLogger::kTemperatureTaskIndex, taskStartTime);
+}
+
+template <typename SchedulingPolicy, typename InputPolicy>
+void BikeSystem<SchedulingPolicy, InputPolicy>::resetTask() {
+    PROFILE_SCOPE("BikeSystem::resetTask");
+    auto taskStartTime = _timer.elapsed_time();
+
+    // polled inputs report the reset here, other inputs through onReset()
+    if (_input.checkReset()) {
+        _resetTime = _input.getPressTime();
+        core_util_atomic_store_bool(&_resetFlag, true);
+    }
+
+    if (core_util_atomic_exchange_bool(&_resetFlag, false)) {
+        _speedometer.reset();
+        const uint32_t responseTime =
+            static_cast<uint32_t>((_timer.elapsed_time() - _resetTime).count());
+        deferredLog<LogFormatId::ResetResponseTime>(responseTime);
+        recordMetric<MetricId::ResetResponseTime>(responseTime);
+    }
+
+    _taskLogger.logPeriodAndExecutionTime(
+        _timer, advembsof::TaskLogger::kResetTaskIndex, taskStartTime);
+}
+
+template <typename SchedulingPolicy, typename InputPolicy>
+void BikeSystem<SchedulingPolicy, InputPolicy>::displayTask1() {
+    PROFILE_SCOPE("BikeSystem::displayTask1");
+    auto taskStartTime = _timer.elapsed_time();
+
+    // with event-driven inputs, the distance is not published by a periodic task
+    if (InputPolicy::kIsEventDriven) {
+        publishSpeedAndDistance();
+    }
+
+    _displayGearSubscriber.update();
+    _displaySpeedSubscriber.update();
+    const SpeedState& speedState = _displaySpeedSubscriber.getValue();
+    _displayFrame.gear           = _displayGearSubscriber.getValue().gear;
+    _displayFrame.speed          = speedState.speed;
+    _displayFrame.distance       = speedState.distance;
+    // rendering is left to the renderer thread
+    _displayRenderer.submit(_displayFrame);
+
+    _taskLogger.logPeriodAndExecutionTime(
+        _timer, advembsof::TaskLogger::kDisplayTask1Index, taskStartTime);
+}
+
+template <typename SchedulingPolicy, typename InputPolicy>
+void BikeSystem<SchedulingPolicy, InputPolicy>::displayTask2() {
+    PROFILE_SCOPE("BikeSystem::displayTask2");
+    auto taskStartTime = _timer.elapsed_time();
+
+    // low-criticality task: stretched or dropped in degraded mode
+    if (!_overloadMonitor.isLowCriticalityReleased()) {
+        // the slot is left idle when computation time is simulated
+        simulateComputationTime(advembsof::TaskLogger::kDisplayTask2Index,
+                                taskStartTime);
+        return;
+    }
+
+    _displayTemperatureSubscriber.update();
+    _displayFrame.temperature = _displayTemperatureSubscriber.getValue();
+    _displayFrame.flags |= DisplayFrame::kTemperatureValidFlag;
+    // rendering is left to the renderer thread
+    _displayRenderer.submit(_displayFrame);
+
+    _taskLogger.logPeriodAndExecutionTime(
+        _timer, advembsof::TaskLogger::kDisplayTask2Index, taskStartTime);
+}
+
+template <typename SchedulingPolicy, typename InputPolicy>
+void BikeSystem<SchedulingPolicy, InputPolicy>::runTask(uint8_t taskIndex) {
+    switch (taskIndex) {
+        case advembsof::TaskLogger::kGearTaskIndex:
+            gearTask();
+            break;
+        case advembsof::TaskLogger::kSpeedTaskIndex:
+            speedDistanceTask();
+            break;
+        case advembsof::TaskLogger::kTemperatureTaskIndex:
+            temperatureTask();
+            break;
+        case advembsof::TaskLogger::kResetTaskIndex:
+            resetTask();
+            break;
+        case advembsof::TaskLogger::kDisplayTask1Index:
+            displayTask1();
+            break;
+        case advembsof::TaskLogger::kDisplayTask2Index:
+            displayTask2();
+            break;
+        default:
+            break;
+    }
+}
+
+template <typename SchedulingPolicy, typename InputPolicy>
+bool BikeSystem<SchedulingPolicy, InputPolicy>::onMajorCycle(bool deadlineMissed) {
+    // update the operating mode at the end of each major cycle
+    _overloadMonitor.sample(deadlineMissed);
+    // the cpu usage of each thread is sampled over the same period
+    _threadCpuMonitor.sample();
+    incrementMetric<MetricId::MajorCycles>();
+    if (deadlineMissed) {
+        incrementMetric<MetricId::DeadlineMisses>();
+    }
+    setMetric<MetricId::CpuLoad>(_overloadMonitor.getLastCpuLoad());
+    // the fragmentation of the heap is detected before an allocation fails
+    _heapAnalyzer.analyze();
+    const HeapAnalyzer::Report& heapReport = _heapAnalyzer.getLastReport();
+    setMetric<MetricId::HeapLargestFreeBlock>(
+        static_cast<int32_t>(heapReport.largestFreeBlock));
+    setMetric<MetricId::HeapFragmentation>(heapReport.fragmentationIndex);
+    // the stack high-water marks are raised before the stacks overflow
+    _stackMonitor.sample();
+
+    // the major cycle boundary is the safe point for changing the schedule
+    const bool hasChanged = _taskTable.applyPendingChanges();
+
+#if !defined(MBED_TEST_MODE)
+    // stats printing is a low-criticality activity
+    if (_overloadMonitor.isLowCriticalityReleased()) {
+        // same statistics as the CPULogger, over the last major cycle (deferred log)
+        const uint32_t cpuUsage = _overloadMonitor.getLastCpuLoad();
+        deferredLog<LogFormatId::CpuUsage>(100 - cpuUsage, cpuUsage);
+        _threadCpuMonitor.printStats();
+        logRideState();
+    }
+#endif
+
+    // the first major cycle completes the initialization (threads, buffers allocated
+    // upon first use): the steady state starts and must not allocate from the heap
+    if (!_isAllocationGuardSealed) {
+        AllocationGuard::seal(kAllocationSealMode);
+        _isAllocationGuardSealed = true;
+    }
+
+    return hasChanged;
+}
+
+template <typename SchedulingPolicy, typename InputPolicy>
+void BikeSystem<SchedulingPolicy, InputPolicy>::logRideState() {
+    _loggerGearSubscriber.update();
+    _loggerSpeedSubscriber.update();
+    _loggerTemperatureSubscriber.update();
+
+    // floats are formatted without printf
+    char speedText[kMaxFormattedSize];
+    char distanceText[kMaxFormattedSize];
+    char temperatureText[kMaxFormattedSize];
+    formatFloat(speedText, sizeof(speedText), _loggerSpeedSubscriber.getValue().speed, 1);
+    formatFloat(distanceText,
+                sizeof(distanceText),
+                _loggerSpeedSubscriber.getValue().distance,
+                1);
+    formatFloat(temperatureText,
+                sizeof(temperatureText),
+                _loggerTemperatureSubscriber.getValue(),
+                1);
+
+    // ages are expressed in ms
+    const std::chrono::microseconds now = _rideStateBus.getTime();
+    tr_debug("Gear %d (age %" PRIu64 "), speed %s distance %s (age %" PRIu64
+             "), temperature %s (age %" PRIu64 ")",
+             _loggerGearSubscriber.getValue().gear,
+             std::chrono::duration_cast<std::chrono::milliseconds>(
+                 _loggerGearSubscriber.getAge(now))
+                 .count(),
+             speedText,
+             distanceText,
+             std::chrono::duration_cast<std::chrono::milliseconds>(
+                 _loggerSpeedSubscriber.getAge(now))
+                 .count(),
+             temperatureText,
+             std::chrono::duration_cast<std::chrono::milliseconds>(
+                 _loggerTemperatureSubscriber.getAge(now))
+                 .count());
+    _rideStateBus.printStats();
+    _sensorDevice.printStats();
+    _displayRenderer.printStats();
+    DeferredLog::getInstance().printStats();
+    PoolAllocator::printStats();
+    _heapAnalyzer.printStats();
+    _stackMonitor.printStats();
+    AllocationGuard::printStats();
+}
+
+template <typename SchedulingPolicy, typename InputPolicy>
+void BikeSystem<SchedulingPolicy, InputPolicy>::simulateComputationTime(
+    uint8_t taskIndex, const std::chrono::microseconds& taskStartTime) {
+    // simulate task computation by waiting for the required task computation time
+    if (!ComputationPolicy<SchedulingPolicy, InputPolicy>::kSimulateComputationTime) {
+        return;
+    }
+    const std::chrono::microseconds endTime =
+        taskStartTime + _taskTable.getTask(taskIndex).computationTime;
+    const std::chrono::microseconds now = _timer.elapsed_time();
+    if (endTime > now) {
+        ThisThread::sleep_for(
+            std::chrono::duration_cast<std::chrono::milliseconds>(endTime - now));
+    }
+}
+
+// explicit instantiation of all variants
+template class BikeSystem<static_scheduling::SuperLoopScheduling,
+                          static_scheduling::PollingInput>;
+template class BikeSystem<static_scheduling_with_event::EventQueueScheduling,
+                          static_scheduling::PollingInput>;
+template class BikeSystem<static_scheduling_with_event::EventQueueScheduling,
+                          static_scheduling_with_event::InterruptInput>;
+template class BikeSystem<static_scheduling_with_event::EventQueueScheduling,
+                          multi_tasking::EventInput>;
+
+}  // namespace bike_computer
@@ -0,0 +1,219 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file bike_system_template.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Bike System header file (policy-based, shared by all variants)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include <chrono>
+
+// from advembsof
+#include "task_logger.hpp"
+
+// from common
+#include "allocation_guard.hpp"
+#include "constants.hpp"
+#include "dirty_field_display.hpp"
+#include "display_renderer.hpp"
+#include "frame_buffer_display_device.hpp"
+#include "heap_analyzer.hpp"
+#include "lcd_display_backend.hpp"
+#include "overload_monitor.hpp"
+#include "ride_state_bus.hpp"
+#include "sensor_device.hpp"
+#include "sensor_filter.hpp"
+#include "speedometer.hpp"
+#include "stack_monitor.hpp"
+#include "task_table.hpp"
+#include "thread_cpu_monitor.hpp"
+
+namespace bike_computer {
+
+// a major cycle lasting longer than its duration + kDeadlineTolerance is considered
+// as a deadline miss
+static constexpr std::chrono::milliseconds kDeadlineTolerance = 50ms;
+
+// once initialized, the system must not allocate from the heap: allocations are
+// trapped in debug builds and logged otherwise (the tests check the logged allocations)
+#if defined(MBED_DEBUG) && !defined(MBED_TEST_MODE)
+static constexpr AllocationGuard::SealMode kAllocationSealMode =
+    AllocationGuard::SealMode::Trap;
+#else
+static constexpr AllocationGuard::SealMode kAllocationSealMode =
+    AllocationGuard::SealMode::Log;
+#endif  // defined(MBED_DEBUG) && !defined(MBED_TEST_MODE)
+
+// temperature channel of the sensor pipeline: each acquisition of the temperature
+// task is a sample, the oversampling rate being the rate of the task
+using TemperaturePipeline =
+    SensorPipeline<IirFilter<kTemperatureFilterShift>, kMaxTemperatureOversamplingRatio>;
+
+// Computation policy of a variant, separate from its scheduling policy: the tasks run
+// for their actual computation time, unless a specialization defines
+// kSimulateComputationTime for stretching them to the computation time of the task
+// table (static scheduling variants, with either scheduling policy)
+template <typename SchedulingPolicy, typename InputPolicy>
+struct ComputationPolicy {
+    static constexpr bool kSimulateComputationTime = false;
+};
+
+// The BikeSystem is parameterized by
+// - a SchedulingPolicy that releases the tasks registered in the task table: it
+//   implements start(System&), stop() and getEventQueue()
+// - an InputPolicy that reads the gear, pedal and reset devices: it implements
+//   getCurrentGear(), getCurrentGearSize(), getCurrentRotationTime(), checkReset(),
+//   getPressTime(), serveReset() and getGearDevice() and defines kIsEventDriven
+// Policies are resolved at compile time and all variants are explicitly
+// instantiated in bike_system_template.cpp.
+template <typename SchedulingPolicy, typename InputPolicy>
+class BikeSystem {
+   public:
+    // constructor
+    BikeSystem();
+
+    // make the class non copyable
+    BikeSystem(BikeSystem&)            = delete;
+    BikeSystem& operator=(BikeSystem&) = delete;
+
+    // method called in main() for starting the system
+    void start();
+
+    // method called for stopping the system
+    void stop();
+
+    // command hook used for changing task periods and phases at runtime
+    TaskTable& getTaskTable();
+
+    // ride state published by the tasks, to which consumers subscribe
+    RideStateBus& getRideStateBus();
+
+    // used for configuring the oversampling ratio of the temperature
+    TemperaturePipeline& getTemperaturePipeline();
+
+#if defined(MBED_TEST_MODE)
+    const advembsof::TaskLogger& getTaskLogger() const;
+    OverloadMonitor& getOverloadMonitor();
+    Speedometer& getSpeedometer();
+    DirtyFieldDisplay& getDirtyFieldDisplay();
+    DisplayRenderer& getDisplayRenderer();
+    ThreadCpuMonitor& getThreadCpuMonitor();
+    HeapAnalyzer& getHeapAnalyzer();
+    StackMonitor& getStackMonitor();
+    typename InputPolicy::GearDevice& getGearDevice();
+    uint8_t getCurrentGear();
+#endif  // defined(MBED_TEST_MODE)
+
+    // these methods must be made public for test purposes only
+#if defined(MBED_TEST_MODE)
+
+   public:
+#else
+
+   private:
+#endif
+    // called upon reset by interrupt-based input policies (ISR context)
+    void onReset();
+
+   private:
+    // the scheduling policy releases the tasks and the major cycle processing
+    friend SchedulingPolicy;
+
+    // private methods
+    void init();
+    void onInputChanged();
+    void updateGear();
+    void updateSpeedAndDistance();
+    void publishSpeedAndDistance();
+    void gearTask();
+    void speedDistanceTask();
+    void temperatureTask();
+    void resetTask();
+    void displayTask1();
+    void displayTask2();
+    void runTask(uint8_t taskIndex);
+    bool onMajorCycle(bool deadlineMissed);
+    void logRideState();
+    void simulateComputationTime(uint8_t taskIndex,
+                                 const std::chrono::microseconds& taskStartTime);
+
+    // timer instance used for logging task time and used by the devices
+    Timer _timer;
+    // scheduling and input policies (the input policy may use the event queue of
+    // the scheduling policy)
+    SchedulingPolicy _scheduler;
+    InputPolicy _input;
+    // ride state shared by the tasks and the subscriptions of the consumers
+    RideStateBus _rideStateBus;
+    RideStateBus::GearTopic::Subscriber _speedTaskGearSubscriber;
+    RideStateBus::GearTopic::Subscriber _displayGearSubscriber;
+    RideStateBus::SpeedTopic::Subscriber _displaySpeedSubscriber;
+    RideStateBus::TemperatureTopic::Subscriber _displayTemperatureSubscriber;
+    RideStateBus::GearTopic::Subscriber _loggerGearSubscriber;
+    RideStateBus::SpeedTopic::Subscriber _loggerSpeedSubscriber;
+    RideStateBus::TemperatureTopic::Subscriber _loggerTemperatureSubscriber;
+#if defined(MBED_TEST_MODE)
+    RideStateBus::GearTopic::Subscriber _testGearSubscriber;
+#endif  // defined(MBED_TEST_MODE)
+    // used for computing the reset response time
+    std::chrono::microseconds _resetTime = std::chrono::microseconds::zero();
+    // reset flag (set in onReset)
+    volatile bool _resetFlag = false;
+    // data members that represent the device display: the fields are drawn with the
+    // glyph atlases into a frame buffer whose dirty regions are flushed to the LCD
+    LcdDisplayBackend _lcdDisplayBackend;
+    FrameBufferDisplayDevice _fieldDisplayDevice;
+    // only the fields whose text changed are redrawn
+    DirtyFieldDisplay _dirtyFieldDisplay;
+    // the fields are rendered by a low-priority thread from the latest frame model
+    // built by the display tasks
+    DisplayRenderer _displayRenderer;
+    DisplayFrame _displayFrame;
+    // data member that represents the device for counting wheel rotations
+    Speedometer _speedometer;
+    // data member that represents the sensor device
+    SensorDevice _sensorDevice;
+    // filtering of the acquired temperatures
+    TemperaturePipeline _temperaturePipeline;
+
+    // used for logging task info
+    advembsof::TaskLogger _taskLogger;
+
+    // used for accounting the cpu usage of each thread and of the interrupts
+    ThreadCpuMonitor _threadCpuMonitor;
+
+    // used for switching between normal and degraded (overload) modes
+    OverloadMonitor _overloadMonitor;
+
+    // used for detecting the fragmentation of the heap
+    HeapAnalyzer _heapAnalyzer;
+
+    // used for recommending the stack size of each thread from its high-water mark
+    StackMonitor _stackMonitor;
+
+    // runtime task table
+    TaskTable _taskTable;
+
+    // set once the allocation guard was sealed, at the end of the first major cycle
+    bool _isAllocationGuardSealed = false;
+};
+
+}  // namespace bike_computer
@@ -0,0 +1,293 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file bus_scheduler.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief BusScheduler implementation
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include "bus_scheduler.hpp"
+
+#include <cinttypes>
+
+#include "mbed_trace.h"
+#if MBED_CONF_MBED_TRACE_ENABLE
+#define TRACE_GROUP "BusScheduler"
+#endif  // MBED_CONF_MBED_TRACE_ENABLE
+
+namespace bike_computer {
+
+// definition required when the constant is odr-used (C++14)
+constexpr uint8_t BusScheduler::kNbrOfPriorities;
+
+I2CTransactionBus::I2CTransactionBus(I2C& i2c) : _i2c(i2c) {}
+
+int I2CTransactionBus::transfer(uint8_t address,
+                                const char* writeData,
+                                uint16_t writeLength,
+                                char* readData,
+                                uint16_t readLength) {
+    int result = 0;
+    _i2c.lock();
+    if (writeLength > 0) {
+        // the read follows with a repeated start
+        result = _i2c.write(address, writeData, writeLength, readLength > 0);
+    }
+    if (result == 0 && readLength > 0) {
+        result = _i2c.read(address, readData, readLength);
+    }
+    _i2c.unlock();
+    return result;
+}
+
+BusTransaction::BusTransaction(uint8_t address,
+                               const char* writeData,
+                               uint16_t writeLength,
+                               char* readData,
+                               uint16_t readLength,
+                               BusPriority priority,
+                               Callback<void(int)> onCompleted)
+    : _address(address),
+      _writeData(writeData),
+      _writeLength(writeLength),
+      _readData(readData),
+      _readLength(readLength),
+      _priority(priority),
+      _onCompleted(onCompleted) {}
+
+BusPriority BusTransaction::getPriority() const { return _priority; }
+
+bool BusTransaction::isPending() const { return core_util_atomic_load_bool(&_isPending); }
+
+int BusTransaction::getResult() const { return _result; }
+
+std::chrono::microseconds BusTransaction::getQueueWait() const { return _queueWait; }
+
+BusScheduler::BusScheduler(TransactionBus& bus,
+                           osPriority threadPriority,
+                           const char* name)
+    : _bus(bus), _thread(threadPriority, OS_STACK_SIZE, nullptr, name) {
+    _timer.start();
+}
+
+BusScheduler::~BusScheduler() { stop(); }
+
+void BusScheduler::start() {
+    if (_isStarted) {
+        return;
+    }
+    _isStarted = true;
+    core_util_atomic_store_bool(&_isStopping, false);
+    _thread.start(callback(this, &BusScheduler::run));
+}
+
+void BusScheduler::stop() {
+    if (!_isStarted) {
+        return;
+    }
+    core_util_atomic_store_bool(&_isStopping, true);
+    // wake up the bus thread
+    _semaphore.release();
+    _thread.join();
+    _isStarted = false;
+}
+
+bool BusScheduler::submit(BusTransaction& transaction) {
+    if (core_util_atomic_exchange_bool(&transaction._isPending, true)) {
+        return false;
+    }
+    const uint8_t priorityIndex = static_cast<uint8_t>(transaction._priority);
+
+    _mutex.lock();
+    transaction._submitTime = _timer.elapsed_time();
+    transaction._next       = nullptr;
+    if (_tails[priorityIndex] == nullptr) {
+        _heads[priorityIndex] = &transaction;
+    } else {
+        _tails[priorityIndex]->_next = &transaction;
+    }
+    _tails[priorityIndex] = &transaction;
+    _queueLength++;
+    if (_queueLength > _maxQueueLength) {
+        _maxQueueLength = _queueLength;
+    }
+    _mutex.unlock();
+
+    _semaphore.release();
+    return true;
+}
+
+// bound to the completion callback of blocking transactions
+static void releaseSemaphore(Semaphore* semaphore, int result) { semaphore->release(); }
+
+int BusScheduler::transfer(uint8_t address,
+                           const char* writeData,
+                           uint16_t writeLength,
+                           char* readData,
+                           uint16_t readLength,
+                           BusPriority priority) {
+    Semaphore completed;
+    BusTransaction transaction(address,
+                               writeData,
+                               writeLength,
+                               readData,
+                               readLength,
+                               priority,
+                               callback(releaseSemaphore, &completed));
+    submit(transaction);
+    completed.acquire();
+    return transaction.getResult();
+}
+
+uint32_t BusScheduler::getNbrOfTransactions(BusPriority priority) const {
+    _mutex.lock();
+    const uint32_t nbrOfTransactions = _nbrOfTransactions[static_cast<uint8_t>(priority)];
+    _mutex.unlock();
+    return nbrOfTransactions;
+}
+
+uint32_t BusScheduler::getNbrOfErrors() const {
+    _mutex.lock();
+    const uint32_t nbrOfErrors = _nbrOfErrors;
+    _mutex.unlock();
+    return nbrOfErrors;
+}
+
+uint16_t BusScheduler::getQueueLength() const {
+    _mutex.lock();
+    const uint16_t queueLength = _queueLength;
+    _mutex.unlock();
+    return queueLength;
+}
+
+uint16_t BusScheduler::getMaxQueueLength() const {
+    _mutex.lock();
+    const uint16_t maxQueueLength = _maxQueueLength;
+    _mutex.unlock();
+    return maxQueueLength;
+}
+
+std::chrono::microseconds BusScheduler::getMaxQueueWait(BusPriority priority) const {
+    _mutex.lock();
+    const std::chrono::microseconds maxQueueWait =
+        _maxQueueWait[static_cast<uint8_t>(priority)];
+    _mutex.unlock();
+    return maxQueueWait;
+}
+
+std::chrono::microseconds BusScheduler::getAverageQueueWait(BusPriority priority) const {
+    const uint8_t priorityIndex = static_cast<uint8_t>(priority);
+    _mutex.lock();
+    const uint64_t averageQueueWait =
+        (_nbrOfTransactions[priorityIndex] == 0)
+            ? 0
+            : _totalQueueWait[priorityIndex] / _nbrOfTransactions[priorityIndex];
+    _mutex.unlock();
+    return std::chrono::microseconds(averageQueueWait);
+}
+
+uint32_t BusScheduler::getUtilization() const {
+    _mutex.lock();
+    const std::chrono::microseconds busyTime = _busyTime;
+    _mutex.unlock();
+    const std::chrono::microseconds elapsedTime = _timer.elapsed_time();
+    if (elapsedTime.count() == 0) {
+        return 0;
+    }
+    return static_cast<uint32_t>((busyTime.count() * 1000) / elapsedTime.count());
+}
+
+void BusScheduler::printStats() const {
+    tr_info("Bus transactions: high %" PRIu32 " (max wait %" PRIu64
+            " us), normal %" PRIu32 " (max wait %" PRIu64 " us), low %" PRIu32
+            " (max wait %" PRIu64 " us), %" PRIu32 " errors, utilization %" PRIu32
+            " per mille",
+            getNbrOfTransactions(BusPriority::High),
+            static_cast<uint64_t>(getMaxQueueWait(BusPriority::High).count()),
+            getNbrOfTransactions(BusPriority::Normal),
+            static_cast<uint64_t>(getMaxQueueWait(BusPriority::Normal).count()),
+            getNbrOfTransactions(BusPriority::Low),
+            static_cast<uint64_t>(getMaxQueueWait(BusPriority::Low).count()),
+            getNbrOfErrors(),
+            getUtilization());
+}
+
+void BusScheduler::run() {
+    while (true) {
+        _semaphore.acquire();
+        if (core_util_atomic_load_bool(&_isStopping)) {
+            return;
+        }
+        BusTransaction* transaction = dequeue();
+        if (transaction == nullptr) {
+            continue;
+        }
+
+        const std::chrono::microseconds startTime = _timer.elapsed_time();
+        transaction->_queueWait                   = startTime - transaction->_submitTime;
+        transaction->_result                      = _bus.transfer(transaction->_address,
+                                                 transaction->_writeData,
+                                                 transaction->_writeLength,
+                                                 transaction->_readData,
+                                                 transaction->_readLength);
+        const std::chrono::microseconds endTime = _timer.elapsed_time();
+
+        const uint8_t priorityIndex = static_cast<uint8_t>(transaction->_priority);
+        _mutex.lock();
+        _nbrOfTransactions[priorityIndex]++;
+        if (transaction->_result != 0) {
+            _nbrOfErrors++;
+        }
+        _totalQueueWait[priorityIndex] += transaction->_queueWait.count();
+        if (transaction->_queueWait > _maxQueueWait[priorityIndex]) {
+            _maxQueueWait[priorityIndex] = transaction->_queueWait;
+        }
+        _busyTime += endTime - startTime;
+        _mutex.unlock();
+
+        // the transaction may be submitted again from its completion callback (the
+        // callback is copied since the transaction may be destroyed once completed)
+        const Callback<void(int)> onCompleted = transaction->_onCompleted;
+        const int result                      = transaction->_result;
+        core_util_atomic_store_bool(&transaction->_isPending, false);
+        if (onCompleted) {
+            onCompleted(result);
+        }
+    }
+}
+
+BusTransaction* BusScheduler::dequeue() {
+    BusTransaction* transaction = nullptr;
+    _mutex.lock();
+    for (uint8_t priorityIndex = 0; priorityIndex < kNbrOfPriorities; priorityIndex++) {
+        transaction = _heads[priorityIndex];
+        if (transaction != nullptr) {
+            _heads[priorityIndex] = transaction->_next;
+            if (_heads[priorityIndex] == nullptr) {
+                _tails[priorityIndex] = nullptr;
+            }
+            _queueLength--;
+            break;
+        }
+    }
+    _mutex.unlock();
+    return transaction;
+}
+
+}  // namespace bike_computer
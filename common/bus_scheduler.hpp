@@ -0,0 +1,176 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file bus_scheduler.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Bus transaction scheduler (prioritized queue served by a bus thread)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include <chrono>
+
+#include "mbed.h"
+
+namespace bike_computer {
+
+// Bus running transactions: a write followed by a read (repeated start), any of both
+// may be empty. Returns 0 on success (acknowledged transaction), non-zero otherwise.
+class TransactionBus {
+   public:
+    virtual ~TransactionBus() = default;
+
+    virtual int transfer(uint8_t address,
+                         const char* writeData,
+                         uint16_t writeLength,
+                         char* readData,
+                         uint16_t readLength) = 0;
+};
+
+// TransactionBus running the transactions on an I2C master (8-bit addresses)
+class I2CTransactionBus : public TransactionBus {
+   public:
+    explicit I2CTransactionBus(I2C& i2c);  // NOLINT(runtime/references)
+
+    int transfer(uint8_t address,
+                 const char* writeData,
+                 uint16_t writeLength,
+                 char* readData,
+                 uint16_t readLength) override;
+
+   private:
+    // data members
+    I2C& _i2c;
+};
+
+// transactions with a higher priority are served first, transactions with the same
+// priority in submission order (the running transaction is never preempted)
+enum class BusPriority : uint8_t { High = 0, Normal = 1, Low = 2 };
+
+// Transaction submitted to a BusScheduler. The buffers must remain valid and the
+// transaction must not be modified until it is completed. The completion callback is
+// called from the bus thread with the result of the transaction.
+class BusTransaction {
+   public:
+    BusTransaction(uint8_t address,
+                   const char* writeData,
+                   uint16_t writeLength,
+                   char* readData,
+                   uint16_t readLength,
+                   BusPriority priority,
+                   Callback<void(int)> onCompleted = nullptr);
+
+    // make the class non copyable
+    BusTransaction(BusTransaction&)            = delete;
+    BusTransaction& operator=(BusTransaction&) = delete;
+
+    BusPriority getPriority() const;
+    bool isPending() const;
+    // methods valid once the transaction is completed
+    int getResult() const;
+    std::chrono::microseconds getQueueWait() const;
+
+   private:
+    friend class BusScheduler;
+
+    // data members
+    const uint8_t _address;
+    const char* _writeData;
+    const uint16_t _writeLength;
+    char* _readData;
+    const uint16_t _readLength;
+    const BusPriority _priority;
+    Callback<void(int)> _onCompleted;
+    // set by the scheduler
+    volatile bool _isPending              = false;
+    int _result                           = 0;
+    std::chrono::microseconds _submitTime = std::chrono::microseconds::zero();
+    std::chrono::microseconds _queueWait  = std::chrono::microseconds::zero();
+    BusTransaction* _next                 = nullptr;
+};
+
+// The BusScheduler serializes the transactions submitted by several threads on a
+// bus: the transactions are queued by priority and run by the bus thread, the
+// submitting threads never wait on the bus unless they call transfer().
+class BusScheduler {
+   public:
+    static constexpr uint8_t kNbrOfPriorities = 3;
+
+    BusScheduler(TransactionBus& bus,  // NOLINT(runtime/references)
+                 osPriority threadPriority = osPriorityAboveNormal,
+                 const char* name          = "BusScheduler");
+    ~BusScheduler();
+
+    // make the class non copyable
+    BusScheduler(BusScheduler&)            = delete;
+    BusScheduler& operator=(BusScheduler&) = delete;
+
+    // methods for starting and stopping the bus thread (the transactions queued when
+    // the thread is stopped are run once it is restarted)
+    void start();
+    void stop();
+
+    // asynchronous transaction, returns false if the transaction is pending already
+    bool submit(BusTransaction& transaction);  // NOLINT(runtime/references)
+    // blocking transaction (must not be called from a completion callback)
+    int transfer(uint8_t address,
+                 const char* writeData,
+                 uint16_t writeLength,
+                 char* readData,
+                 uint16_t readLength,
+                 BusPriority priority);
+
+    // methods for getting the statistics of the bus
+    uint32_t getNbrOfTransactions(BusPriority priority) const;
+    uint32_t getNbrOfErrors() const;
+    uint16_t getQueueLength() const;
+    uint16_t getMaxQueueLength() const;
+    std::chrono::microseconds getMaxQueueWait(BusPriority priority) const;
+    std::chrono::microseconds getAverageQueueWait(BusPriority priority) const;
+    // time spent running transactions over the lifetime of the scheduler (per mille)
+    uint32_t getUtilization() const;
+    void printStats() const;
+
+   private:
+    // private methods
+    void run();
+    BusTransaction* dequeue();
+
+    // data members
+    TransactionBus& _bus;
+    Thread _thread;
+    Semaphore _semaphore;
+    mutable Mutex _mutex;
+    Timer _timer;
+    bool _isStarted           = false;
+    volatile bool _isStopping = false;
+    // one FIFO per priority
+    BusTransaction* _heads[kNbrOfPriorities] = {nullptr};
+    BusTransaction* _tails[kNbrOfPriorities] = {nullptr};
+    uint16_t _queueLength                    = 0;
+    uint16_t _maxQueueLength                 = 0;
+    // statistics
+    uint32_t _nbrOfTransactions[kNbrOfPriorities]             = {0};
+    uint32_t _nbrOfErrors                                     = 0;
+    uint64_t _totalQueueWait[kNbrOfPriorities]                = {0};
+    std::chrono::microseconds _maxQueueWait[kNbrOfPriorities] = {};
+    std::chrono::microseconds _busyTime                       = {};
+};
+
+}  // namespace bike_computer
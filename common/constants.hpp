@@ -51,4 +51,30 @@ static constexpr std::chrono::milliseconds kMaxPedalRotationTime = 1500ms;
 // definition of pedal rotation time change upon acceleration/deceleration
 static constexpr std::chrono::milliseconds kDeltaPedalRotationTime = 25ms;
 
+// temperature filtering constants
+// temperatures are filtered in hundredths of degrees
+static constexpr int32_t kTemperatureScale = 100;
+// coefficient of the IIR filter (1 / 2^kTemperatureFilterShift)
+static constexpr uint8_t kTemperatureFilterShift = 2;
+// maximal number of acquisitions averaged for each filtered temperature
+static constexpr uint8_t kMaxTemperatureOversamplingRatio = 16;
+
+// display constants
+// resolution of the displayed fields (number of decimals): the fields are redrawn
+// when their text at this resolution changes
+static constexpr uint8_t kGearDecimals        = 0;
+static constexpr uint8_t kSpeedDecimals       = 1;
+static constexpr uint8_t kDistanceDecimals    = 2;
+static constexpr uint8_t kTemperatureDecimals = 1;
+
+// heap constants
+// a warning is raised when the largest free block of the heap cannot hold the stack
+// of a thread created with the default stack size
+static constexpr uint32_t kHeapWarningSize = OS_STACK_SIZE;
+
+// stack constants
+// margin added to the stack high-water mark of each thread for recommending its stack
+// size (in percent of the high-water mark)
+static constexpr uint8_t kStackMarginPercent = 25;
+
 }  // namespace bike_computer
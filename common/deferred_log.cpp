@@ -0,0 +1,218 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file deferred_log.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief DeferredLog implementation (binary deferred logging)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include "deferred_log.hpp"
+
+#include <cstdio>
+
+#include "metrics_registry.hpp"
+
+#include "mbed_trace.h"
+#if MBED_CONF_MBED_TRACE_ENABLE
+#define TRACE_GROUP "DeferredLog"
+#endif  // MBED_CONF_MBED_TRACE_ENABLE
+
+namespace bike_computer {
+
+// definitions required when the constants are odr-used (C++14)
+constexpr LogFormat LogFormats::kFormats[LogFormats::kNbrOfFormats];
+constexpr uint32_t DeferredLog::kNbrOfRecords;
+constexpr uint8_t DeferredLog::kMaxNbrOfArguments;
+constexpr uint8_t DeferredLog::kSyncByte;
+constexpr uint8_t DeferredLog::kFrameHeaderSize;
+constexpr uint8_t DeferredLog::kMaxPayloadSize;
+constexpr uint8_t DeferredLog::kMaxFrameSize;
+constexpr std::chrono::milliseconds DeferredLog::kDrainPeriod;
+
+DeferredLog& DeferredLog::getInstance() {
+    static DeferredLog deferredLog;
+    return deferredLog;
+}
+
+DeferredLog::DeferredLog()
+    : _sink(callback(&DeferredLog::writeToConsole)),
+      _thread(osPriorityLow, OS_STACK_SIZE, nullptr, "DeferredLog") {
+    // each record is free for the position of its index
+    for (uint32_t index = 0; index < kNbrOfRecords; index++) {
+        _records[index].sequence = index;
+    }
+    _timer.start();
+}
+
+DeferredLog::~DeferredLog() { stop(); }
+
+void DeferredLog::setSink(Sink sink) {
+    _drainMutex.lock();
+    _sink = sink;
+    _drainMutex.unlock();
+}
+
+void DeferredLog::start() {
+    if (_isStarted) {
+        return;
+    }
+    _isStarted = true;
+    core_util_atomic_store_bool(&_isStopping, false);
+    _thread.start(callback(this, &DeferredLog::run));
+}
+
+void DeferredLog::stop() {
+    if (!_isStarted) {
+        return;
+    }
+    core_util_atomic_store_bool(&_isStopping, true);
+    // wake up the log thread
+    _semaphore.release();
+    _thread.join();
+    _isStarted = false;
+}
+
+void DeferredLog::write(LogFormatId formatId,
+                        const uint32_t* arguments,
+                        uint8_t nbrOfArguments) {
+    // reserve the record at the write position, unless the ring is full
+    uint32_t position = core_util_atomic_load_u32(&_writeIndex);
+    Record* record    = nullptr;
+    while (record == nullptr) {
+        Record& candidate       = _records[position % kNbrOfRecords];
+        const uint32_t sequence = core_util_atomic_load_u32(&candidate.sequence);
+        const int32_t lag       = static_cast<int32_t>(sequence - position);
+        if (lag == 0) {
+            // on failure, position is updated with the current write index
+            if (core_util_atomic_cas_u32(&_writeIndex, &position, position + 1)) {
+                record = &candidate;
+            }
+        } else if (lag < 0) {
+            // the record has not been read yet
+            core_util_atomic_incr_u32(&_nbrOfDroppedRecords, 1);
+            incrementMetric<MetricId::DeferredLogDroppedRecords>();
+            return;
+        } else {
+            // another writer reserved the record
+            position = core_util_atomic_load_u32(&_writeIndex);
+        }
+    }
+
+    record->timestamp      = static_cast<uint32_t>(_timer.elapsed_time().count());
+    record->formatId       = formatId;
+    record->nbrOfArguments = nbrOfArguments;
+    for (uint8_t index = 0; index < nbrOfArguments; index++) {
+        record->arguments[index] = arguments[index];
+    }
+    // publish the record
+    core_util_atomic_store_u32(&record->sequence, position + 1);
+    core_util_atomic_incr_u32(&_nbrOfWrittenRecords, 1);
+}
+
+void DeferredLog::flush() { drain(); }
+
+uint32_t DeferredLog::getNbrOfWrittenRecords() const {
+    return core_util_atomic_load_u32(&_nbrOfWrittenRecords);
+}
+
+uint32_t DeferredLog::getNbrOfDroppedRecords() const {
+    return core_util_atomic_load_u32(&_nbrOfDroppedRecords);
+}
+
+uint32_t DeferredLog::getNbrOfSentFrames() const { return _nbrOfSentFrames; }
+
+void DeferredLog::printStats() const {
+    tr_info("Deferred log: %" PRIu32 " records written, %" PRIu32
+            " dropped, %" PRIu32 " frames sent",
+            getNbrOfWrittenRecords(),
+            getNbrOfDroppedRecords(),
+            getNbrOfSentFrames());
+}
+
+void DeferredLog::run() {
+    while (true) {
+        // the ring is drained periodically, so that writers never signal the thread
+        _semaphore.try_acquire_for(kDrainPeriod);
+        const bool isStopping = core_util_atomic_load_bool(&_isStopping);
+        drain();
+        if (isStopping) {
+            return;
+        }
+    }
+}
+
+void DeferredLog::drain() {
+    uint8_t frame[kMaxFrameSize];
+    Record record;
+    _drainMutex.lock();
+    while (read(record)) {
+        const size_t frameSize = encodeFrame(record, frame);
+        _sink(frame, frameSize);
+        _nbrOfSentFrames++;
+    }
+    _drainMutex.unlock();
+}
+
+bool DeferredLog::read(Record& record) {
+    Record& current = _records[_readIndex % kNbrOfRecords];
+    if (core_util_atomic_load_u32(&current.sequence) != _readIndex + 1) {
+        // the ring is empty or the next record is being written
+        return false;
+    }
+    record.timestamp      = current.timestamp;
+    record.formatId       = current.formatId;
+    record.nbrOfArguments = current.nbrOfArguments;
+    for (uint8_t index = 0; index < current.nbrOfArguments; index++) {
+        record.arguments[index] = current.arguments[index];
+    }
+    // free the record for the next turn of the ring
+    core_util_atomic_store_u32(&current.sequence, _readIndex + kNbrOfRecords);
+    _readIndex++;
+    return true;
+}
+
+size_t DeferredLog::encodeFrame(const Record& record, uint8_t* frame) {
+    const uint16_t formatId = static_cast<uint16_t>(record.formatId);
+    size_t size             = 0;
+    frame[size++]           = kSyncByte;
+    frame[size++]           = static_cast<uint8_t>(formatId);
+    frame[size++]           = static_cast<uint8_t>(formatId >> 8);
+    for (uint8_t shift = 0; shift < 32; shift += 8) {
+        frame[size++] = static_cast<uint8_t>(record.timestamp >> shift);
+    }
+    frame[size++] = 4 * record.nbrOfArguments;
+    for (uint8_t index = 0; index < record.nbrOfArguments; index++) {
+        for (uint8_t shift = 0; shift < 32; shift += 8) {
+            frame[size++] = static_cast<uint8_t>(record.arguments[index] >> shift);
+        }
+    }
+    uint8_t checksum = 0;
+    for (size_t index = 1; index < size; index++) {
+        checksum += frame[index];
+    }
+    frame[size++] = checksum;
+    return size;
+}
+
+void DeferredLog::writeToConsole(const uint8_t* data, size_t size) {
+    fwrite(data, 1, size, stdout);
+    fflush(stdout);
+}
+
+}  // namespace bike_computer
@@ -0,0 +1,202 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file deferred_log.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief DeferredLog header file (binary deferred logging)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include <chrono>
+#include <cstring>
+#include <type_traits>
+
+#include "log_formats.hpp"
+#include "mbed.h"
+
+namespace bike_computer {
+
+// Deferred logging: call sites write a format identifier and the raw values of the
+// arguments into a lock-free ring of records, without any formatting. A low-priority
+// thread drains the ring and sends each record as a binary frame to the sink (the
+// console by default), the frames being decoded on the host (see
+// host/tools/deferred_log_decoder.hpp).
+// A frame is made of the sync byte, the format identifier (16 bits), the timestamp in
+// us (32 bits), the payload size, the payload (the arguments as 32-bit values) and a
+// checksum (8-bit sum of the bytes following the sync byte), all values being stored
+// in little-endian order.
+class DeferredLog {
+   public:
+    // number of records of the ring (records that do not fit are dropped)
+    static constexpr uint32_t kNbrOfRecords     = 64;
+    static constexpr uint8_t kMaxNbrOfArguments = 6;
+    // frame layout
+    static constexpr uint8_t kSyncByte        = 0xA5;
+    static constexpr uint8_t kFrameHeaderSize = 8;
+    static constexpr uint8_t kMaxPayloadSize  = 4 * kMaxNbrOfArguments;
+    static constexpr uint8_t kMaxFrameSize    = kFrameHeaderSize + kMaxPayloadSize + 1;
+    // period at which the ring is drained
+    static constexpr std::chrono::milliseconds kDrainPeriod = 10ms;
+
+    typedef Callback<void(const uint8_t*, size_t)> Sink;
+
+    static DeferredLog& getInstance();
+
+    // make the class non copyable
+    DeferredLog(DeferredLog&)            = delete;
+    DeferredLog& operator=(DeferredLog&) = delete;
+
+    // the sink must be set before the log is started
+    void setSink(Sink sink);
+
+    // start the thread draining the ring (the log thread cannot be restarted once
+    // stopped)
+    void start();
+    // stop the thread, the pending records being sent before it terminates
+    void stop();
+
+    // method called by the call sites: never blocks and may be called from ISR
+    void write(LogFormatId formatId, const uint32_t* arguments, uint8_t nbrOfArguments);
+
+    // send the pending records from the calling thread
+    void flush();
+
+    // methods for getting the statistics
+    uint32_t getNbrOfWrittenRecords() const;
+    uint32_t getNbrOfDroppedRecords() const;
+    uint32_t getNbrOfSentFrames() const;
+
+    // method called for printing the statistics
+    void printStats() const;
+
+   private:
+    DeferredLog();
+    ~DeferredLog();
+
+    // record of the ring: the sequence tells whether the record is free or written
+    // for a given position of the ring (bounded multi-producer queue)
+    struct Record {
+        volatile uint32_t sequence;
+        uint32_t timestamp;
+        LogFormatId formatId;
+        uint8_t nbrOfArguments;
+        uint32_t arguments[kMaxNbrOfArguments];
+    };
+
+    // private methods
+    void run();
+    void drain();
+    bool read(Record& record);  // NOLINT(runtime/references)
+    static size_t encodeFrame(const Record& record, uint8_t* frame);
+    static void writeToConsole(const uint8_t* data, size_t size);
+
+    // data members
+    Timer _timer;
+    Record _records[kNbrOfRecords];
+    volatile uint32_t _writeIndex = 0;
+    uint32_t _readIndex           = 0;
+    // the ring is drained by a single consumer at a time
+    Mutex _drainMutex;
+    Sink _sink;
+    Thread _thread;
+    Semaphore _semaphore;
+    bool _isStarted                        = false;
+    volatile bool _isStopping              = false;
+    volatile uint32_t _nbrOfWrittenRecords = 0;
+    volatile uint32_t _nbrOfDroppedRecords = 0;
+    uint32_t _nbrOfSentFrames              = 0;
+};
+
+// encoding of the log arguments as 32-bit values, only 32-bit (or smaller)
+// integers and floats being supported
+template <typename T, typename Enable = void>
+struct LogArgument;
+
+template <typename T>
+struct LogArgument<
+    T,
+    typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value &&
+                            sizeof(T) <= sizeof(uint32_t)>::type> {
+    static constexpr bool accepts(char conversion) {
+        return conversion == 'd' || conversion == 'i' || conversion == 'c';
+    }
+    static uint32_t encode(T value) {
+        return static_cast<uint32_t>(static_cast<int32_t>(value));
+    }
+};
+
+template <typename T>
+struct LogArgument<
+    T,
+    typename std::enable_if<std::is_integral<T>::value && std::is_unsigned<T>::value &&
+                            sizeof(T) <= sizeof(uint32_t)>::type> {
+    static constexpr bool accepts(char conversion) {
+        return conversion == 'u' || conversion == 'x' || conversion == 'X' ||
+               conversion == 'c';
+    }
+    static uint32_t encode(T value) { return static_cast<uint32_t>(value); }
+};
+
+template <>
+struct LogArgument<float> {
+    static constexpr bool accepts(char conversion) {
+        return conversion == 'f' || conversion == 'e' || conversion == 'g';
+    }
+    static uint32_t encode(float value) {
+        uint32_t bits = 0;
+        memcpy(&bits, &value, sizeof(bits));
+        return bits;
+    }
+};
+
+// checks the types of the arguments against the conversions of a format
+template <typename... Args>
+struct LogArguments {
+    static constexpr bool accept(const char* format, uint8_t index) { return true; }
+};
+
+template <typename T, typename... Args>
+struct LogArguments<T, Args...> {
+    static constexpr bool accept(const char* format, uint8_t index) {
+        return LogArgument<T>::accepts(LogFormats::getConversion(format, index)) &&
+               LogArguments<Args...>::accept(format, index + 1);
+    }
+};
+
+// writes a record to the deferred log, the arguments being checked against the
+// format at compile time, e.g. deferredLog<LogFormatId::SpeedometerSpeed>(speed)
+template <LogFormatId kFormatId, typename... Args>
+void deferredLog(Args... args) {
+    static_assert(
+        LogFormats::getNbrOfArguments(
+            LogFormats::kFormats[static_cast<uint16_t>(kFormatId)].format) ==
+            sizeof...(Args),
+        "the number of arguments does not match the log format");
+    static_assert(sizeof...(Args) <= DeferredLog::kMaxNbrOfArguments,
+                  "too many log arguments");
+    static_assert(LogArguments<Args...>::accept(
+                      LogFormats::kFormats[static_cast<uint16_t>(kFormatId)].format, 0),
+                  "the types of the arguments do not match the log format");
+    // the first element allows formats without arguments
+    const uint32_t arguments[] = {0, LogArgument<Args>::encode(args)...};
+    DeferredLog::getInstance().write(kFormatId, &arguments[1], sizeof...(Args));
+}
+
+}  // namespace bike_computer
@@ -0,0 +1,139 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file dirty_field_display.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief DirtyFieldDisplay implementation
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include "dirty_field_display.hpp"
+
+#include <cinttypes>
+#include <cstring>
+
+#include "constants.hpp"
+#include "fixed_point_format.hpp"
+
+#include "mbed_trace.h"
+#if MBED_CONF_MBED_TRACE_ENABLE
+#define TRACE_GROUP "DirtyFieldDisplay"
+#endif  // MBED_CONF_MBED_TRACE_ENABLE
+
+namespace bike_computer {
+
+// definition required when the constant is odr-used (C++14)
+constexpr uint8_t DirtyFieldDisplay::kNbrOfFields;
+
+DirtyFieldDisplay::DirtyFieldDisplay(FieldDisplayDevice& displayDevice)
+    : _displayDevice(displayDevice) {}
+
+void DirtyFieldDisplay::invalidate() {
+    for (uint8_t index = 0; index < kNbrOfFields; index++) {
+        _fields[index].isValid = false;
+    }
+}
+
+bool DirtyFieldDisplay::updateGear(uint8_t gear) {
+    if (!isDirty(Field::Gear, kGearDecimals, gear)) {
+        return false;
+    }
+    _displayDevice.displayGear(gear);
+    return true;
+}
+
+bool DirtyFieldDisplay::updateSpeed(float speed) {
+    if (!isDirty(Field::Speed, kSpeedDecimals, speed)) {
+        return false;
+    }
+    _displayDevice.displaySpeed(speed);
+    return true;
+}
+
+bool DirtyFieldDisplay::updateDistance(float distance) {
+    if (!isDirty(Field::Distance, kDistanceDecimals, distance)) {
+        return false;
+    }
+    _displayDevice.displayDistance(distance);
+    return true;
+}
+
+bool DirtyFieldDisplay::updateTemperature(float temperature) {
+    if (!isDirty(Field::Temperature, kTemperatureDecimals, temperature)) {
+        return false;
+    }
+    _displayDevice.displayTemperature(temperature);
+    return true;
+}
+
+void DirtyFieldDisplay::endFrame() { _displayDevice.endFrame(); }
+
+const char* DirtyFieldDisplay::getText(Field field) const {
+    return _fields[static_cast<uint8_t>(field)].text;
+}
+
+float DirtyFieldDisplay::getRenderedValue(Field field) const {
+    return _fields[static_cast<uint8_t>(field)].value;
+}
+
+uint32_t DirtyFieldDisplay::getNbrOfRedrawnFields(Field field) const {
+    return _fields[static_cast<uint8_t>(field)].nbrOfRedraws;
+}
+
+uint32_t DirtyFieldDisplay::getNbrOfSkippedFields(Field field) const {
+    return _fields[static_cast<uint8_t>(field)].nbrOfSkips;
+}
+
+uint32_t DirtyFieldDisplay::getNbrOfRedrawnFields() const {
+    uint32_t nbrOfRedraws = 0;
+    for (uint8_t index = 0; index < kNbrOfFields; index++) {
+        nbrOfRedraws += _fields[index].nbrOfRedraws;
+    }
+    return nbrOfRedraws;
+}
+
+uint32_t DirtyFieldDisplay::getNbrOfSkippedFields() const {
+    uint32_t nbrOfSkips = 0;
+    for (uint8_t index = 0; index < kNbrOfFields; index++) {
+        nbrOfSkips += _fields[index].nbrOfSkips;
+    }
+    return nbrOfSkips;
+}
+
+void DirtyFieldDisplay::printStats() const {
+    tr_info("Display fields: %" PRIu32 " redrawn, %" PRIu32 " skipped",
+            getNbrOfRedrawnFields(),
+            getNbrOfSkippedFields());
+}
+
+bool DirtyFieldDisplay::isDirty(Field field, uint8_t nbrOfDecimals, float value) {
+    FieldState& fieldState = _fields[static_cast<uint8_t>(field)];
+    char text[kMaxTextSize];
+    formatFloat(text, sizeof(text), value, nbrOfDecimals);
+    if (fieldState.isValid && strcmp(text, fieldState.text) == 0) {
+        fieldState.nbrOfSkips++;
+        return false;
+    }
+    memcpy(fieldState.text, text, sizeof(text));
+    fieldState.value   = value;
+    fieldState.isValid = true;
+    fieldState.nbrOfRedraws++;
+    return true;
+}
+
+}  // namespace bike_computer
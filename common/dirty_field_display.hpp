@@ -0,0 +1,89 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file dirty_field_display.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Display layer redrawing only the fields whose text changed
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include "field_display_device.hpp"
+#include "mbed.h"
+
+namespace bike_computer {
+
+// The DirtyFieldDisplay remembers, for each field of the display, the last rendered
+// value and its text as shown on screen. A field is redrawn only if the text of the
+// new value differs from the displayed one (a value changing below the displayed
+// resolution does not trigger a redraw).
+class DirtyFieldDisplay {
+   public:
+    enum class Field : uint8_t { Gear = 0, Speed = 1, Distance = 2, Temperature = 3 };
+    static constexpr uint8_t kNbrOfFields = 4;
+
+    explicit DirtyFieldDisplay(
+        FieldDisplayDevice& displayDevice);  // NOLINT(runtime/references)
+
+    // make the class non copyable
+    DirtyFieldDisplay(DirtyFieldDisplay&)            = delete;
+    DirtyFieldDisplay& operator=(DirtyFieldDisplay&) = delete;
+
+    // method called when the screen content is lost (e.g. upon display
+    // initialization): all fields are redrawn at their next update
+    void invalidate();
+
+    // methods returning true if the field was redrawn
+    bool updateGear(uint8_t gear);
+    bool updateSpeed(float speed);
+    bool updateDistance(float distance);
+    bool updateTemperature(float temperature);
+    // method called once the fields of a frame are updated: the redrawn fields are
+    // shown on screen
+    void endFrame();
+
+    // methods for getting the rendered fields and the statistics
+    const char* getText(Field field) const;
+    float getRenderedValue(Field field) const;
+    uint32_t getNbrOfRedrawnFields(Field field) const;
+    uint32_t getNbrOfSkippedFields(Field field) const;
+    uint32_t getNbrOfRedrawnFields() const;
+    uint32_t getNbrOfSkippedFields() const;
+    void printStats() const;
+
+   private:
+    static constexpr uint8_t kMaxTextSize = 16;
+
+    struct FieldState {
+        char text[kMaxTextSize] = {0};
+        float value             = 0.0f;
+        bool isValid            = false;
+        uint32_t nbrOfRedraws   = 0;
+        uint32_t nbrOfSkips     = 0;
+    };
+
+    // private methods
+    bool isDirty(Field field, uint8_t nbrOfDecimals, float value);
+
+    // data members
+    FieldDisplayDevice& _displayDevice;
+    FieldState _fields[kNbrOfFields];
+};
+
+}  // namespace bike_computer
@@ -0,0 +1,52 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file display_device_adapter.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Adapter of the advembsof display device to the FieldDisplayDevice interface
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include "display_device_adapter.hpp"
+
+namespace bike_computer {
+
+DisplayDeviceAdapter::DisplayDeviceAdapter(advembsof::DisplayDevice& displayDevice)
+    : _displayDevice(displayDevice) {}
+
+disco::ReturnCode DisplayDeviceAdapter::init() { return _displayDevice.init(); }
+
+void DisplayDeviceAdapter::displayGear(uint8_t gear) { _displayDevice.displayGear(gear); }
+
+void DisplayDeviceAdapter::displaySpeed(float speed) {
+    _displayDevice.displaySpeed(speed);
+}
+
+void DisplayDeviceAdapter::displayDistance(float distance) {
+    _displayDevice.displayDistance(distance);
+}
+
+void DisplayDeviceAdapter::displayTemperature(float temperature) {
+    _displayDevice.displayTemperature(temperature);
+}
+
+void DisplayDeviceAdapter::endFrame() {
+    // the fields are already shown on screen
+}
+
+}  // namespace bike_computer
@@ -0,0 +1,57 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file display_device_adapter.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Adapter of the advembsof display device to the FieldDisplayDevice interface
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include "display_device.hpp"
+#include "field_display_device.hpp"
+#include "mbed.h"
+
+namespace bike_computer {
+
+// Adapter of the display device of the advembsof library, which draws each field
+// directly on the screen with its generic font: there is no frame to flush
+class DisplayDeviceAdapter : public FieldDisplayDevice {
+   public:
+    explicit DisplayDeviceAdapter(
+        advembsof::DisplayDevice& displayDevice);  // NOLINT(runtime/references)
+
+    // make the class non copyable
+    DisplayDeviceAdapter(DisplayDeviceAdapter&)            = delete;
+    DisplayDeviceAdapter& operator=(DisplayDeviceAdapter&) = delete;
+
+    // FieldDisplayDevice
+    disco::ReturnCode init() override;
+    void displayGear(uint8_t gear) override;
+    void displaySpeed(float speed) override;
+    void displayDistance(float distance) override;
+    void displayTemperature(float temperature) override;
+    void endFrame() override;
+
+   private:
+    // data members
+    advembsof::DisplayDevice& _displayDevice;
+};
+
+}  // namespace bike_computer
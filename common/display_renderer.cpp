@@ -0,0 +1,191 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file display_renderer.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Asynchronous display renderer fed with the latest frame model
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include "display_renderer.hpp"
+
+#include <cinttypes>
+
+#include "metrics_registry.hpp"
+#include "scope_profiler.hpp"
+
+#include "mbed_trace.h"
+#if MBED_CONF_MBED_TRACE_ENABLE
+#define TRACE_GROUP "DisplayRenderer"
+#endif  // MBED_CONF_MBED_TRACE_ENABLE
+
+namespace bike_computer {
+
+// definition required when the constant is odr-used (C++14)
+constexpr uint8_t DisplayFrame::kTemperatureValidFlag;
+
+DisplayRenderer::DisplayRenderer(DirtyFieldDisplay& display,
+                                 osPriority threadPriority,
+                                 const char* name)
+    : _display(display), _thread(threadPriority, OS_STACK_SIZE, nullptr, name) {
+    _handoff.reset(Slot());
+    _timer.start();
+}
+
+DisplayRenderer::~DisplayRenderer() { stop(); }
+
+void DisplayRenderer::start() {
+    if (_isStarted) {
+        return;
+    }
+    _isStarted = true;
+    core_util_atomic_store_bool(&_isStopping, false);
+    _thread.start(callback(this, &DisplayRenderer::run));
+}
+
+void DisplayRenderer::stop() {
+    if (!_isStarted) {
+        return;
+    }
+    core_util_atomic_store_bool(&_isStopping, true);
+    // wake up the renderer thread
+    _semaphore.release();
+    _thread.join();
+    _isStarted = false;
+}
+
+void DisplayRenderer::submit(const DisplayFrame& frame) {
+    Slot& slot    = _handoff.getWriteBuffer();
+    slot.frame    = frame;
+    slot.sequence = core_util_atomic_incr_u32(&_nbrOfSubmittedFrames, 1);
+    _handoff.publish();
+    _semaphore.release();
+}
+
+void DisplayRenderer::setFieldRenderingTime(
+    DirtyFieldDisplay::Field field, const std::chrono::milliseconds& renderingTime) {
+    _fieldRenderingTimes[static_cast<uint8_t>(field)] = renderingTime;
+}
+
+uint32_t DisplayRenderer::getNbrOfSubmittedFrames() const {
+    return core_util_atomic_load_u32(&_nbrOfSubmittedFrames);
+}
+
+uint32_t DisplayRenderer::getNbrOfRenderedFrames() const {
+    _mutex.lock();
+    const uint32_t nbrOfRenderedFrames = _nbrOfRenderedFrames;
+    _mutex.unlock();
+    return nbrOfRenderedFrames;
+}
+
+uint32_t DisplayRenderer::getNbrOfDroppedFrames() const {
+    _mutex.lock();
+    const uint32_t nbrOfDroppedFrames = _nbrOfDroppedFrames;
+    _mutex.unlock();
+    return nbrOfDroppedFrames;
+}
+
+std::chrono::microseconds DisplayRenderer::getLastRenderTime() const {
+    _mutex.lock();
+    const std::chrono::microseconds lastRenderTime = _lastRenderTime;
+    _mutex.unlock();
+    return lastRenderTime;
+}
+
+std::chrono::microseconds DisplayRenderer::getMaxRenderTime() const {
+    _mutex.lock();
+    const std::chrono::microseconds maxRenderTime = _maxRenderTime;
+    _mutex.unlock();
+    return maxRenderTime;
+}
+
+std::chrono::microseconds DisplayRenderer::getAverageRenderTime() const {
+    _mutex.lock();
+    const std::chrono::microseconds averageRenderTime(
+        (_nbrOfRenderedFrames == 0) ? 0 : _totalRenderTime / _nbrOfRenderedFrames);
+    _mutex.unlock();
+    return averageRenderTime;
+}
+
+void DisplayRenderer::printStats() const {
+    tr_info("Display frames: %" PRIu32 " submitted, %" PRIu32 " rendered, %" PRIu32
+            " dropped, render time %" PRIu64 " us (max %" PRIu64 " us)",
+            getNbrOfSubmittedFrames(),
+            getNbrOfRenderedFrames(),
+            getNbrOfDroppedFrames(),
+            static_cast<uint64_t>(getAverageRenderTime().count()),
+            static_cast<uint64_t>(getMaxRenderTime().count()));
+}
+
+void DisplayRenderer::run() {
+    while (true) {
+        _semaphore.acquire();
+        // frames submitted while rendering have been merged into the slot already
+        while (_semaphore.try_acquire()) {
+        }
+        const bool isStopping = core_util_atomic_load_bool(&_isStopping);
+        if (_handoff.update()) {
+            render(_handoff.getReadBuffer());
+        }
+        if (isStopping) {
+            return;
+        }
+    }
+}
+
+void DisplayRenderer::render(const Slot& slot) {
+    PROFILE_SCOPE("DisplayRenderer::render");
+    const std::chrono::microseconds startTime = _timer.elapsed_time();
+
+    const DisplayFrame& frame = slot.frame;
+    renderField(DirtyFieldDisplay::Field::Gear, _display.updateGear(frame.gear));
+    renderField(DirtyFieldDisplay::Field::Speed, _display.updateSpeed(frame.speed));
+    renderField(DirtyFieldDisplay::Field::Distance,
+                _display.updateDistance(frame.distance));
+    if ((frame.flags & DisplayFrame::kTemperatureValidFlag) != 0) {
+        renderField(DirtyFieldDisplay::Field::Temperature,
+                    _display.updateTemperature(frame.temperature));
+    }
+    // the redrawn fields are shown at once
+    _display.endFrame();
+
+    const std::chrono::microseconds renderTime = _timer.elapsed_time() - startTime;
+    recordMetric<MetricId::RenderTime>(static_cast<uint32_t>(renderTime.count()));
+    _mutex.lock();
+    // frames replaced in the slot before being rendered are dropped
+    _nbrOfDroppedFrames += slot.sequence - _lastRenderedSequence - 1;
+    _lastRenderedSequence = slot.sequence;
+    _nbrOfRenderedFrames++;
+    _totalRenderTime += renderTime.count();
+    _lastRenderTime = renderTime;
+    if (renderTime > _maxRenderTime) {
+        _maxRenderTime = renderTime;
+    }
+    _mutex.unlock();
+}
+
+void DisplayRenderer::renderField(DirtyFieldDisplay::Field field, bool isRedrawn) {
+    PROFILE_SCOPE("DisplayRenderer::renderField");
+    const std::chrono::milliseconds& renderingTime =
+        _fieldRenderingTimes[static_cast<uint8_t>(field)];
+    if (isRedrawn && renderingTime > std::chrono::milliseconds::zero()) {
+        ThisThread::sleep_for(renderingTime);
+    }
+}
+
+}  // namespace bike_computer
@@ -0,0 +1,120 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file display_renderer.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Asynchronous display renderer fed with the latest frame model
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include <chrono>
+
+#include "dirty_field_display.hpp"
+#include "mbed.h"
+#include "triple_buffer.hpp"
+
+namespace bike_computer {
+
+// Compact model of the content of the display, built by the display tasks
+struct DisplayFrame {
+    // set when the temperature field holds a measured value
+    static constexpr uint8_t kTemperatureValidFlag = 0x01;
+
+    float speed       = 0.0f;
+    float distance    = 0.0f;
+    float temperature = 0.0f;
+    uint8_t gear      = 0;
+    uint8_t flags     = 0;
+};
+
+// The DisplayRenderer renders the frames submitted by a single producer on a
+// low-priority thread. Frames are handed over through a single slot: a frame
+// submitted while the previous one is not rendered yet replaces it (the replaced
+// frame is counted as dropped), so that the producer never waits on the display.
+class DisplayRenderer {
+   public:
+    explicit DisplayRenderer(
+        DirtyFieldDisplay& display,  // NOLINT(runtime/references)
+        osPriority threadPriority = osPriorityLow,
+        const char* name          = "DisplayRenderer");
+    ~DisplayRenderer();
+
+    // make the class non copyable
+    DisplayRenderer(DisplayRenderer&)            = delete;
+    DisplayRenderer& operator=(DisplayRenderer&) = delete;
+
+    // methods for starting and stopping the renderer thread (a frame pending when
+    // the renderer is stopped is rendered before the thread exits)
+    void start();
+    void stop();
+
+    // method called by the producer (never blocks)
+    void submit(const DisplayFrame& frame);
+
+    // simulated time for drawing a field on the display device, spent only when the
+    // field is redrawn (none by default, must be set before start())
+    void setFieldRenderingTime(DirtyFieldDisplay::Field field,
+                               const std::chrono::milliseconds& renderingTime);
+
+    // methods for getting the statistics of the renderer
+    uint32_t getNbrOfSubmittedFrames() const;
+    uint32_t getNbrOfRenderedFrames() const;
+    uint32_t getNbrOfDroppedFrames() const;
+    std::chrono::microseconds getLastRenderTime() const;
+    std::chrono::microseconds getMaxRenderTime() const;
+    std::chrono::microseconds getAverageRenderTime() const;
+    void printStats() const;
+
+   private:
+    struct Slot {
+        DisplayFrame frame;
+        uint32_t sequence = 0;
+    };
+
+    // private methods
+    void run();
+    void render(const Slot& slot);
+    void renderField(DirtyFieldDisplay::Field field, bool isRedrawn);
+
+    // data members
+    DirtyFieldDisplay& _display;
+    Thread _thread;
+    Semaphore _semaphore;
+    mutable Mutex _mutex;
+    Timer _timer;
+    bool _isStarted           = false;
+    volatile bool _isStopping = false;
+    // single slot handoff (the producer owns the write side, the renderer thread the
+    // read side)
+    TripleBuffer<Slot> _handoff;
+    volatile uint32_t _nbrOfSubmittedFrames = 0;
+    // simulated rendering time of each field
+    std::chrono::milliseconds _fieldRenderingTimes[DirtyFieldDisplay::kNbrOfFields] =
+        {};
+    // statistics
+    uint32_t _lastRenderedSequence            = 0;
+    uint32_t _nbrOfRenderedFrames             = 0;
+    uint32_t _nbrOfDroppedFrames              = 0;
+    uint64_t _totalRenderTime                 = 0;
+    std::chrono::microseconds _lastRenderTime = {};
+    std::chrono::microseconds _maxRenderTime  = {};
+};
+
+}  // namespace bike_computer
@@ -0,0 +1,48 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file field_display_device.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Interface of the devices displaying the fields of the bike computer
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include "mbed.h"
+#include "return_code.hpp"
+
+namespace bike_computer {
+
+// Device displaying the fields of the bike computer. A device may buffer the fields
+// drawn since the previous frame: they are shown on screen at the latest when
+// endFrame() is called, so that the screen never shows a partially drawn frame.
+class FieldDisplayDevice {
+   public:
+    virtual ~FieldDisplayDevice() = default;
+
+    virtual disco::ReturnCode init()                   = 0;
+    virtual void displayGear(uint8_t gear)             = 0;
+    virtual void displaySpeed(float speed)             = 0;
+    virtual void displayDistance(float distance)       = 0;
+    virtual void displayTemperature(float temperature) = 0;
+    // method called once the fields of a frame are drawn
+    virtual void endFrame() = 0;
+};
+
+}  // namespace bike_computer
@@ -0,0 +1,115 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file fixed_point_format.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Formatting of integer and fixed-point values without printf
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include "fixed_point_format.hpp"
+
+#include <cmath>
+
+namespace bike_computer {
+
+// powers of ten by number of decimals
+static constexpr uint32_t kPowersOfTen[kMaxNbrOfDecimals + 1] = {
+    1, 10, 100, 1000, 10000, 100000, 1000000};
+
+// largest magnitude of a formatted value (INT32_MIN)
+static constexpr uint32_t kMaxMagnitude = 0x80000000U;
+
+static uint8_t formatNothing(char* buffer, size_t size) {
+    if (size > 0) {
+        buffer[0] = '\0';
+    }
+    return 0;
+}
+
+static uint8_t formatMagnitude(char* buffer,
+                               size_t size,
+                               bool isNegative,
+                               uint32_t magnitude,
+                               uint8_t nbrOfDecimals) {
+    if (nbrOfDecimals > kMaxNbrOfDecimals) {
+        return formatNothing(buffer, size);
+    }
+
+    // the text is built backwards from the least significant digit, with at least one
+    // digit before the decimal point
+    char text[kMaxFormattedSize];
+    uint8_t length     = 0;
+    uint8_t digitIndex = 0;
+    do {
+        if (digitIndex == nbrOfDecimals && nbrOfDecimals > 0) {
+            text[length++] = '.';
+        }
+        text[length++] = static_cast<char>('0' + magnitude % 10);
+        magnitude /= 10;
+        digitIndex++;
+    } while (magnitude != 0 || digitIndex <= nbrOfDecimals);
+    if (isNegative) {
+        text[length++] = '-';
+    }
+
+    if (length >= size) {
+        return formatNothing(buffer, size);
+    }
+    for (uint8_t index = 0; index < length; index++) {
+        buffer[index] = text[length - 1 - index];
+    }
+    buffer[length] = '\0';
+    return length;
+}
+
+uint8_t formatInteger(char* buffer, size_t size, int32_t value) {
+    return formatFixedPoint(buffer, size, value, 0);
+}
+
+uint8_t formatFixedPoint(char* buffer,
+                         size_t size,
+                         int32_t value,
+                         uint8_t nbrOfDecimals) {
+    // the magnitude is computed in unsigned arithmetic (valid for INT32_MIN)
+    const uint32_t magnitude =
+        (value < 0) ? 0U - static_cast<uint32_t>(value) : static_cast<uint32_t>(value);
+    return formatMagnitude(buffer, size, value < 0, magnitude, nbrOfDecimals);
+}
+
+uint8_t formatFloat(char* buffer, size_t size, float value, uint8_t nbrOfDecimals) {
+    if (nbrOfDecimals > kMaxNbrOfDecimals) {
+        return formatNothing(buffer, size);
+    }
+    // the product of a float (24-bit mantissa) by a power of ten up to 10^6 is exact in
+    // double precision, so that the value is rounded as printf does
+    const bool isNegative = std::signbit(value);
+    const double scaled =
+        (isNegative ? -static_cast<double>(value) : value) * kPowersOfTen[nbrOfDecimals];
+    // infinities and NaN fail the comparison
+    if (!(scaled <= kMaxMagnitude)) {
+        return formatNothing(buffer, size);
+    }
+    const uint32_t magnitude = static_cast<uint32_t>(scaled + 0.5);
+    if (magnitude > (isNegative ? kMaxMagnitude : kMaxMagnitude - 1)) {
+        return formatNothing(buffer, size);
+    }
+    return formatMagnitude(buffer, size, isNegative, magnitude, nbrOfDecimals);
+}
+
+}  // namespace bike_computer
@@ -0,0 +1,56 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file fixed_point_format.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Formatting of integer and fixed-point values without printf
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace bike_computer {
+
+// Formatting of integer and fixed-point values into caller-provided buffers, without
+// heap allocation and without printf: the digits are produced in a single pass, the
+// decimal point being inserted on the fly. Each function returns the length of the
+// formatted text (terminating null character excluded), or 0 if the value cannot be
+// formatted into the buffer (a non-empty buffer then holds an empty string).
+
+// maximum number of decimals of fixed-point values
+static constexpr uint8_t kMaxNbrOfDecimals = 6;
+// buffer size sufficient for any value: sign, 10 digits, decimal point and null
+// character
+static constexpr uint8_t kMaxFormattedSize = 13;
+
+// formats value as "%" PRId32 does
+uint8_t formatInteger(char* buffer, size_t size, int32_t value);
+
+// formats the fixed-point value (value / 10^nbrOfDecimals) with nbrOfDecimals
+// decimals
+uint8_t formatFixedPoint(char* buffer, size_t size, int32_t value, uint8_t nbrOfDecimals);
+
+// formats value as "%.<nbrOfDecimals>f" does, except that ties are rounded half away
+// from zero (as minimal-printf does). Values whose scaled magnitude does not fit in an
+// int32_t, infinities and NaN are not formatted.
+uint8_t formatFloat(char* buffer, size_t size, float value, uint8_t nbrOfDecimals);
+
+}  // namespace bike_computer
@@ -0,0 +1,258 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file frame_buffer.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief FrameBuffer implementation
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include "frame_buffer.hpp"
+
+#include <cinttypes>
+#include <cstring>
+
+#include "mbed_trace.h"
+#if MBED_CONF_MBED_TRACE_ENABLE
+#define TRACE_GROUP "FrameBuffer"
+#endif  // MBED_CONF_MBED_TRACE_ENABLE
+
+namespace bike_computer {
+
+// definition required when the constant is odr-used (C++14)
+constexpr uint8_t FrameBuffer::kMaxNbrOfDirtyRectangles;
+
+bool Rectangle::isEmpty() const { return width == 0 || height == 0; }
+
+uint32_t Rectangle::getArea() const { return static_cast<uint32_t>(width) * height; }
+
+bool Rectangle::isAdjacent(const Rectangle& other) const {
+    return x <= other.x + other.width && other.x <= x + width &&
+           y <= other.y + other.height && other.y <= y + height;
+}
+
+Rectangle Rectangle::unite(const Rectangle& other) const {
+    if (isEmpty()) {
+        return other;
+    }
+    if (other.isEmpty()) {
+        return *this;
+    }
+    const int right  = (x + width > other.x + other.width) ? x + width
+                                                            : other.x + other.width;
+    const int bottom = (y + height > other.y + other.height) ? y + height
+                                                              : other.y + other.height;
+    Rectangle united;
+    united.x      = (x < other.x) ? x : other.x;
+    united.y      = (y < other.y) ? y : other.y;
+    united.width  = static_cast<uint16_t>(right - united.x);
+    united.height = static_cast<uint16_t>(bottom - united.y);
+    return united;
+}
+
+FrameBuffer::FrameBuffer(uint16_t* pixels,
+                         uint16_t width,
+                         uint16_t height,
+                         DisplayBackend& backend)
+    : _pixels(pixels), _width(width), _height(height), _backend(backend) {}
+
+uint16_t FrameBuffer::getWidth() const { return _width; }
+
+uint16_t FrameBuffer::getHeight() const { return _height; }
+
+uint16_t FrameBuffer::getPixel(uint16_t x, uint16_t y) const {
+    MBED_ASSERT(x < _width && y < _height);
+    return _pixels[static_cast<uint32_t>(y) * _width + x];
+}
+
+void FrameBuffer::fillRectangle(const Rectangle& rectangle, uint16_t color) {
+    Rectangle clipped;
+    if (!clip(rectangle, clipped)) {
+        return;
+    }
+    for (uint16_t row = 0; row < clipped.height; row++) {
+        uint16_t* pixel =
+            &_pixels[static_cast<uint32_t>(clipped.y + row) * _width + clipped.x];
+        for (uint16_t column = 0; column < clipped.width; column++) {
+            pixel[column] = color;
+        }
+    }
+    markDirty(clipped);
+}
+
+void FrameBuffer::drawBitmap(uint16_t x,
+                             uint16_t y,
+                             const uint8_t* bitmap,
+                             uint16_t width,
+                             uint16_t height,
+                             uint16_t foregroundColor,
+                             uint16_t backgroundColor) {
+    Rectangle rectangle;
+    rectangle.x      = x;
+    rectangle.y      = y;
+    rectangle.width  = width;
+    rectangle.height = height;
+    Rectangle clipped;
+    if (!clip(rectangle, clipped)) {
+        return;
+    }
+    // the 4 pixels of each nibble value, so that the bitmap is copied 4 pixels at a
+    // time
+    static constexpr uint8_t kNbrOfNibbles = 16;
+    uint16_t nibblePixels[kNbrOfNibbles][4];
+    for (uint8_t nibble = 0; nibble < kNbrOfNibbles; nibble++) {
+        for (uint8_t bit = 0; bit < 4; bit++) {
+            nibblePixels[nibble][bit] =
+                ((nibble & (0x08 >> bit)) != 0) ? foregroundColor : backgroundColor;
+        }
+    }
+
+    const uint16_t bytesPerRow = (width + 7) / 8;
+    for (uint16_t row = 0; row < clipped.height; row++) {
+        const uint8_t* bits = &bitmap[static_cast<uint32_t>(row) * bytesPerRow];
+        uint16_t* pixel     = &_pixels[static_cast<uint32_t>(y + row) * _width + x];
+        uint16_t column     = 0;
+        for (; column + 8 <= clipped.width; column += 8) {
+            const uint8_t byte = *bits++;
+            memcpy(&pixel[column], nibblePixels[byte >> 4], sizeof(nibblePixels[0]));
+            memcpy(
+                &pixel[column + 4], nibblePixels[byte & 0x0F], sizeof(nibblePixels[0]));
+        }
+        // last pixels of the row
+        uint8_t byte = (column < clipped.width) ? *bits : 0;
+        for (; column < clipped.width; column++) {
+            pixel[column] = ((byte & 0x80) != 0) ? foregroundColor : backgroundColor;
+            byte <<= 1;
+        }
+    }
+    markDirty(clipped);
+}
+
+void FrameBuffer::invalidate() {
+    _dirtyRectangles[0].x      = 0;
+    _dirtyRectangles[0].y      = 0;
+    _dirtyRectangles[0].width  = _width;
+    _dirtyRectangles[0].height = _height;
+    _nbrOfDirtyRectangles      = 1;
+}
+
+uint32_t FrameBuffer::flush() {
+    uint32_t nbrOfPixels = 0;
+    if (_nbrOfDirtyRectangles > 0) {
+        _backend.beginFlush();
+        for (uint8_t index = 0; index < _nbrOfDirtyRectangles; index++) {
+            const Rectangle& rectangle = _dirtyRectangles[index];
+            _backend.flushRectangle(
+                rectangle,
+                &_pixels[static_cast<uint32_t>(rectangle.y) * _width + rectangle.x],
+                _width);
+            nbrOfPixels += rectangle.getArea();
+        }
+        _backend.endFlush();
+        _nbrOfDirtyRectangles = 0;
+        _nbrOfFlushes++;
+    }
+    _nbrOfFlushedPixels += nbrOfPixels;
+    _nbrOfFlushedPixelsInLastFrame = nbrOfPixels;
+    return nbrOfPixels;
+}
+
+uint8_t FrameBuffer::getNbrOfDirtyRectangles() const { return _nbrOfDirtyRectangles; }
+
+const Rectangle& FrameBuffer::getDirtyRectangle(uint8_t index) const {
+    MBED_ASSERT(index < _nbrOfDirtyRectangles);
+    return _dirtyRectangles[index];
+}
+
+uint32_t FrameBuffer::getNbrOfFlushes() const { return _nbrOfFlushes; }
+
+uint32_t FrameBuffer::getNbrOfFlushedPixels() const { return _nbrOfFlushedPixels; }
+
+uint32_t FrameBuffer::getNbrOfFlushedPixelsInLastFrame() const {
+    return _nbrOfFlushedPixelsInLastFrame;
+}
+
+void FrameBuffer::printStats() const {
+    tr_info("Frame buffer: %" PRIu32 " flushes, %" PRIu32 " pixels flushed (%" PRIu32
+            " in the last frame, %" PRIu32 " in a full frame)",
+            _nbrOfFlushes,
+            _nbrOfFlushedPixels,
+            _nbrOfFlushedPixelsInLastFrame,
+            static_cast<uint32_t>(_width) * _height);
+}
+
+bool FrameBuffer::clip(const Rectangle& rectangle, Rectangle& clipped) const {
+    if (rectangle.isEmpty() || rectangle.x >= _width || rectangle.y >= _height) {
+        return false;
+    }
+    clipped = rectangle;
+    if (clipped.x + clipped.width > _width) {
+        clipped.width = _width - clipped.x;
+    }
+    if (clipped.y + clipped.height > _height) {
+        clipped.height = _height - clipped.y;
+    }
+    return true;
+}
+
+void FrameBuffer::markDirty(const Rectangle& rectangle) {
+    Rectangle dirty = rectangle;
+    // merge the rectangles overlapping or touching the new one (the merged rectangle
+    // may in turn touch other rectangles)
+    bool isMerged = true;
+    while (isMerged) {
+        isMerged = false;
+        for (uint8_t index = 0; index < _nbrOfDirtyRectangles; index++) {
+            if (_dirtyRectangles[index].isAdjacent(dirty)) {
+                dirty = dirty.unite(_dirtyRectangles[index]);
+                removeDirtyRectangle(index);
+                isMerged = true;
+                break;
+            }
+        }
+    }
+    if (_nbrOfDirtyRectangles < kMaxNbrOfDirtyRectangles) {
+        _dirtyRectangles[_nbrOfDirtyRectangles] = dirty;
+        _nbrOfDirtyRectangles++;
+        return;
+    }
+
+    // all slots are used: merge with the rectangle whose union grows the least
+    uint8_t bestIndex   = 0;
+    uint32_t bestGrowth = UINT32_MAX;
+    for (uint8_t index = 0; index < _nbrOfDirtyRectangles; index++) {
+        const Rectangle& other = _dirtyRectangles[index];
+        const uint32_t growth =
+            dirty.unite(other).getArea() - other.getArea() - dirty.getArea();
+        if (growth < bestGrowth) {
+            bestIndex  = index;
+            bestGrowth = growth;
+        }
+    }
+    dirty = dirty.unite(_dirtyRectangles[bestIndex]);
+    removeDirtyRectangle(bestIndex);
+    // the union may now touch other rectangles
+    markDirty(dirty);
+}
+
+void FrameBuffer::removeDirtyRectangle(uint8_t index) {
+    _nbrOfDirtyRectangles--;
+    _dirtyRectangles[index] = _dirtyRectangles[_nbrOfDirtyRectangles];
+}
+
+}  // namespace bike_computer
@@ -0,0 +1,131 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file frame_buffer.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Off-screen frame buffer flushing the dirty rectangles of each frame
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include "mbed.h"
+#include "return_code.hpp"
+
+namespace bike_computer {
+
+// rectangle in display coordinates (an empty rectangle has a null area)
+struct Rectangle {
+    uint16_t x      = 0;
+    uint16_t y      = 0;
+    uint16_t width  = 0;
+    uint16_t height = 0;
+
+    bool isEmpty() const;
+    uint32_t getArea() const;
+    // true if the rectangles overlap or touch each other
+    bool isAdjacent(const Rectangle& other) const;
+    // smallest rectangle containing both rectangles
+    Rectangle unite(const Rectangle& other) const;
+};
+
+// Display receiving the flushed regions of the frame buffer. The regions of a frame
+// are flushed in one burst, between beginFlush() and endFlush().
+class DisplayBackend {
+   public:
+    virtual ~DisplayBackend() = default;
+
+    // method called before the first flush
+    virtual disco::ReturnCode init() = 0;
+    virtual void beginFlush()        = 0;
+    // the pixels are the ones of the frame buffer at the top left corner of the
+    // rectangle, the stride is the width of the frame buffer
+    virtual void flushRectangle(const Rectangle& rectangle,
+                                const uint16_t* pixels,
+                                uint16_t stride) = 0;
+    virtual void endFlush()                      = 0;
+};
+
+// The FrameBuffer accumulates the drawing of a frame in RAM (RGB565 pixels) and
+// records the dirty rectangles. flush() sends the dirty regions only to the display
+// backend, so that the display never shows a partially drawn frame. Up to
+// kMaxNbrOfDirtyRectangles are tracked: overlapping or touching rectangles are
+// merged, and when all slots are used the new rectangle is merged with the one
+// whose union grows the least.
+class FrameBuffer {
+   public:
+    static constexpr uint8_t kMaxNbrOfDirtyRectangles = 4;
+
+    // the pixel memory (width * height pixels) is provided by the caller
+    FrameBuffer(uint16_t* pixels,
+                uint16_t width,
+                uint16_t height,
+                DisplayBackend& backend);  // NOLINT(runtime/references)
+
+    // make the class non copyable
+    FrameBuffer(FrameBuffer&)            = delete;
+    FrameBuffer& operator=(FrameBuffer&) = delete;
+
+    uint16_t getWidth() const;
+    uint16_t getHeight() const;
+    uint16_t getPixel(uint16_t x, uint16_t y) const;
+
+    // drawing methods (clipped to the frame buffer)
+    void fillRectangle(const Rectangle& rectangle, uint16_t color);
+    // 1 bit per pixel bitmap, rows of (width + 7) / 8 bytes, most significant bit
+    // first
+    void drawBitmap(uint16_t x,
+                    uint16_t y,
+                    const uint8_t* bitmap,
+                    uint16_t width,
+                    uint16_t height,
+                    uint16_t foregroundColor,
+                    uint16_t backgroundColor);
+
+    // method called when the display content is lost: the whole frame is flushed
+    void invalidate();
+    // flush the dirty regions, returns the number of flushed pixels
+    uint32_t flush();
+
+    // methods for getting the dirty rectangles and the statistics
+    uint8_t getNbrOfDirtyRectangles() const;
+    const Rectangle& getDirtyRectangle(uint8_t index) const;
+    uint32_t getNbrOfFlushes() const;
+    uint32_t getNbrOfFlushedPixels() const;
+    uint32_t getNbrOfFlushedPixelsInLastFrame() const;
+    void printStats() const;
+
+   private:
+    // private methods
+    bool clip(const Rectangle& rectangle, Rectangle& clipped) const;
+    void markDirty(const Rectangle& rectangle);
+    void removeDirtyRectangle(uint8_t index);
+
+    // data members
+    uint16_t* _pixels;
+    const uint16_t _width;
+    const uint16_t _height;
+    DisplayBackend& _backend;
+    Rectangle _dirtyRectangles[kMaxNbrOfDirtyRectangles];
+    uint8_t _nbrOfDirtyRectangles            = 0;
+    uint32_t _nbrOfFlushes                   = 0;
+    uint32_t _nbrOfFlushedPixels             = 0;
+    uint32_t _nbrOfFlushedPixelsInLastFrame  = 0;
+};
+
+}  // namespace bike_computer
@@ -0,0 +1,204 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file frame_buffer_display_device.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Field display device drawing into a frame buffer flushed to a display backend
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include "frame_buffer_display_device.hpp"
+
+#include <cinttypes>
+
+#include "constants.hpp"
+#include "fixed_point_format.hpp"
+#include "glyph_atlas.hpp"
+
+#include "mbed_trace.h"
+#if MBED_CONF_MBED_TRACE_ENABLE
+#define TRACE_GROUP "FrameBufferDisplayDevice"
+#endif  // MBED_CONF_MBED_TRACE_ENABLE
+
+namespace bike_computer {
+
+// definitions required when the constants are odr-used (C++14)
+constexpr uint16_t FrameBufferDisplayDevice::kWidth;
+constexpr uint16_t FrameBufferDisplayDevice::kHeight;
+constexpr uint16_t FrameBufferDisplayDevice::kForegroundColor;
+constexpr uint16_t FrameBufferDisplayDevice::kBackgroundColor;
+constexpr uint16_t FrameBufferDisplayDevice::kLabelColor;
+
+using FieldLayout = FrameBufferDisplayDevice::FieldLayout;
+
+// layout of the fields (large glyphs are 24 x 28 pixels, small ones 12 x 14): the
+// units are bottom-aligned with the values
+static constexpr uint16_t kMargin                   = 16;
+static constexpr FieldLayout kGearLayout            = {kMargin, 16, 2, true};
+static constexpr FieldLayout kSpeedLayout           = {kMargin, 64, 5, true};
+static constexpr FieldLayout kSpeedUnitLayout       = {
+    kMargin + 5 * LargeGlyphAtlas::kGlyphWidth, 78, 4, false};
+static constexpr FieldLayout kDistanceLayout        = {kMargin, 120, 8, false};
+static constexpr FieldLayout kDistanceUnitLayout    = {
+    kMargin + 8 * SmallGlyphAtlas::kGlyphWidth, 120, 2, false};
+static constexpr FieldLayout kTemperatureLayout     = {kMargin, 152, 5, false};
+static constexpr FieldLayout kTemperatureUnitLayout = {
+    kMargin + 5 * SmallGlyphAtlas::kGlyphWidth, 152, 1, false};
+
+FrameBufferDisplayDevice::FrameBufferDisplayDevice(uint16_t* pixels,
+                                                   DisplayBackend& backend)
+    : _backend(backend), _frameBuffer(pixels, kWidth, kHeight, backend) {
+    _timer.start();
+}
+
+disco::ReturnCode FrameBufferDisplayDevice::init() {
+    const disco::ReturnCode rc = _backend.init();
+    if (rc != disco::ReturnCode::Ok) {
+        return rc;
+    }
+    const std::chrono::microseconds startTime = _timer.elapsed_time();
+
+    Rectangle screen;
+    screen.x      = 0;
+    screen.y      = 0;
+    screen.width  = kWidth;
+    screen.height = kHeight;
+    _frameBuffer.fillRectangle(screen, kBackgroundColor);
+    _currentFrameStats.nbrOfDrawCalls++;
+    _currentFrameStats.nbrOfTouchedPixels += screen.getArea();
+    drawText(kSpeedUnitLayout, "km/h", kLabelColor);
+    drawText(kDistanceUnitLayout, "km", kLabelColor);
+    drawText(kTemperatureUnitLayout, "C", kLabelColor);
+    // the screen content is unknown
+    _frameBuffer.invalidate();
+
+    _currentFrameStats.renderTime += _timer.elapsed_time() - startTime;
+    return disco::ReturnCode::Ok;
+}
+
+void FrameBufferDisplayDevice::displayGear(uint8_t gear) {
+    drawField(kGearLayout, gear, kGearDecimals);
+}
+
+void FrameBufferDisplayDevice::displaySpeed(float speed) {
+    drawField(kSpeedLayout, speed, kSpeedDecimals);
+}
+
+void FrameBufferDisplayDevice::displayDistance(float distance) {
+    drawField(kDistanceLayout, distance, kDistanceDecimals);
+}
+
+void FrameBufferDisplayDevice::displayTemperature(float temperature) {
+    drawField(kTemperatureLayout, temperature, kTemperatureDecimals);
+}
+
+void FrameBufferDisplayDevice::endFrame() {
+    const std::chrono::microseconds startTime = _timer.elapsed_time();
+    _currentFrameStats.nbrOfFlushedPixels = _frameBuffer.flush();
+    _currentFrameStats.renderTime += _timer.elapsed_time() - startTime;
+
+    _nbrOfFrames++;
+    _totalFrameTime += _currentFrameStats.renderTime.count();
+    if (_currentFrameStats.renderTime > _maxFrameTime) {
+        _maxFrameTime = _currentFrameStats.renderTime;
+    }
+    _lastFrameStats    = _currentFrameStats;
+    _currentFrameStats = FrameStats();
+}
+
+uint32_t FrameBufferDisplayDevice::getNbrOfFrames() const { return _nbrOfFrames; }
+
+const FrameBufferDisplayDevice::FrameStats& FrameBufferDisplayDevice::getLastFrameStats()
+    const {
+    return _lastFrameStats;
+}
+
+std::chrono::microseconds FrameBufferDisplayDevice::getMaxFrameTime() const {
+    return _maxFrameTime;
+}
+
+std::chrono::microseconds FrameBufferDisplayDevice::getAverageFrameTime() const {
+    return std::chrono::microseconds(
+        (_nbrOfFrames == 0) ? 0 : _totalFrameTime / _nbrOfFrames);
+}
+
+void FrameBufferDisplayDevice::printStats() const {
+    tr_info("Frame buffer display: %" PRIu32 " frames, last frame %" PRIu32
+            " draw calls, %" PRIu32 " touched pixels, %" PRIu32
+            " flushed pixels, frame time %" PRIu64 " us (max %" PRIu64 " us)",
+            getNbrOfFrames(),
+            _lastFrameStats.nbrOfDrawCalls,
+            _lastFrameStats.nbrOfTouchedPixels,
+            _lastFrameStats.nbrOfFlushedPixels,
+            static_cast<uint64_t>(getAverageFrameTime().count()),
+            static_cast<uint64_t>(getMaxFrameTime().count()));
+}
+
+void FrameBufferDisplayDevice::drawField(const FieldLayout& layout,
+                                         float value,
+                                         uint8_t nbrOfDecimals) {
+    const std::chrono::microseconds startTime = _timer.elapsed_time();
+
+    char text[kMaxFormattedSize];
+    formatFloat(text, sizeof(text), value, nbrOfDecimals);
+    drawText(layout, text, kForegroundColor);
+
+    _currentFrameStats.renderTime += _timer.elapsed_time() - startTime;
+}
+
+void FrameBufferDisplayDevice::drawText(const FieldLayout& layout,
+                                        const char* text,
+                                        uint16_t color) {
+    // texts longer than the field are truncated
+    char fieldText[kMaxFormattedSize];
+    uint8_t length = 0;
+    while (text[length] != '\0' && length < layout.nbrOfCharacters &&
+           length < kMaxFormattedSize - 1) {
+        fieldText[length] = text[length];
+        length++;
+    }
+    fieldText[length] = '\0';
+
+    const uint16_t glyphWidth =
+        layout.isLarge ? LargeGlyphAtlas::kGlyphWidth : SmallGlyphAtlas::kGlyphWidth;
+    const uint16_t glyphHeight =
+        layout.isLarge ? LargeGlyphAtlas::kGlyphHeight : SmallGlyphAtlas::kGlyphHeight;
+    const uint16_t width =
+        layout.isLarge
+            ? kLargeGlyphAtlas.drawText(
+                  _frameBuffer, layout.x, layout.y, fieldText, color, kBackgroundColor)
+            : kSmallGlyphAtlas.drawText(
+                  _frameBuffer, layout.x, layout.y, fieldText, color, kBackgroundColor);
+
+    // the rest of the field is cleared (a shorter text replaces a longer one)
+    Rectangle field;
+    field.x      = layout.x;
+    field.y      = layout.y;
+    field.width  = layout.nbrOfCharacters * glyphWidth;
+    field.height = glyphHeight;
+    if (width < field.width) {
+        Rectangle rest = field;
+        rest.x += width;
+        rest.width -= width;
+        _frameBuffer.fillRectangle(rest, kBackgroundColor);
+    }
+    _currentFrameStats.nbrOfDrawCalls++;
+    _currentFrameStats.nbrOfTouchedPixels += field.getArea();
+}
+
+}  // namespace bike_computer
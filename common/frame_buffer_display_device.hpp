@@ -0,0 +1,105 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file frame_buffer_display_device.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Field display device drawing into a frame buffer flushed to a display backend
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include <chrono>
+
+#include "field_display_device.hpp"
+#include "frame_buffer.hpp"
+#include "mbed.h"
+#include "return_code.hpp"
+
+namespace bike_computer {
+
+// Field display device that draws the fields with the glyph atlases into an off-screen
+// frame buffer, whose dirty regions are flushed to a display backend at the end of
+// each frame. A frame gathers the fields drawn since the previous endFrame() call: its
+// draw calls, touched pixels, flushed pixels and rendering time (drawing and flush)
+// are counted.
+class FrameBufferDisplayDevice : public FieldDisplayDevice {
+   public:
+    static constexpr uint16_t kWidth           = 320;
+    static constexpr uint16_t kHeight          = 240;
+    static constexpr uint16_t kForegroundColor = 0xFFFF;
+    static constexpr uint16_t kBackgroundColor = 0x0000;
+    static constexpr uint16_t kLabelColor      = 0x7BEF;
+
+    struct FrameStats {
+        uint32_t nbrOfDrawCalls              = 0;
+        uint32_t nbrOfTouchedPixels          = 0;
+        uint32_t nbrOfFlushedPixels          = 0;
+        std::chrono::microseconds renderTime = std::chrono::microseconds::zero();
+    };
+
+    // position of a field and number of characters reserved for its text
+    struct FieldLayout {
+        uint16_t x;
+        uint16_t y;
+        uint8_t nbrOfCharacters;
+        bool isLarge;
+    };
+
+    // the frame buffer memory (kWidth * kHeight pixels) is provided by the caller
+    FrameBufferDisplayDevice(uint16_t* pixels,
+                             DisplayBackend& backend);  // NOLINT(runtime/references)
+
+    // make the class non copyable
+    FrameBufferDisplayDevice(FrameBufferDisplayDevice&)            = delete;
+    FrameBufferDisplayDevice& operator=(FrameBufferDisplayDevice&) = delete;
+
+    // FieldDisplayDevice (init() initializes the backend and draws the background and
+    // the units, endFrame() flushes the fields drawn since the previous frame to the
+    // backend)
+    disco::ReturnCode init() override;
+    void displayGear(uint8_t gear) override;
+    void displaySpeed(float speed) override;
+    void displayDistance(float distance) override;
+    void displayTemperature(float temperature) override;
+    void endFrame() override;
+
+    // methods for getting the statistics of the frames
+    uint32_t getNbrOfFrames() const;
+    const FrameStats& getLastFrameStats() const;
+    std::chrono::microseconds getMaxFrameTime() const;
+    std::chrono::microseconds getAverageFrameTime() const;
+    void printStats() const;
+
+   private:
+    // private methods
+    void drawField(const FieldLayout& layout, float value, uint8_t nbrOfDecimals);
+    void drawText(const FieldLayout& layout, const char* text, uint16_t color);
+
+    // data members
+    Timer _timer;
+    DisplayBackend& _backend;
+    FrameBuffer _frameBuffer;
+    FrameStats _currentFrameStats;
+    FrameStats _lastFrameStats;
+    uint32_t _nbrOfFrames                   = 0;
+    uint64_t _totalFrameTime                = 0;
+    std::chrono::microseconds _maxFrameTime = std::chrono::microseconds::zero();
+};
+
+}  // namespace bike_computer
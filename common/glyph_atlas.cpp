@@ -0,0 +1,44 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file glyph_atlas.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Glyph atlas instances (constant-initialized, placed in flash)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include "glyph_atlas.hpp"
+
+namespace bike_computer {
+
+// definitions required when the constants are odr-used (C++14)
+constexpr char BaseFont::kCharacters[];
+constexpr uint8_t BaseFont::kRows[][BaseFont::kHeight];
+
+// the atlases are rasterized by the compiler
+constexpr SmallGlyphAtlas kSmallGlyphAtlas;
+constexpr LargeGlyphAtlas kLargeGlyphAtlas;
+
+// top row of the 1 scaled by 2: pixels 4 and 5 set
+static_assert(!kSmallGlyphAtlas.isPixelSet('1', 3, 0) &&
+                  kSmallGlyphAtlas.isPixelSet('1', 4, 0) &&
+                  kSmallGlyphAtlas.isPixelSet('1', 5, 1) &&
+                  !kSmallGlyphAtlas.isPixelSet('1', 6, 1),
+              "Glyph atlas not rasterized at compile time");
+
+}  // namespace bike_computer
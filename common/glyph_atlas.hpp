@@ -0,0 +1,154 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file glyph_atlas.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Pre-rasterized glyph atlas for the numeric fields
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include "frame_buffer.hpp"
+#include "mbed.h"
+
+namespace bike_computer {
+
+// 5 x 7 base font of the characters used by the numeric fields (digits, signs and
+// unit suffixes), each row being stored in the 5 least significant bits, the most
+// significant of them being the leftmost pixel
+struct BaseFont {
+    static constexpr uint8_t kNbrOfGlyphs = 19;
+    static constexpr uint8_t kWidth       = 5;
+    static constexpr uint8_t kHeight      = 7;
+
+    static constexpr char kCharacters[kNbrOfGlyphs + 1] = "0123456789.- kmh/C%";
+    static constexpr uint8_t kRows[kNbrOfGlyphs][kHeight] = {
+        {0x0E, 0x11, 0x13, 0x15, 0x19, 0x11, 0x0E},  // 0
+        {0x04, 0x0C, 0x04, 0x04, 0x04, 0x04, 0x0E},  // 1
+        {0x0E, 0x11, 0x01, 0x02, 0x04, 0x08, 0x1F},  // 2
+        {0x1F, 0x02, 0x04, 0x02, 0x01, 0x11, 0x0E},  // 3
+        {0x02, 0x06, 0x0A, 0x12, 0x1F, 0x02, 0x02},  // 4
+        {0x1F, 0x10, 0x1E, 0x01, 0x01, 0x11, 0x0E},  // 5
+        {0x06, 0x08, 0x10, 0x1E, 0x11, 0x11, 0x0E},  // 6
+        {0x1F, 0x01, 0x02, 0x04, 0x08, 0x08, 0x08},  // 7
+        {0x0E, 0x11, 0x11, 0x0E, 0x11, 0x11, 0x0E},  // 8
+        {0x0E, 0x11, 0x11, 0x0F, 0x01, 0x02, 0x0C},  // 9
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C},  // .
+        {0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00},  // -
+        {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},  // space
+        {0x10, 0x10, 0x12, 0x14, 0x18, 0x14, 0x12},  // k
+        {0x00, 0x00, 0x1A, 0x15, 0x15, 0x11, 0x11},  // m
+        {0x10, 0x10, 0x16, 0x19, 0x11, 0x11, 0x11},  // h
+        {0x00, 0x01, 0x02, 0x04, 0x08, 0x10, 0x00},  // /
+        {0x0E, 0x11, 0x10, 0x10, 0x10, 0x11, 0x0E},  // C
+        {0x18, 0x19, 0x02, 0x04, 0x08, 0x13, 0x03}   // %
+    };
+
+    // returns kNbrOfGlyphs for the characters not in the font
+    static constexpr uint8_t getGlyphIndex(char character) {
+        uint8_t index = 0;
+        while (index < kNbrOfGlyphs && kCharacters[index] != character) {
+            index++;
+        }
+        return index;
+    }
+};
+
+// Glyphs of the base font scaled by kScale and rasterized at compile time, with one
+// blank column on the right of each glyph (1 bit per pixel, rows of kBytesPerRow
+// bytes, most significant bit first). Atlas instances are constant-initialized and
+// thus placed in flash. Text is rendered by copying the glyph blocks into the frame
+// buffer; characters not in the font are rendered as spaces.
+template <uint8_t kScale>
+class GlyphAtlas {
+   public:
+    static constexpr uint16_t kGlyphWidth  = (BaseFont::kWidth + 1) * kScale;
+    static constexpr uint16_t kGlyphHeight = BaseFont::kHeight * kScale;
+    static constexpr uint16_t kBytesPerRow = (kGlyphWidth + 7) / 8;
+    static constexpr uint16_t kGlyphSize   = kBytesPerRow * kGlyphHeight;
+
+    constexpr GlyphAtlas() : _bitmaps{} {
+        for (uint8_t glyph = 0; glyph < BaseFont::kNbrOfGlyphs; glyph++) {
+            for (uint16_t y = 0; y < kGlyphHeight; y++) {
+                const uint8_t row = BaseFont::kRows[glyph][y / kScale];
+                for (uint16_t x = 0; x < BaseFont::kWidth * kScale; x++) {
+                    if ((row & (0x10 >> (x / kScale))) != 0) {
+                        _bitmaps[glyph][y * kBytesPerRow + x / 8] |= 0x80 >> (x % 8);
+                    }
+                }
+            }
+        }
+    }
+
+    // make the class non copyable
+    GlyphAtlas(GlyphAtlas&)            = delete;
+    GlyphAtlas& operator=(GlyphAtlas&) = delete;
+
+    constexpr const uint8_t* getGlyph(char character) const {
+        const uint8_t index = BaseFont::getGlyphIndex(character);
+        return _bitmaps[(index < BaseFont::kNbrOfGlyphs) ? index
+                                                         : BaseFont::getGlyphIndex(' ')];
+    }
+
+    constexpr bool isPixelSet(char character, uint16_t x, uint16_t y) const {
+        return (getGlyph(character)[y * kBytesPerRow + x / 8] & (0x80 >> (x % 8))) != 0;
+    }
+
+    static uint16_t getTextWidth(const char* text) {
+        uint16_t width = 0;
+        for (; *text != '\0'; text++) {
+            width += kGlyphWidth;
+        }
+        return width;
+    }
+
+    // returns the width of the rendered text
+    uint16_t drawText(FrameBuffer& frameBuffer,  // NOLINT(runtime/references)
+                      uint16_t x,
+                      uint16_t y,
+                      const char* text,
+                      uint16_t foregroundColor,
+                      uint16_t backgroundColor) const {
+        const uint16_t startX = x;
+        for (; *text != '\0'; text++) {
+            frameBuffer.drawBitmap(x,
+                                   y,
+                                   getGlyph(*text),
+                                   kGlyphWidth,
+                                   kGlyphHeight,
+                                   foregroundColor,
+                                   backgroundColor);
+            x += kGlyphWidth;
+        }
+        return x - startX;
+    }
+
+   private:
+    // data members
+    uint8_t _bitmaps[BaseFont::kNbrOfGlyphs][kGlyphSize];
+};
+
+// sizes used by the numeric fields: the speed is displayed with large glyphs, the
+// other fields and the unit suffixes with small ones
+using SmallGlyphAtlas = GlyphAtlas<2>;
+using LargeGlyphAtlas = GlyphAtlas<4>;
+extern const SmallGlyphAtlas kSmallGlyphAtlas;
+extern const LargeGlyphAtlas kLargeGlyphAtlas;
+
+}  // namespace bike_computer
@@ -0,0 +1,83 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file headless_display_device.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Display device rendering into memory, with frame statistics and PPM dump
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include "headless_display_device.hpp"
+
+#include <cstdio>
+
+#include "mbed_trace.h"
+#if MBED_CONF_MBED_TRACE_ENABLE
+#define TRACE_GROUP "HeadlessDisplayDevice"
+#endif  // MBED_CONF_MBED_TRACE_ENABLE
+
+namespace bike_computer {
+
+HeadlessDisplayDevice::HeadlessDisplayDevice(uint16_t* pixels, uint16_t* screen)
+    : HeadlessScreen(screen, kWidth, kHeight),
+      FrameBufferDisplayDevice(pixels, _screenBackend) {}
+
+uint16_t HeadlessDisplayDevice::getPixel(uint16_t x, uint16_t y) const {
+    return _screenBackend.getPixel(x, y);
+}
+
+void HeadlessDisplayDevice::writePpm(Callback<void(const uint8_t*, size_t)> write) const {
+    char header[32];
+    const int headerLength =
+        snprintf(header, sizeof(header), "P6\n%u %u\n255\n", kWidth, kHeight);
+    write(reinterpret_cast<const uint8_t*>(header), headerLength);
+
+    // RGB565 pixels are expanded to 24 bits, the high bits being replicated in the
+    // low ones
+    uint8_t row[kWidth * 3];
+    for (uint16_t y = 0; y < kHeight; y++) {
+        for (uint16_t x = 0; x < kWidth; x++) {
+            const uint16_t pixel = _screenBackend.getPixel(x, y);
+            const uint8_t red    = (pixel >> 11) & 0x1F;
+            const uint8_t green  = (pixel >> 5) & 0x3F;
+            const uint8_t blue   = pixel & 0x1F;
+            row[x * 3]           = (red << 3) | (red >> 2);
+            row[x * 3 + 1]       = (green << 2) | (green >> 4);
+            row[x * 3 + 2]       = (blue << 3) | (blue >> 2);
+        }
+        write(row, sizeof(row));
+    }
+}
+
+static void writeToFile(FILE* file, const uint8_t* data, size_t size) {
+    fwrite(data, 1, size, file);
+}
+
+bool HeadlessDisplayDevice::dumpPpm(const char* path) const {
+    FILE* file = fopen(path, "wb");
+    if (file == nullptr) {
+        tr_error("Cannot open %s", path);
+        return false;
+    }
+    writePpm(callback(writeToFile, file));
+    const bool isWritten = ferror(file) == 0;
+    fclose(file);
+    return isWritten;
+}
+
+}  // namespace bike_computer
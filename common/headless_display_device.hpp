@@ -0,0 +1,59 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file headless_display_device.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Display device rendering into memory, with frame statistics and PPM dump
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include "frame_buffer_display_device.hpp"
+#include "mbed.h"
+#include "memory_display_backend.hpp"
+
+namespace bike_computer {
+
+// holds the screen memory backend, so that it is constructed before the frame buffer
+// display device that flushes to it (base-from-member)
+class HeadlessScreen {
+   protected:
+    HeadlessScreen(uint16_t* screen, uint16_t width, uint16_t height)
+        : _screenBackend(screen, width, height) {}
+
+    MemoryDisplayBackend _screenBackend;
+};
+
+// Frame buffer display device flushed to a screen memory, so that rendering can be
+// profiled and checked without the LCD. The screen can be dumped as a binary PPM image.
+class HeadlessDisplayDevice : private HeadlessScreen, public FrameBufferDisplayDevice {
+   public:
+    // the frame buffer and the screen memories (kWidth * kHeight pixels each) are
+    // provided by the caller
+    HeadlessDisplayDevice(uint16_t* pixels, uint16_t* screen);
+
+    // methods for reading the screen
+    uint16_t getPixel(uint16_t x, uint16_t y) const;
+    // the image is written by chunks of at most one row
+    void writePpm(Callback<void(const uint8_t*, size_t)> write) const;
+    // returns false if the file cannot be written
+    bool dumpPpm(const char* path) const;
+};
+
+}  // namespace bike_computer
@@ -0,0 +1,228 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file heap_analyzer.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Heap fragmentation analysis implementation
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include "heap_analyzer.hpp"
+
+#include <cinttypes>
+#include <cstdio>
+
+#if defined(BIKE_COMPUTER_HOST)
+#include "mbed_port/simulated_heap.hpp"
+#elif defined(__GNUC__) && !defined(__ARMCC_VERSION)
+#include <newlib.h>
+#include <reent.h>
+#endif  // defined(BIKE_COMPUTER_HOST)
+
+#include "mbed_trace.h"
+#if MBED_CONF_MBED_TRACE_ENABLE
+#define TRACE_GROUP "HeapAnalyzer"
+#endif  // MBED_CONF_MBED_TRACE_ENABLE
+
+typedef mbed::Callback<void(size_t)> FreeBlockFunction;
+
+#if defined(BIKE_COMPUTER_HOST)
+
+// the host port walks the heap of the simulated target
+static void forEachFreeBlock(FreeBlockFunction function) {
+    host::forEachFreeHeapBlock(function);
+}
+
+#elif defined(__GNUC__) && !defined(__ARMCC_VERSION)
+
+// the allocators of newlib are locked while their free chunks are walked
+extern "C" void __malloc_lock(struct _reent* reent);
+extern "C" void __malloc_unlock(struct _reent* reent);
+extern "C" void* _sbrk(int incr);
+// heap region of mbed OS (mbed_boot.h)
+extern "C" unsigned char* mbed_heap_start;
+extern "C" uint32_t mbed_heap_size;
+
+// the end of the heap region was never handed out to the allocator
+static size_t getUnusedHeapSize() {
+    const unsigned char* heapBreak = static_cast<const unsigned char*>(_sbrk(0));
+    return static_cast<size_t>(mbed_heap_start + mbed_heap_size - heapBreak);
+}
+
+#if defined(_NANO_MALLOC)
+
+// free chunks of the newlib-nano allocator (nano-mallocr.c): the size includes the
+// header and the list is sorted by address
+struct NanoChunk {
+    long size;
+    NanoChunk* next;
+};
+extern "C" NanoChunk* __malloc_free_list;
+
+// the function is called with the allocator locked, it must not allocate
+static void forEachFreeBlock(FreeBlockFunction function) {
+    __malloc_lock(_REENT);
+    for (const NanoChunk* chunk = __malloc_free_list; chunk != nullptr;
+         chunk = chunk->next) {
+        function(static_cast<size_t>(chunk->size) - sizeof(long));
+    }
+    function(getUnusedHeapSize());
+    __malloc_unlock(_REENT);
+}
+
+#else
+
+// chunks of the full newlib allocator (mallocr.c): the size includes the header and
+// its low bits are flags, the free chunks are linked in bins whose list heads are
+// stored by pairs in __malloc_av_ (fake chunks, see bin_at())
+struct NewlibChunk {
+    size_t prevSize;
+    size_t size;
+    NewlibChunk* fd;
+    NewlibChunk* bk;
+};
+static constexpr uint8_t kNbrOfNewlibBins = 128;
+// PREV_INUSE and IS_MMAPPED flags
+static constexpr size_t kNewlibSizeFlags = 0x3;
+extern "C" NewlibChunk* __malloc_av_[kNbrOfNewlibBins * 2 + 2];
+
+static NewlibChunk* getNewlibBin(uint8_t index) {
+    return reinterpret_cast<NewlibChunk*>(
+        reinterpret_cast<unsigned char*>(&__malloc_av_[2 * index + 2]) -
+        2 * sizeof(size_t));
+}
+
+// usable size of a free chunk (the size of the initial top chunk is 0)
+static size_t getUsableSize(const NewlibChunk* chunk) {
+    const size_t chunkSize = chunk->size & ~kNewlibSizeFlags;
+    return (chunkSize > sizeof(size_t)) ? chunkSize - sizeof(size_t) : 0;
+}
+
+// the function is called with the allocator locked, it must not allocate
+static void forEachFreeBlock(FreeBlockFunction function) {
+    __malloc_lock(_REENT);
+    // bin 0 holds the top chunk, bin 1 the last remainder and the others the free
+    // chunks by size
+    for (uint8_t index = 1; index < kNbrOfNewlibBins; index++) {
+        const NewlibChunk* bin = getNewlibBin(index);
+        for (const NewlibChunk* chunk = bin->fd; chunk != bin; chunk = chunk->fd) {
+            function(getUsableSize(chunk));
+        }
+    }
+    // the top chunk is extended with the end of the heap region: both form a single
+    // block
+    function(getUsableSize(__malloc_av_[2]) + getUnusedHeapSize());
+    __malloc_unlock(_REENT);
+}
+
+#endif  // defined(_NANO_MALLOC)
+
+#else
+
+// the free list of the ARM C library cannot be walked: the free memory of the heap
+// statistics is reported as a single block, the fragmentation is thus not visible
+static void forEachFreeBlock(FreeBlockFunction function) {
+    mbed_stats_heap_t heapStats = {0};
+    mbed_stats_heap_get(&heapStats);
+    function(heapStats.reserved_size - heapStats.current_size - heapStats.overhead_size);
+}
+
+#endif  // defined(BIKE_COMPUTER_HOST)
+
+namespace bike_computer {
+
+// definitions required when the constants are odr-used (C++14)
+constexpr uint8_t HeapAnalyzer::kNbrOfBuckets;
+constexpr uint32_t HeapAnalyzer::kFirstBucketBound;
+
+HeapAnalyzer::HeapAnalyzer(uint32_t warningSize) : _warningSize(warningSize) {}
+
+void HeapAnalyzer::analyze() {
+    _report = {};
+    forEachFreeBlock(callback(this, &HeapAnalyzer::onFreeBlock));
+    if (_report.freeSize > 0) {
+        _report.fragmentationIndex = static_cast<uint8_t>(
+            (static_cast<uint64_t>(_report.freeSize - _report.largestFreeBlock) * 100) /
+            _report.freeSize);
+    }
+    _lastReport = _report;
+    _nbrOfAnalyses++;
+
+    const bool isLow = _lastReport.largestFreeBlock < _warningSize;
+    if (isLow && !_isWarningRaised) {
+        _nbrOfWarnings++;
+        tr_warn("Largest free block of %" PRIu32 " bytes (%" PRIu32
+                " bytes free in %" PRIu32 " blocks): an allocation of %" PRIu32
+                " bytes would fail",
+                _lastReport.largestFreeBlock,
+                _lastReport.freeSize,
+                _lastReport.nbrOfFreeBlocks,
+                _warningSize);
+    } else if (!isLow && _isWarningRaised) {
+        tr_info("Largest free block of %" PRIu32 " bytes, warning cleared",
+                _lastReport.largestFreeBlock);
+    }
+    _isWarningRaised = isLow;
+}
+
+const HeapAnalyzer::Report& HeapAnalyzer::getLastReport() const { return _lastReport; }
+
+bool HeapAnalyzer::canAllocate(size_t size) const {
+    return size <= _lastReport.largestFreeBlock;
+}
+
+bool HeapAnalyzer::isWarningRaised() const { return _isWarningRaised; }
+
+uint32_t HeapAnalyzer::getNbrOfWarnings() const { return _nbrOfWarnings; }
+
+uint32_t HeapAnalyzer::getNbrOfAnalyses() const { return _nbrOfAnalyses; }
+
+void HeapAnalyzer::printStats() const {
+    // block counts, from the smallest bucket
+    char text[kNbrOfBuckets * 11 + 1] = {0};
+    size_t length                     = 0;
+    for (uint8_t bucket = 0; bucket < kNbrOfBuckets; bucket++) {
+        length += snprintf(text + length,
+                           sizeof(text) - length,
+                           " %" PRIu32,
+                           _lastReport.histogram[bucket]);
+    }
+    tr_info("Heap: %" PRIu32 " bytes free in %" PRIu32 " blocks, largest %" PRIu32
+            " bytes, fragmentation %u%%, blocks per size:%s",
+            _lastReport.freeSize,
+            _lastReport.nbrOfFreeBlocks,
+            _lastReport.largestFreeBlock,
+            _lastReport.fragmentationIndex,
+            text);
+}
+
+void HeapAnalyzer::onFreeBlock(size_t size) {
+    const uint32_t blockSize = static_cast<uint32_t>(size);
+    _report.freeSize += blockSize;
+    _report.nbrOfFreeBlocks++;
+    if (blockSize > _report.largestFreeBlock) {
+        _report.largestFreeBlock = blockSize;
+    }
+    uint8_t bucket = 0;
+    while (bucket < kNbrOfBuckets - 1 && blockSize >= getBucketBound(bucket)) {
+        bucket++;
+    }
+    _report.histogram[bucket]++;
+}
+
+}  // namespace bike_computer
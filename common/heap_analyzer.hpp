@@ -0,0 +1,93 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file heap_analyzer.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Heap fragmentation analysis with early warning
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include "mbed.h"
+
+namespace bike_computer {
+
+// Analysis of the fragmentation of the heap from the free blocks of the allocator:
+// largest free block, histogram of the sizes of the free blocks and fragmentation
+// index. A warning is raised as soon as the largest free block becomes smaller than
+// the warning size, that is before an allocation of that size fails. Once the system
+// is initialized, the free list holds a few blocks: the analysis may thus be run once
+// per major cycle.
+class HeapAnalyzer {
+   public:
+    static constexpr uint8_t kNbrOfBuckets = 8;
+    // upper bound (excluded) of the first bucket, the bound of each bucket being twice
+    // the bound of the previous one, the last bucket holding all larger blocks
+    static constexpr uint32_t kFirstBucketBound = 32;
+
+    struct Report {
+        uint32_t freeSize;
+        uint32_t largestFreeBlock;
+        uint32_t nbrOfFreeBlocks;
+        uint32_t histogram[kNbrOfBuckets];
+        // share of the free memory outside of the largest free block (in percent): 0
+        // when all free memory can be allocated at once
+        uint8_t fragmentationIndex;
+    };
+
+    explicit HeapAnalyzer(uint32_t warningSize);
+
+    // make the class non copyable
+    HeapAnalyzer(HeapAnalyzer&)            = delete;
+    HeapAnalyzer& operator=(HeapAnalyzer&) = delete;
+
+    // method called once per major cycle: walks the free blocks of the heap
+    void analyze();
+
+    const Report& getLastReport() const;
+    // returns true if an allocation of size bytes succeeds according to the last
+    // analysis
+    bool canAllocate(size_t size) const;
+    bool isWarningRaised() const;
+    // number of times the warning was raised
+    uint32_t getNbrOfWarnings() const;
+    uint32_t getNbrOfAnalyses() const;
+
+    static constexpr uint32_t getBucketBound(uint8_t bucket) {
+        return kFirstBucketBound << bucket;
+    }
+
+    // method called for printing the last report
+    void printStats() const;
+
+   private:
+    // private methods
+    void onFreeBlock(size_t size);
+
+    // data members
+    const uint32_t _warningSize;
+    // report built by the current analysis
+    Report _report          = {};
+    Report _lastReport      = {};
+    bool _isWarningRaised   = false;
+    uint32_t _nbrOfWarnings = 0;
+    uint32_t _nbrOfAnalyses = 0;
+};
+
+}  // namespace bike_computer
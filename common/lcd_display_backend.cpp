@@ -0,0 +1,145 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file lcd_display_backend.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Display backend writing the flushed regions to the LCD of the DISCO_H747I board
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include "lcd_display_backend.hpp"
+
+#include "stm32h747i_discovery_lcd.h"
+
+#include "mbed_trace.h"
+#if MBED_CONF_MBED_TRACE_ENABLE
+#define TRACE_GROUP "LcdDisplayBackend"
+#endif  // MBED_CONF_MBED_TRACE_ENABLE
+
+namespace bike_computer {
+
+// definitions required when the constants are odr-used (C++14)
+constexpr uint32_t LcdDisplayBackend::kLcdInstance;
+constexpr uint16_t LcdDisplayBackend::kMaxWidth;
+
+// opaque black, in the ARGB8888 format used by the BSP for filling rectangles
+static constexpr uint32_t kClearColor = 0xFF000000;
+
+// one row of a rectangle converted to the pixel format of the LCD, shared by the
+// backends since the board has a single LCD (the backend stays small enough to be a
+// member of objects living on the thread stacks)
+static uint32_t gLcdRow[LcdDisplayBackend::kMaxWidth];
+
+LcdDisplayBackend::LcdDisplayBackend(uint16_t width, uint16_t height)
+    : _width(width), _height(height) {
+    MBED_ASSERT(width <= kMaxWidth);
+}
+
+disco::ReturnCode LcdDisplayBackend::init() {
+    if (BSP_LCD_Init(kLcdInstance, LCD_ORIENTATION_LANDSCAPE) != BSP_ERROR_NONE) {
+        tr_error("Cannot initialize the LCD");
+        return disco::ReturnCode::Error;
+    }
+    uint32_t xSize = 0;
+    uint32_t ySize = 0;
+    if (BSP_LCD_GetXSize(kLcdInstance, &xSize) != BSP_ERROR_NONE ||
+        BSP_LCD_GetYSize(kLcdInstance, &ySize) != BSP_ERROR_NONE ||
+        BSP_LCD_GetFormat(kLcdInstance, &_pixelFormat) != BSP_ERROR_NONE ||
+        xSize < _width || ySize < _height) {
+        tr_error("Unsupported LCD");
+        return disco::ReturnCode::Error;
+    }
+    _xPosition = (xSize - _width) / 2;
+    _yPosition = (ySize - _height) / 2;
+    BSP_LCD_FillRect(kLcdInstance, 0, 0, xSize, ySize, kClearColor);
+    _isInitialized = true;
+    return disco::ReturnCode::Ok;
+}
+
+void LcdDisplayBackend::beginFlush() {
+    MBED_ASSERT(!_isFlushing);
+    _isFlushing                = true;
+    _nbrOfPixelsInCurrentFrame = 0;
+}
+
+void LcdDisplayBackend::flushRectangle(const Rectangle& rectangle,
+                                       const uint16_t* pixels,
+                                       uint16_t stride) {
+    MBED_ASSERT(_isFlushing);
+    MBED_ASSERT(rectangle.x + rectangle.width <= _width &&
+                rectangle.y + rectangle.height <= _height);
+    if (!_isInitialized) {
+        return;
+    }
+    // one region write per row, the rows of the rectangle not being contiguous in the
+    // frame buffer
+    for (uint16_t row = 0; row < rectangle.height; row++) {
+        const uint16_t* rowPixels = &pixels[static_cast<uint32_t>(row) * stride];
+        uint8_t* data             = nullptr;
+        if (_pixelFormat == LCD_PIXEL_FORMAT_RGB565) {
+            data = reinterpret_cast<uint8_t*>(const_cast<uint16_t*>(rowPixels));
+        } else {
+            for (uint16_t column = 0; column < rectangle.width; column++) {
+                gLcdRow[column] = toLcdColor(rowPixels[column]);
+            }
+            data = reinterpret_cast<uint8_t*>(gLcdRow);
+        }
+        BSP_LCD_FillRGBRect(kLcdInstance,
+                            _xPosition + rectangle.x,
+                            _yPosition + rectangle.y + row,
+                            data,
+                            rectangle.width,
+                            1);
+    }
+    _nbrOfRectangles++;
+    _nbrOfPixelsInCurrentFrame += rectangle.getArea();
+}
+
+void LcdDisplayBackend::endFlush() {
+    MBED_ASSERT(_isFlushing);
+    _isFlushing             = false;
+    _nbrOfPixelsInLastFrame = _nbrOfPixelsInCurrentFrame;
+    _nbrOfFrames++;
+}
+
+uint16_t LcdDisplayBackend::getXPosition() const { return _xPosition; }
+
+uint16_t LcdDisplayBackend::getYPosition() const { return _yPosition; }
+
+uint32_t LcdDisplayBackend::toLcdColor(uint16_t color) const {
+    if (_pixelFormat == LCD_PIXEL_FORMAT_RGB565) {
+        return color;
+    }
+    // RGB565 pixels are expanded to opaque ARGB8888 ones, the high bits being
+    // replicated in the low ones
+    const uint32_t red   = (color >> 11) & 0x1F;
+    const uint32_t green = (color >> 5) & 0x3F;
+    const uint32_t blue  = color & 0x1F;
+    return 0xFF000000 | (((red << 3) | (red >> 2)) << 16) |
+           (((green << 2) | (green >> 4)) << 8) | ((blue << 3) | (blue >> 2));
+}
+
+uint32_t LcdDisplayBackend::getNbrOfFrames() const { return _nbrOfFrames; }
+
+uint32_t LcdDisplayBackend::getNbrOfRectangles() const { return _nbrOfRectangles; }
+
+uint32_t LcdDisplayBackend::getNbrOfPixelsInLastFrame() const {
+    return _nbrOfPixelsInLastFrame;
+}
+
+}  // namespace bike_computer
@@ -0,0 +1,81 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file lcd_display_backend.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Display backend writing the flushed regions to the LCD of the DISCO_H747I board
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include "frame_buffer.hpp"
+#include "mbed.h"
+#include "return_code.hpp"
+
+namespace bike_computer {
+
+// Display backend writing each flushed region to the LCD of the board, row by row,
+// with the BSP region writes. The frame buffer (width * height pixels) is centered on
+// the LCD and its RGB565 pixels are converted to the pixel format of the LCD.
+class LcdDisplayBackend : public DisplayBackend {
+   public:
+    static constexpr uint32_t kLcdInstance = 0;
+    // maximal width of the frame buffer (size of the row conversion buffer)
+    static constexpr uint16_t kMaxWidth = 320;
+
+    LcdDisplayBackend(uint16_t width, uint16_t height);
+
+    // make the class non copyable
+    LcdDisplayBackend(LcdDisplayBackend&)            = delete;
+    LcdDisplayBackend& operator=(LcdDisplayBackend&) = delete;
+
+    // DisplayBackend (init() initializes and clears the LCD)
+    disco::ReturnCode init() override;
+    void beginFlush() override;
+    void flushRectangle(const Rectangle& rectangle,
+                        const uint16_t* pixels,
+                        uint16_t stride) override;
+    void endFlush() override;
+
+    // position of the frame buffer on the LCD
+    uint16_t getXPosition() const;
+    uint16_t getYPosition() const;
+    // returns the color of the LCD for a RGB565 color
+    uint32_t toLcdColor(uint16_t color) const;
+    // methods for getting the statistics of the backend
+    uint32_t getNbrOfFrames() const;
+    uint32_t getNbrOfRectangles() const;
+    uint32_t getNbrOfPixelsInLastFrame() const;
+
+   private:
+    // data members
+    const uint16_t _width;
+    const uint16_t _height;
+    uint16_t _xPosition                 = 0;
+    uint16_t _yPosition                 = 0;
+    uint32_t _pixelFormat               = 0;
+    bool _isInitialized                 = false;
+    bool _isFlushing                    = false;
+    uint32_t _nbrOfFrames               = 0;
+    uint32_t _nbrOfRectangles           = 0;
+    uint32_t _nbrOfPixelsInCurrentFrame = 0;
+    uint32_t _nbrOfPixelsInLastFrame    = 0;
+};
+
+}  // namespace bike_computer
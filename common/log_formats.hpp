@@ -0,0 +1,127 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file log_formats.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Formats of the deferred log records (shared with the host decoder)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include "mbed.h"
+#include "mbed_trace.h"
+
+namespace bike_computer {
+
+// identifiers of the deferred log formats, used as index in LogFormats::kFormats
+enum class LogFormatId : uint16_t {
+    SpeedometerSpeed    = 0,
+    SpeedometerDistance = 1,
+    ResetResponseTime   = 2,
+    CpuUsage            = 3
+};
+
+// format of a deferred log record: the arguments are 32-bit values and the only
+// supported conversions are d, i and c (signed), u, x, X and c (unsigned) and f, e
+// and g (float), with optional flags, width and precision
+struct LogFormat {
+    LogFormatId id;
+    // trace level (TRACE_LEVEL_DEBUG, TRACE_LEVEL_INFO, ...) and group
+    uint8_t level;
+    const char* group;
+    const char* format;
+};
+
+struct LogFormats {
+    static constexpr uint16_t kNbrOfFormats = 4;
+    static constexpr LogFormat kFormats[kNbrOfFormats] = {
+        {LogFormatId::SpeedometerSpeed,
+         TRACE_LEVEL_DEBUG,
+         "Speedometer",
+         "New speed is %f"},
+        {LogFormatId::SpeedometerDistance,
+         TRACE_LEVEL_DEBUG,
+         "Speedometer",
+         "Total distance %f, distance %f, speed %f, elapsed time %u"},
+        {LogFormatId::ResetResponseTime,
+         TRACE_LEVEL_INFO,
+         "BikeSystem",
+         "Reset task: response time is %u usecs"},
+        {LogFormatId::CpuUsage,
+         TRACE_LEVEL_INFO,
+         "BikeSystem",
+         "Idle: %u%% Usage: %u%%"}};
+
+    // returns true if a conversion modifier (flag, width or precision) follows the %
+    static constexpr bool isModifier(char character) {
+        return character == '-' || character == '+' || character == ' ' ||
+               character == '#' || character == '.' ||
+               (character >= '0' && character <= '9');
+    }
+
+    // returns the conversion of the argument at index in the format (0 if the format
+    // has less arguments)
+    static constexpr char getConversion(const char* format, uint8_t index) {
+        uint8_t argumentIndex = 0;
+        const char* character = format;
+        while (*character != '\0') {
+            if (*character++ != '%') {
+                continue;
+            }
+            if (*character == '%') {
+                character++;
+                continue;
+            }
+            while (isModifier(*character)) {
+                character++;
+            }
+            if (*character == '\0') {
+                break;
+            }
+            if (argumentIndex == index) {
+                return *character;
+            }
+            argumentIndex++;
+            character++;
+        }
+        return 0;
+    }
+
+    static constexpr uint8_t getNbrOfArguments(const char* format) {
+        uint8_t nbrOfArguments = 0;
+        while (getConversion(format, nbrOfArguments) != 0) {
+            nbrOfArguments++;
+        }
+        return nbrOfArguments;
+    }
+
+    // returns true if the formats are stored in the order of their identifier
+    static constexpr bool areOrdered() {
+        for (uint16_t index = 0; index < kNbrOfFormats; index++) {
+            if (static_cast<uint16_t>(kFormats[index].id) != index) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+static_assert(LogFormats::areOrdered(), "log formats must be ordered by identifier");
+
+}  // namespace bike_computer
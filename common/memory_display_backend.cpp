@@ -0,0 +1,86 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file memory_display_backend.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief MemoryDisplayBackend implementation
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include "memory_display_backend.hpp"
+
+#include <cstring>
+
+namespace bike_computer {
+
+MemoryDisplayBackend::MemoryDisplayBackend(uint16_t* screen,
+                                           uint16_t width,
+                                           uint16_t height)
+    : _screen(screen), _width(width), _height(height) {}
+
+disco::ReturnCode MemoryDisplayBackend::init() { return disco::ReturnCode::Ok; }
+
+void MemoryDisplayBackend::beginFlush() {
+    MBED_ASSERT(!_isFlushing);
+    _isFlushing                = true;
+    _nbrOfPixelsInCurrentFrame = 0;
+}
+
+void MemoryDisplayBackend::flushRectangle(const Rectangle& rectangle,
+                                          const uint16_t* pixels,
+                                          uint16_t stride) {
+    MBED_ASSERT(_isFlushing);
+    MBED_ASSERT(rectangle.x + rectangle.width <= _width &&
+                rectangle.y + rectangle.height <= _height);
+    for (uint16_t row = 0; row < rectangle.height; row++) {
+        memcpy(&_screen[static_cast<uint32_t>(rectangle.y + row) * _width + rectangle.x],
+               &pixels[static_cast<uint32_t>(row) * stride],
+               rectangle.width * sizeof(uint16_t));
+    }
+    _nbrOfRectangles++;
+    _nbrOfPixelsInCurrentFrame += rectangle.getArea();
+}
+
+void MemoryDisplayBackend::endFlush() {
+    MBED_ASSERT(_isFlushing);
+    _isFlushing             = false;
+    _nbrOfPixelsInLastFrame = _nbrOfPixelsInCurrentFrame;
+    _nbrOfPixels += _nbrOfPixelsInCurrentFrame;
+    _nbrOfFrames++;
+}
+
+uint16_t MemoryDisplayBackend::getWidth() const { return _width; }
+
+uint16_t MemoryDisplayBackend::getHeight() const { return _height; }
+
+uint16_t MemoryDisplayBackend::getPixel(uint16_t x, uint16_t y) const {
+    MBED_ASSERT(x < _width && y < _height);
+    return _screen[static_cast<uint32_t>(y) * _width + x];
+}
+
+uint32_t MemoryDisplayBackend::getNbrOfFrames() const { return _nbrOfFrames; }
+
+uint32_t MemoryDisplayBackend::getNbrOfRectangles() const { return _nbrOfRectangles; }
+
+uint32_t MemoryDisplayBackend::getNbrOfPixels() const { return _nbrOfPixels; }
+
+uint32_t MemoryDisplayBackend::getNbrOfPixelsInLastFrame() const {
+    return _nbrOfPixelsInLastFrame;
+}
+
+}  // namespace bike_computer
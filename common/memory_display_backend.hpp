@@ -0,0 +1,73 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file memory_display_backend.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Display backend writing the flushed regions to memory
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include "frame_buffer.hpp"
+#include "mbed.h"
+#include "return_code.hpp"
+
+namespace bike_computer {
+
+// Display backend copying the flushed regions to a screen memory (width * height
+// pixels, provided by the caller) and counting the pixels flushed per frame
+class MemoryDisplayBackend : public DisplayBackend {
+   public:
+    MemoryDisplayBackend(uint16_t* screen, uint16_t width, uint16_t height);
+
+    // make the class non copyable
+    MemoryDisplayBackend(MemoryDisplayBackend&)            = delete;
+    MemoryDisplayBackend& operator=(MemoryDisplayBackend&) = delete;
+
+    // DisplayBackend (the screen memory needs no initialization)
+    disco::ReturnCode init() override;
+    void beginFlush() override;
+    void flushRectangle(const Rectangle& rectangle,
+                        const uint16_t* pixels,
+                        uint16_t stride) override;
+    void endFlush() override;
+
+    uint16_t getWidth() const;
+    uint16_t getHeight() const;
+    uint16_t getPixel(uint16_t x, uint16_t y) const;
+    // methods for getting the statistics of the backend
+    uint32_t getNbrOfFrames() const;
+    uint32_t getNbrOfRectangles() const;
+    uint32_t getNbrOfPixels() const;
+    uint32_t getNbrOfPixelsInLastFrame() const;
+
+   private:
+    // data members
+    uint16_t* _screen;
+    const uint16_t _width;
+    const uint16_t _height;
+    bool _isFlushing                    = false;
+    uint32_t _nbrOfFrames               = 0;
+    uint32_t _nbrOfRectangles           = 0;
+    uint32_t _nbrOfPixels               = 0;
+    uint32_t _nbrOfPixelsInCurrentFrame = 0;
+    uint32_t _nbrOfPixelsInLastFrame    = 0;
+};
+
+}  // namespace bike_computer
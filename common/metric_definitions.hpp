@@ -0,0 +1,157 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file metric_definitions.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Definitions of the metrics of the registry (shared with the host decoder)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include "mbed.h"
+
+namespace bike_computer {
+
+// identifiers of the metrics, used as index in MetricDefinitions::kDefinitions
+enum class MetricId : uint8_t {
+    MajorCycles               = 0,
+    DeadlineMisses            = 1,
+    ModeTransitions           = 2,
+    CpuLoad                   = 3,
+    Gear                      = 4,
+    ResetResponseTime         = 5,
+    RenderTime                = 6,
+    SensorBusTransactions     = 7,
+    DeferredLogDroppedRecords = 8,
+    HeapLargestFreeBlock      = 9,
+    HeapFragmentation         = 10
+};
+
+// counters are incremented, gauges hold the last value set (signed) and histograms
+// count the recorded values per bucket
+enum class MetricType : uint8_t { Counter = 0, Gauge = 1, Histogram = 2 };
+
+struct MetricDefinition {
+    MetricId id;
+    MetricType type;
+    // name of the metric in the exported time series
+    const char* name;
+    // histograms only: upper bound (excluded) of the first bucket, the bound of each
+    // bucket being the bound of the previous one shifted by bucketShift, the last
+    // bucket holding all larger values
+    uint32_t firstBucketBound;
+    uint8_t bucketShift;
+};
+
+struct MetricDefinitions {
+    static constexpr uint8_t kNbrOfMetrics = 11;
+    static constexpr uint8_t kNbrOfBuckets = 8;
+    static constexpr MetricDefinition kDefinitions[kNbrOfMetrics] = {
+        {MetricId::MajorCycles, MetricType::Counter, "major_cycles", 0, 0},
+        {MetricId::DeadlineMisses, MetricType::Counter, "deadline_misses", 0, 0},
+        {MetricId::ModeTransitions, MetricType::Counter, "mode_transitions", 0, 0},
+        {MetricId::CpuLoad, MetricType::Gauge, "cpu_load_percent", 0, 0},
+        {MetricId::Gear, MetricType::Gauge, "gear", 0, 0},
+        {MetricId::ResetResponseTime,
+         MetricType::Histogram,
+         "reset_response_time_us",
+         64,
+         2},
+        {MetricId::RenderTime, MetricType::Histogram, "render_time_us", 1000, 1},
+        {MetricId::SensorBusTransactions,
+         MetricType::Counter,
+         "sensor_bus_transactions",
+         0,
+         0},
+        {MetricId::DeferredLogDroppedRecords,
+         MetricType::Counter,
+         "deferred_log_dropped_records",
+         0,
+         0},
+        {MetricId::HeapLargestFreeBlock,
+         MetricType::Gauge,
+         "heap_largest_free_block",
+         0,
+         0},
+        {MetricId::HeapFragmentation,
+         MetricType::Gauge,
+         "heap_fragmentation_percent",
+         0,
+         0}};
+
+    // number of 32-bit values (slots) used for storing a metric
+    static constexpr uint8_t getNbrOfSlots(MetricType type) {
+        return (type == MetricType::Histogram) ? kNbrOfBuckets : 1;
+    }
+
+    // index of the first slot of a metric, the slots of all metrics being stored
+    // contiguously in the order of their identifier
+    static constexpr uint8_t getFirstSlot(uint8_t metricIndex) {
+        uint8_t slot = 0;
+        for (uint8_t index = 0; index < metricIndex; index++) {
+            slot += getNbrOfSlots(kDefinitions[index].type);
+        }
+        return slot;
+    }
+
+    static constexpr uint8_t getFirstSlot(MetricId id) {
+        return getFirstSlot(static_cast<uint8_t>(id));
+    }
+
+    static constexpr uint8_t getNbrOfSlots() { return getFirstSlot(kNbrOfMetrics); }
+
+    // upper bound (excluded) of a histogram bucket, the last bucket having no bound
+    static constexpr uint32_t getBucketBound(const MetricDefinition& definition,
+                                             uint8_t bucket) {
+        return definition.firstBucketBound << (definition.bucketShift * bucket);
+    }
+
+    static constexpr uint8_t getBucket(const MetricDefinition& definition,
+                                       uint32_t value) {
+        uint8_t bucket = 0;
+        while (bucket < kNbrOfBuckets - 1 &&
+               value >= getBucketBound(definition, bucket)) {
+            bucket++;
+        }
+        return bucket;
+    }
+
+    // returns true if the definitions are stored in the order of their identifier
+    // and if the bounds of all histogram buckets can be represented
+    static constexpr bool areValid() {
+        for (uint8_t index = 0; index < kNbrOfMetrics; index++) {
+            const MetricDefinition& definition = kDefinitions[index];
+            if (static_cast<uint8_t>(definition.id) != index) {
+                return false;
+            }
+            if (definition.type == MetricType::Histogram &&
+                (definition.firstBucketBound == 0 || definition.bucketShift == 0 ||
+                 (definition.firstBucketBound >> (32 - definition.bucketShift *
+                                                           (kNbrOfBuckets - 2))) != 0)) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+static_assert(MetricDefinitions::areValid(),
+              "metric definitions must be ordered by identifier with valid buckets");
+
+}  // namespace bike_computer
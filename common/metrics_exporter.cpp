@@ -0,0 +1,158 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file metrics_exporter.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief MetricsExporter implementation (binary export of the metric deltas)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include "metrics_exporter.hpp"
+
+#include <cstdio>
+
+namespace bike_computer {
+
+// definitions required when the constants are odr-used (C++14)
+constexpr uint8_t MetricsExporter::kSyncByte;
+constexpr uint8_t MetricsExporter::kFrameHeaderSize;
+constexpr uint8_t MetricsExporter::kMaxDeltaSize;
+constexpr uint8_t MetricsExporter::kMaxPayloadSize;
+constexpr uint16_t MetricsExporter::kMaxFrameSize;
+constexpr std::chrono::milliseconds MetricsExporter::kExportPeriod;
+
+// zigzag encoding of signed deltas, for small negative deltas to be encoded on few
+// bytes (0, -1, 1, -2, ... are encoded as 0, 1, 2, 3, ...)
+static uint32_t encodeZigzag(int32_t value) {
+    return (static_cast<uint32_t>(value) << 1) ^ static_cast<uint32_t>(value >> 31);
+}
+
+MetricsExporter& MetricsExporter::getInstance() {
+    static MetricsExporter metricsExporter;
+    return metricsExporter;
+}
+
+MetricsExporter::MetricsExporter()
+    : _sink(callback(&MetricsExporter::writeToConsole)),
+      _thread(osPriorityLow, OS_STACK_SIZE, nullptr, "MetricsExporter") {
+    _timer.start();
+}
+
+MetricsExporter::~MetricsExporter() { stop(); }
+
+void MetricsExporter::setSink(Sink sink) {
+    _exportMutex.lock();
+    _sink = sink;
+    _exportMutex.unlock();
+}
+
+void MetricsExporter::start() {
+    if (_isStarted) {
+        return;
+    }
+    _isStarted = true;
+    core_util_atomic_store_bool(&_isStopping, false);
+    _thread.start(callback(this, &MetricsExporter::run));
+}
+
+void MetricsExporter::stop() {
+    if (!_isStarted) {
+        return;
+    }
+    core_util_atomic_store_bool(&_isStopping, true);
+    // wake up the export thread
+    _semaphore.release();
+    _thread.join();
+    _isStarted = false;
+}
+
+void MetricsExporter::exportDeltas() {
+    uint8_t frame[kMaxFrameSize];
+    _exportMutex.lock();
+    size_t size = kFrameHeaderSize;
+    for (uint8_t index = 0; index < MetricDefinitions::kNbrOfMetrics; index++) {
+        const MetricType type   = MetricDefinitions::kDefinitions[index].type;
+        const uint8_t firstSlot = MetricDefinitions::getFirstSlot(index);
+        const uint8_t lastSlot  = firstSlot + MetricDefinitions::getNbrOfSlots(type);
+        for (uint8_t slot = firstSlot; slot < lastSlot; slot++) {
+            // a slot updated while being exported is exported again at the next period
+            const uint32_t value = MetricsRegistry::load(slot);
+            if (value == _lastValues[slot]) {
+                continue;
+            }
+            uint32_t delta = value - _lastValues[slot];
+            if (type == MetricType::Gauge) {
+                delta = encodeZigzag(static_cast<int32_t>(delta));
+            }
+            _lastValues[slot] = value;
+            frame[size++]     = slot;
+            size += encodeDelta(delta, &frame[size]);
+        }
+    }
+
+    const uint32_t timestamp = static_cast<uint32_t>(
+        std::chrono::duration_cast<std::chrono::milliseconds>(_timer.elapsed_time())
+            .count());
+    frame[0] = kSyncByte;
+    frame[1] = static_cast<uint8_t>(_sequence);
+    frame[2] = static_cast<uint8_t>(_sequence >> 8);
+    for (uint8_t index = 0; index < 4; index++) {
+        frame[3 + index] = static_cast<uint8_t>(timestamp >> (8 * index));
+    }
+    frame[kFrameHeaderSize - 1] = static_cast<uint8_t>(size - kFrameHeaderSize);
+    uint8_t checksum            = 0;
+    for (size_t index = 1; index < size; index++) {
+        checksum += frame[index];
+    }
+    frame[size++] = checksum;
+
+    _sequence++;
+    _sink(frame, size);
+    _nbrOfSentFrames++;
+    _exportMutex.unlock();
+}
+
+uint32_t MetricsExporter::getNbrOfSentFrames() const { return _nbrOfSentFrames; }
+
+void MetricsExporter::run() {
+    while (true) {
+        _semaphore.try_acquire_for(kExportPeriod);
+        const bool isStopping = core_util_atomic_load_bool(&_isStopping);
+        exportDeltas();
+        if (isStopping) {
+            return;
+        }
+    }
+}
+
+size_t MetricsExporter::encodeDelta(uint32_t delta, uint8_t* data) {
+    size_t size = 0;
+    while (delta >= 0x80) {
+        data[size++] = static_cast<uint8_t>(delta | 0x80);
+        delta >>= 7;
+    }
+    data[size++] = static_cast<uint8_t>(delta);
+    return size;
+}
+
+void MetricsExporter::writeToConsole(const uint8_t* data, size_t size) {
+    fwrite(data, 1, size, stdout);
+    fflush(stdout);
+}
+
+}  // namespace bike_computer
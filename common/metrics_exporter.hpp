@@ -0,0 +1,108 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file metrics_exporter.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief MetricsExporter header file (binary export of the metric deltas)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include <chrono>
+
+#include "mbed.h"
+#include "metrics_registry.hpp"
+
+namespace bike_computer {
+
+// Periodic export of the metrics: a low-priority thread reads the slots of the
+// registry and sends the slots that changed since the previous export as a binary
+// frame to the sink (the console by default), the frames being decoded to a time
+// series on the host (see host/tools/metrics_decoder.hpp).
+// A frame is made of the sync byte, a sequence number (16 bits), the timestamp in ms
+// (32 bits), the payload size, the payload and a checksum (8-bit sum of the bytes
+// following the sync byte), all values being stored in little-endian order. The
+// payload is a list of (slot index, delta) pairs, the delta being encoded as a
+// variable-length integer (7 bits per byte, the most significant bit telling that
+// another byte follows). Gauge deltas are signed and zigzag encoded.
+// A frame is sent upon each export, even when no slot changed, so that the time
+// series has one row per export period.
+class MetricsExporter {
+   public:
+    // frame layout
+    static constexpr uint8_t kSyncByte        = 0x5A;
+    static constexpr uint8_t kFrameHeaderSize = 8;
+    static constexpr uint8_t kMaxDeltaSize    = 5;
+    static constexpr uint8_t kMaxPayloadSize =
+        MetricsRegistry::kNbrOfSlots * (1 + kMaxDeltaSize);
+    static constexpr uint16_t kMaxFrameSize = kFrameHeaderSize + kMaxPayloadSize + 1;
+    // period at which the deltas are exported
+    static constexpr std::chrono::milliseconds kExportPeriod = 1000ms;
+
+    typedef Callback<void(const uint8_t*, size_t)> Sink;
+
+    static MetricsExporter& getInstance();
+
+    // make the class non copyable
+    MetricsExporter(MetricsExporter&)            = delete;
+    MetricsExporter& operator=(MetricsExporter&) = delete;
+
+    // the sink must be set before the exporter is started
+    void setSink(Sink sink);
+
+    // start the export thread (the thread cannot be restarted once stopped)
+    void start();
+    // stop the thread, the last deltas being exported before it terminates
+    void stop();
+
+    // export the deltas from the calling thread
+    void exportDeltas();
+
+    // method for getting the statistics
+    uint32_t getNbrOfSentFrames() const;
+
+   private:
+    MetricsExporter();
+    ~MetricsExporter();
+
+    // private methods
+    void run();
+    static size_t encodeDelta(uint32_t delta, uint8_t* data);
+    static void writeToConsole(const uint8_t* data, size_t size);
+
+    // data members
+    Timer _timer;
+    // values of the slots upon the previous export
+    uint32_t _lastValues[MetricsRegistry::kNbrOfSlots] = {0};
+    uint16_t _sequence                                  = 0;
+    // the deltas are exported by a single thread at a time
+    Mutex _exportMutex;
+    Sink _sink;
+    Thread _thread;
+    Semaphore _semaphore;
+    bool _isStarted           = false;
+    volatile bool _isStopping = false;
+    uint32_t _nbrOfSentFrames = 0;
+};
+
+static_assert(MetricsRegistry::kNbrOfSlots * (1 + MetricsExporter::kMaxDeltaSize) <=
+                  UINT8_MAX,
+              "the payload size of the metrics frames must fit in one byte");
+
+}  // namespace bike_computer
@@ -0,0 +1,83 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file metrics_registry.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief MetricsRegistry implementation (statically allocated metrics)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include "metrics_registry.hpp"
+
+#include <cinttypes>
+#include <cstdio>
+
+#include "mbed_trace.h"
+#if MBED_CONF_MBED_TRACE_ENABLE
+#define TRACE_GROUP "MetricsRegistry"
+#endif  // MBED_CONF_MBED_TRACE_ENABLE
+
+namespace bike_computer {
+
+// definitions required when the constants are odr-used (C++14)
+constexpr MetricDefinition
+    MetricDefinitions::kDefinitions[MetricDefinitions::kNbrOfMetrics];
+constexpr uint8_t MetricDefinitions::kNbrOfMetrics;
+constexpr uint8_t MetricDefinitions::kNbrOfBuckets;
+constexpr uint8_t MetricsRegistry::kNbrOfSlots;
+
+// zero-initialized before any constructor runs
+volatile uint32_t MetricsRegistry::_slots[MetricsRegistry::kNbrOfSlots];
+
+void MetricsRegistry::add(uint8_t slot, uint32_t value) {
+    core_util_atomic_incr_u32(&_slots[slot], value);
+}
+
+void MetricsRegistry::store(uint8_t slot, uint32_t value) {
+    core_util_atomic_store_u32(&_slots[slot], value);
+}
+
+uint32_t MetricsRegistry::load(uint8_t slot) {
+    return core_util_atomic_load_u32(&_slots[slot]);
+}
+
+void MetricsRegistry::printStats() {
+    for (uint8_t index = 0; index < MetricDefinitions::kNbrOfMetrics; index++) {
+        const MetricDefinition& definition = MetricDefinitions::kDefinitions[index];
+        const uint8_t slot                 = MetricDefinitions::getFirstSlot(index);
+        if (definition.type == MetricType::Gauge) {
+            tr_info("%s: %" PRId32, definition.name, static_cast<int32_t>(load(slot)));
+        } else if (definition.type == MetricType::Counter) {
+            tr_info("%s: %" PRIu32, definition.name, load(slot));
+        } else {
+            // bucket counts, from the lowest bucket
+            char text[MetricDefinitions::kNbrOfBuckets * 11 + 1] = {0};
+            size_t length                                        = 0;
+            for (uint8_t bucket = 0; bucket < MetricDefinitions::kNbrOfBuckets;
+                 bucket++) {
+                length += snprintf(text + length,
+                                   sizeof(text) - length,
+                                   " %" PRIu32,
+                                   load(slot + bucket));
+            }
+            tr_info("%s:%s", definition.name, text);
+        }
+    }
+}
+
+}  // namespace bike_computer
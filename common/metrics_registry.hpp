@@ -0,0 +1,91 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file metrics_registry.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief MetricsRegistry header file (statically allocated metrics)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include "metric_definitions.hpp"
+#include "mbed.h"
+
+namespace bike_computer {
+
+// Registry of the metrics defined in metric_definitions.hpp: the values of all metrics
+// are statically allocated 32-bit slots that are updated atomically without locks, so
+// that metrics may be updated from any thread or ISR, even before main() is called.
+// Modules update the metrics through incrementMetric(), setMetric() and
+// recordMetric(), the type of the metric being checked at compile time.
+class MetricsRegistry {
+   public:
+    static constexpr uint8_t kNbrOfSlots = MetricDefinitions::getNbrOfSlots();
+
+    // methods called by the update functions
+    static void add(uint8_t slot, uint32_t value);
+    static void store(uint8_t slot, uint32_t value);
+
+    // method for reading the value of a slot (gauges are stored as int32_t)
+    static uint32_t load(uint8_t slot);
+
+    // method called for printing the value of each metric
+    static void printStats();
+
+   private:
+    // data members
+    static volatile uint32_t _slots[kNbrOfSlots];
+};
+
+// increments a counter, e.g. incrementMetric<MetricId::MajorCycles>()
+template <MetricId kMetricId>
+void incrementMetric(uint32_t delta = 1) {
+    static_assert(MetricDefinitions::kDefinitions[static_cast<uint8_t>(kMetricId)].type ==
+                      MetricType::Counter,
+                  "the metric is not a counter");
+    constexpr uint8_t kSlot = MetricDefinitions::getFirstSlot(kMetricId);
+    MetricsRegistry::add(kSlot, delta);
+}
+
+// sets the value of a gauge, e.g. setMetric<MetricId::Gear>(gear)
+template <MetricId kMetricId>
+void setMetric(int32_t value) {
+    static_assert(MetricDefinitions::kDefinitions[static_cast<uint8_t>(kMetricId)].type ==
+                      MetricType::Gauge,
+                  "the metric is not a gauge");
+    constexpr uint8_t kSlot = MetricDefinitions::getFirstSlot(kMetricId);
+    MetricsRegistry::store(kSlot, static_cast<uint32_t>(value));
+}
+
+// records a value in the buckets of a histogram,
+// e.g. recordMetric<MetricId::RenderTime>(renderTime)
+template <MetricId kMetricId>
+void recordMetric(uint32_t value) {
+    static_assert(MetricDefinitions::kDefinitions[static_cast<uint8_t>(kMetricId)].type ==
+                      MetricType::Histogram,
+                  "the metric is not a histogram");
+    constexpr uint8_t kSlot = MetricDefinitions::getFirstSlot(kMetricId);
+    MetricsRegistry::add(
+        kSlot + MetricDefinitions::getBucket(
+                    MetricDefinitions::kDefinitions[static_cast<uint8_t>(kMetricId)],
+                    value),
+        1);
+}
+
+}  // namespace bike_computer
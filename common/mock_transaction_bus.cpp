@@ -0,0 +1,79 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file mock_transaction_bus.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief MockTransactionBus implementation
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include "mock_transaction_bus.hpp"
+
+namespace bike_computer {
+
+MockTransactionBus::MockTransactionBus(const std::chrono::microseconds& byteTime)
+    : _byteTime(byteTime) {}
+
+int MockTransactionBus::transfer(uint8_t address,
+                                 const char* writeData,
+                                 uint16_t writeLength,
+                                 char* readData,
+                                 uint16_t readLength) {
+    const uint8_t nbrOfRunningTransactions =
+        core_util_atomic_incr_u8(&_nbrOfRunningTransactions, 1);
+    // the maximum is updated by the transactions running concurrently
+    uint8_t maxNbrOfTransactions =
+        core_util_atomic_load_u8(&_maxNbrOfConcurrentTransactions);
+    while (nbrOfRunningTransactions > maxNbrOfTransactions &&
+           !core_util_atomic_cas_u8(&_maxNbrOfConcurrentTransactions,
+                                    &maxNbrOfTransactions,
+                                    nbrOfRunningTransactions)) {
+    }
+
+    wait_us(static_cast<int>(getTransferTime(writeLength, readLength).count()));
+    for (uint16_t index = 0; index < readLength; index++) {
+        readData[index] = static_cast<char>(address + index);
+    }
+
+    core_util_atomic_incr_u32(&_nbrOfTransactions, 1);
+    core_util_atomic_incr_u32(&_nbrOfBytes, writeLength + readLength);
+    core_util_atomic_decr_u8(&_nbrOfRunningTransactions, 1);
+    return 0;
+}
+
+std::chrono::microseconds MockTransactionBus::getTransferTime(uint16_t writeLength,
+                                                              uint16_t readLength) const {
+    // one address byte per direction
+    const uint16_t nbrOfAddressBytes =
+        ((writeLength > 0) ? 1 : 0) + ((readLength > 0) ? 1 : 0);
+    return _byteTime * (nbrOfAddressBytes + writeLength + readLength);
+}
+
+uint32_t MockTransactionBus::getNbrOfTransactions() const {
+    return core_util_atomic_load_u32(&_nbrOfTransactions);
+}
+
+uint32_t MockTransactionBus::getNbrOfBytes() const {
+    return core_util_atomic_load_u32(&_nbrOfBytes);
+}
+
+uint8_t MockTransactionBus::getMaxNbrOfConcurrentTransactions() const {
+    return core_util_atomic_load_u8(&_maxNbrOfConcurrentTransactions);
+}
+
+}  // namespace bike_computer
@@ -0,0 +1,70 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file mock_transaction_bus.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Mock transaction bus with a configurable byte time
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include <chrono>
+
+#include "bus_scheduler.hpp"
+#include "mbed.h"
+
+namespace bike_computer {
+
+// Bus keeping the cpu busy during the time needed for clocking the bytes of each
+// transaction (address bytes included), as a polled bus master would do. The bytes
+// read are the low bytes of address + index. The bus records the largest number of
+// transactions running concurrently, which must be 1 when the bus is scheduled.
+class MockTransactionBus : public TransactionBus {
+   public:
+    explicit MockTransactionBus(const std::chrono::microseconds& byteTime);
+
+    // make the class non copyable
+    MockTransactionBus(MockTransactionBus&)            = delete;
+    MockTransactionBus& operator=(MockTransactionBus&) = delete;
+
+    int transfer(uint8_t address,
+                 const char* writeData,
+                 uint16_t writeLength,
+                 char* readData,
+                 uint16_t readLength) override;
+
+    // duration of a transaction
+    std::chrono::microseconds getTransferTime(uint16_t writeLength,
+                                              uint16_t readLength) const;
+
+    // methods for getting the statistics of the bus
+    uint32_t getNbrOfTransactions() const;
+    uint32_t getNbrOfBytes() const;
+    uint8_t getMaxNbrOfConcurrentTransactions() const;
+
+   private:
+    // data members
+    const std::chrono::microseconds _byteTime;
+    volatile uint32_t _nbrOfTransactions             = 0;
+    volatile uint32_t _nbrOfBytes                    = 0;
+    volatile uint8_t _nbrOfRunningTransactions       = 0;
+    volatile uint8_t _maxNbrOfConcurrentTransactions = 0;
+};
+
+}  // namespace bike_computer
@@ -0,0 +1,164 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file overload_monitor.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief OverloadMonitor implementation (mixed-criticality mode switching)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include "overload_monitor.hpp"
+
+#include "metrics_registry.hpp"
+
+#include "mbed_trace.h"
+#if MBED_CONF_MBED_TRACE_ENABLE
+#define TRACE_GROUP "OverloadMonitor"
+#endif  // MBED_CONF_MBED_TRACE_ENABLE
+
+namespace bike_computer {
+
+// definitions required when the constants are odr-used (C++14)
+constexpr uint8_t OverloadMonitor::kEnterLoadThreshold;
+constexpr uint8_t OverloadMonitor::kExitLoadThreshold;
+constexpr uint8_t OverloadMonitor::kRecoveryCycles;
+constexpr uint8_t OverloadMonitor::kLowCriticalityStretchFactor;
+
+static const char* const kModeNames[OverloadMonitor::kNbrOfModes] = {"normal",
+                                                                     "degraded"};
+
+OverloadMonitor::OverloadMonitor(Timer& timer) : _timer(timer) {
+    for (uint8_t modeIndex = 0; modeIndex < kNbrOfModes; modeIndex++) {
+        _timeInMode[modeIndex] = std::chrono::microseconds::zero();
+    }
+    // initialize the cpu statistics used as reference for the first sample
+    mbed_stats_cpu_t stats;
+    mbed_stats_cpu_get(&stats);
+    _lastUptime   = stats.uptime;
+    _lastIdleTime = stats.idle_time;
+}
+
+void OverloadMonitor::sample(bool deadlineMissed) {
+    uint8_t cpuLoad = measureCpuLoad();
+#if defined(MBED_TEST_MODE)
+    if (_simulatedCpuLoad != kNoSimulatedLoad) {
+        cpuLoad = _simulatedCpuLoad;
+    }
+#endif  // defined(MBED_TEST_MODE)
+    update(cpuLoad, deadlineMissed);
+}
+
+void OverloadMonitor::update(uint8_t cpuLoad, bool deadlineMissed) {
+    _lastCpuLoad = cpuLoad;
+    if (_mode == Mode::Normal) {
+        // enter the degraded mode as soon as the system is overloaded
+        if (cpuLoad >= kEnterLoadThreshold || deadlineMissed) {
+            switchTo(Mode::Degraded, cpuLoad, deadlineMissed);
+        }
+        return;
+    }
+
+    // in degraded mode, the system must be recovered for kRecoveryCycles
+    // consecutive cycles before switching back to the normal mode
+    _degradedCycles++;
+    if (cpuLoad <= kExitLoadThreshold && !deadlineMissed) {
+        _recoveredCycles++;
+    } else {
+        _recoveredCycles = 0;
+    }
+    if (_recoveredCycles >= kRecoveryCycles) {
+        switchTo(Mode::Normal, cpuLoad, deadlineMissed);
+    }
+}
+
+bool OverloadMonitor::isLowCriticalityReleased() const {
+    if (_mode == Mode::Normal) {
+        return true;
+    }
+    if (kLowCriticalityStretchFactor == 0) {
+        return false;
+    }
+    return (_degradedCycles % kLowCriticalityStretchFactor) ==
+           (kLowCriticalityStretchFactor - 1);
+}
+
+OverloadMonitor::Mode OverloadMonitor::getMode() const { return _mode; }
+
+uint8_t OverloadMonitor::getLastCpuLoad() const { return _lastCpuLoad; }
+
+uint32_t OverloadMonitor::getNbrOfTransitions() const { return _nbrOfTransitions; }
+
+std::chrono::microseconds OverloadMonitor::getTimeInMode(Mode mode) const {
+    std::chrono::microseconds timeInMode = _timeInMode[static_cast<uint8_t>(mode)];
+    if (mode == _mode) {
+        timeInMode += _timer.elapsed_time() - _modeStartTime;
+    }
+    return timeInMode;
+}
+
+void OverloadMonitor::printStats() const {
+    for (uint8_t modeIndex = 0; modeIndex < kNbrOfModes; modeIndex++) {
+        const auto timeInMode = std::chrono::duration_cast<std::chrono::milliseconds>(
+            getTimeInMode(static_cast<Mode>(modeIndex)));
+        tr_info("Time spent in %s mode: %" PRIu64 " ms",
+                kModeNames[modeIndex],
+                timeInMode.count());
+    }
+}
+
+#if defined(MBED_TEST_MODE)
+void OverloadMonitor::simulateCpuLoad(uint8_t cpuLoad) { _simulatedCpuLoad = cpuLoad; }
+#endif  // defined(MBED_TEST_MODE)
+
+uint8_t OverloadMonitor::measureCpuLoad() {
+    // same computation as the one done by the CPULogger, but over the last cycle only
+    mbed_stats_cpu_t stats;
+    mbed_stats_cpu_get(&stats);
+    const uint64_t uptimeDiff = stats.uptime - _lastUptime;
+    const uint64_t idleDiff   = stats.idle_time - _lastIdleTime;
+    _lastUptime               = stats.uptime;
+    _lastIdleTime             = stats.idle_time;
+    if (uptimeDiff == 0 || idleDiff > uptimeDiff) {
+        return 0;
+    }
+    return static_cast<uint8_t>(100 - ((idleDiff * 100) / uptimeDiff));
+}
+
+void OverloadMonitor::switchTo(Mode mode, uint8_t cpuLoad, bool deadlineMissed) {
+    const std::chrono::microseconds now = _timer.elapsed_time();
+    const auto timeInPreviousMode       = now - _modeStartTime;
+    _timeInMode[static_cast<uint8_t>(_mode)] += timeInPreviousMode;
+
+    tr_info("Switching from %s to %s mode (cpu load %d%%, deadline missed %d) "
+            "after %" PRIu64 " ms",
+            kModeNames[static_cast<uint8_t>(_mode)],
+            kModeNames[static_cast<uint8_t>(mode)],
+            cpuLoad,
+            deadlineMissed,
+            std::chrono::duration_cast<std::chrono::milliseconds>(timeInPreviousMode)
+                .count());
+
+    _mode            = mode;
+    _modeStartTime   = now;
+    _recoveredCycles = 0;
+    _degradedCycles  = 0;
+    _nbrOfTransitions++;
+    incrementMetric<MetricId::ModeTransitions>();
+}
+
+}  // namespace bike_computer
@@ -0,0 +1,104 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file overload_monitor.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief OverloadMonitor header file (mixed-criticality mode switching)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include <chrono>
+
+#include "mbed.h"
+
+namespace bike_computer {
+
+class OverloadMonitor {
+   public:
+    // operating modes of the bike system
+    enum class Mode : uint8_t { Normal = 0, Degraded = 1 };
+    static constexpr uint8_t kNbrOfModes = 2;
+
+    // cpu load (in percent) above which the system enters the degraded mode
+    static constexpr uint8_t kEnterLoadThreshold = 85;
+    // cpu load (in percent) below which the system may leave the degraded mode
+    static constexpr uint8_t kExitLoadThreshold = 60;
+    // number of consecutive recovered major cycles required for leaving the
+    // degraded mode (hysteresis)
+    static constexpr uint8_t kRecoveryCycles = 3;
+    // in degraded mode, low-criticality tasks are released once every
+    // kLowCriticalityStretchFactor major cycles (0 means that they are dropped)
+    static constexpr uint8_t kLowCriticalityStretchFactor = 2;
+
+    explicit OverloadMonitor(Timer& timer);  // NOLINT(runtime/references)
+
+    // make the class non copyable
+    OverloadMonitor(OverloadMonitor&)            = delete;
+    OverloadMonitor& operator=(OverloadMonitor&) = delete;
+
+    // method called once per major cycle: samples the cpu load over the last cycle
+    // and updates the mode
+    void sample(bool deadlineMissed);
+
+    // method called once per major cycle with an already measured cpu load
+    // (expressed in percent)
+    void update(uint8_t cpuLoad, bool deadlineMissed);
+
+    // method called by low-criticality tasks for checking whether they must run
+    bool isLowCriticalityReleased() const;
+
+    // methods for getting the mode and the mode statistics
+    Mode getMode() const;
+    uint8_t getLastCpuLoad() const;
+    uint32_t getNbrOfTransitions() const;
+    std::chrono::microseconds getTimeInMode(Mode mode) const;
+
+    // method called for printing the time spent in each mode
+    void printStats() const;
+
+#if defined(MBED_TEST_MODE)
+    // force the cpu load used by sample() (kNoSimulatedLoad for real measurements)
+    static constexpr uint8_t kNoSimulatedLoad = 0xFF;
+    void simulateCpuLoad(uint8_t cpuLoad);
+#endif  // defined(MBED_TEST_MODE)
+
+   private:
+    // private methods
+    uint8_t measureCpuLoad();
+    void switchTo(Mode mode, uint8_t cpuLoad, bool deadlineMissed);
+
+    // data members
+    Timer& _timer;
+    volatile Mode _mode                      = Mode::Normal;
+    std::chrono::microseconds _modeStartTime = std::chrono::microseconds::zero();
+    std::chrono::microseconds _timeInMode[kNbrOfModes];
+    uint32_t _nbrOfTransitions = 0;
+    uint8_t _recoveredCycles   = 0;
+    uint32_t _degradedCycles   = 0;
+    uint8_t _lastCpuLoad       = 0;
+    // cpu statistics of the previous sample, used for computing the load
+    uint64_t _lastUptime   = 0;
+    uint64_t _lastIdleTime = 0;
+#if defined(MBED_TEST_MODE)
+    uint8_t _simulatedCpuLoad = kNoSimulatedLoad;
+#endif  // defined(MBED_TEST_MODE)
+};
+
+}  // namespace bike_computer
@@ -0,0 +1,227 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file polling_scheduler.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief PollingScheduler implementation
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include "polling_scheduler.hpp"
+
+#include <cinttypes>
+
+#include "mbed_trace.h"
+#if MBED_CONF_MBED_TRACE_ENABLE
+#define TRACE_GROUP "PollingScheduler"
+#endif  // MBED_CONF_MBED_TRACE_ENABLE
+
+namespace bike_computer {
+
+PollingScheduler::PollingScheduler(SensorRegistry& registry,
+                                   const std::chrono::milliseconds& framePeriod)
+    : _registry(registry), _framePeriod(framePeriod) {}
+
+bool PollingScheduler::plan() {
+    const uint8_t nbrOfSensors = _registry.getNbrOfSensors();
+    _nbrOfBuses                = 0;
+    for (uint8_t slot = 0; slot < kNbrOfFrameSlots; slot++) {
+        _plannedLoads[slot] = 0;
+    }
+
+    for (uint8_t index = 0; index < nbrOfSensors; index++) {
+        Sensor& sensor = _registry.getSensor(index);
+        Entry& entry   = _entries[index];
+
+        // group the sensors by bus
+        uint8_t busIndex = 0;
+        while (busIndex < _nbrOfBuses && _buses[busIndex] != &sensor.getBus()) {
+            busIndex++;
+        }
+        if (busIndex == _nbrOfBuses) {
+            if (_nbrOfBuses == kMaxNbrOfBuses) {
+                tr_error("Too many sensor buses");
+                return false;
+            }
+            _buses[_nbrOfBuses] = &sensor.getBus();
+            _nbrOfBuses++;
+        }
+        entry.busIndex  = busIndex;
+        entry.isPending = false;
+
+        // the period is saturated to the longest one that can be planned (about 11
+        // minutes with 10 ms frames), so that it never wraps
+        const int64_t periodInFrames = sensor.getSamplingPeriod() / _framePeriod;
+        entry.periodInFrames =
+            (periodInFrames < 1)            ? 1
+            : (periodInFrames > UINT16_MAX) ? UINT16_MAX
+                                            : static_cast<uint16_t>(periodInFrames);
+    }
+
+    // the sensors with the shortest periods are the most constrained ones: they are
+    // placed first
+    bool isPlaced[SensorRegistry::kMaxNbrOfSensors] = {false};
+    for (uint8_t placement = 0; placement < nbrOfSensors; placement++) {
+        uint8_t nextIndex = 0;
+        bool isFound      = false;
+        for (uint8_t index = 0; index < nbrOfSensors; index++) {
+            if (!isPlaced[index] &&
+                (!isFound ||
+                 _entries[index].periodInFrames < _entries[nextIndex].periodInFrames)) {
+                nextIndex = index;
+                isFound   = true;
+            }
+        }
+        Entry& entry        = _entries[nextIndex];
+        entry.phase         = choosePhase(entry.periodInFrames);
+        isPlaced[nextIndex] = true;
+        for (uint32_t slot = entry.phase; slot < kNbrOfFrameSlots;
+             slot += entry.periodInFrames) {
+            _plannedLoads[slot]++;
+        }
+    }
+    return true;
+}
+
+void PollingScheduler::poll(const std::chrono::microseconds& now) {
+    const uint8_t nbrOfSensors = _registry.getNbrOfSensors();
+    uint8_t nbrOfStarts        = 0;
+
+    for (uint8_t busIndex = 0; busIndex < _nbrOfBuses; busIndex++) {
+        bool isLocked = false;
+        for (uint8_t index = 0; index < nbrOfSensors; index++) {
+            Entry& entry = _entries[index];
+            if (entry.busIndex != busIndex) {
+                continue;
+            }
+            Sensor& sensor = _registry.getSensor(index);
+            const bool isFetchDue =
+                entry.isPending && now - entry.startTime >= sensor.getConversionTime();
+            const bool isStartDue = (_frame % entry.periodInFrames) == entry.phase;
+            if (!isFetchDue && !isStartDue) {
+                continue;
+            }
+
+            // all transactions of the frame on this bus run in a single batch
+            if (!isLocked) {
+                _buses[busIndex]->lock();
+                isLocked = true;
+                _nbrOfBatches++;
+            }
+            if (isFetchDue) {
+                float value = 0.0f;
+                if (sensor.fetchSample(value)) {
+                    sensor.updateValue(value, now);
+                    entry.isPending = false;
+                    _nbrOfFetchedSamples++;
+                }
+            }
+            if (isStartDue) {
+                if (entry.isPending) {
+                    _nbrOfOverruns++;
+                } else if (sensor.startSample()) {
+                    entry.isPending = true;
+                    entry.startTime = now;
+                    _nbrOfStartedSamples++;
+                    nbrOfStarts++;
+                }
+            }
+        }
+        if (isLocked) {
+            _buses[busIndex]->unlock();
+        }
+    }
+
+    if (nbrOfStarts > _maxNbrOfStartsPerFrame) {
+        _maxNbrOfStartsPerFrame = nbrOfStarts;
+    }
+    _frame++;
+}
+
+uint16_t PollingScheduler::getPeriodInFrames(uint8_t sensorIndex) const {
+    return _entries[sensorIndex].periodInFrames;
+}
+
+uint16_t PollingScheduler::getPhase(uint8_t sensorIndex) const {
+    return _entries[sensorIndex].phase;
+}
+
+uint8_t PollingScheduler::getPlannedMaxLoad() const {
+    uint8_t maxLoad = 0;
+    for (uint8_t slot = 0; slot < kNbrOfFrameSlots; slot++) {
+        if (_plannedLoads[slot] > maxLoad) {
+            maxLoad = _plannedLoads[slot];
+        }
+    }
+    return maxLoad;
+}
+
+uint32_t PollingScheduler::getNbrOfFrames() const { return _frame; }
+
+uint32_t PollingScheduler::getNbrOfBatches() const { return _nbrOfBatches; }
+
+uint32_t PollingScheduler::getNbrOfStartedSamples() const { return _nbrOfStartedSamples; }
+
+uint32_t PollingScheduler::getNbrOfFetchedSamples() const { return _nbrOfFetchedSamples; }
+
+uint32_t PollingScheduler::getNbrOfOverruns() const { return _nbrOfOverruns; }
+
+uint8_t PollingScheduler::getMaxNbrOfStartsPerFrame() const {
+    return _maxNbrOfStartsPerFrame;
+}
+
+void PollingScheduler::printStats() const {
+    tr_info("Sensor polling: %" PRIu32 " frames, %" PRIu32 " batches, %" PRIu32
+            " samples started, %" PRIu32 " fetched, %" PRIu32
+            " overruns, at most %d starts per frame (planned %d)",
+            _frame,
+            _nbrOfBatches,
+            _nbrOfStartedSamples,
+            _nbrOfFetchedSamples,
+            _nbrOfOverruns,
+            _maxNbrOfStartsPerFrame,
+            getPlannedMaxLoad());
+}
+
+uint16_t PollingScheduler::choosePhase(uint16_t periodInFrames) const {
+    // the phase minimizing the largest load of the frames used by the sensor, then
+    // their total load
+    const uint16_t nbrOfPhases =
+        (periodInFrames < kNbrOfFrameSlots) ? periodInFrames : kNbrOfFrameSlots;
+    uint16_t bestPhase   = 0;
+    uint16_t bestMaxLoad = UINT16_MAX;
+    uint32_t bestLoad    = UINT32_MAX;
+    for (uint16_t phase = 0; phase < nbrOfPhases; phase++) {
+        uint16_t maxLoad = 0;
+        uint32_t load    = 0;
+        for (uint32_t slot = phase; slot < kNbrOfFrameSlots; slot += periodInFrames) {
+            if (_plannedLoads[slot] > maxLoad) {
+                maxLoad = _plannedLoads[slot];
+            }
+            load += _plannedLoads[slot];
+        }
+        if (maxLoad < bestMaxLoad || (maxLoad == bestMaxLoad && load < bestLoad)) {
+            bestPhase   = phase;
+            bestMaxLoad = maxLoad;
+            bestLoad    = load;
+        }
+    }
+    return bestPhase;
+}
+
+}  // namespace bike_computer
@@ -0,0 +1,103 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file polling_scheduler.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Batched polling of the registered sensors, spread across frames
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include <chrono>
+
+#include "mbed.h"
+#include "sensor_registry.hpp"
+
+namespace bike_computer {
+
+// The polling scheduler is called once per frame (poll()) and samples each registered
+// sensor at its sampling period, rounded to a multiple of the frame period:
+// - plan() gives each sensor a phase (the frame of its first sample) chosen so that
+//   the samples are spread across the frames instead of piling onto the same ones
+// - in each frame, the transactions of the sensors sharing a bus are run in a single
+//   batch (the bus is locked once): the samples whose conversion has elapsed are
+//   fetched and the due samples are started
+// Periods dividing kNbrOfFrameSlots are spread exactly.
+class PollingScheduler {
+   public:
+    static constexpr uint8_t kNbrOfFrameSlots = 60;
+    static constexpr uint8_t kMaxNbrOfBuses   = 8;
+
+    PollingScheduler(SensorRegistry& registry,  // NOLINT(runtime/references)
+                     const std::chrono::milliseconds& framePeriod);
+
+    // make the class non copyable
+    PollingScheduler(PollingScheduler&)            = delete;
+    PollingScheduler& operator=(PollingScheduler&) = delete;
+
+    // method called once all sensors are registered, returns false if the sensors use
+    // too many buses
+    bool plan();
+
+    // method called once per frame
+    void poll(const std::chrono::microseconds& now);
+
+    // methods for getting the plan and the statistics
+    uint16_t getPeriodInFrames(uint8_t sensorIndex) const;
+    uint16_t getPhase(uint8_t sensorIndex) const;
+    // largest number of samples started in a frame according to the plan
+    uint8_t getPlannedMaxLoad() const;
+    uint32_t getNbrOfFrames() const;
+    uint32_t getNbrOfBatches() const;
+    uint32_t getNbrOfStartedSamples() const;
+    uint32_t getNbrOfFetchedSamples() const;
+    // samples due while the previous one was not fetched yet
+    uint32_t getNbrOfOverruns() const;
+    uint8_t getMaxNbrOfStartsPerFrame() const;
+    void printStats() const;
+
+   private:
+    struct Entry {
+        uint16_t periodInFrames             = 1;
+        uint16_t phase                      = 0;
+        uint8_t busIndex                    = 0;
+        bool isPending                      = false;
+        std::chrono::microseconds startTime = std::chrono::microseconds::zero();
+    };
+
+    // private methods
+    uint16_t choosePhase(uint16_t periodInFrames) const;
+
+    // data members
+    SensorRegistry& _registry;
+    const std::chrono::milliseconds _framePeriod;
+    Entry _entries[SensorRegistry::kMaxNbrOfSensors];
+    SensorBus* _buses[kMaxNbrOfBuses] = {nullptr};
+    uint8_t _nbrOfBuses               = 0;
+    // number of samples started in each frame slot according to the plan
+    uint8_t _plannedLoads[kNbrOfFrameSlots] = {0};
+    uint32_t _frame                         = 0;
+    uint32_t _nbrOfBatches                  = 0;
+    uint32_t _nbrOfStartedSamples           = 0;
+    uint32_t _nbrOfFetchedSamples           = 0;
+    uint32_t _nbrOfOverruns                 = 0;
+    uint8_t _maxNbrOfStartsPerFrame         = 0;
+};
+
+}  // namespace bike_computer
@@ -0,0 +1,167 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file pool_allocator.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Fixed-block pool allocator implementation
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include "pool_allocator.hpp"
+
+#include <cinttypes>
+
+#include "mbed_trace.h"
+#if MBED_CONF_MBED_TRACE_ENABLE
+#define TRACE_GROUP "PoolAllocator"
+#endif  // MBED_CONF_MBED_TRACE_ENABLE
+
+namespace bike_computer {
+
+// definitions required when the constants are odr-used (C++14)
+constexpr PoolDefinition PoolDefinitions::kDefinitions[PoolDefinitions::kNbrOfPools];
+constexpr uint8_t PoolDefinitions::kNbrOfPools;
+constexpr uint8_t PoolDefinitions::kAlignment;
+
+// zero-initialized before any constructor runs
+alignas(PoolDefinitions::kAlignment) uint8_t
+    PoolAllocator::_memory[PoolDefinitions::getTotalSize()];
+PoolAllocator::Pool PoolAllocator::_pools[PoolDefinitions::kNbrOfPools];
+
+void* PoolAllocator::allocate(size_t size) {
+    uint8_t firstPoolIndex = 0;
+    while (firstPoolIndex < PoolDefinitions::kNbrOfPools &&
+           PoolDefinitions::kDefinitions[firstPoolIndex].blockSize < size) {
+        firstPoolIndex++;
+    }
+    if (firstPoolIndex == PoolDefinitions::kNbrOfPools) {
+        // larger than the largest block, counted as a failure of the largest pool
+        core_util_critical_section_enter();
+        _pools[PoolDefinitions::kNbrOfPools - 1].nbrOfFailures++;
+        core_util_critical_section_exit();
+        return nullptr;
+    }
+
+    core_util_critical_section_enter();
+    void* block       = nullptr;
+    uint8_t poolIndex = firstPoolIndex;
+    for (; poolIndex < PoolDefinitions::kNbrOfPools; poolIndex++) {
+        block = allocateFromPool(poolIndex);
+        if (block != nullptr) {
+            break;
+        }
+    }
+    if (block == nullptr) {
+        _pools[firstPoolIndex].nbrOfFailures++;
+    } else if (poolIndex != firstPoolIndex) {
+        _pools[firstPoolIndex].nbrOfSpills++;
+    }
+    core_util_critical_section_exit();
+    return block;
+}
+
+void PoolAllocator::free(void* block) {
+    if (block == nullptr) {
+        return;
+    }
+    MBED_ASSERT(owns(block));
+    const uint32_t offset = static_cast<uint8_t*>(block) - _memory;
+    uint8_t poolIndex     = 0;
+    while (offset >= PoolDefinitions::getOffset(poolIndex + 1)) {
+        poolIndex++;
+    }
+    MBED_ASSERT((offset - PoolDefinitions::getOffset(poolIndex)) %
+                    PoolDefinitions::kDefinitions[poolIndex].blockSize ==
+                0);
+
+    core_util_critical_section_enter();
+    Pool& pool           = _pools[poolIndex];
+    FreeBlock* freeBlock = static_cast<FreeBlock*>(block);
+    freeBlock->next      = pool.freeBlocks;
+    pool.freeBlocks      = freeBlock;
+    pool.nbrOfUsedBlocks--;
+    core_util_critical_section_exit();
+}
+
+bool PoolAllocator::owns(const void* block) {
+    return block >= &_memory[0] && block < &_memory[PoolDefinitions::getTotalSize()];
+}
+
+PoolAllocator::PoolStats PoolAllocator::getPoolStats(uint8_t poolIndex) {
+    MBED_ASSERT(poolIndex < PoolDefinitions::kNbrOfPools);
+    core_util_critical_section_enter();
+    const Pool& pool = _pools[poolIndex];
+    PoolStats stats  = {PoolDefinitions::kDefinitions[poolIndex].blockSize,
+                        PoolDefinitions::kDefinitions[poolIndex].nbrOfBlocks,
+                        pool.nbrOfUsedBlocks,
+                        pool.highWaterMark,
+                        pool.nbrOfSpills,
+                        pool.nbrOfFailures};
+    core_util_critical_section_exit();
+    return stats;
+}
+
+void PoolAllocator::printStats() {
+    for (uint8_t poolIndex = 0; poolIndex < PoolDefinitions::kNbrOfPools; poolIndex++) {
+        const PoolStats stats = getPoolStats(poolIndex);
+        tr_info("Pool of %" PRIu16 " bytes blocks: %" PRIu16 "/%" PRIu16
+                " used (high-water mark %" PRIu16 "), %" PRIu32 " spills, %" PRIu32
+                " failures",
+                stats.blockSize,
+                stats.nbrOfUsedBlocks,
+                stats.nbrOfBlocks,
+                stats.highWaterMark,
+                stats.nbrOfSpills,
+                stats.nbrOfFailures);
+    }
+}
+
+#if defined(MBED_TEST_MODE)
+void PoolAllocator::resetStats() {
+    core_util_critical_section_enter();
+    for (Pool& pool : _pools) {
+        pool.highWaterMark = pool.nbrOfUsedBlocks;
+        pool.nbrOfSpills   = 0;
+        pool.nbrOfFailures = 0;
+    }
+    core_util_critical_section_exit();
+}
+#endif  // defined(MBED_TEST_MODE)
+
+void* PoolAllocator::allocateFromPool(uint8_t poolIndex) {
+    const PoolDefinition& definition = PoolDefinitions::kDefinitions[poolIndex];
+    Pool& pool                       = _pools[poolIndex];
+    void* block                      = nullptr;
+    if (pool.freeBlocks != nullptr) {
+        block           = pool.freeBlocks;
+        pool.freeBlocks = pool.freeBlocks->next;
+    } else if (pool.nbrOfHandedOutBlocks < definition.nbrOfBlocks) {
+        block = &_memory[PoolDefinitions::getOffset(poolIndex) +
+                         pool.nbrOfHandedOutBlocks * definition.blockSize];
+        pool.nbrOfHandedOutBlocks++;
+    } else {
+        return nullptr;
+    }
+    pool.nbrOfUsedBlocks++;
+    if (pool.nbrOfUsedBlocks > pool.highWaterMark) {
+        pool.highWaterMark = pool.nbrOfUsedBlocks;
+    }
+    return block;
+}
+
+}  // namespace bike_computer
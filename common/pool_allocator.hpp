@@ -0,0 +1,122 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file pool_allocator.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Fixed-block pool allocator with per pool statistics
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include <new>
+#include <utility>
+
+#include "mbed.h"
+#include "pool_definitions.hpp"
+
+namespace bike_computer {
+
+// Allocator of fixed-size blocks from the statically allocated pools defined in
+// pool_definitions.hpp. A request is served by the smallest pool whose blocks are large
+// enough and spills to the larger pools when that pool is exhausted. Since all blocks of
+// a pool have the same size, freeing blocks can never prevent a later allocation of the
+// same size, as opposed to the heap. Allocations and frees run in constant time in a
+// short critical section, they may thus be done from any thread or ISR, even before
+// main() is called.
+class PoolAllocator {
+   public:
+    struct PoolStats {
+        uint16_t blockSize;
+        uint16_t nbrOfBlocks;
+        uint16_t nbrOfUsedBlocks;
+        uint16_t highWaterMark;
+        // allocations served by a larger pool because this pool was exhausted
+        uint32_t nbrOfSpills;
+        // allocations that no pool could serve, counted in the smallest fitting pool
+        uint32_t nbrOfFailures;
+    };
+
+    // method returning a block of at least size bytes, nullptr if no block is available
+    static void* allocate(size_t size);
+
+    // method returning a block to its pool (nullptr is accepted)
+    static void free(void* block);
+
+    // method returning true if the block belongs to one of the pools
+    static bool owns(const void* block);
+
+    static PoolStats getPoolStats(uint8_t poolIndex);
+
+    // method called for printing the statistics of each pool
+    static void printStats();
+
+    // methods used for tests only
+#if defined(MBED_TEST_MODE)
+    // resets the high-water marks to the current usage and clears the counters
+    static void resetStats();
+#endif  // defined(MBED_TEST_MODE)
+
+   private:
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    struct Pool {
+        // blocks freed at least once, the blocks that were never allocated follow the
+        // blocks already handed out, so that no initialization is needed
+        FreeBlock* freeBlocks;
+        uint16_t nbrOfHandedOutBlocks;
+        uint16_t nbrOfUsedBlocks;
+        uint16_t highWaterMark;
+        uint32_t nbrOfSpills;
+        uint32_t nbrOfFailures;
+    };
+
+    // private methods
+    // must be called in a critical section
+    static void* allocateFromPool(uint8_t poolIndex);
+
+    // data members
+    alignas(PoolDefinitions::kAlignment) static uint8_t
+        _memory[PoolDefinitions::getTotalSize()];
+    static Pool _pools[PoolDefinitions::kNbrOfPools];
+};
+
+// constructs an object in a pool block, e.g. poolNew<Payload>(value), returns nullptr
+// if no block is available
+template <typename T, typename... Args>
+T* poolNew(Args&&... args) {
+    static_assert(alignof(T) <= PoolDefinitions::kAlignment,
+                  "the alignment of the object is larger than the one of the blocks");
+    static_assert(sizeof(T) <= PoolDefinitions::getLargestBlockSize(),
+                  "the object does not fit in any pool");
+    void* block = PoolAllocator::allocate(sizeof(T));
+    return (block != nullptr) ? new (block) T(std::forward<Args>(args)...) : nullptr;
+}
+
+// destroys an object constructed with poolNew() and returns its block to its pool
+template <typename T>
+void poolDelete(T* object) {
+    if (object != nullptr) {
+        object->~T();
+        PoolAllocator::free(object);
+    }
+}
+
+}  // namespace bike_computer
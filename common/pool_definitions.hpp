@@ -0,0 +1,84 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file pool_definitions.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Size classes of the fixed-block pool allocator
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include "mbed.h"
+
+namespace bike_computer {
+
+struct PoolDefinition {
+    // size of each block, in bytes
+    uint16_t blockSize;
+    uint16_t nbrOfBlocks;
+};
+
+// pools of the allocator, from the smallest blocks to the largest ones: the blocks are
+// sized for log records and event payloads (small classes) and for trace buffers (large
+// classes)
+struct PoolDefinitions {
+    static constexpr uint8_t kNbrOfPools = 5;
+
+    // alignment of all blocks, a free block holding the pointer to the next free block
+    static constexpr uint8_t kAlignment = 8;
+
+    static constexpr PoolDefinition kDefinitions[kNbrOfPools] = {
+        {16, 32}, {32, 32}, {64, 16}, {128, 8}, {256, 4}};
+
+    // offset of the first block of a pool, the pools being stored contiguously
+    static constexpr uint32_t getOffset(uint8_t poolIndex) {
+        uint32_t offset = 0;
+        for (uint8_t index = 0; index < poolIndex; index++) {
+            offset += kDefinitions[index].blockSize * kDefinitions[index].nbrOfBlocks;
+        }
+        return offset;
+    }
+
+    static constexpr uint32_t getTotalSize() { return getOffset(kNbrOfPools); }
+
+    static constexpr uint16_t getLargestBlockSize() {
+        return kDefinitions[kNbrOfPools - 1].blockSize;
+    }
+
+    // returns true if the pools are sorted by block size and if all blocks are aligned
+    // and large enough for holding a pointer
+    static constexpr bool areValid() {
+        for (uint8_t index = 0; index < kNbrOfPools; index++) {
+            const PoolDefinition& definition = kDefinitions[index];
+            if (definition.nbrOfBlocks == 0 || definition.blockSize < sizeof(void*) ||
+                definition.blockSize % kAlignment != 0) {
+                return false;
+            }
+            if (index > 0 && definition.blockSize <= kDefinitions[index - 1].blockSize) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+static_assert(PoolDefinitions::areValid(),
+              "pools must be sorted by block size with aligned blocks");
+
+}  // namespace bike_computer
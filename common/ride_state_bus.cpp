@@ -0,0 +1,86 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file ride_state_bus.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief RideStateBus implementation (publish/subscribe of the ride state)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include "ride_state_bus.hpp"
+
+#include "mbed_trace.h"
+#if MBED_CONF_MBED_TRACE_ENABLE
+#define TRACE_GROUP "RideStateBus"
+#endif  // MBED_CONF_MBED_TRACE_ENABLE
+
+namespace bike_computer {
+
+RideStateBus::RideStateBus(Timer& timer)
+    : _timer(timer),
+      _gearTopic(GearState()),
+      _speedTopic(SpeedState()),
+      _temperatureTopic(0.0f) {}
+
+void RideStateBus::publishGear(uint8_t gear, uint8_t gearSize) {
+    GearState gearState;
+    gearState.gear     = gear;
+    gearState.gearSize = gearSize;
+    _gearTopic.publish(gearState, _timer.elapsed_time());
+}
+
+void RideStateBus::publishSpeed(float speed, float distance) {
+    SpeedState speedState;
+    speedState.speed    = speed;
+    speedState.distance = distance;
+    _speedTopic.publish(speedState, _timer.elapsed_time());
+}
+
+void RideStateBus::publishTemperature(float temperature) {
+    _temperatureTopic.publish(temperature, _timer.elapsed_time());
+}
+
+RideStateBus::GearTopic::Subscriber RideStateBus::subscribeGear() {
+    GearTopic::Subscriber subscriber = _gearTopic.subscribe();
+    MBED_ASSERT(subscriber.isValid());
+    return subscriber;
+}
+
+RideStateBus::SpeedTopic::Subscriber RideStateBus::subscribeSpeed() {
+    SpeedTopic::Subscriber subscriber = _speedTopic.subscribe();
+    MBED_ASSERT(subscriber.isValid());
+    return subscriber;
+}
+
+RideStateBus::TemperatureTopic::Subscriber RideStateBus::subscribeTemperature() {
+    TemperatureTopic::Subscriber subscriber = _temperatureTopic.subscribe();
+    MBED_ASSERT(subscriber.isValid());
+    return subscriber;
+}
+
+std::chrono::microseconds RideStateBus::getTime() const { return _timer.elapsed_time(); }
+
+void RideStateBus::printStats() const {
+    tr_info("Ride state updates: gear %" PRIu32 ", speed %" PRIu32
+            ", temperature %" PRIu32,
+            _gearTopic.getNbrOfUpdates(),
+            _speedTopic.getNbrOfUpdates(),
+            _temperatureTopic.getNbrOfUpdates());
+}
+
+}  // namespace bike_computer
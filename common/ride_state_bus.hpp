@@ -0,0 +1,94 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file ride_state_bus.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief RideStateBus header file (publish/subscribe of the ride state)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include <chrono>
+
+#include "constants.hpp"
+#include "mbed.h"
+#include "triple_buffer.hpp"
+
+namespace bike_computer {
+
+// values published on the gear topic
+struct GearState {
+    uint8_t gear     = kMinGear;
+    uint8_t gearSize = kMaxGearSize - kMinGear;
+};
+
+// values published on the speed topic
+struct SpeedState {
+    float speed    = 0.0f;
+    float distance = 0.0f;
+};
+
+// Ride state shared between producers (tasks reading the devices) and consumers
+// (display, logging, telemetry). Each topic has a single producer.
+class RideStateBus {
+   public:
+    // the topics are sized for their consumers in the bike system (the gear topic is
+    // read by the speed task, the display and the logger, the other topics by the
+    // display and the logger), plus extra consumers (telemetry and tests)
+    static constexpr uint8_t kNbrOfExtraSubscribers       = 2;
+    static constexpr uint8_t kNbrOfGearSubscribers        = 3 + kNbrOfExtraSubscribers;
+    static constexpr uint8_t kNbrOfSpeedSubscribers       = 2 + kNbrOfExtraSubscribers;
+    static constexpr uint8_t kNbrOfTemperatureSubscribers = 2 + kNbrOfExtraSubscribers;
+
+    using GearTopic        = Topic<GearState, kNbrOfGearSubscribers>;
+    using SpeedTopic       = Topic<SpeedState, kNbrOfSpeedSubscribers>;
+    using TemperatureTopic = Topic<float, kNbrOfTemperatureSubscribers>;
+
+    explicit RideStateBus(Timer& timer);  // NOLINT(runtime/references)
+
+    // make the class non copyable
+    RideStateBus(RideStateBus&)            = delete;
+    RideStateBus& operator=(RideStateBus&) = delete;
+
+    // methods called by the producers (samples are stamped with the current time)
+    void publishGear(uint8_t gear, uint8_t gearSize);
+    void publishSpeed(float speed, float distance);
+    void publishTemperature(float temperature);
+
+    // methods called by the consumers at initialization (subscribing more consumers
+    // than a topic is sized for is an error)
+    GearTopic::Subscriber subscribeGear();
+    SpeedTopic::Subscriber subscribeSpeed();
+    TemperatureTopic::Subscriber subscribeTemperature();
+
+    // method for getting the time used for computing sample ages
+    std::chrono::microseconds getTime() const;
+
+    // method for printing the number of updates per topic
+    void printStats() const;
+
+   private:
+    // data members
+    Timer& _timer;
+    GearTopic _gearTopic;
+    SpeedTopic _speedTopic;
+    TemperatureTopic _temperatureTopic;
+};
+
+}  // namespace bike_computer
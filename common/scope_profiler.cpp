@@ -0,0 +1,227 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file scope_profiler.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief ScopeProfiler implementation (cycle-counter profiling of named zones)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include "scope_profiler.hpp"
+
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+
+namespace bike_computer {
+
+// definitions required when the constants are odr-used (C++14)
+constexpr uint8_t ScopeProfiler::kMaxNbrOfZones;
+constexpr uint8_t ScopeProfiler::kInvalidZone;
+constexpr uint8_t ProfilerZone::kUnregisteredZone;
+
+// the profiler is constructed before main() is called, so that the first scope may
+// be entered from an ISR (no guarded function-local static)
+ScopeProfiler ScopeProfiler::_instance;
+
+ScopeProfiler& ScopeProfiler::getInstance() { return _instance; }
+
+ScopeProfiler::ScopeProfiler() {
+    for (uint8_t index = 0; index < kMaxNbrOfZones; index++) {
+        _zones[index].name = nullptr;
+    }
+    reset();
+#if !defined(BIKE_COMPUTER_HOST)
+    // enable the DWT cycle counter, the access to the DWT registers being locked on
+    // Cortex-M7 until the lock access register is written
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+#if (__CORTEX_M == 7U)
+    DWT->LAR = 0xC5ACCE55;
+#endif  // (__CORTEX_M == 7U)
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif  // !defined(BIKE_COMPUTER_HOST)
+}
+
+#if defined(BIKE_COMPUTER_HOST)
+uint32_t ScopeProfiler::getTicks() {
+    return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                     std::chrono::steady_clock::now().time_since_epoch())
+                                     .count());
+}
+
+uint32_t ScopeProfiler::getTicksPerUs() { return 1000; }
+#else
+uint32_t ScopeProfiler::getTicks() { return DWT->CYCCNT; }
+
+uint32_t ScopeProfiler::getTicksPerUs() { return SystemCoreClock / 1000000; }
+#endif  // defined(BIKE_COMPUTER_HOST)
+
+uint8_t ScopeProfiler::registerZone(const char* name) {
+    uint8_t zoneIndex = kInvalidZone;
+    // registration happens once per zone declaration and may happen in ISR
+    core_util_critical_section_enter();
+    for (uint8_t index = 0; index < _nbrOfZones; index++) {
+        if (strcmp(_zones[index].name, name) == 0) {
+            zoneIndex = index;
+            break;
+        }
+    }
+    if (zoneIndex == kInvalidZone) {
+        if (_nbrOfZones < kMaxNbrOfZones) {
+            zoneIndex              = _nbrOfZones;
+            _zones[zoneIndex].name = name;
+            _nbrOfZones            = zoneIndex + 1;
+        } else {
+            _nbrOfIgnoredZones++;
+        }
+    }
+    core_util_critical_section_exit();
+    return zoneIndex;
+}
+
+void ScopeProfiler::record(uint8_t zoneIndex, uint32_t ticks) {
+    if (zoneIndex >= kMaxNbrOfZones) {
+        return;
+    }
+    Zone& zone = _zones[zoneIndex];
+    core_util_atomic_incr_u32(&zone.nbrOfCalls, 1);
+    core_util_atomic_incr_u64(&zone.totalTicks, ticks);
+    // on failure, the expected value is updated with the current min or max
+    uint32_t minTicks = core_util_atomic_load_u32(&zone.minTicks);
+    while (ticks < minTicks) {
+        if (core_util_atomic_cas_u32(&zone.minTicks, &minTicks, ticks)) {
+            break;
+        }
+    }
+    uint32_t maxTicks = core_util_atomic_load_u32(&zone.maxTicks);
+    while (ticks > maxTicks) {
+        if (core_util_atomic_cas_u32(&zone.maxTicks, &maxTicks, ticks)) {
+            break;
+        }
+    }
+}
+
+uint8_t ScopeProfiler::getNbrOfZones() const {
+    return core_util_atomic_load_u8(&_nbrOfZones);
+}
+
+ScopeProfiler::ZoneStats ScopeProfiler::getZoneStats(uint8_t zoneIndex) const {
+    const Zone& zone = _zones[zoneIndex];
+    ZoneStats zoneStats;
+    zoneStats.name       = zone.name;
+    zoneStats.nbrOfCalls = core_util_atomic_load_u32(&zone.nbrOfCalls);
+    zoneStats.totalTicks = core_util_atomic_load_u64(&zone.totalTicks);
+    zoneStats.minTicks =
+        (zoneStats.nbrOfCalls == 0) ? 0 : core_util_atomic_load_u32(&zone.minTicks);
+    zoneStats.maxTicks = core_util_atomic_load_u32(&zone.maxTicks);
+    return zoneStats;
+}
+
+bool ScopeProfiler::findZoneStats(const char* name, ZoneStats& zoneStats) const {
+    const uint8_t nbrOfZones = getNbrOfZones();
+    for (uint8_t index = 0; index < nbrOfZones; index++) {
+        if (strcmp(_zones[index].name, name) == 0) {
+            zoneStats = getZoneStats(index);
+            return true;
+        }
+    }
+    return false;
+}
+
+uint32_t ScopeProfiler::getNbrOfIgnoredZones() const {
+    return core_util_atomic_load_u32(&_nbrOfIgnoredZones);
+}
+
+void ScopeProfiler::reset() {
+    for (uint8_t index = 0; index < kMaxNbrOfZones; index++) {
+        Zone& zone = _zones[index];
+        core_util_atomic_store_u32(&zone.nbrOfCalls, 0);
+        core_util_atomic_store_u64(&zone.totalTicks, 0);
+        core_util_atomic_store_u32(&zone.minTicks, UINT32_MAX);
+        core_util_atomic_store_u32(&zone.maxTicks, 0);
+    }
+}
+
+void ScopeProfiler::print() const {
+    // zones sorted by decreasing total ticks (insertion sort of the zone indexes)
+    const uint8_t nbrOfZones = getNbrOfZones();
+    uint8_t order[kMaxNbrOfZones];
+    uint64_t totalTicks[kMaxNbrOfZones];
+    for (uint8_t index = 0; index < nbrOfZones; index++) {
+        totalTicks[index] = core_util_atomic_load_u64(&_zones[index].totalTicks);
+        uint8_t position  = index;
+        while (position > 0 && totalTicks[order[position - 1]] < totalTicks[index]) {
+            order[position] = order[position - 1];
+            position--;
+        }
+        order[position] = index;
+    }
+
+    const uint32_t ticksPerUs = getTicksPerUs();
+    printf("Scope profiler (%" PRIu32 " ticks per us, %" PRIu32 " ignored zones):\n",
+           ticksPerUs,
+           getNbrOfIgnoredZones());
+    for (uint8_t index = 0; index < nbrOfZones; index++) {
+        const ZoneStats zoneStats = getZoneStats(order[index]);
+        const uint32_t averageTicks =
+            (zoneStats.nbrOfCalls == 0)
+                ? 0
+                : static_cast<uint32_t>(zoneStats.totalTicks / zoneStats.nbrOfCalls);
+        printf("  %-36s calls %7" PRIu32 ", total %10" PRIu64 " us, avg %9" PRIu32
+               ", min %9" PRIu32 ", max %9" PRIu32 " ticks\n",
+               zoneStats.name,
+               zoneStats.nbrOfCalls,
+               zoneStats.totalTicks / ticksPerUs,
+               averageTicks,
+               zoneStats.minTicks,
+               zoneStats.maxTicks);
+    }
+}
+
+bool ScopeProfiler::executeCommand(const char* command) {
+    static constexpr uint8_t kMaxTokenSize = 16;
+    char verb[kMaxTokenSize]               = {0};
+    char argument[kMaxTokenSize]           = {0};
+    const int nbrOfTokens = sscanf(command, "%15s %15s", verb, argument);
+    if (nbrOfTokens < 1 || strcmp(verb, "profile") != 0) {
+        return false;
+    }
+    if (nbrOfTokens == 1) {
+        print();
+    } else if (strcmp(argument, "reset") == 0) {
+        reset();
+        printf("Profiler reset\n");
+    } else {
+        printf("Usage: profile [reset]\n");
+    }
+    return true;
+}
+
+uint8_t ProfilerZone::getIndex() {
+    uint8_t index = core_util_atomic_load_u8(&_index);
+    if (index == kUnregisteredZone) {
+        // concurrent first uses of a zone register the same name, hence the same index
+        index = ScopeProfiler::getInstance().registerZone(_name);
+        core_util_atomic_store_u8(&_index, index);
+    }
+    return index;
+}
+
+}  // namespace bike_computer
@@ -0,0 +1,158 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file scope_profiler.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief ScopeProfiler header file (cycle-counter profiling of named zones)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include "mbed.h"
+
+namespace bike_computer {
+
+// Profiling of named zones: a zone is declared in a scope with PROFILE_SCOPE("name")
+// and the ticks spent in the scope are accumulated in a fixed table (number of
+// calls, total, min and max ticks). Ticks are cpu cycles read from the DWT cycle
+// counter on target and ns read from a monotonic clock on host. Zones declared at
+// different places with the same name share the same entry (e.g. the instantiations
+// of a template), scopes may be used in ISR and the profiler is compiled out when
+// the scope-profiler-enabled application option is false.
+class ScopeProfiler {
+   public:
+    static constexpr uint8_t kMaxNbrOfZones = 24;
+    // index of the zones that could not be registered (table full)
+    static constexpr uint8_t kInvalidZone = 0xFF;
+
+    struct ZoneStats {
+        const char* name;
+        uint32_t nbrOfCalls;
+        uint64_t totalTicks;
+        uint32_t minTicks;
+        uint32_t maxTicks;
+    };
+
+    static ScopeProfiler& getInstance();
+
+    // make the class non copyable
+    ScopeProfiler(ScopeProfiler&)            = delete;
+    ScopeProfiler& operator=(ScopeProfiler&) = delete;
+
+    // method called for reading the tick counter (32 bits, wraps around)
+    static uint32_t getTicks();
+    static uint32_t getTicksPerUs();
+
+    // register a zone (or find the zone with the same name), returns kInvalidZone
+    // when the table is full
+    uint8_t registerZone(const char* name);
+    // method called when leaving a scope
+    void record(uint8_t zoneIndex, uint32_t ticks);
+
+    // methods for getting the statistics of the zones
+    uint8_t getNbrOfZones() const;
+    ZoneStats getZoneStats(uint8_t zoneIndex) const;
+    bool findZoneStats(const char* name,
+                       ZoneStats& zoneStats) const;  // NOLINT(runtime/references)
+    uint32_t getNbrOfIgnoredZones() const;
+
+    // reset the statistics of all zones (the zones remain registered)
+    void reset();
+
+    // method called for printing the zones sorted by decreasing total time
+    void print() const;
+
+    // execute a console command ("profile" prints the zones, "profile reset" resets
+    // them), returns false if the command is not a profiler command
+    bool executeCommand(const char* command);
+
+   private:
+    ScopeProfiler();
+
+    struct Zone {
+        const char* name;
+        volatile uint32_t nbrOfCalls;
+        volatile uint64_t totalTicks;
+        volatile uint32_t minTicks;
+        volatile uint32_t maxTicks;
+    };
+
+    // data members
+    static ScopeProfiler _instance;
+    Zone _zones[kMaxNbrOfZones];
+    volatile uint8_t _nbrOfZones         = 0;
+    volatile uint32_t _nbrOfIgnoredZones = 0;
+};
+
+// Zone declared by PROFILE_SCOPE: the zone is constant-initialized (no guard on
+// the function-local static) and registered upon its first use
+class ProfilerZone {
+   public:
+    static constexpr uint8_t kUnregisteredZone = 0xFE;
+
+    constexpr explicit ProfilerZone(const char* name) : _name(name) {}
+
+    // make the class non copyable
+    ProfilerZone(ProfilerZone&)            = delete;
+    ProfilerZone& operator=(ProfilerZone&) = delete;
+
+    uint8_t getIndex();
+
+   private:
+    // data members
+    const char* _name;
+    uint8_t _index = kUnregisteredZone;
+};
+
+// RAII scope measuring the ticks spent between its construction and destruction
+class ProfilerScope {
+   public:
+    explicit ProfilerScope(ProfilerZone& zone)  // NOLINT(runtime/references)
+        : _zoneIndex(zone.getIndex()), _startTicks(ScopeProfiler::getTicks()) {}
+
+    ~ProfilerScope() {
+        ScopeProfiler::getInstance().record(_zoneIndex,
+                                            ScopeProfiler::getTicks() - _startTicks);
+    }
+
+    // make the class non copyable
+    ProfilerScope(ProfilerScope&)            = delete;
+    ProfilerScope& operator=(ProfilerScope&) = delete;
+
+   private:
+    // data members
+    const uint8_t _zoneIndex;
+    const uint32_t _startTicks;
+};
+
+}  // namespace bike_computer
+
+#define BIKE_PROFILER_CONCAT_(a, b) a##b
+#define BIKE_PROFILER_CONCAT(a, b) BIKE_PROFILER_CONCAT_(a, b)
+
+#if MBED_CONF_APP_SCOPE_PROFILER_ENABLED
+// profiles the rest of the enclosing scope as the zone named name
+#define PROFILE_SCOPE(name)                                                           \
+    static bike_computer::ProfilerZone BIKE_PROFILER_CONCAT(profilerZone, __LINE__)( \
+        name);                                                                        \
+    bike_computer::ProfilerScope BIKE_PROFILER_CONCAT(profilerScope, __LINE__)(      \
+        BIKE_PROFILER_CONCAT(profilerZone, __LINE__))
+#else
+#define PROFILE_SCOPE(name)
+#endif  // MBED_CONF_APP_SCOPE_PROFILER_ENABLED
@@ -0,0 +1,67 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file sensor.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Sensor implementation (cached value of the sensors)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include "sensor.hpp"
+
+namespace bike_computer {
+
+Sensor::Sensor(const char* name,
+               SensorBus& bus,
+               const std::chrono::milliseconds& samplingPeriod)
+    : _name(name), _bus(bus), _samplingPeriod(samplingPeriod) {}
+
+const char* Sensor::getName() const { return _name; }
+
+SensorBus& Sensor::getBus() const { return _bus; }
+
+std::chrono::milliseconds Sensor::getSamplingPeriod() const { return _samplingPeriod; }
+
+float Sensor::getValue() const {
+    core_util_critical_section_enter();
+    const float value = _value;
+    core_util_critical_section_exit();
+    return value;
+}
+
+std::chrono::microseconds Sensor::getTimestamp() const {
+    core_util_critical_section_enter();
+    const std::chrono::microseconds timestamp = _timestamp;
+    core_util_critical_section_exit();
+    return timestamp;
+}
+
+uint32_t Sensor::getNbrOfSamples() const {
+    return core_util_atomic_load_u32(&_nbrOfSamples);
+}
+
+void Sensor::updateValue(float value, const std::chrono::microseconds& timestamp) {
+    // the value and its timestamp are updated together
+    core_util_critical_section_enter();
+    _value     = value;
+    _timestamp = timestamp;
+    core_util_critical_section_exit();
+    core_util_atomic_incr_u32(&_nbrOfSamples, 1);
+}
+
+}  // namespace bike_computer
@@ -0,0 +1,88 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file sensor.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Common interface of the sensors polled by the sensor scheduler
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include <chrono>
+
+#include "mbed.h"
+
+namespace bike_computer {
+
+// Bus shared by several sensors: the polling scheduler locks it once for running all
+// the transactions of a frame on the bus (batch)
+class SensorBus {
+   public:
+    virtual ~SensorBus() = default;
+
+    virtual void lock()   = 0;
+    virtual void unlock() = 0;
+};
+
+// Sensor sampled asynchronously: startSample() triggers a sample and returns
+// immediately, fetchSample() reads it once the conversion time has elapsed. The last
+// fetched sample is cached with its timestamp. Implementations are called with the
+// bus locked.
+class Sensor {
+   public:
+    // the sampling period is the period requested from the polling scheduler
+    Sensor(const char* name,
+           SensorBus& bus,  // NOLINT(runtime/references)
+           const std::chrono::milliseconds& samplingPeriod);
+    virtual ~Sensor() = default;
+
+    // make the class non copyable
+    Sensor(Sensor&)            = delete;
+    Sensor& operator=(Sensor&) = delete;
+
+    const char* getName() const;
+    SensorBus& getBus() const;
+    std::chrono::milliseconds getSamplingPeriod() const;
+
+    virtual bool init()        = 0;
+    virtual bool startSample() = 0;
+    // returns false if the sample is not available
+    virtual bool fetchSample(float& value) = 0;  // NOLINT(runtime/references)
+    // minimal time between the start and the fetch of a sample
+    virtual std::chrono::microseconds getConversionTime() const = 0;
+
+    // methods for reading the cached value (from any thread)
+    float getValue() const;
+    std::chrono::microseconds getTimestamp() const;
+    uint32_t getNbrOfSamples() const;
+
+    // method called by the polling scheduler with each fetched sample
+    void updateValue(float value, const std::chrono::microseconds& timestamp);
+
+   private:
+    // data members
+    const char* _name;
+    SensorBus& _bus;
+    const std::chrono::milliseconds _samplingPeriod;
+    float _value                         = 0.0f;
+    std::chrono::microseconds _timestamp = std::chrono::microseconds::zero();
+    volatile uint32_t _nbrOfSamples      = 0;
+};
+
+}  // namespace bike_computer
@@ -18,12 +18,16 @@
  *
  * @brief SensorDevice implementation (static scheduling)
  *
- * @date 2023-08-20
+ * @date 2026-10-19
  * @version 1.0.0
  ***************************************************************************/
 
 #include "sensor_device.hpp"
 
+#include <cinttypes>
+
+#include "metrics_registry.hpp"
+
 #include "mbed_trace.h"
 #if MBED_CONF_MBED_TRACE_ENABLE
 #define TRACE_GROUP "SensorDevice"
@@ -31,19 +35,252 @@
 
 namespace bike_computer {
 
-SensorDevice::SensorDevice() : _hdc1000(PD_13, PD_12, PC_6) {}
+// definition required when the constant is odr-used (C++14)
+constexpr std::chrono::milliseconds SensorDevice::kConversionTime;
+constexpr std::chrono::milliseconds SensorDevice::kDefaultTimeToLive;
+
+// pins of the HDC1000 on the DISCO_H747I
+static constexpr PinName kSdaPin       = PD_13;
+static constexpr PinName kSclPin       = PD_12;
+static constexpr PinName kDataReadyPin = PC_6;
+// fast mode I2C, 8-bit address of the HDC1000 and registers used for acquisitions
+static constexpr int kI2CFrequency              = 400000;
+static constexpr int kI2CAddress                = 0x40 << 1;
+static constexpr uint8_t kTemperatureRegister   = 0x00;
+static constexpr uint8_t kConfigurationRegister = 0x02;
+// acquisition mode (temperature and humidity measured in sequence) with 14 bit
+// resolutions
+static constexpr uint16_t kAcquisitionConfiguration = 0x1000;
+// a conversion not read after this time is considered as lost and triggered again
+static constexpr std::chrono::milliseconds kMaxConversionTime = 100ms;
+// polling of the result by blocking acquisitions when the conversion lasts longer
+static constexpr std::chrono::milliseconds kPollingPeriod = 1ms;
+static constexpr int kMaxNbrOfPollings                    = 100;
+
+SensorDevice::SensorDevice()
+    : _hdc1000(kSdaPin, kSclPin, kDataReadyPin), _i2c(kSdaPin, kSclPin) {
+    _i2c.frequency(kI2CFrequency);
+    _timer.start();
+}
 
 bool SensorDevice::init() {
     // probe for testing the presence of the sensor
     bool rc = _hdc1000.probe();
     if (!rc) {
         tr_error("HDC1000 not present");
+        return rc;
+    }
+
+    // first acquisition, so that the cached values are valid
+    getMeasurement();
+    rc = getNbrOfResults() > 0;
+    if (!rc) {
+        tr_error("HDC1000 acquisition failed");
     }
     return rc;
 }
 
-float SensorDevice::readTemperature() { return _hdc1000.getTemperature(); }
+float SensorDevice::readTemperature() { return getMeasurement().temperature; }
+
+float SensorDevice::readHumidity() { return getMeasurement().humidity; }
+
+SensorDevice::Measurement SensorDevice::getMeasurement() {
+    _mutex.lock();
+    if (isFreshLocked()) {
+        core_util_atomic_incr_u32(&_nbrOfCacheHits, 1);
+        const Measurement measurement = _measurement;
+        _mutex.unlock();
+        return measurement;
+    }
+
+    // a pending conversion (started by another consumer or split-phase) is shared
+    if (!startConversionLocked()) {
+        const Measurement measurement = _measurement;
+        _mutex.unlock();
+        return measurement;
+    }
+    const std::chrono::microseconds waitTime =
+        _conversionStartTime + kConversionTime - _timer.elapsed_time();
+    _mutex.unlock();
+    if (waitTime > std::chrono::microseconds::zero()) {
+        ThisThread::sleep_for(
+            std::chrono::duration_cast<std::chrono::milliseconds>(waitTime) + 1ms);
+    }
+
+    for (int polling = 0; polling < kMaxNbrOfPollings; polling++) {
+        _mutex.lock();
+        // the result may have been fetched by another consumer
+        if (fetchResultLocked() || isFreshLocked()) {
+            const Measurement measurement = _measurement;
+            _mutex.unlock();
+            return measurement;
+        }
+        _mutex.unlock();
+        ThisThread::sleep_for(kPollingPeriod);
+    }
+
+    tr_error("HDC1000 acquisition timed out");
+    _mutex.lock();
+    const Measurement measurement = _measurement;
+    _mutex.unlock();
+    return measurement;
+}
+
+bool SensorDevice::startConversion() {
+    _mutex.lock();
+    const bool rc = startConversionLocked();
+    _mutex.unlock();
+    return rc;
+}
+
+bool SensorDevice::isConversionCompleted() const {
+    return core_util_atomic_load_bool(&_isConversionCompleted);
+}
+
+bool SensorDevice::fetchResult() {
+    _mutex.lock();
+    const bool rc = fetchResultLocked();
+    _mutex.unlock();
+    return rc;
+}
+
+float SensorDevice::getTemperature() {
+    _mutex.lock();
+    const float temperature = _measurement.temperature;
+    _mutex.unlock();
+    return temperature;
+}
+
+float SensorDevice::getHumidity() {
+    _mutex.lock();
+    const float humidity = _measurement.humidity;
+    _mutex.unlock();
+    return humidity;
+}
+
+std::chrono::microseconds SensorDevice::getAge() {
+    _mutex.lock();
+    const std::chrono::microseconds age = _timer.elapsed_time() - _measurement.timestamp;
+    _mutex.unlock();
+    return age;
+}
+
+void SensorDevice::setTimeToLive(const std::chrono::milliseconds& timeToLive) {
+    _mutex.lock();
+    _timeToLive = timeToLive;
+    _mutex.unlock();
+}
+
+std::chrono::milliseconds SensorDevice::getTimeToLive() {
+    _mutex.lock();
+    const std::chrono::milliseconds timeToLive = _timeToLive;
+    _mutex.unlock();
+    return timeToLive;
+}
+
+uint32_t SensorDevice::getNbrOfResults() const {
+    return core_util_atomic_load_u32(&_nbrOfResults);
+}
+
+uint32_t SensorDevice::getNbrOfCacheHits() const {
+    return core_util_atomic_load_u32(&_nbrOfCacheHits);
+}
+
+uint32_t SensorDevice::getNbrOfBusTransactions() const {
+    return core_util_atomic_load_u32(&_nbrOfBusTransactions);
+}
 
-float SensorDevice::readHumidity() { return _hdc1000.getHumidity(); }
+uint32_t SensorDevice::getNbrOfBusTransactionsPerMinute() const {
+    // average since the creation of the device
+    const int64_t elapsedTime = _timer.elapsed_time().count();
+    if (elapsedTime <= 0) {
+        return 0;
+    }
+    static constexpr int64_t kMinuteUs = 60000000;
+    return static_cast<uint32_t>((getNbrOfBusTransactions() * kMinuteUs) / elapsedTime);
+}
+
+void SensorDevice::printStats() const {
+    tr_info("Sensor bus transactions: %" PRIu32 " (%" PRIu32
+            " per minute), acquisitions %" PRIu32 ", cache hits %" PRIu32,
+            getNbrOfBusTransactions(),
+            getNbrOfBusTransactionsPerMinute(),
+            getNbrOfResults(),
+            getNbrOfCacheHits());
+}
+
+bool SensorDevice::startConversionLocked() {
+    const std::chrono::microseconds now = _timer.elapsed_time();
+    if (_isConversionStarted && now - _conversionStartTime < kMaxConversionTime) {
+        return true;
+    }
+
+    if (!_isConfigured) {
+        const char configuration[3] = {static_cast<char>(kConfigurationRegister),
+                                       static_cast<char>(kAcquisitionConfiguration >> 8),
+                                       static_cast<char>(kAcquisitionConfiguration)};
+        if (write(configuration, sizeof(configuration)) != 0) {
+            return false;
+        }
+        _isConfigured = true;
+    }
+
+    // writing the pointer of the temperature register triggers the acquisition
+    const char command = static_cast<char>(kTemperatureRegister);
+    if (write(&command, sizeof(command)) != 0) {
+        return false;
+    }
+    _isConversionStarted = true;
+    _conversionStartTime = now;
+    core_util_atomic_store_bool(&_isConversionCompleted, false);
+    _conversionTimeout.attach(callback(this, &SensorDevice::onConversionCompleted),
+                              kConversionTime);
+    return true;
+}
+
+bool SensorDevice::fetchResultLocked() {
+    if (!_isConversionStarted) {
+        return false;
+    }
+    // the read is not acknowledged by the sensor before the end of the conversion
+    char data[4] = {0};
+    if (read(data, sizeof(data)) != 0) {
+        return false;
+    }
+    _isConversionStarted = false;
+
+    const uint16_t rawTemperature =
+        (static_cast<uint8_t>(data[0]) << 8) | static_cast<uint8_t>(data[1]);
+    const uint16_t rawHumidity =
+        (static_cast<uint8_t>(data[2]) << 8) | static_cast<uint8_t>(data[3]);
+    _measurement.temperature = rawTemperature * 165.0f / 65536.0f - 40.0f;
+    _measurement.humidity    = rawHumidity * 100.0f / 65536.0f;
+    _measurement.timestamp   = _conversionStartTime + kConversionTime;
+    _isMeasurementValid      = true;
+    core_util_atomic_incr_u32(&_nbrOfResults, 1);
+    return true;
+}
+
+bool SensorDevice::isFreshLocked() const {
+    return _isMeasurementValid &&
+           _timer.elapsed_time() - _measurement.timestamp <= _timeToLive;
+}
+
+int SensorDevice::write(const char* data, int length) {
+    core_util_atomic_incr_u32(&_nbrOfBusTransactions, 1);
+    incrementMetric<MetricId::SensorBusTransactions>();
+    return _i2c.write(kI2CAddress, data, length);
+}
+
+int SensorDevice::read(char* data, int length) {
+    core_util_atomic_incr_u32(&_nbrOfBusTransactions, 1);
+    incrementMetric<MetricId::SensorBusTransactions>();
+    return _i2c.read(kI2CAddress, data, length);
+}
+
+void SensorDevice::onConversionCompleted() {
+    // ISR context: the I2C transfer is left to fetchResult()
+    core_util_atomic_store_bool(&_isConversionCompleted, true);
+}
 
 }  // namespace bike_computer
@@ -18,32 +18,113 @@
  *
  * @brief SensorDevice header file (static scheduling)
  *
- * @date 2023-08-20
+ * @date 2026-10-19
  * @version 1.0.0
  ***************************************************************************/
 
 #pragma once
 
+#include <chrono>
+
 #include "hdc1000.hpp"
 #include "mbed.h"
 
 namespace bike_computer {
 
+// The sensor device acquires the temperature and the humidity in a single sequential
+// conversion of the HDC1000 and keeps the result in a timestamped cache shared by all
+// consumers:
+// - readTemperature(), readHumidity() and getMeasurement() return the cached values
+//   while they are younger than the time to live, otherwise they run a blocking
+//   acquisition (consumers waiting at the same time share it)
+// - startConversion() triggers a split-phase acquisition and returns immediately, a
+//   timeout signals the end of the conversion time and fetchResult() then reads the
+//   result with a single short I2C transfer into the cache
+// The number of I2C bus transactions is counted for monitoring the bus traffic.
 class SensorDevice {
    public:
+    struct Measurement {
+        float temperature = 0.0f;
+        float humidity    = 0.0f;
+        // end of the conversion, measured by the timer of the device
+        std::chrono::microseconds timestamp = std::chrono::microseconds::zero();
+    };
+
     // constructor
     SensorDevice();
 
-    // method for initializing the device
+    // make the class non copyable
+    SensorDevice(SensorDevice&)            = delete;
+    SensorDevice& operator=(SensorDevice&) = delete;
+
+    // method for initializing the device (a first acquisition fills the cache)
     bool init();
 
-    // methods used for
+    // methods used for reading the cached values, acquired if stale (blocking)
     float readTemperature();
     float readHumidity();
+    Measurement getMeasurement();
+
+    // methods used for split-phase acquisitions (a pending conversion is not
+    // triggered again)
+    bool startConversion();
+    bool isConversionCompleted() const;
+    // returns false if no conversion was started or if it is not completed yet
+    bool fetchResult();
+
+    // methods used for reading the cached values without any bus transaction
+    float getTemperature();
+    float getHumidity();
+    std::chrono::microseconds getAge();
+
+    // cached values older than the time to live are stale
+    void setTimeToLive(const std::chrono::milliseconds& timeToLive);
+    std::chrono::milliseconds getTimeToLive();
+
+    // methods used for getting and printing the statistics of the device
+    uint32_t getNbrOfResults() const;
+    uint32_t getNbrOfCacheHits() const;
+    uint32_t getNbrOfBusTransactions() const;
+    uint32_t getNbrOfBusTransactionsPerMinute() const;
+    void printStats() const;
+
+    // conversion time of an acquisition of both values with 14 bit resolution
+    // (6.35 ms + 6.5 ms according to the datasheet, with margin)
+    static constexpr std::chrono::milliseconds kConversionTime = 15ms;
+    // the temperature task refreshes the cache every 1600 ms
+    static constexpr std::chrono::milliseconds kDefaultTimeToLive = 2000ms;
 
    private:
+    // private methods (called with the mutex held)
+    bool startConversionLocked();
+    bool fetchResultLocked();
+    bool isFreshLocked() const;
+    int write(const char* data, int length);
+    int read(char* data, int length);
+    // called by the timeout (ISR context)
+    void onConversionCompleted();
+
     // data members
     advembsof::HDC1000 _hdc1000;
+    I2C _i2c;
+    Timeout _conversionTimeout;
+    // time base of the cache
+    Timer _timer;
+    // protects the cache and the acquisition state
+    Mutex _mutex;
+    std::chrono::milliseconds _timeToLive = kDefaultTimeToLive;
+    bool _isConfigured                    = false;
+    // pending conversion
+    bool _isConversionStarted                      = false;
+    std::chrono::microseconds _conversionStartTime = std::chrono::microseconds::zero();
+    // set by the timeout
+    volatile bool _isConversionCompleted = false;
+    bool _isMeasurementValid             = false;
+    Measurement _measurement;
+    // statistics
+    volatile uint32_t _nbrOfResults         = 0;
+    volatile uint32_t _nbrOfCacheHits       = 0;
+    volatile uint32_t _nbrOfBusTransactions = 0;
 };
 
 }  // namespace bike_computer
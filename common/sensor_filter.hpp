@@ -0,0 +1,172 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file sensor_filter.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Fixed-point oversampling and filtering pipeline for sensor channels
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+
+namespace bike_computer {
+
+// Samples of all sensor channels are 24 bit fixed-point integers (a channel defines
+// its own scale, e.g. hundredths of degrees for the temperature). All filter state is
+// held in fixed size members, so that filtering never allocates.
+
+// First order IIR (exponential moving average) filter with a coefficient of
+// 1 / 2^kShift: y[n] = y[n-1] + (x[n] - y[n-1]) / 2^kShift. The state keeps
+// kFractionalBits additional bits so that small steps are not lost by truncation,
+// which limits the samples to 24 bit values.
+template <uint8_t kShift>
+class IirFilter {
+   public:
+    void reset(int32_t sample) { _state = sample * kOne; }
+
+    int32_t filter(int32_t sample) {
+        _state += (sample * kOne - _state) >> kShift;
+        return (_state + kOne / 2) >> kFractionalBits;
+    }
+
+   private:
+    static constexpr uint8_t kFractionalBits = 8;
+    static constexpr int32_t kOne            = 1 << kFractionalBits;
+    static_assert(kShift > 0 && kShift < kFractionalBits, "invalid IIR filter shift");
+
+    int32_t _state = 0;
+};
+
+// Median filter over the last kWindowSize samples (odd size), removing isolated
+// outliers without smoothing steps
+template <uint8_t kWindowSize>
+class MedianFilter {
+   public:
+    static_assert(kWindowSize % 2 == 1, "the median window size must be odd");
+
+    void reset(int32_t sample) {
+        for (uint8_t index = 0; index < kWindowSize; index++) {
+            _window[index] = sample;
+        }
+        _nextIndex = 0;
+    }
+
+    int32_t filter(int32_t sample) {
+        _window[_nextIndex] = sample;
+        _nextIndex          = (_nextIndex + 1) % kWindowSize;
+
+        // insertion sort of a copy of the window (small windows only)
+        int32_t sorted[kWindowSize];
+        for (uint8_t index = 0; index < kWindowSize; index++) {
+            const int32_t value = _window[index];
+            int16_t position    = static_cast<int16_t>(index) - 1;
+            while (position >= 0 && sorted[position] > value) {
+                sorted[position + 1] = sorted[position];
+                position--;
+            }
+            sorted[position + 1] = value;
+        }
+        return sorted[kWindowSize / 2];
+    }
+
+   private:
+    int32_t _window[kWindowSize] = {0};
+    uint8_t _nextIndex           = 0;
+};
+
+// Pipeline stage of a sensor channel: the samples acquired at the oversampling rate
+// are decimated by averaging oversamplingRatio samples, each decimated sample being
+// filtered. The oversampling ratio can be changed at runtime up to
+// kMaxOversamplingRatio.
+template <typename Filter, uint8_t kMaxOversamplingRatio>
+class SensorPipeline {
+   public:
+    // the sum of the decimated 24 bit samples must fit in 32 bits
+    static_assert(kMaxOversamplingRatio > 0 && kMaxOversamplingRatio <= 128,
+                  "invalid maximal oversampling ratio");
+
+    explicit SensorPipeline(uint8_t oversamplingRatio = 1) {
+        setOversamplingRatio(oversamplingRatio);
+    }
+
+    // the first output is the given sample, without filter transient
+    void reset(int32_t sample) {
+        _filter.reset(sample);
+        _output        = sample;
+        _sum           = 0;
+        _nbrOfSamples  = 0;
+        _isInitialized = true;
+    }
+
+    // returns false if the ratio is out of range (the ratio is left unchanged)
+    bool setOversamplingRatio(uint8_t oversamplingRatio) {
+        if (oversamplingRatio == 0 || oversamplingRatio > kMaxOversamplingRatio) {
+            return false;
+        }
+        _oversamplingRatio = oversamplingRatio;
+        // the partial decimation is restarted
+        _sum          = 0;
+        _nbrOfSamples = 0;
+        return true;
+    }
+    uint8_t getOversamplingRatio() const { return _oversamplingRatio; }
+
+    // method called for each acquired sample, returns true when a new output is
+    // available (once every oversamplingRatio samples)
+    bool push(int32_t sample) {
+        _sum += sample;
+        _nbrOfSamples++;
+        _nbrOfInputs++;
+        if (_nbrOfSamples < _oversamplingRatio) {
+            return false;
+        }
+        // rounded average of the decimated samples
+        const int32_t ratio           = _oversamplingRatio;
+        const int32_t half            = (_sum >= 0) ? ratio / 2 : -(ratio / 2);
+        const int32_t decimatedSample = (_sum + half) / ratio;
+        _sum          = 0;
+        _nbrOfSamples = 0;
+
+        if (!_isInitialized) {
+            reset(decimatedSample);
+        } else {
+            _output = _filter.filter(decimatedSample);
+        }
+        _nbrOfOutputs++;
+        return true;
+    }
+
+    int32_t getOutput() const { return _output; }
+    uint32_t getNbrOfInputs() const { return _nbrOfInputs; }
+    uint32_t getNbrOfOutputs() const { return _nbrOfOutputs; }
+
+   private:
+    // data members
+    Filter _filter;
+    uint8_t _oversamplingRatio = 1;
+    int32_t _sum               = 0;
+    uint8_t _nbrOfSamples      = 0;
+    bool _isInitialized        = false;
+    int32_t _output            = 0;
+    uint32_t _nbrOfInputs      = 0;
+    uint32_t _nbrOfOutputs     = 0;
+};
+
+}  // namespace bike_computer
@@ -0,0 +1,78 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file sensor_registry.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief SensorRegistry implementation
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include "sensor_registry.hpp"
+
+#include <cstring>
+
+#include "mbed_trace.h"
+#if MBED_CONF_MBED_TRACE_ENABLE
+#define TRACE_GROUP "SensorRegistry"
+#endif  // MBED_CONF_MBED_TRACE_ENABLE
+
+namespace bike_computer {
+
+bool SensorRegistry::add(Sensor& sensor) {
+    if (_nbrOfSensors == kMaxNbrOfSensors) {
+        tr_error("Sensor registry full, %s not registered", sensor.getName());
+        return false;
+    }
+    if (find(sensor.getName()) != nullptr) {
+        tr_error("Sensor %s already registered", sensor.getName());
+        return false;
+    }
+    _sensors[_nbrOfSensors] = &sensor;
+    _nbrOfSensors++;
+    return true;
+}
+
+uint8_t SensorRegistry::getNbrOfSensors() const { return _nbrOfSensors; }
+
+Sensor& SensorRegistry::getSensor(uint8_t index) const {
+    MBED_ASSERT(index < _nbrOfSensors);
+    return *_sensors[index];
+}
+
+Sensor* SensorRegistry::find(const char* name) const {
+    for (uint8_t index = 0; index < _nbrOfSensors; index++) {
+        if (strcmp(_sensors[index]->getName(), name) == 0) {
+            return _sensors[index];
+        }
+    }
+    return nullptr;
+}
+
+uint8_t SensorRegistry::initAll() {
+    uint8_t nbrOfInitializedSensors = 0;
+    for (uint8_t index = 0; index < _nbrOfSensors; index++) {
+        if (_sensors[index]->init()) {
+            nbrOfInitializedSensors++;
+        } else {
+            tr_error("Sensor %s initialization failed", _sensors[index]->getName());
+        }
+    }
+    return nbrOfInitializedSensors;
+}
+
+}  // namespace bike_computer
@@ -0,0 +1,60 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file sensor_registry.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Registry of the sensors of the bike computer
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include "mbed.h"
+#include "sensor.hpp"
+
+namespace bike_computer {
+
+// Fixed capacity registry of the sensors, filled at initialization
+class SensorRegistry {
+   public:
+    static constexpr uint8_t kMaxNbrOfSensors = 64;
+
+    SensorRegistry() = default;
+
+    // make the class non copyable
+    SensorRegistry(SensorRegistry&)            = delete;
+    SensorRegistry& operator=(SensorRegistry&) = delete;
+
+    // returns false if the registry is full or if the name is already registered
+    bool add(Sensor& sensor);  // NOLINT(runtime/references)
+
+    uint8_t getNbrOfSensors() const;
+    Sensor& getSensor(uint8_t index) const;
+    // returns nullptr if no sensor has this name
+    Sensor* find(const char* name) const;
+
+    // initialize all sensors, returns the number of sensors initialized successfully
+    uint8_t initAll();
+
+   private:
+    // data members
+    Sensor* _sensors[kMaxNbrOfSensors] = {nullptr};
+    uint8_t _nbrOfSensors              = 0;
+};
+
+}  // namespace bike_computer
@@ -0,0 +1,133 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file simulated_sensor.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Simulated sensor backends implementation
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include "simulated_sensor.hpp"
+
+#include <cmath>
+
+namespace bike_computer {
+
+// conversion time, mean value, amplitude and period (in s) of the simulated waveform
+// of each kind of sensor
+struct SimulatedKind {
+    std::chrono::microseconds conversionTime;
+    float mean;
+    float amplitude;
+    float period;
+};
+static constexpr uint8_t kNbrOfKinds                       = 4;
+static constexpr SimulatedKind kSimulatedKinds[kNbrOfKinds] = {
+    // cadence (rpm)
+    {500us, 80.0f, 5.0f, 10.0f},
+    // heart rate (bpm)
+    {2000us, 140.0f, 10.0f, 60.0f},
+    // barometric pressure (hPa)
+    {8000us, 950.0f, 2.0f, 600.0f},
+    // battery level (%)
+    {200us, 80.0f, 20.0f, 3600.0f}};
+
+SimulatedSensorBus::SimulatedSensorBus(const std::chrono::microseconds& transactionTime)
+    : _transactionTime(transactionTime) {
+    _timer.start();
+}
+
+void SimulatedSensorBus::lock() {
+    _mutex.lock();
+    _nbrOfBatches++;
+    _nbrOfBatchTransactions = 0;
+}
+
+void SimulatedSensorBus::unlock() {
+    if (_nbrOfBatchTransactions > _maxNbrOfTransactionsPerBatch) {
+        _maxNbrOfTransactionsPerBatch = _nbrOfBatchTransactions;
+    }
+    _mutex.unlock();
+}
+
+void SimulatedSensorBus::transfer() {
+    // the transaction keeps the cpu busy as a polled transfer would do
+    wait_us(static_cast<int>(_transactionTime.count()));
+    _nbrOfTransactions++;
+    _nbrOfBatchTransactions++;
+}
+
+std::chrono::microseconds SimulatedSensorBus::getTime() const {
+    return _timer.elapsed_time();
+}
+
+uint32_t SimulatedSensorBus::getNbrOfBatches() const { return _nbrOfBatches; }
+
+uint32_t SimulatedSensorBus::getNbrOfTransactions() const { return _nbrOfTransactions; }
+
+uint32_t SimulatedSensorBus::getMaxNbrOfTransactionsPerBatch() const {
+    return _maxNbrOfTransactionsPerBatch;
+}
+
+SimulatedSensor::SimulatedSensor(const char* name,
+                                 Kind kind,
+                                 SimulatedSensorBus& bus,
+                                 const std::chrono::milliseconds& samplingPeriod)
+    : Sensor(name, bus, samplingPeriod), _kind(kind), _simulatedBus(bus) {}
+
+SimulatedSensor::Kind SimulatedSensor::getKind() const { return _kind; }
+
+uint32_t SimulatedSensor::getNbrOfEarlyFetches() const { return _nbrOfEarlyFetches; }
+
+bool SimulatedSensor::init() { return true; }
+
+bool SimulatedSensor::startSample() {
+    _simulatedBus.transfer();
+    _isStarted = true;
+    _startTime = _simulatedBus.getTime();
+    return true;
+}
+
+bool SimulatedSensor::fetchSample(float& value) {
+    _simulatedBus.transfer();
+    const std::chrono::microseconds now = _simulatedBus.getTime();
+    if (!_isStarted) {
+        return false;
+    }
+    if (now - _startTime < getConversionTime()) {
+        _nbrOfEarlyFetches++;
+        return false;
+    }
+    _isStarted = false;
+    value      = getSimulatedValue(now);
+    return true;
+}
+
+std::chrono::microseconds SimulatedSensor::getConversionTime() const {
+    return kSimulatedKinds[static_cast<uint8_t>(_kind)].conversionTime;
+}
+
+float SimulatedSensor::getSimulatedValue(const std::chrono::microseconds& time) const {
+    static constexpr float kTwoPi       = 6.2831853f;
+    const SimulatedKind& simulatedKind = kSimulatedKinds[static_cast<uint8_t>(_kind)];
+    const float seconds                = time.count() / 1000000.0f;
+    return simulatedKind.mean +
+           simulatedKind.amplitude * sinf(kTwoPi * seconds / simulatedKind.period);
+}
+
+}  // namespace bike_computer
@@ -0,0 +1,103 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file simulated_sensor.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Simulated sensor backends (cadence, heart rate, barometer, battery)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include <chrono>
+
+#include "mbed.h"
+#include "sensor.hpp"
+
+namespace bike_computer {
+
+// Bus of simulated sensors: each transaction keeps the bus busy during the
+// transaction time. The bus counts its batches (lock/unlock pairs) and transactions.
+class SimulatedSensorBus : public SensorBus {
+   public:
+    explicit SimulatedSensorBus(const std::chrono::microseconds& transactionTime);
+
+    // make the class non copyable
+    SimulatedSensorBus(SimulatedSensorBus&)            = delete;
+    SimulatedSensorBus& operator=(SimulatedSensorBus&) = delete;
+
+    void lock() override;
+    void unlock() override;
+
+    // method called by the simulated sensors, with the bus locked
+    void transfer();
+
+    // time base of the simulated sensors
+    std::chrono::microseconds getTime() const;
+
+    // methods for getting the statistics of the bus
+    uint32_t getNbrOfBatches() const;
+    uint32_t getNbrOfTransactions() const;
+    uint32_t getMaxNbrOfTransactionsPerBatch() const;
+
+   private:
+    // data members
+    const std::chrono::microseconds _transactionTime;
+    Mutex _mutex;
+    Timer _timer;
+    uint32_t _nbrOfBatches                 = 0;
+    uint32_t _nbrOfTransactions            = 0;
+    uint32_t _nbrOfBatchTransactions       = 0;
+    uint32_t _maxNbrOfTransactionsPerBatch = 0;
+};
+
+// Simulated sensor: a sample is ready once the conversion time of its kind has
+// elapsed (fetching it earlier fails) and its value follows a waveform of its kind.
+// Starting and fetching a sample each take one bus transaction.
+class SimulatedSensor : public Sensor {
+   public:
+    enum class Kind : uint8_t { Cadence, HeartRate, Barometer, Battery };
+
+    SimulatedSensor(const char* name,
+                    Kind kind,
+                    SimulatedSensorBus& bus,  // NOLINT(runtime/references)
+                    const std::chrono::milliseconds& samplingPeriod);
+
+    Kind getKind() const;
+    // number of fetches before the end of the conversion
+    uint32_t getNbrOfEarlyFetches() const;
+
+    // Sensor
+    bool init() override;
+    bool startSample() override;
+    bool fetchSample(float& value) override;  // NOLINT(runtime/references)
+    std::chrono::microseconds getConversionTime() const override;
+
+   private:
+    // private methods
+    float getSimulatedValue(const std::chrono::microseconds& time) const;
+
+    // data members
+    const Kind _kind;
+    SimulatedSensorBus& _simulatedBus;
+    bool _isStarted                      = false;
+    std::chrono::microseconds _startTime = std::chrono::microseconds::zero();
+    uint32_t _nbrOfEarlyFetches          = 0;
+};
+
+}  // namespace bike_computer
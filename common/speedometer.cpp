@@ -27,6 +27,8 @@
 #include <chrono>
 #include <ratio>
 
+#include "deferred_log.hpp"
+#include "scope_profiler.hpp"
 // from disco_h747i/wrappers
 #include "joystick.hpp"
 #include "mbed_trace.h"
@@ -104,6 +106,7 @@ void Speedometer::setOnResetCallback(mbed::Callback<void()> cb) { _cb = cb; }
 #endif  // defined(MBED_TEST_MODE)
 
 void Speedometer::computeSpeed() {
+    PROFILE_SCOPE("Speedometer::computeSpeed");
     // For computing the speed given a rear gear (braquet), one must divide the size of
     // the tray (plateau) by the size of the rear gear (pignon arrière), and then multiply
     // the result by the circumference of the wheel. Example: tray = 50, rear gear = 15.
@@ -122,10 +125,12 @@ void Speedometer::computeSpeed() {
     _currentSpeed =
         (distancePerPedalRotation * 3600.0f) /
         std::chrono::duration_cast<std::chrono::milliseconds>(_pedalRotationTime).count();
-    tr_debug("New speed is %f", _currentSpeed);
+    // the speed is formatted on the host (deferred log)
+    deferredLog<LogFormatId::SpeedometerSpeed>(_currentSpeed);
 }
 
 void Speedometer::computeDistance() {
+    PROFILE_SCOPE("Speedometer::computeDistance");
     // For computing the speed given a rear gear (braquet), one must divide the size of
     // the tray (plateau) by the size of the rear gear (pignon arrière), and then multiply
     // the result by the circumference of the wheel. Example: tray = 50, rear gear = 15.
@@ -149,11 +154,12 @@ void Speedometer::computeDistance() {
     _totalDistanceMutex.lock();
     _totalDistance += distance;
     _totalDistanceMutex.unlock();
-    tr_debug("Total distance %f, distance %f, speed %f, elapsed time %" PRIu64 "",
-             _totalDistance,
-             distance,
-             _currentSpeed,
-             elapsedTime.count());
+    // the values are formatted on the host (deferred log)
+    deferredLog<LogFormatId::SpeedometerDistance>(
+        _totalDistance,
+        distance,
+        _currentSpeed,
+        static_cast<uint32_t>(elapsedTime.count()));
 
     // update _lastTime
     _lastTime = _timer.elapsed_time();
@@ -0,0 +1,234 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file stack_monitor.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief StackMonitor implementation (per-thread stack high-water marks)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include "stack_monitor.hpp"
+
+#include <cstring>
+
+#if !defined(BIKE_COMPUTER_HOST)
+#include "cmsis_os2.h"
+#include "rtx_os.h"
+#endif  // !defined(BIKE_COMPUTER_HOST)
+
+#include "mbed_trace.h"
+#if MBED_CONF_MBED_TRACE_ENABLE
+#define TRACE_GROUP "StackMonitor"
+#endif  // MBED_CONF_MBED_TRACE_ENABLE
+
+typedef mbed::Callback<void(
+    const void*, const char*, const uint32_t*, uint32_t, uint32_t)>
+    ThreadStackFunction;
+
+#if defined(BIKE_COMPUTER_HOST)
+
+// the host port fills the native stacks of the threads started by rtos::Thread
+static constexpr uint32_t kStackFillPattern = host::kStackFillPattern;
+
+static void readThreadStacks(ThreadStackFunction function) {
+    host::forEachThreadStack(function);
+}
+
+// the stacks are scanned while their threads run, which the sanitizers would report
+#define STACK_SCAN_ATTRIBUTES __attribute__((no_sanitize("address", "thread")))
+
+#else
+
+// RTX fills the stacks upon thread creation when stack watermarking is enabled
+static constexpr uint32_t kStackFillPattern = osRtxStackFillPattern;
+// threads enumerated upon each sample (more than the table size, for accounting the
+// ignored threads)
+static constexpr uint8_t kMaxNbrOfThreadIds = 24;
+
+static void readThreadStacks(ThreadStackFunction function) {
+    osThreadId_t ids[kMaxNbrOfThreadIds];
+    const uint32_t nbrOfThreads = osThreadEnumerate(ids, kMaxNbrOfThreadIds);
+    for (uint32_t index = 0; index < nbrOfThreads; index++) {
+        // the thread cannot be deleted (releasing its stack) while its stack is scanned
+        const int32_t lock          = osKernelLock();
+        const osThreadState_t state = osThreadGetState(ids[index]);
+        if (state != osThreadError && state != osThreadTerminated) {
+            const osRtxThread_t* thread = static_cast<const osRtxThread_t*>(ids[index]);
+            function(ids[index],
+                     thread->name,
+                     static_cast<const uint32_t*>(thread->stack_mem),
+                     thread->stack_size,
+                     thread->stack_size);
+        }
+        osKernelRestoreLock(lock);
+    }
+}
+
+#define STACK_SCAN_ATTRIBUTES
+
+#endif  // defined(BIKE_COMPUTER_HOST)
+
+// number of words of the stack that are still filled with the pattern, from the lowest
+// address: the lowest word (magic word of the stack overflow check) is not scanned
+STACK_SCAN_ATTRIBUTES static uint32_t countUntouchedWords(const uint32_t* stackMemory,
+                                                          uint32_t nbrOfWords) {
+    uint32_t nbrOfUntouchedWords = 0;
+    for (uint32_t index = 1; index < nbrOfWords; index++) {
+        if (stackMemory[index] != kStackFillPattern) {
+            break;
+        }
+        nbrOfUntouchedWords++;
+    }
+    return nbrOfUntouchedWords;
+}
+
+namespace bike_computer {
+
+// definitions required when the constants are odr-used (C++14)
+constexpr uint8_t StackMonitor::kMaxNbrOfThreads;
+constexpr uint32_t StackMonitor::kStackAlignment;
+
+StackMonitor::StackMonitor(uint8_t marginPercent) : _marginPercent(marginPercent) {
+#if !defined(BIKE_COMPUTER_HOST) && !MBED_STACK_STATS_ENABLED
+    tr_warn("Stack watermarking requires platform.stack-stats-enabled");
+#endif  // !defined(BIKE_COMPUTER_HOST) && !MBED_STACK_STATS_ENABLED
+}
+
+void StackMonitor::sample() {
+    // threads that are not reported anymore are removed from the table
+    for (uint8_t index = 0; index < _nbrOfThreads; index++) {
+        _entries[index].isSampled = false;
+    }
+    _nbrOfIgnoredThreads = 0;
+    readThreadStacks(callback(this, &StackMonitor::onThreadStack));
+    uint8_t nbrOfThreads = 0;
+    for (uint8_t index = 0; index < _nbrOfThreads; index++) {
+        if (_entries[index].isSampled) {
+            _entries[nbrOfThreads++] = _entries[index];
+        }
+    }
+    _nbrOfThreads = nbrOfThreads;
+
+    // the warnings are printed once the stacks are scanned (with the kernel unlocked)
+    for (uint8_t index = 0; index < _nbrOfThreads; index++) {
+        Entry& entry                   = _entries[index];
+        const ThreadStack& threadStack = entry.threadStack;
+        if (!entry.isWarningRaised &&
+            threadStack.recommendedSize > threadStack.stackSize) {
+            entry.isWarningRaised = true;
+            _nbrOfWarnings++;
+            tr_warn("Thread %s: stack of %" PRIu32 " bytes with %" PRIu32
+                    " bytes used, %" PRIu32 " bytes recommended",
+                    threadStack.name,
+                    threadStack.stackSize,
+                    threadStack.usedSize,
+                    threadStack.recommendedSize);
+        }
+    }
+
+    _nbrOfSamples++;
+}
+
+uint8_t StackMonitor::getNbrOfThreads() const { return _nbrOfThreads; }
+
+const StackMonitor::ThreadStack& StackMonitor::getThreadStack(uint8_t index) const {
+    MBED_ASSERT(index < _nbrOfThreads);
+    return _entries[index].threadStack;
+}
+
+const StackMonitor::ThreadStack* StackMonitor::findThreadStack(const char* name) const {
+    for (uint8_t index = 0; index < _nbrOfThreads; index++) {
+        if (strcmp(_entries[index].threadStack.name, name) == 0) {
+            return &_entries[index].threadStack;
+        }
+    }
+    return nullptr;
+}
+
+uint32_t StackMonitor::getNbrOfSamples() const { return _nbrOfSamples; }
+
+uint32_t StackMonitor::getNbrOfIgnoredThreads() const { return _nbrOfIgnoredThreads; }
+
+bool StackMonitor::isWarningRaised() const {
+    for (uint8_t index = 0; index < _nbrOfThreads; index++) {
+        if (_entries[index].isWarningRaised) {
+            return true;
+        }
+    }
+    return false;
+}
+
+uint32_t StackMonitor::getNbrOfWarnings() const { return _nbrOfWarnings; }
+
+void StackMonitor::printStats() const {
+    uint32_t totalStackSize       = 0;
+    uint32_t totalRecommendedSize = 0;
+    for (uint8_t index = 0; index < _nbrOfThreads; index++) {
+        const ThreadStack& threadStack = _entries[index].threadStack;
+        tr_info("Thread %s: stack %" PRIu32 " / %" PRIu32
+                " bytes used, recommended %" PRIu32 " bytes",
+                threadStack.name,
+                threadStack.usedSize,
+                threadStack.stackSize,
+                threadStack.recommendedSize);
+        totalStackSize += threadStack.stackSize;
+        totalRecommendedSize += threadStack.recommendedSize;
+    }
+    tr_info("Thread stacks: %" PRIu32 " bytes reserved, %" PRIu32
+            " bytes recommended (margin %u%%)",
+            totalStackSize,
+            totalRecommendedSize,
+            _marginPercent);
+}
+
+void StackMonitor::onThreadStack(const void* id,
+                                 const char* name,
+                                 const uint32_t* stackMemory,
+                                 uint32_t stackMemorySize,
+                                 uint32_t stackSize) {
+    Entry* entry = nullptr;
+    for (uint8_t index = 0; index < _nbrOfThreads; index++) {
+        if (_entries[index].threadStack.id == id) {
+            entry = &_entries[index];
+            break;
+        }
+    }
+    if (entry == nullptr) {
+        if (_nbrOfThreads == kMaxNbrOfThreads) {
+            _nbrOfIgnoredThreads++;
+            return;
+        }
+        entry                  = &_entries[_nbrOfThreads++];
+        entry->threadStack.id  = id;
+        entry->isWarningRaised = false;
+    }
+    // the lowest word is accounted as unused, as by osThreadGetStackSpace()
+    const uint32_t nbrOfWords = stackMemorySize / sizeof(uint32_t);
+    const uint32_t unusedSize =
+        (nbrOfWords > 0) ? (countUntouchedWords(stackMemory, nbrOfWords) + 1) *
+                               static_cast<uint32_t>(sizeof(uint32_t))
+                         : 0;
+    entry->threadStack.name      = (name != nullptr) ? name : "unnamed";
+    entry->threadStack.stackSize = stackSize;
+    entry->threadStack.usedSize  = stackMemorySize - unusedSize;
+    entry->threadStack.recommendedSize =
+        getRecommendedSize(entry->threadStack.usedSize, _marginPercent);
+    entry->isSampled = true;
+}
+
+}  // namespace bike_computer
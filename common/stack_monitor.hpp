@@ -0,0 +1,112 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file stack_monitor.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief StackMonitor header file (per-thread stack high-water marks)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include "mbed.h"
+
+namespace bike_computer {
+
+// Per-thread stack high-water marks: the stacks are filled with a pattern when their
+// thread is created (RTX stack watermarking on the target, enabled with the stack
+// statistics) and the untouched part of each stack is scanned from its lowest address
+// once per major cycle. The stack size recommended for each thread is its high-water
+// mark with a margin, a warning being raised for the threads whose reserved stack is
+// smaller than the recommended size (before the stack overflows).
+class StackMonitor {
+   public:
+    // maximum number of threads in the table, the threads in excess being ignored
+    static constexpr uint8_t kMaxNbrOfThreads = 16;
+    // stack sizes are multiples of 8 bytes (stack alignment of the target)
+    static constexpr uint32_t kStackAlignment = 8;
+
+    struct ThreadStack {
+        const void* id;
+        const char* name;
+        // reserved stack size and high-water mark (in bytes)
+        uint32_t stackSize;
+        uint32_t usedSize;
+        // high-water mark with the margin (in bytes)
+        uint32_t recommendedSize;
+    };
+
+    explicit StackMonitor(uint8_t marginPercent);
+
+    // make the class non copyable
+    StackMonitor(StackMonitor&)            = delete;
+    StackMonitor& operator=(StackMonitor&) = delete;
+
+    // method called once per major cycle: scans the stack of each thread
+    void sample();
+
+    // methods for getting the high-water marks of the last sample
+    uint8_t getNbrOfThreads() const;
+    const ThreadStack& getThreadStack(uint8_t index) const;
+    // returns nullptr if no thread with this name was sampled
+    const ThreadStack* findThreadStack(const char* name) const;
+    uint32_t getNbrOfSamples() const;
+    uint32_t getNbrOfIgnoredThreads() const;
+    // returns true if the reserved stack of a thread is smaller than its recommended
+    // size
+    bool isWarningRaised() const;
+    // number of threads for which the warning was raised
+    uint32_t getNbrOfWarnings() const;
+
+    static constexpr uint32_t getRecommendedSize(uint32_t usedSize,
+                                                 uint8_t marginPercent) {
+        // the margin is rounded up, as is the size to the stack alignment
+        const uint32_t size = usedSize + (usedSize * marginPercent + 99) / 100;
+        return (size + kStackAlignment - 1) / kStackAlignment * kStackAlignment;
+    }
+
+    // method called for printing the high-water marks of the last sample and the
+    // total stack sizes (reserved and recommended)
+    void printStats() const;
+
+   private:
+    // private methods
+    void onThreadStack(const void* id,
+                       const char* name,
+                       const uint32_t* stackMemory,
+                       uint32_t stackMemorySize,
+                       uint32_t stackSize);
+
+    // table entry: the warning is raised once per thread, the high-water mark of a
+    // thread never decreasing
+    struct Entry {
+        ThreadStack threadStack;
+        bool isWarningRaised;
+        bool isSampled;
+    };
+
+    // data members
+    const uint8_t _marginPercent;
+    Entry _entries[kMaxNbrOfThreads];
+    uint8_t _nbrOfThreads         = 0;
+    uint32_t _nbrOfSamples        = 0;
+    uint32_t _nbrOfIgnoredThreads = 0;
+    uint32_t _nbrOfWarnings       = 0;
+};
+
+}  // namespace bike_computer
@@ -0,0 +1,60 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file task_console.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief TaskConsole implementation (console commands for the task table)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include "task_console.hpp"
+
+#include <cstdio>
+
+#include "scope_profiler.hpp"
+
+#include "mbed_trace.h"
+#if MBED_CONF_MBED_TRACE_ENABLE
+#define TRACE_GROUP "TaskConsole"
+#endif  // MBED_CONF_MBED_TRACE_ENABLE
+
+namespace bike_computer {
+
+TaskConsole::TaskConsole(TaskTable& taskTable)
+    : _taskTable(taskTable),
+      _thread(osPriorityBelowNormal, kStackSize, nullptr, "TaskConsole") {}
+
+void TaskConsole::start() {
+    osStatus status = _thread.start(callback(this, &TaskConsole::run));
+    if (status != osOK) {
+        tr_error("Cannot start the task console thread: %d", status);
+    }
+}
+
+void TaskConsole::run() {
+    char line[kMaxLineSize];
+    while (true) {
+        // block until a full command line is entered on the console
+        if (fgets(line, sizeof(line), stdin) != nullptr &&
+            !ScopeProfiler::getInstance().executeCommand(line)) {
+            _taskTable.executeCommand(line);
+        }
+    }
+}
+
+}  // namespace bike_computer
@@ -0,0 +1,54 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file task_console.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief TaskConsole header file (console commands for the task table)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include "mbed.h"
+#include "task_table.hpp"
+
+namespace bike_computer {
+
+class TaskConsole {
+   public:
+    explicit TaskConsole(TaskTable& taskTable);  // NOLINT(runtime/references)
+
+    // make the class non copyable
+    TaskConsole(TaskConsole&)            = delete;
+    TaskConsole& operator=(TaskConsole&) = delete;
+
+    // method called for starting the thread reading commands from the console
+    void start();
+
+   private:
+    // private methods
+    void run();
+
+    // data members
+    static constexpr uint32_t kStackSize  = 2048;
+    static constexpr uint8_t kMaxLineSize = 64;
+    TaskTable& _taskTable;
+    Thread _thread;
+};
+
+}  // namespace bike_computer
@@ -0,0 +1,307 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file task_table.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief TaskTable implementation (runtime reconfigurable task periods)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include "task_table.hpp"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+
+#include "mbed_trace.h"
+#if MBED_CONF_MBED_TRACE_ENABLE
+#define TRACE_GROUP "TaskTable"
+#endif  // MBED_CONF_MBED_TRACE_ENABLE
+
+namespace bike_computer {
+
+// definition required since the constant is odr-used (C++14)
+constexpr std::chrono::milliseconds TaskTable::kMaxMajorCycle;
+
+static int64_t greatestCommonDivisor(int64_t a, int64_t b) {
+    while (b != 0) {
+        int64_t remainder = a % b;
+        a                 = b;
+        b                 = remainder;
+    }
+    return a;
+}
+
+void TaskTable::setTask(uint8_t taskIndex,
+                        const char* name,
+                        const std::chrono::milliseconds& period,
+                        const std::chrono::milliseconds& phase,
+                        const std::chrono::milliseconds& computationTime) {
+    if (taskIndex >= kMaxNbrOfTasks) {
+        tr_error("Invalid task index %d", taskIndex);
+        return;
+    }
+    _mutex.lock();
+    _tasks[taskIndex].name            = name;
+    _tasks[taskIndex].period          = period;
+    _tasks[taskIndex].phase           = phase;
+    _tasks[taskIndex].computationTime = computationTime;
+    _pendingTasks[taskIndex]          = _tasks[taskIndex];
+    _mutex.unlock();
+}
+
+TaskTable::ChangeStatus TaskTable::requestChange(
+    uint8_t taskIndex,
+    const std::chrono::milliseconds& period,
+    const std::chrono::milliseconds& phase) {
+    if (!isTaskDefined(taskIndex)) {
+        return ChangeStatus::UnknownTask;
+    }
+
+    _mutex.lock();
+    // validate the table resulting from all pending changes including this one
+    Task candidateTasks[kMaxNbrOfTasks];
+    memcpy(candidateTasks, _pendingTasks, sizeof(candidateTasks));
+    candidateTasks[taskIndex].period = period;
+    candidateTasks[taskIndex].phase  = phase;
+    ChangeStatus status              = validate(candidateTasks);
+    if (status == ChangeStatus::Accepted) {
+        memcpy(_pendingTasks, candidateTasks, sizeof(_pendingTasks));
+        _hasPendingChanges = true;
+    }
+    _mutex.unlock();
+
+    tr_info("Change of task %s (period %" PRIu64 " ms, phase %" PRIu64 " ms): status %d",
+            _tasks[taskIndex].name,
+            period.count(),
+            phase.count(),
+            static_cast<int>(status));
+    return status;
+}
+
+TaskTable::ChangeStatus TaskTable::executeCommand(const char* command) {
+    static constexpr uint8_t kMaxTokenSize = 16;
+    char verb[kMaxTokenSize]               = {0};
+    char name[kMaxTokenSize]               = {0};
+    uint32_t period                        = 0;
+    uint32_t phase                         = 0;
+    int nbrOfTokens =
+        sscanf(command, "%15s %15s %" SCNu32 " %" SCNu32, verb, name, &period, &phase);
+
+    if (nbrOfTokens == 1 && strcmp(verb, "tasks") == 0) {
+        print();
+        return ChangeStatus::Accepted;
+    }
+    if (nbrOfTokens < 3 || strcmp(verb, "period") != 0) {
+        printf("Usage: tasks | period <task name> <period in ms> [<phase in ms>]\n");
+        return ChangeStatus::InvalidParameters;
+    }
+
+    int taskIndex = findTask(name);
+    if (taskIndex < 0) {
+        printf("Unknown task %s\n", name);
+        return ChangeStatus::UnknownTask;
+    }
+    // keep the current phase if none is given
+    std::chrono::milliseconds newPhase = std::chrono::milliseconds(phase);
+    if (nbrOfTokens == 3) {
+        _mutex.lock();
+        newPhase = _pendingTasks[taskIndex].phase;
+        _mutex.unlock();
+    }
+
+    ChangeStatus status = requestChange(
+        static_cast<uint8_t>(taskIndex), std::chrono::milliseconds(period), newPhase);
+    printf("Change request %s\n",
+           (status == ChangeStatus::Accepted) ? "accepted" : "rejected");
+    return status;
+}
+
+bool TaskTable::applyPendingChanges() {
+    // try to lock since this method is called from the scheduler
+    if (!_mutex.trylock()) {
+        return false;
+    }
+    bool hasChanged = _hasPendingChanges;
+    if (_hasPendingChanges) {
+        memcpy(_tasks, _pendingTasks, sizeof(_tasks));
+        _hasPendingChanges = false;
+    }
+    _mutex.unlock();
+    if (hasChanged) {
+        tr_info("New task table applied (major cycle %" PRIu64
+                " ms, utilization %" PRIu32 " per mille)",
+                getMajorCycle().count(),
+                getUtilization());
+    }
+    return hasChanged;
+}
+
+bool TaskTable::isTaskDefined(uint8_t taskIndex) const {
+    return taskIndex < kMaxNbrOfTasks && _tasks[taskIndex].name != nullptr;
+}
+
+const TaskTable::Task& TaskTable::getTask(uint8_t taskIndex) const {
+    return _tasks[taskIndex];
+}
+
+int TaskTable::findTask(const char* name) const {
+    for (uint8_t taskIndex = 0; taskIndex < kMaxNbrOfTasks; taskIndex++) {
+        if (isTaskDefined(taskIndex) && strcmp(_tasks[taskIndex].name, name) == 0) {
+            return taskIndex;
+        }
+    }
+    return -1;
+}
+
+std::chrono::milliseconds TaskTable::getMajorCycle() const {
+    return computeMajorCycle(_tasks);
+}
+
+uint32_t TaskTable::getUtilization() const { return computeUtilization(_tasks); }
+
+uint8_t TaskTable::buildCyclicSchedule(Job (&jobs)[kMaxNbrOfJobs]) const {
+    return buildJobs(_tasks, jobs);
+}
+
+void TaskTable::print() const {
+    printf("Task table (major cycle %" PRIu64 " ms, utilization %" PRIu32
+           " per mille):\n",
+           getMajorCycle().count(),
+           getUtilization());
+    for (uint8_t taskIndex = 0; taskIndex < kMaxNbrOfTasks; taskIndex++) {
+        if (isTaskDefined(taskIndex)) {
+            printf("  %-12s period %5" PRIu64 " ms, phase %5" PRIu64
+                   " ms, computation time %4" PRIu64 " ms\n",
+                   _tasks[taskIndex].name,
+                   _tasks[taskIndex].period.count(),
+                   _tasks[taskIndex].phase.count(),
+                   _tasks[taskIndex].computationTime.count());
+        }
+    }
+}
+
+std::chrono::milliseconds TaskTable::computeMajorCycle(
+    const Task (&tasks)[kMaxNbrOfTasks]) {
+    // the major cycle is the least common multiple of all task periods: the
+    // computation stops as soon as it exceeds kMaxMajorCycle, so that the products
+    // of periods bounded by kMaxMajorCycle cannot overflow
+    static constexpr std::chrono::milliseconds kOutOfRange = kMaxMajorCycle + 1ms;
+    int64_t majorCycle = 0;
+    for (uint8_t taskIndex = 0; taskIndex < kMaxNbrOfTasks; taskIndex++) {
+        const int64_t period = tasks[taskIndex].period.count();
+        if (tasks[taskIndex].name == nullptr || period <= 0) {
+            continue;
+        }
+        if (period > kMaxMajorCycle.count()) {
+            return kOutOfRange;
+        }
+        majorCycle = (majorCycle == 0)
+                         ? period
+                         : (majorCycle / greatestCommonDivisor(majorCycle, period)) *
+                               period;
+        if (majorCycle > kMaxMajorCycle.count()) {
+            return kOutOfRange;
+        }
+    }
+    return std::chrono::milliseconds(majorCycle);
+}
+
+uint32_t TaskTable::computeUtilization(const Task (&tasks)[kMaxNbrOfTasks]) {
+    // the processor demand over the major cycle is computed exactly in ms
+    const int64_t majorCycle = computeMajorCycle(tasks).count();
+    if (majorCycle == 0) {
+        return 0;
+    }
+    int64_t demand = 0;
+    for (uint8_t taskIndex = 0; taskIndex < kMaxNbrOfTasks; taskIndex++) {
+        if (tasks[taskIndex].name != nullptr) {
+            demand += tasks[taskIndex].computationTime.count() *
+                      (majorCycle / tasks[taskIndex].period.count());
+        }
+    }
+    return static_cast<uint32_t>((demand * 1000) / majorCycle);
+}
+
+uint8_t TaskTable::buildJobs(const Task (&tasks)[kMaxNbrOfTasks],
+                             Job (&jobs)[kMaxNbrOfJobs]) {
+    const std::chrono::milliseconds majorCycle = computeMajorCycle(tasks);
+    uint8_t nbrOfJobs                          = 0;
+    for (uint8_t taskIndex = 0; taskIndex < kMaxNbrOfTasks; taskIndex++) {
+        if (tasks[taskIndex].name == nullptr) {
+            continue;
+        }
+        for (auto releaseTime = tasks[taskIndex].phase; releaseTime < majorCycle;
+             releaseTime += tasks[taskIndex].period) {
+            if (nbrOfJobs == kMaxNbrOfJobs) {
+                return 0;
+            }
+            // insert the job sorted by release time (insertion sort)
+            uint8_t jobIndex = nbrOfJobs;
+            while (jobIndex > 0 && jobs[jobIndex - 1].releaseTime > releaseTime) {
+                jobs[jobIndex] = jobs[jobIndex - 1];
+                jobIndex--;
+            }
+            jobs[jobIndex].taskIndex   = taskIndex;
+            jobs[jobIndex].releaseTime = releaseTime;
+            nbrOfJobs++;
+        }
+    }
+    return nbrOfJobs;
+}
+
+TaskTable::ChangeStatus TaskTable::validate(const Task (&tasks)[kMaxNbrOfTasks]) {
+    for (uint8_t taskIndex = 0; taskIndex < kMaxNbrOfTasks; taskIndex++) {
+        const Task& task = tasks[taskIndex];
+        if (task.name != nullptr &&
+            (task.period <= 0ms || task.period > kMaxMajorCycle || task.phase < 0ms ||
+             task.phase >= task.period || task.computationTime > task.period)) {
+            return ChangeStatus::InvalidParameters;
+        }
+    }
+    const std::chrono::milliseconds majorCycle = computeMajorCycle(tasks);
+    if (majorCycle > kMaxMajorCycle) {
+        return ChangeStatus::InvalidParameters;
+    }
+    if (computeUtilization(tasks) > 1000) {
+        return ChangeStatus::UtilizationExceeded;
+    }
+
+    // all jobs are executed non preemptively in the order of their release time:
+    // each job must complete before the release of the next job of the same task
+    // and all jobs must complete within the major cycle
+    Job jobs[kMaxNbrOfJobs];
+    const uint8_t nbrOfJobs = buildJobs(tasks, jobs);
+    if (nbrOfJobs == 0) {
+        return ChangeStatus::NotSchedulable;
+    }
+    std::chrono::milliseconds finishTime = 0ms;
+    for (uint8_t jobIndex = 0; jobIndex < nbrOfJobs; jobIndex++) {
+        const Task& task = tasks[jobs[jobIndex].taskIndex];
+        finishTime =
+            std::max(finishTime, jobs[jobIndex].releaseTime) + task.computationTime;
+        if (finishTime > jobs[jobIndex].releaseTime + task.period ||
+            finishTime > majorCycle) {
+            return ChangeStatus::NotSchedulable;
+        }
+    }
+    return ChangeStatus::Accepted;
+}
+
+}  // namespace bike_computer
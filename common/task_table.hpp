@@ -0,0 +1,125 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file task_table.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief TaskTable header file (runtime reconfigurable task periods)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include <chrono>
+
+#include "mbed.h"
+
+namespace bike_computer {
+
+class TaskTable {
+   public:
+    // maximal number of tasks in the table (indexed as in advembsof::TaskLogger)
+    static constexpr uint8_t kMaxNbrOfTasks = 8;
+    // maximal number of jobs in a major cycle (for cyclic schedules)
+    static constexpr uint8_t kMaxNbrOfJobs = 32;
+    // maximal duration of a major cycle
+    static constexpr std::chrono::milliseconds kMaxMajorCycle = 10000ms;
+
+    // definition of a periodic task
+    struct Task {
+        const char* name                          = nullptr;
+        std::chrono::milliseconds period          = 0ms;
+        std::chrono::milliseconds phase           = 0ms;
+        std::chrono::milliseconds computationTime = 0ms;
+    };
+
+    // definition of a job (a task release within the major cycle)
+    struct Job {
+        uint8_t taskIndex                     = 0;
+        std::chrono::milliseconds releaseTime = 0ms;
+    };
+
+    // status returned upon a change request
+    enum class ChangeStatus {
+        Accepted = 0,
+        UnknownTask,
+        InvalidParameters,
+        UtilizationExceeded,
+        NotSchedulable
+    };
+
+    TaskTable() = default;
+
+    // make the class non copyable
+    TaskTable(TaskTable&)            = delete;
+    TaskTable& operator=(TaskTable&) = delete;
+
+    // method called at initialization for registering a task
+    void setTask(uint8_t taskIndex,
+                 const char* name,
+                 const std::chrono::milliseconds& period,
+                 const std::chrono::milliseconds& phase,
+                 const std::chrono::milliseconds& computationTime);
+
+    // command hook (thread safe): the change is validated and recorded, it is then
+    // applied by the scheduler at the next safe point
+    ChangeStatus requestChange(uint8_t taskIndex,
+                               const std::chrono::milliseconds& period,
+                               const std::chrono::milliseconds& phase);
+
+    // console command hook, accepting "tasks" and
+    // "period <task name> <period in ms> [<phase in ms>]"
+    ChangeStatus executeCommand(const char* command);
+
+    // method called by the scheduler at a safe point (major cycle boundary)
+    // returns true if the table was changed
+    bool applyPendingChanges();
+
+    // methods for getting the current table (utilization is expressed in per mille)
+    bool isTaskDefined(uint8_t taskIndex) const;
+    const Task& getTask(uint8_t taskIndex) const;
+    int findTask(const char* name) const;
+    std::chrono::milliseconds getMajorCycle() const;
+    uint32_t getUtilization() const;
+
+    // method for building a cyclic schedule (jobs sorted by release time)
+    // returns the number of jobs in the major cycle
+    uint8_t buildCyclicSchedule(Job (&jobs)[kMaxNbrOfJobs]) const;
+
+    // method for printing the table
+    void print() const;
+
+   private:
+    // private methods
+    // returns a major cycle larger than kMaxMajorCycle (but not the exact one) when
+    // the least common multiple of the periods exceeds kMaxMajorCycle
+    static std::chrono::milliseconds computeMajorCycle(
+        const Task (&tasks)[kMaxNbrOfTasks]);
+    static uint32_t computeUtilization(const Task (&tasks)[kMaxNbrOfTasks]);
+    static uint8_t buildJobs(const Task (&tasks)[kMaxNbrOfTasks],
+                             Job (&jobs)[kMaxNbrOfJobs]);
+    static ChangeStatus validate(const Task (&tasks)[kMaxNbrOfTasks]);
+
+    // data members
+    Task _tasks[kMaxNbrOfTasks];
+    // tasks including the changes to be applied at the next safe point
+    Task _pendingTasks[kMaxNbrOfTasks];
+    bool _hasPendingChanges = false;
+    Mutex _mutex;
+};
+
+}  // namespace bike_computer
@@ -0,0 +1,282 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file thread_cpu_monitor.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief ThreadCpuMonitor implementation (per-thread and interrupt cpu accounting)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include "thread_cpu_monitor.hpp"
+
+#include <cstring>
+
+#if !defined(BIKE_COMPUTER_HOST)
+#include "cmsis_os2.h"
+#include "hal/us_ticker_api.h"
+#endif  // !defined(BIKE_COMPUTER_HOST)
+
+#include "mbed_trace.h"
+#if MBED_CONF_MBED_TRACE_ENABLE
+#define TRACE_GROUP "ThreadCpuMonitor"
+#endif  // MBED_CONF_MBED_TRACE_ENABLE
+
+typedef mbed::Callback<void(const void*, const char*, uint64_t)> ThreadCpuTimeFunction;
+
+#if defined(BIKE_COMPUTER_HOST)
+
+// the host port reads the cpu clocks of the native threads
+static void readThreadCpuTimes(ThreadCpuTimeFunction function) {
+    host::forEachThreadCpuTime(function);
+}
+
+static uint64_t readIsrCpuTime() { return host::getIsrCpuTime(); }
+
+static void enterIsr() { host::isrEnter(); }
+
+static void exitIsr() { host::isrExit(); }
+
+#else
+
+// cpu time (in us) charged to a thread by the thread switch hook, the records of the
+// threads being never removed
+struct ThreadCpuRecord {
+    osThreadId_t id;
+    uint64_t cpuTime;
+};
+static constexpr uint8_t kMaxNbrOfRecords = 16;
+static ThreadCpuRecord gThreadCpuRecords[kMaxNbrOfRecords];
+static osThreadId_t gRunningThread = nullptr;
+static uint32_t gSwitchTime        = 0;
+// interrupt time spent during the slice of the running thread and in total
+static uint32_t gSliceIsrTime = 0;
+static uint64_t gIsrCpuTime   = 0;
+static uint32_t gIsrNesting   = 0;
+static uint32_t gIsrStartTime = 0;
+
+// charges the time elapsed since the previous thread switch to the running thread,
+// must be called with interrupts disabled
+static void chargeRunningThread(uint32_t now) {
+    // the us ticker wraps around, slices being much shorter than the wrap period
+    const uint32_t sliceTime = now - gSwitchTime;
+    if (gRunningThread != nullptr) {
+        // the records are allocated in order, a free record ends the search
+        for (ThreadCpuRecord& record : gThreadCpuRecords) {
+            if (record.id == gRunningThread || record.id == nullptr) {
+                record.id = gRunningThread;
+                record.cpuTime +=
+                    (sliceTime > gSliceIsrTime) ? sliceTime - gSliceIsrTime : 0;
+                break;
+            }
+        }
+    }
+    gSwitchTime   = now;
+    gSliceIsrTime = 0;
+}
+
+// RTX event recorder hook called upon each thread switch (the RTX events are enabled
+// with rtos.enable-all-rtx-events and implemented by the application)
+extern "C" void EvrRtxThreadSwitched(osThreadId_t thread_id) {
+    core_util_critical_section_enter();
+    chargeRunningThread(us_ticker_read());
+    gRunningThread = thread_id;
+    core_util_critical_section_exit();
+}
+
+static void readThreadCpuTimes(ThreadCpuTimeFunction function) {
+    // the records are copied for calling the function with interrupts enabled
+    ThreadCpuRecord records[kMaxNbrOfRecords];
+    core_util_critical_section_enter();
+    chargeRunningThread(us_ticker_read());
+    for (uint8_t index = 0; index < kMaxNbrOfRecords; index++) {
+        records[index] = gThreadCpuRecords[index];
+    }
+    core_util_critical_section_exit();
+    for (const ThreadCpuRecord& record : records) {
+        if (record.id == nullptr) {
+            break;
+        }
+        // deleted threads are not reported
+        if (osThreadGetState(record.id) == osThreadError) {
+            continue;
+        }
+        function(record.id, osThreadGetName(record.id), record.cpuTime);
+    }
+}
+
+static uint64_t readIsrCpuTime() {
+    core_util_critical_section_enter();
+    const uint64_t isrCpuTime = gIsrCpuTime;
+    core_util_critical_section_exit();
+    return isrCpuTime;
+}
+
+static void enterIsr() {
+    core_util_critical_section_enter();
+    if (gIsrNesting++ == 0) {
+        gIsrStartTime = us_ticker_read();
+    }
+    core_util_critical_section_exit();
+}
+
+static void exitIsr() {
+    core_util_critical_section_enter();
+    if (gIsrNesting > 0 && --gIsrNesting == 0) {
+        const uint32_t isrTime = us_ticker_read() - gIsrStartTime;
+        gSliceIsrTime += isrTime;
+        gIsrCpuTime += isrTime;
+    }
+    core_util_critical_section_exit();
+}
+
+#endif  // defined(BIKE_COMPUTER_HOST)
+
+namespace bike_computer {
+
+// definition required when the constant is odr-used (C++14)
+constexpr uint8_t ThreadCpuMonitor::kMaxNbrOfThreads;
+
+ThreadCpuMonitor::IsrScope::IsrScope() { enterIsr(); }
+
+ThreadCpuMonitor::IsrScope::~IsrScope() { exitIsr(); }
+
+ThreadCpuMonitor::ThreadCpuMonitor(Timer& timer) : _timer(timer) {
+    // the cpu times at construction are used as reference for the first sample
+    _isPriming = true;
+    sample();
+    _isPriming    = false;
+    _nbrOfSamples = 0;
+}
+
+void ThreadCpuMonitor::sample() {
+    // the timer may have been started after the construction
+    const std::chrono::microseconds now = _timer.elapsed_time();
+    _samplePeriod   = (now > _lastSampleTime) ? now - _lastSampleTime : now;
+    _lastSampleTime = now;
+
+    // threads that are not reported anymore are removed from the table
+    for (uint8_t index = 0; index < _nbrOfThreads; index++) {
+        _entries[index].isSampled = false;
+    }
+    _nbrOfIgnoredThreads = 0;
+    readThreadCpuTimes(callback(this, &ThreadCpuMonitor::onThreadCpuTime));
+    uint8_t nbrOfThreads = 0;
+    for (uint8_t index = 0; index < _nbrOfThreads; index++) {
+        if (_entries[index].isSampled) {
+            _entries[nbrOfThreads] = _entries[index];
+            _entries[nbrOfThreads].threadLoad.load =
+                computeLoad(_entries[nbrOfThreads].threadLoad.cpuTime);
+            nbrOfThreads++;
+        }
+    }
+    _nbrOfThreads = nbrOfThreads;
+
+    const uint64_t isrCpuTime = readIsrCpuTime();
+    _isrTime        = std::chrono::microseconds(isrCpuTime - _lastIsrCpuTime);
+    _isrLoad        = computeLoad(_isrTime);
+    _lastIsrCpuTime = isrCpuTime;
+
+    _nbrOfSamples++;
+}
+
+uint8_t ThreadCpuMonitor::getNbrOfThreads() const { return _nbrOfThreads; }
+
+const ThreadCpuMonitor::ThreadLoad& ThreadCpuMonitor::getThreadLoad(
+    uint8_t index) const {
+    MBED_ASSERT(index < _nbrOfThreads);
+    return _entries[index].threadLoad;
+}
+
+const ThreadCpuMonitor::ThreadLoad* ThreadCpuMonitor::findThreadLoad(
+    const char* name) const {
+    for (uint8_t index = 0; index < _nbrOfThreads; index++) {
+        if (strcmp(_entries[index].threadLoad.name, name) == 0) {
+            return &_entries[index].threadLoad;
+        }
+    }
+    return nullptr;
+}
+
+std::chrono::microseconds ThreadCpuMonitor::getIsrTime() const { return _isrTime; }
+
+uint16_t ThreadCpuMonitor::getIsrLoad() const { return _isrLoad; }
+
+std::chrono::microseconds ThreadCpuMonitor::getSamplePeriod() const {
+    return _samplePeriod;
+}
+
+uint32_t ThreadCpuMonitor::getNbrOfSamples() const { return _nbrOfSamples; }
+
+uint32_t ThreadCpuMonitor::getNbrOfIgnoredThreads() const { return _nbrOfIgnoredThreads; }
+
+void ThreadCpuMonitor::printStats() const {
+    tr_info("Thread cpu loads over %" PRIu64 " ms (interrupts %" PRIu64 " us, %u.%u%%)",
+            static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::milliseconds>(_samplePeriod)
+                    .count()),
+            static_cast<uint64_t>(_isrTime.count()),
+            _isrLoad / 10,
+            _isrLoad % 10);
+    for (uint8_t index = 0; index < _nbrOfThreads; index++) {
+        const ThreadLoad& threadLoad = _entries[index].threadLoad;
+        tr_info("Thread %s: %" PRIu64 " us, %u.%u%%",
+                threadLoad.name,
+                static_cast<uint64_t>(threadLoad.cpuTime.count()),
+                threadLoad.load / 10,
+                threadLoad.load % 10);
+    }
+}
+
+void ThreadCpuMonitor::onThreadCpuTime(const void* id,
+                                       const char* name,
+                                       uint64_t cpuTime) {
+    Entry* entry = nullptr;
+    for (uint8_t index = 0; index < _nbrOfThreads; index++) {
+        if (_entries[index].threadLoad.id == id) {
+            entry = &_entries[index];
+            break;
+        }
+    }
+    if (entry == nullptr) {
+        if (_nbrOfThreads == kMaxNbrOfThreads) {
+            _nbrOfIgnoredThreads++;
+            return;
+        }
+        entry                = &_entries[_nbrOfThreads++];
+        entry->threadLoad.id = id;
+        // a thread created since the previous sample used all its cpu time during the
+        // sample period
+        entry->lastCpuTime = _isPriming ? cpuTime : 0;
+    }
+    entry->threadLoad.name = (name != nullptr) ? name : "unnamed";
+    entry->threadLoad.cpuTime =
+        std::chrono::microseconds((cpuTime > entry->lastCpuTime)
+                                      ? cpuTime - entry->lastCpuTime
+                                      : 0);
+    entry->lastCpuTime = cpuTime;
+    entry->isSampled   = true;
+}
+
+uint16_t ThreadCpuMonitor::computeLoad(const std::chrono::microseconds& cpuTime) const {
+    if (_samplePeriod <= std::chrono::microseconds::zero()) {
+        return 0;
+    }
+    return static_cast<uint16_t>((cpuTime.count() * 1000) / _samplePeriod.count());
+}
+
+}  // namespace bike_computer
@@ -0,0 +1,114 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file thread_cpu_monitor.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief ThreadCpuMonitor header file (per-thread and interrupt cpu accounting)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include <chrono>
+
+#include "mbed.h"
+
+namespace bike_computer {
+
+// Per-thread cpu accounting: on the target, the time elapsed between two thread
+// switches is charged to the thread that was running (RTX thread switch hook), the
+// time spent in interrupt handlers instrumented with IsrScope being excluded. The
+// cpu time of each thread is sampled once per major cycle into a fixed table.
+class ThreadCpuMonitor {
+   public:
+    // maximum number of threads in the table, the threads in excess being ignored
+    static constexpr uint8_t kMaxNbrOfThreads = 12;
+
+    struct ThreadLoad {
+        const void* id;
+        const char* name;
+        // cpu time used by the thread during the last sample period
+        std::chrono::microseconds cpuTime;
+        // share of the last sample period (in per mille)
+        uint16_t load;
+    };
+
+    // accounts the enclosing scope as interrupt time: to be declared first in the
+    // interrupt handlers (nested scopes are accounted once)
+    class IsrScope {
+       public:
+        IsrScope();
+        ~IsrScope();
+
+        // make the class non copyable
+        IsrScope(IsrScope&)            = delete;
+        IsrScope& operator=(IsrScope&) = delete;
+    };
+
+    explicit ThreadCpuMonitor(Timer& timer);  // NOLINT(runtime/references)
+
+    // make the class non copyable
+    ThreadCpuMonitor(ThreadCpuMonitor&)            = delete;
+    ThreadCpuMonitor& operator=(ThreadCpuMonitor&) = delete;
+
+    // method called once per major cycle: samples the cpu time used by each thread
+    // and by the interrupt handlers since the previous sample
+    void sample();
+
+    // methods for getting the loads of the last sample period
+    uint8_t getNbrOfThreads() const;
+    const ThreadLoad& getThreadLoad(uint8_t index) const;
+    // returns nullptr if no thread with this name was sampled
+    const ThreadLoad* findThreadLoad(const char* name) const;
+    std::chrono::microseconds getIsrTime() const;
+    uint16_t getIsrLoad() const;
+    std::chrono::microseconds getSamplePeriod() const;
+    uint32_t getNbrOfSamples() const;
+    uint32_t getNbrOfIgnoredThreads() const;
+
+    // method called for printing the loads of the last sample period
+    void printStats() const;
+
+   private:
+    // private methods
+    void onThreadCpuTime(const void* id, const char* name, uint64_t cpuTime);
+    uint16_t computeLoad(const std::chrono::microseconds& cpuTime) const;
+
+    // table entry: the load and the cpu time of the thread at the previous sample
+    struct Entry {
+        ThreadLoad threadLoad;
+        uint64_t lastCpuTime;
+        bool isSampled;
+    };
+
+    // data members
+    Timer& _timer;
+    Entry _entries[kMaxNbrOfThreads];
+    uint8_t _nbrOfThreads                     = 0;
+    std::chrono::microseconds _lastSampleTime = std::chrono::microseconds::zero();
+    std::chrono::microseconds _samplePeriod   = std::chrono::microseconds::zero();
+    uint64_t _lastIsrCpuTime                  = 0;
+    std::chrono::microseconds _isrTime        = std::chrono::microseconds::zero();
+    uint16_t _isrLoad                         = 0;
+    uint32_t _nbrOfSamples                    = 0;
+    uint32_t _nbrOfIgnoredThreads             = 0;
+    // set while the first sample (reference cpu times) is taken
+    bool _isPriming = false;
+};
+
+}  // namespace bike_computer
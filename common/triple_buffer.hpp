@@ -0,0 +1,186 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file triple_buffer.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Lock-free triple buffer and publish/subscribe topic
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include <chrono>
+
+#include "mbed.h"
+
+namespace bike_computer {
+
+// Single producer, single consumer triple buffer: the producer fills the back
+// buffer and swaps it with the middle one, the consumer swaps the middle buffer with
+// the front one when it is newer. Neither side ever blocks and the consumer always
+// reads the newest complete value.
+template <typename T>
+class TripleBuffer {
+   public:
+    TripleBuffer() = default;
+
+    // make the class non copyable
+    TripleBuffer(TripleBuffer&)            = delete;
+    TripleBuffer& operator=(TripleBuffer&) = delete;
+
+    // method called for setting all buffers before the buffer is shared
+    void reset(const T& value) {
+        for (uint8_t index = 0; index < kNbrOfBuffers; index++) {
+            _buffers[index] = value;
+        }
+    }
+
+    // producer side: fill the write buffer, then publish it
+    T& getWriteBuffer() { return _buffers[_backIndex]; }
+    void publish() {
+        const uint8_t previousIndex =
+            core_util_atomic_exchange_u8(&_middleIndex, _backIndex | kNewFlag);
+        _backIndex = previousIndex & kIndexMask;
+    }
+
+    // consumer side: returns true if a newer value was made available in the read
+    // buffer
+    bool update() {
+        if ((core_util_atomic_load_u8(&_middleIndex) & kNewFlag) == 0) {
+            return false;
+        }
+        const uint8_t previousIndex =
+            core_util_atomic_exchange_u8(&_middleIndex, _frontIndex);
+        _frontIndex = previousIndex & kIndexMask;
+        return true;
+    }
+    const T& getReadBuffer() const { return _buffers[_frontIndex]; }
+
+   private:
+    static constexpr uint8_t kNbrOfBuffers = 3;
+    static constexpr uint8_t kIndexMask    = 0x03;
+    // set in the middle index when it holds a value not yet read by the consumer
+    static constexpr uint8_t kNewFlag = 0x04;
+
+    // data members
+    T _buffers[kNbrOfBuffers];
+    // owned by the producer
+    uint8_t _backIndex = 0;
+    // shared by the producer and the consumer (atomic accesses only)
+    volatile uint8_t _middleIndex = 1;
+    // owned by the consumer
+    uint8_t _frontIndex = 2;
+};
+
+// Topic with a single producer and up to kMaxNbrOfSubscribers consumers, each
+// subscriber owning a triple buffer. Samples are stamped with the publication time
+// and a sequence number (the number of updates of the topic).
+template <typename T, uint8_t kMaxNbrOfSubscribers = 4>
+class Topic {
+   public:
+    struct Sample {
+        T value;
+        std::chrono::microseconds timestamp = std::chrono::microseconds::zero();
+        uint32_t sequence                   = 0;
+    };
+
+    // handle used by a consumer for reading the topic
+    class Subscriber {
+       public:
+        Subscriber() = default;
+
+        // returns false if the subscription failed (too many subscribers)
+        bool isValid() const { return _buffer != nullptr; }
+
+        // make the newest sample available, returns true if it changed since the
+        // last update (the subscriber must be valid)
+        bool update() {
+            MBED_ASSERT(isValid());
+            return _buffer->update();
+        }
+
+        // methods for getting the sample made available by the last update
+        const Sample& getSample() const {
+            MBED_ASSERT(isValid());
+            return _buffer->getReadBuffer();
+        }
+        const T& getValue() const { return getSample().value; }
+        std::chrono::microseconds getAge(const std::chrono::microseconds& now) const {
+            return now - getSample().timestamp;
+        }
+
+       private:
+        friend class Topic;
+        explicit Subscriber(TripleBuffer<Sample>* buffer) : _buffer(buffer) {}
+
+        TripleBuffer<Sample>* _buffer = nullptr;
+    };
+
+    explicit Topic(const T& initialValue) {
+        Sample sample;
+        sample.value = initialValue;
+        for (uint8_t index = 0; index < kMaxNbrOfSubscribers; index++) {
+            _buffers[index].reset(sample);
+        }
+    }
+
+    // make the class non copyable
+    Topic(Topic&)            = delete;
+    Topic& operator=(Topic&) = delete;
+
+    // method called at initialization by each consumer
+    Subscriber subscribe() {
+        const uint8_t index = core_util_atomic_incr_u8(&_nbrOfSubscribers, 1) - 1;
+        if (index >= kMaxNbrOfSubscribers) {
+            core_util_atomic_decr_u8(&_nbrOfSubscribers, 1);
+            return Subscriber();
+        }
+        return Subscriber(&_buffers[index]);
+    }
+
+    // method called by the single producer of the topic (never blocks)
+    void publish(const T& value, const std::chrono::microseconds& timestamp) {
+        const uint32_t sequence  = core_util_atomic_incr_u32(&_nbrOfUpdates, 1);
+        uint8_t nbrOfSubscribers = core_util_atomic_load_u8(&_nbrOfSubscribers);
+        // the counter may temporarily exceed the maximum upon a failed subscription
+        if (nbrOfSubscribers > kMaxNbrOfSubscribers) {
+            nbrOfSubscribers = kMaxNbrOfSubscribers;
+        }
+        for (uint8_t index = 0; index < nbrOfSubscribers; index++) {
+            Sample& sample   = _buffers[index].getWriteBuffer();
+            sample.value     = value;
+            sample.timestamp = timestamp;
+            sample.sequence  = sequence;
+            _buffers[index].publish();
+        }
+    }
+
+    // methods for getting the topic statistics
+    uint32_t getNbrOfUpdates() const { return core_util_atomic_load_u32(&_nbrOfUpdates); }
+    uint8_t getNbrOfSubscribers() const {
+        return core_util_atomic_load_u8(&_nbrOfSubscribers);
+    }
+
+   private:
+    // data members
+    TripleBuffer<Sample> _buffers[kMaxNbrOfSubscribers];
+    volatile uint8_t _nbrOfSubscribers = 0;
+    volatile uint32_t _nbrOfUpdates    = 0;
+};
+
+}  // namespace bike_computer
@@ -1,7 +1,9 @@
 #pragma once
 
+#include "heap_analyzer.hpp"
 #include "mbed.h"
 #include "memory_logger.hpp"
+#include "pool_allocator.hpp"
 
 namespace multi_tasking {
 
@@ -65,6 +67,10 @@ class MemoryFragmenter {
                  availableSize,
                  heapInfo.reserved_size);
         blockSize += 8;
+        // the analyzer warns that the largest free block is too small
+        bike_computer::HeapAnalyzer heapAnalyzer(blockSize);
+        heapAnalyzer.analyze();
+        heapAnalyzer.printStats();
         // this allocation will fail
         tr_debug("Allocating 1 block of size %" PRIu32 " should succeed !", blockSize);
         pBlockArray[0] = new char[blockSize];
@@ -74,7 +80,52 @@ class MemoryFragmenter {
         }
     }
 
+    // same scenario with the fixed-block pool allocator: the blocks freed in a pool
+    // can be allocated again for any size that fits in the blocks of that pool
+    void fragmentPools() {
+        const bike_computer::PoolDefinition& definition =
+            bike_computer::PoolDefinitions::kDefinitions[kPoolIndex];
+        // allocate all blocks of the pool
+        uint32_t blockSize = definition.blockSize - 8;
+        tr_debug("Allocating pool blocks of size %" PRIu32 "", blockSize);
+        char* pBlockArray[kNbrOfPoolBlocks] = {NULL};
+        for (uint32_t blockIndex = 0; blockIndex < kNbrOfPoolBlocks; blockIndex++) {
+            pBlockArray[blockIndex] =
+                static_cast<char*>(bike_computer::PoolAllocator::allocate(blockSize));
+            if (pBlockArray[blockIndex] == NULL) {
+                tr_error("Cannot allocate pool block for index %" PRIu32 "", blockIndex);
+            }
+        }
+        tr_debug("Pool statistics after full allocation:");
+        bike_computer::PoolAllocator::printStats();
+        // free only the even blocks
+        for (uint32_t blockIndex = 0; blockIndex < kNbrOfPoolBlocks; blockIndex += 2) {
+            bike_computer::PoolAllocator::free(pBlockArray[blockIndex]);
+            pBlockArray[blockIndex] = NULL;
+        }
+        tr_debug("Pool statistics after half deallocation:");
+        bike_computer::PoolAllocator::printStats();
+
+        // allocating one block that is slightly bigger succeeds, since it still fits in
+        // the blocks of the pool
+        blockSize += 8;
+        pBlockArray[0] =
+            static_cast<char*>(bike_computer::PoolAllocator::allocate(blockSize));
+        if (pBlockArray[0] == NULL) {
+            tr_error("Cannot allocate 1 pool block of size %" PRIu32 "", blockSize);
+        } else {
+            tr_debug("Allocated 1 pool block of size %" PRIu32 "", blockSize);
+        }
+        for (uint32_t blockIndex = 0; blockIndex < kNbrOfPoolBlocks; blockIndex++) {
+            bike_computer::PoolAllocator::free(pBlockArray[blockIndex]);
+        }
+    }
+
    private:
+    // pool used by fragmentPools() (blocks of 64 bytes)
+    static constexpr uint8_t kPoolIndex = 2;
+    static constexpr uint16_t kNbrOfPoolBlocks =
+        bike_computer::PoolDefinitions::kDefinitions[kPoolIndex].nbrOfBlocks;
     static constexpr uint8_t kNbrOfBlocks  = 8;
     static constexpr uint16_t kMarginSpace = 1024;
     static constexpr uint8_t kArraySize    = 100;
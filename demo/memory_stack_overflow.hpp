@@ -2,7 +2,9 @@
 
 #include <cstdint>
 
+#include "constants.hpp"
 #include "mbed.h"
+#include "stack_monitor.hpp"
 
 namespace multi_tasking {
 
@@ -21,12 +23,17 @@ class MemoryStackOverflow {
             _doubleArray[i] += anotherArray[i];
         }
         _multiplier++;
+        // the high-water mark grows with each allocation: the warning is raised once
+        // the stack is too small with the margin, before the stack overflows
+        _stackMonitor.sample();
+        _stackMonitor.printStats();
     }
 
    private:
     static constexpr size_t kArraySize = 40;
     double _doubleArray[kArraySize]    = {0};
     size_t _multiplier                 = 1;
+    bike_computer::StackMonitor _stackMonitor{bike_computer::kStackMarginPercent};
 };
 
 }  // namespace multi_tasking
@@ -0,0 +1,204 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/****************************************************************************
+ * @file bus_scheduler_benchmark.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Throughput and latency of the bus transaction scheduler (mock bus)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "bus_scheduler.hpp"
+#include "mbed.h"
+#include "mock_transaction_bus.hpp"
+
+using bike_computer::BusPriority;
+using bike_computer::BusScheduler;
+using bike_computer::BusTransaction;
+using bike_computer::MockTransactionBus;
+
+namespace {
+
+constexpr uint8_t kAddress         = 0x80;
+constexpr uint8_t kReadLength      = 4;
+constexpr uint8_t kNbrOfThreads    = 4;
+constexpr uint8_t kNbrOfSensors    = 8;
+constexpr uint8_t kRefreshLength   = 32;
+constexpr uint16_t kNbrOfRefreshes = 200;
+
+struct ClientArguments {
+    BusScheduler* scheduler;
+    uint32_t nbrOfTransactions;
+};
+
+void runClientThread(ClientArguments* arguments) {
+    const char reg             = 0x00;
+    char readData[kReadLength] = {0};
+    for (uint32_t index = 0; index < arguments->nbrOfTransactions; index++) {
+        arguments->scheduler->transfer(
+            kAddress, &reg, 1, readData, kReadLength, BusPriority::Normal);
+    }
+}
+
+// blocking transactions submitted by several threads: the overhead per transaction is
+// the time spent beyond the time of the bus
+void benchmarkThroughput(const std::chrono::microseconds& byteTime,
+                         uint32_t nbrOfTransactions) {
+    MockTransactionBus bus(byteTime);
+    BusScheduler scheduler(bus);
+    scheduler.start();
+
+    ClientArguments arguments = {&scheduler, nbrOfTransactions / kNbrOfThreads};
+    Thread threads[kNbrOfThreads];
+    const auto startTime = std::chrono::steady_clock::now();
+    for (uint8_t index = 0; index < kNbrOfThreads; index++) {
+        threads[index].start(callback(runClientThread, &arguments));
+    }
+    for (uint8_t index = 0; index < kNbrOfThreads; index++) {
+        threads[index].join();
+    }
+    const double elapsedTime = std::chrono::duration<double, std::micro>(
+                                   std::chrono::steady_clock::now() - startTime)
+                                   .count();
+
+    const uint32_t nbrOfRunTransactions = bus.getNbrOfTransactions();
+    const double transferTime =
+        static_cast<double>(bus.getTransferTime(1, kReadLength).count());
+    const double timePerTransaction = elapsedTime / nbrOfRunTransactions;
+    printf("throughput (%u threads): %.0f transactions/s, %.2f us/transaction (bus %.0f"
+           " us, overhead %.2f us), utilization %" PRIu32 " per mille\n",
+           kNbrOfThreads,
+           nbrOfRunTransactions * 1000000.0 / elapsedTime,
+           timePerTransaction,
+           transferTime,
+           timePerTransaction - transferTime,
+           scheduler.getUtilization());
+}
+
+// low priority transaction submitted again as soon as it completes
+class SensorTraffic {
+   public:
+    SensorTraffic()
+        : _transaction(kAddress,
+                       &_reg,
+                       1,
+                       _readData,
+                       kReadLength,
+                       BusPriority::Low,
+                       callback(this, &SensorTraffic::onCompleted)) {}
+
+    void start(BusScheduler& scheduler) {  // NOLINT(runtime/references)
+        _scheduler = &scheduler;
+        _scheduler->submit(_transaction);
+    }
+    void stop() {
+        core_util_atomic_store_bool(&_isStopped, true);
+        while (_transaction.isPending()) {
+            ThisThread::sleep_for(1ms);
+        }
+    }
+
+   private:
+    void onCompleted(int result) {
+        if (!core_util_atomic_load_bool(&_isStopped)) {
+            _scheduler->submit(_transaction);
+        }
+    }
+
+    const char _reg             = 0x00;
+    char _readData[kReadLength] = {0};
+    BusScheduler* _scheduler    = nullptr;
+    volatile bool _isStopped    = false;
+    BusTransaction _transaction;
+};
+
+// latency of the high priority transactions (display refreshes) while the sensor
+// reads keep the queue full
+void benchmarkLatency(const std::chrono::microseconds& byteTime) {
+    MockTransactionBus bus(byteTime);
+    BusScheduler scheduler(bus);
+    scheduler.start();
+    SensorTraffic sensorTraffic[kNbrOfSensors];
+    for (uint8_t index = 0; index < kNbrOfSensors; index++) {
+        sensorTraffic[index].start(scheduler);
+    }
+
+    char frame[kRefreshLength] = {0};
+    std::vector<int64_t> waits;
+    for (uint16_t refresh = 0; refresh < kNbrOfRefreshes; refresh++) {
+        BusTransaction transaction(
+            kAddress, frame, kRefreshLength, nullptr, 0, BusPriority::High);
+        scheduler.submit(transaction);
+        while (transaction.isPending()) {
+            ThisThread::yield();
+        }
+        waits.push_back(transaction.getQueueWait().count());
+        ThisThread::sleep_for(1ms);
+    }
+    for (uint8_t index = 0; index < kNbrOfSensors; index++) {
+        sensorTraffic[index].stop();
+    }
+
+    std::sort(waits.begin(), waits.end());
+    const std::chrono::microseconds averageSensorWait =
+        scheduler.getAverageQueueWait(BusPriority::Low);
+    printf("latency (%u queued sensor reads of %" PRIu64
+           " us): refresh wait p50 %" PRId64 " us, p99 %" PRId64 " us, max %" PRId64
+           " us, sensor read wait average %" PRIu64 " us\n",
+           kNbrOfSensors,
+           static_cast<uint64_t>(bus.getTransferTime(1, kReadLength).count()),
+           waits[waits.size() / 2],
+           waits[(waits.size() * 99) / 100],
+           waits.back(),
+           static_cast<uint64_t>(averageSensorWait.count()));
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    uint32_t nbrOfTransactions = 20000;
+    uint32_t byteTime          = 10;
+    int option                 = 0;
+    while ((option = getopt(argc, argv, "n:b:")) != -1) {
+        if (option == 'n') {
+            nbrOfTransactions = static_cast<uint32_t>(strtoul(optarg, nullptr, 10));
+        } else if (option == 'b') {
+            byteTime = static_cast<uint32_t>(strtoul(optarg, nullptr, 10));
+        } else {
+            printf("Usage: %s [-n <number of transactions>] [-b <byte time in us>]\n",
+                   argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    if (nbrOfTransactions < kNbrOfThreads) {
+        return EXIT_FAILURE;
+    }
+
+    benchmarkThroughput(std::chrono::microseconds(byteTime), nbrOfTransactions);
+    benchmarkLatency(std::chrono::microseconds(byteTime));
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,201 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file deferred_log_benchmark.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Host benchmark of the deferred log (cost of a log call site)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include <unistd.h>
+
+#include <chrono>
+#include <cinttypes>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "deferred_log.hpp"
+#include "fixed_point_format.hpp"
+
+using bike_computer::DeferredLog;
+using bike_computer::deferredLog;
+using bike_computer::formatFloat;
+using bike_computer::kMaxFormattedSize;
+using bike_computer::kMaxNbrOfDecimals;
+using bike_computer::LogFormatId;
+
+namespace {
+
+// time stamp counter on x86 (reference cycles), nanoseconds otherwise
+uint64_t getCycles() {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+#endif
+}
+
+// the outputs are summed so that the formatting cannot be optimized away
+volatile uint32_t gChecksum = 0;
+
+void sumFrame(const uint8_t* data, size_t size) {
+    uint32_t sum = gChecksum;
+    for (size_t index = 0; index < size; index++) {
+        sum = sum * 31 + data[index];
+    }
+    gChecksum = sum;
+}
+
+// the records are logged by batches, so that the ring never overflows
+constexpr uint32_t kBatchSize = DeferredLog::kNbrOfRecords / 2;
+
+struct Measure {
+    uint64_t cycles     = 0;
+    uint64_t nsTime     = 0;
+    uint32_t nbrOfCalls = 0;
+
+    void print(const char* name) const {
+        printf("%-34s %8.1f cycles/record %8.1f ns/record\n",
+               name,
+               static_cast<double>(cycles) / nbrOfCalls,
+               static_cast<double>(nsTime) / nbrOfCalls);
+    }
+};
+
+// the arguments of the distance record of the Speedometer
+float getTotalDistance(uint32_t index) { return 0.001f * index; }
+float getDistance(uint32_t index) { return 0.0001f * (index % 100); }
+float getSpeed(uint32_t index) { return 20.0f + 0.01f * (index % 1000); }
+
+template <typename Function>
+void measureBatch(Measure& measure,  // NOLINT(runtime/references)
+                  uint32_t firstIndex,
+                  Function function) {
+    const auto startTime       = std::chrono::steady_clock::now();
+    const uint64_t startCycles = getCycles();
+    for (uint32_t index = firstIndex; index < firstIndex + kBatchSize; index++) {
+        function(index);
+    }
+    measure.cycles += getCycles() - startCycles;
+    measure.nsTime += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                          std::chrono::steady_clock::now() - startTime)
+                          .count();
+    measure.nbrOfCalls += kBatchSize;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    uint32_t nbrOfRecords = 1000000;
+    int option            = 0;
+    while ((option = getopt(argc, argv, "n:")) != -1) {
+        if (option == 'n') {
+            nbrOfRecords = static_cast<uint32_t>(strtoul(optarg, nullptr, 10));
+        } else {
+            printf("Usage: %s [-n <number of records>]\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    if (nbrOfRecords < kBatchSize) {
+        return EXIT_FAILURE;
+    }
+
+    // the log thread is not started, the ring being drained by the benchmark
+    DeferredLog& log = DeferredLog::getInstance();
+    log.setSink(callback(sumFrame));
+
+    Measure printfMeasure;
+    Measure formatFloatMeasure;
+    Measure deferredLogMeasure;
+    Measure drainMeasure;
+    char text[128];
+    for (uint32_t firstIndex = 0; firstIndex + kBatchSize <= nbrOfRecords;
+         firstIndex += kBatchSize) {
+        // formatting done by tr_debug (without the console output)
+        measureBatch(printfMeasure, firstIndex, [&](uint32_t index) {
+            const int length =
+                snprintf(text,
+                         sizeof(text),
+                         "Total distance %f, distance %f, speed %f, elapsed time %u",
+                         static_cast<double>(getTotalDistance(index)),
+                         static_cast<double>(getDistance(index)),
+                         static_cast<double>(getSpeed(index)),
+                         static_cast<unsigned>(index));
+            sumFrame(reinterpret_cast<const uint8_t*>(text), static_cast<size_t>(length));
+        });
+        // floats formatted without printf before calling tr_debug
+        measureBatch(formatFloatMeasure, firstIndex, [&](uint32_t index) {
+            char totalDistanceText[kMaxFormattedSize];
+            char distanceText[kMaxFormattedSize];
+            char speedText[kMaxFormattedSize];
+            formatFloat(totalDistanceText,
+                        sizeof(totalDistanceText),
+                        getTotalDistance(index),
+                        kMaxNbrOfDecimals);
+            formatFloat(distanceText,
+                        sizeof(distanceText),
+                        getDistance(index),
+                        kMaxNbrOfDecimals);
+            formatFloat(speedText, sizeof(speedText), getSpeed(index), kMaxNbrOfDecimals);
+            const int length =
+                snprintf(text,
+                         sizeof(text),
+                         "Total distance %s, distance %s, speed %s, elapsed time %u",
+                         totalDistanceText,
+                         distanceText,
+                         speedText,
+                         static_cast<unsigned>(index));
+            sumFrame(reinterpret_cast<const uint8_t*>(text), static_cast<size_t>(length));
+        });
+        // deferred log call site
+        measureBatch(deferredLogMeasure, firstIndex, [&](uint32_t index) {
+            deferredLog<LogFormatId::SpeedometerDistance>(
+                getTotalDistance(index), getDistance(index), getSpeed(index), index);
+        });
+        // cost of the log thread (frame encoding), per record
+        const auto startTime       = std::chrono::steady_clock::now();
+        const uint64_t startCycles = getCycles();
+        log.flush();
+        drainMeasure.cycles += getCycles() - startCycles;
+        drainMeasure.nsTime += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                   std::chrono::steady_clock::now() - startTime)
+                                   .count();
+        drainMeasure.nbrOfCalls += kBatchSize;
+    }
+
+#if defined(__x86_64__) || defined(__i386__)
+    printf("Cycles are time stamp counter cycles\n");
+#else
+    printf("Cycles are nanoseconds (no cycle counter)\n");
+#endif
+    printfMeasure.print("snprintf (tr_debug formatting)");
+    formatFloatMeasure.print("formatFloat and snprintf");
+    deferredLogMeasure.print("deferredLog (call site)");
+    drainMeasure.print("deferred log drain (log thread)");
+    printf("%" PRIu32 " records written, %" PRIu32 " dropped, %" PRIu32 " frames sent\n",
+           log.getNbrOfWrittenRecords(),
+           log.getNbrOfDroppedRecords(),
+           log.getNbrOfSentFrames());
+    return (log.getNbrOfDroppedRecords() == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,136 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/****************************************************************************
+ * @file fixed_point_format_benchmark.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Formatting time of the display and log values (fixed-point vs printf)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include <unistd.h>
+
+#include <chrono>
+#include <cinttypes>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+#include "fixed_point_format.hpp"
+
+using bike_computer::formatFixedPoint;
+using bike_computer::formatFloat;
+using bike_computer::kMaxFormattedSize;
+
+namespace {
+
+// fields formatted by the display and the logs, with their resolution and range
+struct Field {
+    const char* name;
+    uint8_t nbrOfDecimals;
+    float minValue;
+    float maxValue;
+};
+constexpr uint8_t kNbrOfFields        = 4;
+constexpr Field kFields[kNbrOfFields] = {{"speed", 1, 0.0f, 80.0f},
+                                         {"distance", 2, 0.0f, 500.0f},
+                                         {"temperature", 1, -20.0f, 45.0f},
+                                         {"log", 6, 0.0f, 100.0f}};
+
+// the texts are summed so that the formatting cannot be optimized away
+volatile uint32_t gChecksum = 0;
+
+uint32_t checksum(const char* text, uint32_t length) {
+    uint32_t sum = length;
+    for (; *text != '\0'; text++) {
+        sum = sum * 31 + static_cast<uint8_t>(*text);
+    }
+    return sum;
+}
+
+template <typename Function>
+double measure(uint32_t nbrOfValues, Function function) {
+    uint32_t sum         = 0;
+    const auto startTime = std::chrono::steady_clock::now();
+    for (uint32_t index = 0; index < nbrOfValues; index++) {
+        sum += function(index);
+    }
+    gChecksum = gChecksum + sum;
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() -
+                                                    startTime)
+               .count() /
+           nbrOfValues;
+}
+
+void benchmark(const Field& field, uint32_t nbrOfValues) {
+    const float step = (field.maxValue - field.minValue) / nbrOfValues;
+    char text[kMaxFormattedSize];
+
+    const double printfTime = measure(nbrOfValues, [&](uint32_t index) {
+        const float value = field.minValue + step * index;
+        const int length  = snprintf(text,
+                                    sizeof(text),
+                                    "%.*f",
+                                    static_cast<int>(field.nbrOfDecimals),
+                                    static_cast<double>(value));
+        return checksum(text, static_cast<uint32_t>(length));
+    });
+    const double floatTime = measure(nbrOfValues, [&](uint32_t index) {
+        const float value = field.minValue + step * index;
+        return checksum(text,
+                        formatFloat(text, sizeof(text), value, field.nbrOfDecimals));
+    });
+    // values already held in fixed point, as the temperature samples
+    const double fixedPointTime = measure(nbrOfValues, [&](uint32_t index) {
+        const int32_t value = static_cast<int32_t>(index);
+        return checksum(text,
+                        formatFixedPoint(text, sizeof(text), value, field.nbrOfDecimals));
+    });
+
+    printf("%-12s printf %7.1f ns/value, formatFloat %6.1f ns/value (x%.1f), "
+           "formatFixedPoint %6.1f ns/value (x%.1f)\n",
+           field.name,
+           printfTime,
+           floatTime,
+           printfTime / floatTime,
+           fixedPointTime,
+           printfTime / fixedPointTime);
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    uint32_t nbrOfValues = 1000000;
+    int option           = 0;
+    while ((option = getopt(argc, argv, "n:")) != -1) {
+        if (option == 'n') {
+            nbrOfValues = static_cast<uint32_t>(strtoul(optarg, nullptr, 10));
+        } else {
+            printf("Usage: %s [-n <number of values>]\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    if (nbrOfValues == 0) {
+        return EXIT_FAILURE;
+    }
+
+    for (uint8_t index = 0; index < kNbrOfFields; index++) {
+        benchmark(kFields[index], nbrOfValues);
+    }
+    return EXIT_SUCCESS;
+}
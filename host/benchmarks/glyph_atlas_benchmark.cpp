@@ -0,0 +1,165 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/****************************************************************************
+ * @file glyph_atlas_benchmark.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Rendering time of the numeric fields (glyph atlas vs generic font path)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+#include "frame_buffer.hpp"
+#include "glyph_atlas.hpp"
+#include "memory_display_backend.hpp"
+
+using bike_computer::BaseFont;
+using bike_computer::FrameBuffer;
+using bike_computer::kLargeGlyphAtlas;
+using bike_computer::kSmallGlyphAtlas;
+using bike_computer::MemoryDisplayBackend;
+using bike_computer::Rectangle;
+
+namespace {
+
+constexpr uint16_t kWidth      = 320;
+constexpr uint16_t kHeight     = 240;
+constexpr uint16_t kForeground = 0xFFFF;
+constexpr uint16_t kBackground = 0x0000;
+
+uint16_t gPixels[kWidth * kHeight];
+uint16_t gScreen[kWidth * kHeight];
+
+// generic font path (reference): the base font is scaled at runtime, each font pixel
+// being drawn as a scale x scale rectangle
+uint16_t drawGenericText(FrameBuffer& frameBuffer,
+                         uint8_t scale,
+                         uint16_t x,
+                         uint16_t y,
+                         const char* text) {
+    const uint16_t startX = x;
+    for (; *text != '\0'; text++) {
+        uint8_t index = BaseFont::getGlyphIndex(*text);
+        if (index == BaseFont::kNbrOfGlyphs) {
+            index = BaseFont::getGlyphIndex(' ');
+        }
+        Rectangle cell;
+        cell.x      = x;
+        cell.y      = y;
+        cell.width  = (BaseFont::kWidth + 1) * scale;
+        cell.height = BaseFont::kHeight * scale;
+        frameBuffer.fillRectangle(cell, kBackground);
+        for (uint8_t row = 0; row < BaseFont::kHeight; row++) {
+            for (uint8_t column = 0; column < BaseFont::kWidth; column++) {
+                if ((BaseFont::kRows[index][row] & (0x10 >> column)) != 0) {
+                    Rectangle pixel;
+                    pixel.x      = x + column * scale;
+                    pixel.y      = y + row * scale;
+                    pixel.width  = scale;
+                    pixel.height = scale;
+                    frameBuffer.fillRectangle(pixel, kForeground);
+                }
+            }
+        }
+        x += cell.width;
+    }
+    return x - startX;
+}
+
+// fields of the dashboard and their values
+struct Field {
+    const char* name;
+    bool isLarge;
+    const char* texts[4];
+};
+constexpr uint8_t kNbrOfFields        = 4;
+constexpr Field kFields[kNbrOfFields] = {
+    {"gear", false, {"1", "2", "3", "4"}},
+    {"speed", true, {"25.3", "25.4", "26.0", "9.8"}},
+    {"distance", false, {"12.34km", "12.35km", "12.36km", "12.37km"}},
+    {"temperature", false, {"21.5C", "21.6C", "-3.2C", "21.7C"}}};
+
+// the rendering into the frame buffer is measured, the flush is not
+void benchmark(const Field& field, uint32_t nbrOfRenders) {
+    MemoryDisplayBackend backend(gScreen, kWidth, kHeight);
+    FrameBuffer frameBuffer(gPixels, kWidth, kHeight, backend);
+
+    uint32_t width = 0;
+    auto startTime = std::chrono::steady_clock::now();
+    for (uint32_t render = 0; render < nbrOfRenders; render++) {
+        const char* text = field.texts[render % 4];
+        width += field.isLarge ? kLargeGlyphAtlas.drawText(
+                                     frameBuffer, 0, 0, text, kForeground, kBackground)
+                               : kSmallGlyphAtlas.drawText(
+                                     frameBuffer, 0, 0, text, kForeground, kBackground);
+    }
+    const double atlasTime = std::chrono::duration<double, std::micro>(
+                                 std::chrono::steady_clock::now() - startTime)
+                                 .count() /
+                             nbrOfRenders;
+
+    startTime = std::chrono::steady_clock::now();
+    for (uint32_t render = 0; render < nbrOfRenders; render++) {
+        width += drawGenericText(
+            frameBuffer, field.isLarge ? 4 : 2, 0, 0, field.texts[render % 4]);
+    }
+    const double genericTime = std::chrono::duration<double, std::micro>(
+                                   std::chrono::steady_clock::now() - startTime)
+                                   .count() /
+                               nbrOfRenders;
+
+    printf("%-12s glyph atlas %7.3f us/field, generic font %7.3f us/field (x%.1f, "
+           "%" PRIu32 " pixels wide)\n",
+           field.name,
+           atlasTime,
+           genericTime,
+           genericTime / atlasTime,
+           width / (2 * nbrOfRenders));
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    uint32_t nbrOfRenders = 100000;
+    int option            = 0;
+    while ((option = getopt(argc, argv, "n:")) != -1) {
+        if (option == 'n') {
+            nbrOfRenders = static_cast<uint32_t>(strtoul(optarg, nullptr, 10));
+        } else {
+            printf("Usage: %s [-n <number of renders>]\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    if (nbrOfRenders == 0) {
+        return EXIT_FAILURE;
+    }
+
+    printf("Glyph atlas: %u bytes (small), %u bytes (large) in flash\n",
+           static_cast<unsigned>(sizeof(kSmallGlyphAtlas)),
+           static_cast<unsigned>(sizeof(kLargeGlyphAtlas)));
+    for (uint8_t index = 0; index < kNbrOfFields; index++) {
+        benchmark(kFields[index], nbrOfRenders);
+    }
+    return EXIT_SUCCESS;
+}
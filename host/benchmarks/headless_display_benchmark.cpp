@@ -0,0 +1,158 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/****************************************************************************
+ * @file headless_display_benchmark.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Rendering cost of a ride on the headless display (all fields vs changed
+ * fields)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include <unistd.h>
+
+#include <cinttypes>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "constants.hpp"
+#include "fixed_point_format.hpp"
+#include "headless_display_device.hpp"
+
+using bike_computer::formatFloat;
+using bike_computer::HeadlessDisplayDevice;
+using bike_computer::kDistanceDecimals;
+using bike_computer::kGearDecimals;
+using bike_computer::kMaxFormattedSize;
+using bike_computer::kSpeedDecimals;
+using bike_computer::kTemperatureDecimals;
+
+namespace {
+
+constexpr uint32_t kNbrOfPixels =
+    HeadlessDisplayDevice::kWidth * HeadlessDisplayDevice::kHeight;
+uint16_t gPixels[kNbrOfPixels];
+uint16_t gScreen[kNbrOfPixels];
+
+// ride state at each frame (one frame per display refresh)
+struct RideState {
+    uint8_t gear;
+    float speed;
+    float distance;
+    float temperature;
+};
+
+RideState getRideState(uint32_t frame) {
+    RideState rideState;
+    rideState.gear        = 1 + (frame / 50) % 9;
+    rideState.speed       = 25.0f + static_cast<float>((frame * 7) % 40) / 10.0f;
+    rideState.distance    = static_cast<float>(frame) * 0.0045f;
+    rideState.temperature = 21.0f + static_cast<float>((frame / 20) % 10) / 10.0f;
+    return rideState;
+}
+
+// field drawn only if its text changed, as done by the DirtyFieldDisplay
+bool hasChanged(char* lastText, float value, uint8_t nbrOfDecimals) {
+    char text[kMaxFormattedSize];
+    formatFloat(text, sizeof(text), value, nbrOfDecimals);
+    if (strcmp(text, lastText) == 0) {
+        return false;
+    }
+    memcpy(lastText, text, sizeof(text));
+    return true;
+}
+
+void benchmark(const char* name,
+               bool changedFieldsOnly,
+               uint32_t nbrOfFrames,
+               const char* imagePath) {
+    HeadlessDisplayDevice displayDevice(gPixels, gScreen);
+    displayDevice.init();
+    displayDevice.endFrame();
+
+    char texts[4][kMaxFormattedSize] = {};
+    uint64_t nbrOfDrawCalls          = 0;
+    uint64_t nbrOfTouchedPixels      = 0;
+    uint64_t nbrOfFlushedPixels      = 0;
+    for (uint32_t frame = 0; frame < nbrOfFrames; frame++) {
+        const RideState rideState = getRideState(frame);
+        if (!changedFieldsOnly || hasChanged(texts[0], rideState.gear, kGearDecimals)) {
+            displayDevice.displayGear(rideState.gear);
+        }
+        if (!changedFieldsOnly || hasChanged(texts[1], rideState.speed, kSpeedDecimals)) {
+            displayDevice.displaySpeed(rideState.speed);
+        }
+        if (!changedFieldsOnly ||
+            hasChanged(texts[2], rideState.distance, kDistanceDecimals)) {
+            displayDevice.displayDistance(rideState.distance);
+        }
+        if (!changedFieldsOnly ||
+            hasChanged(texts[3], rideState.temperature, kTemperatureDecimals)) {
+            displayDevice.displayTemperature(rideState.temperature);
+        }
+        displayDevice.endFrame();
+        const HeadlessDisplayDevice::FrameStats& frameStats =
+            displayDevice.getLastFrameStats();
+        nbrOfDrawCalls += frameStats.nbrOfDrawCalls;
+        nbrOfTouchedPixels += frameStats.nbrOfTouchedPixels;
+        nbrOfFlushedPixels += frameStats.nbrOfFlushedPixels;
+    }
+
+    // the initial frame is not accounted for in the averages
+    const uint32_t nbrOfRideFrames = displayDevice.getNbrOfFrames() - 1;
+    printf("%-16s %5.2f draw calls/frame, %7.0f touched pixels/frame, %7.0f flushed "
+           "pixels/frame, %3" PRIu64 " us/frame (max %" PRIu64 " us)\n",
+           name,
+           static_cast<double>(nbrOfDrawCalls) / nbrOfRideFrames,
+           static_cast<double>(nbrOfTouchedPixels) / nbrOfRideFrames,
+           static_cast<double>(nbrOfFlushedPixels) / nbrOfRideFrames,
+           static_cast<uint64_t>(displayDevice.getAverageFrameTime().count()),
+           static_cast<uint64_t>(displayDevice.getMaxFrameTime().count()));
+
+    if (imagePath != nullptr && !displayDevice.dumpPpm(imagePath)) {
+        printf("Cannot write %s\n", imagePath);
+    }
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    uint32_t nbrOfFrames  = 10000;
+    const char* imagePath = nullptr;
+    int option            = 0;
+    while ((option = getopt(argc, argv, "n:o:")) != -1) {
+        if (option == 'n') {
+            nbrOfFrames = static_cast<uint32_t>(strtoul(optarg, nullptr, 10));
+        } else if (option == 'o') {
+            imagePath = optarg;
+        } else {
+            printf("Usage: %s [-n <number of frames>] [-o <last frame image (PPM)>]\n",
+                   argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    if (nbrOfFrames == 0) {
+        return EXIT_FAILURE;
+    }
+
+    benchmark("all fields", false, nbrOfFrames, nullptr);
+    benchmark("changed fields", true, nbrOfFrames, imagePath);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,555 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file micro_benchmarks.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Micro-benchmarks of the core components (JSON results, baseline comparison)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "mbed.h"
+#include "mbed_port/block_device.hpp"
+#include "mbed_port/mail.hpp"
+#include "mbed_port/queue.hpp"
+#include "mbed_trace.h"
+#include "my_candidate_applications.hpp"
+#include "speedometer.hpp"
+#include "task_logger.hpp"
+
+using advembsof::TaskLogger;
+using bike_computer::MyCandidateApplications;
+using bike_computer::Speedometer;
+
+namespace {
+
+// each benchmark is run several times and the fastest run is kept, since the slower
+// runs are the ones disturbed by the rest of the system
+constexpr uint8_t kNbrOfRepetitions  = 5;
+constexpr float kDefaultThreshold    = 25.0f;
+constexpr uint32_t kQueueSize        = 16;
+constexpr uint32_t kEventBatchSize   = 64;
+constexpr uint32_t kNbrOfSlots       = 4;
+constexpr mbed::bd_size_t kSlotSize  = 0x10000;
+constexpr uint32_t kHeaderSize       = 0x1000;
+constexpr mbed::bd_size_t kEraseSize = 0x1000;
+
+// the results are accumulated so that the measured operations cannot be optimized away
+volatile uint32_t gChecksum = 0;
+volatile float gFloatSink   = 0.0f;
+
+void addToChecksum(uint32_t value) { gChecksum = gChecksum + value; }
+void incrementChecksum() { addToChecksum(1); }
+
+struct Message {
+    uint32_t value;
+    uint32_t padding[3];
+};
+
+// a benchmark runs the number of operations given as argument and returns the number of
+// operations actually run, 0 meaning that the benchmark failed
+using BenchmarkFunction = uint32_t (*)(uint32_t nbrOfOperations);
+
+struct Benchmark {
+    const char* name;
+    BenchmarkFunction function;
+    // the slower benchmarks run fewer operations
+    uint32_t divider;
+};
+
+struct BenchmarkResult {
+    std::string name;
+    uint32_t nbrOfOperations;
+    double nsPerOperation;
+    double medianNsPerOperation;
+};
+
+// Speedometer: the setters compute the distance and the speed when the value changes
+
+uint32_t benchmarkSpeedometerSetRotationTime(uint32_t nbrOfOperations) {
+    Timer timer;
+    timer.start();
+    Speedometer speedometer(timer);
+    for (uint32_t index = 0; index < nbrOfOperations; index++) {
+        speedometer.setCurrentRotationTime((index & 1) ? 800ms : 900ms);
+    }
+    gFloatSink = speedometer.getCurrentSpeed();
+    return nbrOfOperations;
+}
+
+uint32_t benchmarkSpeedometerSetGearSize(uint32_t nbrOfOperations) {
+    Timer timer;
+    timer.start();
+    Speedometer speedometer(timer);
+    for (uint32_t index = 0; index < nbrOfOperations; index++) {
+        speedometer.setGearSize((index & 1) ? 15 : 16);
+    }
+    gFloatSink = speedometer.getCurrentSpeed();
+    return nbrOfOperations;
+}
+
+uint32_t benchmarkSpeedometerGetCurrentSpeed(uint32_t nbrOfOperations) {
+    Timer timer;
+    timer.start();
+    Speedometer speedometer(timer);
+    speedometer.setGearSize(15);
+    float speed = 0.0f;
+    for (uint32_t index = 0; index < nbrOfOperations; index++) {
+        speed += speedometer.getCurrentSpeed();
+    }
+    gFloatSink = speed;
+    return nbrOfOperations;
+}
+
+uint32_t benchmarkSpeedometerGetDistance(uint32_t nbrOfOperations) {
+    Timer timer;
+    timer.start();
+    Speedometer speedometer(timer);
+    speedometer.setGearSize(15);
+    float distance = 0.0f;
+    for (uint32_t index = 0; index < nbrOfOperations; index++) {
+        distance += speedometer.getDistance();
+    }
+    gFloatSink = distance;
+    return nbrOfOperations;
+}
+
+// TaskLogger: the enabled logger formats a trace, which is filtered by the trace level
+// (see main) so that the console output is not measured
+
+uint32_t runTaskLogger(uint32_t nbrOfOperations, bool isEnabled) {
+    Timer timer;
+    timer.start();
+    TaskLogger taskLogger;
+    taskLogger.enable(isEnabled);
+    for (uint32_t index = 0; index < nbrOfOperations; index++) {
+        taskLogger.logPeriodAndExecutionTime(
+            timer, index % TaskLogger::kNbrOfTasks, timer.elapsed_time());
+    }
+    addToChecksum(taskLogger.getComputationTime(0).count());
+    return nbrOfOperations;
+}
+
+uint32_t benchmarkTaskLoggerDisabled(uint32_t nbrOfOperations) {
+    return runTaskLogger(nbrOfOperations, false);
+}
+
+uint32_t benchmarkTaskLoggerEnabled(uint32_t nbrOfOperations) {
+    return runTaskLogger(nbrOfOperations, true);
+}
+
+// events versus callbacks: a posted event is called when the queue is dispatched, the
+// last event of each batch stops the dispatch
+
+uint32_t benchmarkCallbackCall(uint32_t nbrOfOperations) {
+    mbed::Callback<void()> callback(incrementChecksum);
+    for (uint32_t index = 0; index < nbrOfOperations; index++) {
+        callback();
+    }
+    return nbrOfOperations;
+}
+
+uint32_t benchmarkEventQueueCall(uint32_t nbrOfOperations) {
+    EventQueue eventQueue;
+    for (uint32_t index = 0; index < nbrOfOperations; index += kEventBatchSize) {
+        for (uint32_t event = 0; event < kEventBatchSize; event++) {
+            eventQueue.call(incrementChecksum);
+        }
+        eventQueue.call(callback(&eventQueue, &EventQueue::break_dispatch));
+        eventQueue.dispatch_forever();
+    }
+    return ((nbrOfOperations + kEventBatchSize - 1) / kEventBatchSize) * kEventBatchSize;
+}
+
+uint32_t benchmarkEventPost(uint32_t nbrOfOperations) {
+    EventQueue eventQueue;
+    Event<void()> event(&eventQueue, incrementChecksum);
+    for (uint32_t index = 0; index < nbrOfOperations; index += kEventBatchSize) {
+        for (uint32_t batchIndex = 0; batchIndex < kEventBatchSize; batchIndex++) {
+            event.post();
+        }
+        eventQueue.call(callback(&eventQueue, &EventQueue::break_dispatch));
+        eventQueue.dispatch_forever();
+    }
+    return ((nbrOfOperations + kEventBatchSize - 1) / kEventBatchSize) * kEventBatchSize;
+}
+
+// Queue and Mail versus the event queue: single thread put/get, then transfers between
+// a producer thread and a consumer blocked without timeout (as in basic-queue-test)
+
+uint32_t benchmarkQueuePutGet(uint32_t nbrOfOperations) {
+    Queue<uint32_t, kQueueSize> queue;
+    uint32_t message = 1;
+    for (uint32_t index = 0; index < nbrOfOperations; index++) {
+        uint32_t* value = nullptr;
+        if (!queue.try_put(&message) || !queue.try_get(&value)) {
+            return 0;
+        }
+        addToChecksum(*value);
+    }
+    return nbrOfOperations;
+}
+
+uint32_t benchmarkMailPutGet(uint32_t nbrOfOperations) {
+    Mail<Message, kQueueSize> mail;
+    for (uint32_t index = 0; index < nbrOfOperations; index++) {
+        Message* message = mail.try_alloc();
+        if (message == nullptr) {
+            return 0;
+        }
+        message->value = index;
+        mail.put(message);
+        message = mail.try_get();
+        if (message == nullptr) {
+            return 0;
+        }
+        addToChecksum(message->value);
+        mail.free(message);
+    }
+    return nbrOfOperations;
+}
+
+struct TransferArguments {
+    uint32_t nbrOfMessages;
+    Queue<uint32_t, 1>* queue;
+    Mail<Message, 1>* mail;
+    EventQueue* eventQueue;
+};
+
+void produceQueueMessages(TransferArguments* arguments) {
+    static uint32_t message = 1;
+    for (uint32_t index = 0; index < arguments->nbrOfMessages; index++) {
+        arguments->queue->try_put_for(Kernel::wait_for_u32_forever, &message);
+    }
+}
+
+void produceMailMessages(TransferArguments* arguments) {
+    for (uint32_t index = 0; index < arguments->nbrOfMessages; index++) {
+        Message* message = arguments->mail->try_alloc_for(Kernel::wait_for_u32_forever);
+        message->value   = index;
+        arguments->mail->put(message);
+    }
+}
+
+void produceEvents(TransferArguments* arguments) {
+    for (uint32_t index = 0; index < arguments->nbrOfMessages; index++) {
+        arguments->eventQueue->call(addToChecksum, index);
+    }
+    arguments->eventQueue->call(
+        callback(arguments->eventQueue, &EventQueue::break_dispatch));
+}
+
+uint32_t benchmarkQueueTransfer(uint32_t nbrOfOperations) {
+    Queue<uint32_t, 1> queue;
+    TransferArguments arguments = {nbrOfOperations, &queue, nullptr, nullptr};
+    Thread producer;
+    producer.start(callback(produceQueueMessages, &arguments));
+    for (uint32_t index = 0; index < nbrOfOperations; index++) {
+        uint32_t* value = nullptr;
+        queue.try_get_for(Kernel::wait_for_u32_forever, &value);
+        addToChecksum(*value);
+    }
+    producer.join();
+    return nbrOfOperations;
+}
+
+uint32_t benchmarkMailTransfer(uint32_t nbrOfOperations) {
+    Mail<Message, 1> mail;
+    TransferArguments arguments = {nbrOfOperations, nullptr, &mail, nullptr};
+    Thread producer;
+    producer.start(callback(produceMailMessages, &arguments));
+    for (uint32_t index = 0; index < nbrOfOperations; index++) {
+        Message* message = mail.try_get_for(Kernel::wait_for_u32_forever);
+        addToChecksum(message->value);
+        mail.free(message);
+    }
+    producer.join();
+    return nbrOfOperations;
+}
+
+// the event queue is not bounded on the host: the producer never waits for the consumer
+uint32_t benchmarkEventQueueTransfer(uint32_t nbrOfOperations) {
+    EventQueue eventQueue;
+    TransferArguments arguments = {nbrOfOperations, nullptr, nullptr, &eventQueue};
+    Thread producer;
+    producer.start(callback(produceEvents, &arguments));
+    eventQueue.dispatch_forever();
+    producer.join();
+    return nbrOfOperations;
+}
+
+// MyCandidateApplications: the headers of the candidates are read from a block device
+// simulated in memory, the expected slot is checked
+
+uint32_t runGetSlotForCandidate(uint32_t nbrOfOperations,
+                                const uint64_t firmwareVersions[kNbrOfSlots],
+                                uint32_t expectedSlotIndex) {
+    HeapBlockDevice blockDevice(kNbrOfSlots * kSlotSize, 1, 1, kEraseSize);
+    blockDevice.init();
+    MyCandidateApplications candidateApplications(
+        blockDevice, 0, kNbrOfSlots * kSlotSize, kHeaderSize, kNbrOfSlots);
+    for (uint32_t slotIndex = 0; slotIndex < kNbrOfSlots; slotIndex++) {
+        // a version 0 means that the slot is empty
+        if (firmwareVersions[slotIndex] != 0) {
+            candidateApplications.getBlockDeviceApplication(slotIndex).writeHeader(
+                firmwareVersions[slotIndex], kSlotSize - kHeaderSize);
+        }
+    }
+    for (uint32_t index = 0; index < nbrOfOperations; index++) {
+        const uint32_t slotIndex = candidateApplications.getSlotForCandidate();
+        if (slotIndex != expectedSlotIndex) {
+            fprintf(stderr,
+                    "Wrong slot for candidate: %" PRIu32 " instead of %" PRIu32 "\n",
+                    slotIndex,
+                    expectedSlotIndex);
+            return 0;
+        }
+    }
+    blockDevice.deinit();
+    return nbrOfOperations;
+}
+
+uint32_t benchmarkGetSlotForCandidateFree(uint32_t nbrOfOperations) {
+    static constexpr uint64_t kFirmwareVersions[kNbrOfSlots] = {3, 1, 2, 0};
+    return runGetSlotForCandidate(nbrOfOperations, kFirmwareVersions, 3);
+}
+
+uint32_t benchmarkGetSlotForCandidateOldest(uint32_t nbrOfOperations) {
+    static constexpr uint64_t kFirmwareVersions[kNbrOfSlots] = {3, 1, 4, 2};
+    return runGetSlotForCandidate(nbrOfOperations, kFirmwareVersions, 1);
+}
+
+const Benchmark kBenchmarks[] = {
+    {"speedometer_set_rotation_time", benchmarkSpeedometerSetRotationTime, 1},
+    {"speedometer_set_gear_size", benchmarkSpeedometerSetGearSize, 1},
+    {"speedometer_get_current_speed", benchmarkSpeedometerGetCurrentSpeed, 1},
+    {"speedometer_get_distance", benchmarkSpeedometerGetDistance, 1},
+    {"task_logger_disabled", benchmarkTaskLoggerDisabled, 1},
+    {"task_logger_enabled", benchmarkTaskLoggerEnabled, 1},
+    {"callback_call", benchmarkCallbackCall, 1},
+    {"event_queue_call", benchmarkEventQueueCall, 1},
+    {"event_post", benchmarkEventPost, 1},
+    {"queue_put_get", benchmarkQueuePutGet, 1},
+    {"mail_put_get", benchmarkMailPutGet, 1},
+    {"queue_transfer", benchmarkQueueTransfer, 10},
+    {"mail_transfer", benchmarkMailTransfer, 10},
+    {"event_queue_transfer", benchmarkEventQueueTransfer, 10},
+    {"get_slot_for_candidate_free", benchmarkGetSlotForCandidateFree, 10},
+    {"get_slot_for_candidate_oldest", benchmarkGetSlotForCandidateOldest, 10},
+};
+
+bool runBenchmark(const Benchmark& benchmark,
+                  uint32_t nbrOfOperations,
+                  BenchmarkResult& result) {  // NOLINT(runtime/references)
+    nbrOfOperations = std::max<uint32_t>(nbrOfOperations / benchmark.divider, 1);
+    std::vector<double> nsPerOperation;
+    uint32_t nbrOfRunOperations = 0;
+    for (uint8_t repetition = 0; repetition < kNbrOfRepetitions; repetition++) {
+        const auto startTime     = std::chrono::steady_clock::now();
+        nbrOfRunOperations       = benchmark.function(nbrOfOperations);
+        const double elapsedTime = std::chrono::duration<double, std::nano>(
+                                       std::chrono::steady_clock::now() - startTime)
+                                       .count();
+        if (nbrOfRunOperations == 0) {
+            return false;
+        }
+        nsPerOperation.push_back(elapsedTime / nbrOfRunOperations);
+    }
+    std::sort(nsPerOperation.begin(), nsPerOperation.end());
+    result.name                 = benchmark.name;
+    result.nbrOfOperations      = nbrOfRunOperations;
+    result.nsPerOperation       = nsPerOperation.front();
+    result.medianNsPerOperation = nsPerOperation[nsPerOperation.size() / 2];
+    return true;
+}
+
+void writeJson(FILE* file, const std::vector<BenchmarkResult>& results) {
+    fprintf(file, "{\n  \"repetitions\": %u,\n  \"benchmarks\": [\n", kNbrOfRepetitions);
+    for (size_t index = 0; index < results.size(); index++) {
+        fprintf(file,
+                "    {\"name\": \"%s\", \"operations\": %" PRIu32
+                ", \"ns_per_op\": %.3f, \"median_ns_per_op\": %.3f}%s\n",
+                results[index].name.c_str(),
+                results[index].nbrOfOperations,
+                results[index].nsPerOperation,
+                results[index].medianNsPerOperation,
+                (index + 1 < results.size()) ? "," : "");
+    }
+    fprintf(file, "  ]\n}\n");
+}
+
+// the baseline is a file written by this program: only the name and the ns_per_op
+// fields of each benchmark are read
+bool readBaseline(const char* fileName,
+                  std::vector<BenchmarkResult>& baseline) {  // NOLINT(runtime/references)
+    FILE* file = fopen(fileName, "r");
+    if (file == nullptr) {
+        fprintf(stderr, "Cannot open baseline %s\n", fileName);
+        return false;
+    }
+    std::string content;
+    char buffer[256];
+    size_t size = 0;
+    while ((size = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+        content.append(buffer, size);
+    }
+    fclose(file);
+
+    static const char kNameKey[]           = "\"name\": \"";
+    static const char kNsPerOperationKey[] = "\"ns_per_op\": ";
+    size_t position                        = content.find(kNameKey);
+    while (position != std::string::npos) {
+        const size_t nameStart = position + strlen(kNameKey);
+        const size_t nameEnd   = content.find('"', nameStart);
+        const size_t valueKey  = content.find(kNsPerOperationKey, nameStart);
+        if (nameEnd == std::string::npos || valueKey == std::string::npos) {
+            fprintf(stderr, "Invalid baseline %s\n", fileName);
+            return false;
+        }
+        BenchmarkResult result = {};
+        result.name            = content.substr(nameStart, nameEnd - nameStart);
+        result.nsPerOperation =
+            strtod(content.c_str() + valueKey + strlen(kNsPerOperationKey), nullptr);
+        baseline.push_back(result);
+        position = content.find(kNameKey, nameEnd);
+    }
+    return true;
+}
+
+// returns the number of regressions, that is of benchmarks slower than the baseline by
+// more than the threshold (in percent)
+uint32_t compareWithBaseline(const std::vector<BenchmarkResult>& results,
+                             const std::vector<BenchmarkResult>& baseline,
+                             float threshold) {
+    uint32_t nbrOfRegressions = 0;
+    for (const BenchmarkResult& result : results) {
+        auto reference = std::find_if(
+            baseline.begin(), baseline.end(), [&result](const BenchmarkResult& other) {
+                return other.name == result.name;
+            });
+        if (reference == baseline.end() || reference->nsPerOperation <= 0.0) {
+            fprintf(stderr,
+                    "%-32s %12.3f ns/op (not in baseline)\n",
+                    result.name.c_str(),
+                    result.nsPerOperation);
+            continue;
+        }
+        const double change =
+            (result.nsPerOperation / reference->nsPerOperation - 1.0) * 100.0;
+        const bool isRegression = change > threshold;
+        if (isRegression) {
+            nbrOfRegressions++;
+        }
+        fprintf(stderr,
+                "%-32s %12.3f ns/op (baseline %12.3f ns/op, %+7.1f%%)%s\n",
+                result.name.c_str(),
+                result.nsPerOperation,
+                reference->nsPerOperation,
+                change,
+                isRegression ? " REGRESSION" : "");
+    }
+    fprintf(stderr,
+            "%" PRIu32 " regression(s) over %.1f%%\n",
+            nbrOfRegressions,
+            static_cast<double>(threshold));
+    return nbrOfRegressions;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    uint32_t nbrOfOperations = 100000;
+    const char* outputName   = nullptr;
+    const char* baselineName = nullptr;
+    const char* filter       = nullptr;
+    float threshold          = kDefaultThreshold;
+    int option               = 0;
+    while ((option = getopt(argc, argv, "n:o:b:t:f:")) != -1) {
+        if (option == 'n') {
+            nbrOfOperations = static_cast<uint32_t>(strtoul(optarg, nullptr, 10));
+        } else if (option == 'o') {
+            outputName = optarg;
+        } else if (option == 'b') {
+            baselineName = optarg;
+        } else if (option == 't') {
+            threshold = strtof(optarg, nullptr);
+        } else if (option == 'f') {
+            filter = optarg;
+        } else {
+            printf("Usage: %s [-n <number of operations>] [-o <json output file>]"
+                   " [-b <baseline json file>] [-t <regression threshold in %%>]"
+                   " [-f <benchmark name filter>]\n",
+                   argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    if (nbrOfOperations == 0) {
+        return EXIT_FAILURE;
+    }
+
+    std::vector<BenchmarkResult> baseline;
+    if (baselineName != nullptr && !readBaseline(baselineName, baseline)) {
+        return EXIT_FAILURE;
+    }
+
+    // the traces would be measured and mixed with the results
+    mbed_trace_config_set(TRACE_ACTIVE_LEVEL_NONE);
+
+    std::vector<BenchmarkResult> results;
+    for (const Benchmark& benchmark : kBenchmarks) {
+        if (filter != nullptr && strstr(benchmark.name, filter) == nullptr) {
+            continue;
+        }
+        BenchmarkResult result = {};
+        if (!runBenchmark(benchmark, nbrOfOperations, result)) {
+            fprintf(stderr, "Benchmark %s failed\n", benchmark.name);
+            return EXIT_FAILURE;
+        }
+        results.push_back(result);
+    }
+
+    FILE* output = stdout;
+    if (outputName != nullptr) {
+        output = fopen(outputName, "w");
+        if (output == nullptr) {
+            fprintf(stderr, "Cannot open %s\n", outputName);
+            return EXIT_FAILURE;
+        }
+    }
+    writeJson(output, results);
+    if (output != stdout) {
+        fclose(output);
+    }
+
+    if (baselineName != nullptr &&
+        compareWithBaseline(results, baseline, threshold) > 0) {
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,137 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file sensor_filter_benchmark.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Host benchmark of the sensor filtering pipeline (cycles per sample)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "sensor_filter.hpp"
+
+using bike_computer::IirFilter;
+using bike_computer::MedianFilter;
+using bike_computer::SensorPipeline;
+
+namespace {
+
+// floating point first order IIR filter, used as reference
+class FloatIirFilter {
+   public:
+    void reset(int32_t sample) { _state = static_cast<float>(sample); }
+    int32_t filter(int32_t sample) {
+        _state += (static_cast<float>(sample) - _state) * 0.25f;
+        return static_cast<int32_t>(_state + 0.5f);
+    }
+
+   private:
+    float _state = 0.0f;
+};
+
+// time stamp counter on x86 (reference cycles), nanoseconds otherwise
+uint64_t getCycles() {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+#endif
+}
+
+// noisy temperature samples in hundredths of degrees, generated beforehand
+constexpr uint32_t kNbrOfInputSamples = 4096;
+int32_t gInputSamples[kNbrOfInputSamples];
+
+void generateInputSamples() {
+    uint32_t seed = 1;
+    for (uint32_t index = 0; index < kNbrOfInputSamples; index++) {
+        // linear congruential generator, noise of +/- 10 hundredths of degrees
+        seed                 = seed * 1664525u + 1013904223u;
+        gInputSamples[index] = 2200 + static_cast<int32_t>((seed >> 16) % 21) - 10;
+    }
+}
+
+template <typename Pipeline>
+void benchmark(const char* name, uint8_t oversamplingRatio, uint32_t nbrOfSamples) {
+    Pipeline pipeline(oversamplingRatio);
+    int64_t sum = 0;
+
+    const auto startTime       = std::chrono::steady_clock::now();
+    const uint64_t startCycles = getCycles();
+    for (uint32_t sample = 0; sample < nbrOfSamples; sample++) {
+        if (pipeline.push(gInputSamples[sample % kNbrOfInputSamples])) {
+            sum += pipeline.getOutput();
+        }
+    }
+    const uint64_t cycles  = getCycles() - startCycles;
+    const auto elapsedTime = std::chrono::steady_clock::now() - startTime;
+
+    const double nsPerSample =
+        std::chrono::duration<double, std::nano>(elapsedTime).count() / nbrOfSamples;
+    const double cyclesPerSample = static_cast<double>(cycles) / nbrOfSamples;
+    const double mean = static_cast<double>(sum) / pipeline.getNbrOfOutputs() / 100.0;
+    printf("%-28s ratio %2u: %7.2f cycles/sample %7.2f ns/sample (mean %.2f C)\n",
+           name,
+           oversamplingRatio,
+           cyclesPerSample,
+           nsPerSample,
+           mean);
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    uint32_t nbrOfSamples = 10000000;
+    int option            = 0;
+    while ((option = getopt(argc, argv, "n:")) != -1) {
+        if (option == 'n') {
+            nbrOfSamples = static_cast<uint32_t>(strtoul(optarg, nullptr, 10));
+        } else {
+            printf("Usage: %s [-n <number of samples>]\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    if (nbrOfSamples == 0) {
+        return EXIT_FAILURE;
+    }
+
+    generateInputSamples();
+#if defined(__x86_64__) || defined(__i386__)
+    printf("Cycles are time stamp counter cycles\n");
+#else
+    printf("Cycles are nanoseconds (no cycle counter)\n");
+#endif
+    benchmark<SensorPipeline<FloatIirFilter, 16>>("float IIR (reference)", 1,
+                                                  nbrOfSamples);
+    benchmark<SensorPipeline<IirFilter<2>, 16>>("fixed-point IIR", 1, nbrOfSamples);
+    benchmark<SensorPipeline<IirFilter<2>, 16>>("fixed-point IIR", 16, nbrOfSamples);
+    benchmark<SensorPipeline<MedianFilter<5>, 16>>("median of 5", 1, nbrOfSamples);
+    benchmark<SensorPipeline<MedianFilter<5>, 16>>("median of 5", 16, nbrOfSamples);
+    return EXIT_SUCCESS;
+}
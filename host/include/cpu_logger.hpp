@@ -0,0 +1,49 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file cpu_logger.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief CPU logger of the advembsof library (host port layer)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include "mbed.h"
+
+namespace advembsof {
+
+class CPULogger {
+   public:
+    explicit CPULogger(Timer& timer);  // NOLINT(runtime/references)
+
+    // make the class non copyable
+    CPULogger(CPULogger&)            = delete;
+    CPULogger& operator=(CPULogger&) = delete;
+
+    // method printing the cpu load since the last call
+    void printStats();
+
+   private:
+    // data members
+    Timer& _timer;
+    uint64_t _lastUptime   = 0;
+    uint64_t _lastIdleTime = 0;
+};
+
+}  // namespace advembsof
@@ -0,0 +1,63 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file display_device.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Simulated display device of the advembsof library (host port layer)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include "mbed.h"
+#include "return_code.hpp"
+
+namespace advembsof {
+
+// display printing the displayed values as traces
+class DisplayDevice {
+   public:
+    DisplayDevice() = default;
+
+    // make the class non copyable
+    DisplayDevice(DisplayDevice&)            = delete;
+    DisplayDevice& operator=(DisplayDevice&) = delete;
+
+    disco::ReturnCode init();
+
+    void displayGear(uint8_t gear);
+    void displaySpeed(float speed);
+    void displayDistance(float distance);
+    void displayTemperature(float temperature);
+
+    // host only: last displayed values
+    uint8_t getDisplayedGear() const;
+    float getDisplayedSpeed() const;
+    float getDisplayedDistance() const;
+    float getDisplayedTemperature() const;
+
+   private:
+    // data members
+    bool _isInitialized = false;
+    uint8_t _gear       = 0;
+    float _speed        = 0.0f;
+    float _distance     = 0.0f;
+    float _temperature  = 0.0f;
+};
+
+}  // namespace advembsof
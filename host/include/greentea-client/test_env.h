@@ -0,0 +1,31 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file test_env.h
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief greentea client of the host test harness (host port layer)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include <cstdio>
+
+// there is no greentea host on the host: the timeout of the suite is enforced by ctest
+#define GREENTEA_SETUP(timeout, hostTest) \
+    printf("{{timeout;%d}}\n{{host_test_name;%s}}\n", (timeout), (hostTest))
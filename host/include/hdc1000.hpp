@@ -0,0 +1,57 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file hdc1000.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief HDC1000 sensor driver of the advembsof library (host port layer)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include <chrono>
+
+#include "mbed.h"
+
+namespace advembsof {
+
+// HDC1000 driver using the simulated sensor attached to the I2C bus (see
+// host::SimulatedHDC1000): each measurement is triggered and read once converted, the
+// calling thread being blocked during the conversion
+class HDC1000 {
+   public:
+    HDC1000(PinName sda, PinName scl, PinName dataReady);
+
+    // make the class non copyable
+    HDC1000(HDC1000&)            = delete;
+    HDC1000& operator=(HDC1000&) = delete;
+
+    bool probe();
+    float getTemperature();
+    float getHumidity();
+
+   private:
+    // private methods
+    bool readRegister(uint8_t pointer, uint16_t& value);  // NOLINT(runtime/references)
+    uint16_t measure(uint8_t pointer);
+
+    // data members
+    I2C _i2c;
+};
+
+}  // namespace advembsof
@@ -0,0 +1,73 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file joystick.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Simulated joystick of the disco_h747i wrappers (host port layer)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include "mbed.h"
+#include "return_code.hpp"
+
+namespace disco {
+
+class Joystick {
+   public:
+    enum class State {
+        NotPressed = 0,
+        UpPressed,
+        DownPressed,
+        LeftPressed,
+        RightPressed,
+        SelPressed
+    };
+
+    static Joystick& getInstance();
+
+    // make the class non copyable
+    Joystick(Joystick&)            = delete;
+    Joystick& operator=(Joystick&) = delete;
+
+    ReturnCode init();
+    State getState();
+
+    // the callbacks are called upon a press, in interrupt context on the target
+    void setUpCallback(mbed::Callback<void()> callback);
+    void setDownCallback(mbed::Callback<void()> callback);
+    void setLeftCallback(mbed::Callback<void()> callback);
+    void setRightCallback(mbed::Callback<void()> callback);
+    void setSelCallback(mbed::Callback<void()> callback);
+
+    // host only: change the simulated state, the callback of a pressed direction
+    // being called from the calling thread
+    void setSimulatedState(State state);
+
+   private:
+    Joystick() = default;
+
+    // data members
+    static constexpr uint8_t kNbrOfStates = 6;
+    Mutex _mutex;
+    volatile uint8_t _state = static_cast<uint8_t>(State::NotPressed);
+    mbed::Callback<void()> _callbacks[kNbrOfStates];
+};
+
+}  // namespace disco
@@ -0,0 +1,54 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file mbed.h
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Subset of the mbed OS 6 API used by the bike computer (host port layer)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include <chrono>
+#include <cinttypes>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+#include "mbed_port/callback.hpp"
+#include "mbed_port/event_queue.hpp"
+#include "mbed_port/i2c.hpp"
+#include "mbed_port/interrupt_in.hpp"
+#include "mbed_port/kernel.hpp"
+#include "mbed_port/mail.hpp"
+#include "mbed_port/mem_trace.hpp"
+#include "mbed_port/memory_pool.hpp"
+#include "mbed_port/mutex.hpp"
+#include "mbed_port/pin_names.hpp"
+#include "mbed_port/platform.hpp"
+#include "mbed_port/queue.hpp"
+#include "mbed_port/semaphore.hpp"
+#include "mbed_port/thread.hpp"
+#include "mbed_port/ticker.hpp"
+#include "mbed_port/timer.hpp"
+
+// same global using directives as mbed OS
+using namespace mbed;
+using namespace rtos;
+using namespace events;
+using namespace std::chrono_literals;
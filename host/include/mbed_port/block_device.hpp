@@ -0,0 +1,111 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file block_device.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief mbed::BlockDevice and mbed::HeapBlockDevice for the host port layer
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+namespace mbed {
+
+typedef uint64_t bd_addr_t;
+typedef uint64_t bd_size_t;
+
+// error codes as defined by mbed OS
+enum bd_error {
+    BD_ERROR_OK           = 0,
+    BD_ERROR_DEVICE_ERROR = -4001,
+};
+
+// block device interface, as the mbed one
+class BlockDevice {
+   public:
+    virtual ~BlockDevice() = default;
+
+    virtual int init()                                                      = 0;
+    virtual int deinit()                                                    = 0;
+    virtual int read(void* buffer, bd_addr_t addr, bd_size_t size)          = 0;
+    virtual int program(const void* buffer, bd_addr_t addr, bd_size_t size) = 0;
+    virtual int erase(bd_addr_t addr, bd_size_t size)                       = 0;
+
+    virtual bd_size_t get_read_size() const    = 0;
+    virtual bd_size_t get_program_size() const = 0;
+    virtual bd_size_t get_erase_size() const   = 0;
+    virtual int get_erase_value() const        = 0;
+    virtual bd_size_t size() const             = 0;
+    virtual const char* get_type() const       = 0;
+
+    bool is_valid_read(bd_addr_t addr, bd_size_t size) const {
+        return isValid(addr, size, get_read_size());
+    }
+    bool is_valid_program(bd_addr_t addr, bd_size_t size) const {
+        return isValid(addr, size, get_program_size());
+    }
+    bool is_valid_erase(bd_addr_t addr, bd_size_t size) const {
+        return isValid(addr, size, get_erase_size());
+    }
+
+   private:
+    bool isValid(bd_addr_t addr, bd_size_t size, bd_size_t alignment) const {
+        return (addr % alignment == 0) && (size % alignment == 0) &&
+               (addr + size <= this->size());
+    }
+};
+
+// block device simulated in memory: unlike the mbed one, the whole device is allocated
+// by init() and erased blocks read as a flash device (0xFF)
+class HeapBlockDevice : public BlockDevice {
+   public:
+    HeapBlockDevice(bd_size_t size, bd_size_t block = 512);
+    HeapBlockDevice(bd_size_t size, bd_size_t read, bd_size_t program, bd_size_t erase);
+
+    // make the class non copyable
+    HeapBlockDevice(HeapBlockDevice&)            = delete;
+    HeapBlockDevice& operator=(HeapBlockDevice&) = delete;
+
+    int init() override;
+    int deinit() override;
+    int read(void* buffer, bd_addr_t addr, bd_size_t size) override;
+    int program(const void* buffer, bd_addr_t addr, bd_size_t size) override;
+    int erase(bd_addr_t addr, bd_size_t size) override;
+
+    bd_size_t get_read_size() const override { return _readSize; }
+    bd_size_t get_program_size() const override { return _programSize; }
+    bd_size_t get_erase_size() const override { return _eraseSize; }
+    int get_erase_value() const override { return kErasedValue; }
+    bd_size_t size() const override { return _size; }
+    const char* get_type() const override { return "HEAP"; }
+
+   private:
+    static constexpr uint8_t kErasedValue = 0xFF;
+
+    // data members
+    const bd_size_t _size;
+    const bd_size_t _readSize;
+    const bd_size_t _programSize;
+    const bd_size_t _eraseSize;
+    std::unique_ptr<uint8_t[]> _data;
+};
+
+}  // namespace mbed
@@ -0,0 +1,114 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file callback.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief mbed::Callback for the host port layer
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "inplace_function.hpp"
+
+namespace mbed {
+
+template <typename Signature>
+class Callback;
+
+// Callback storing its functor in place: as the mbed implementation, it never
+// allocates, the functors being limited to kStorageSize bytes (a bound member function)
+template <typename R, typename... Args>
+class Callback<R(Args...)> {
+   public:
+    static constexpr size_t kStorageSize = 4 * sizeof(void*);
+
+    Callback() = default;
+    Callback(std::nullptr_t) {}  // NOLINT(runtime/explicit)
+
+    // any function pointer or functor (including lambdas)
+    template <typename F,
+              typename = typename std::enable_if<
+                  !std::is_same<typename std::decay<F>::type, Callback>::value>::type>
+    Callback(F function)  // NOLINT(runtime/explicit)
+        : _function(std::move(function)) {}
+
+    // member function bound to an object
+    template <typename T, typename U>
+    Callback(U* object, R (T::*method)(Args...))
+        : _function([object, method](Args... args) {
+              return (object->*method)(std::forward<Args>(args)...);
+          }) {}
+    template <typename T, typename U>
+    Callback(const U* object, R (T::*method)(Args...) const)
+        : _function([object, method](Args... args) {
+              return (object->*method)(std::forward<Args>(args)...);
+          }) {}
+
+    // function with a bound first argument
+    template <typename T, typename U>
+    Callback(R (*function)(T*, Args...), U* argument)
+        : _function([function, argument](Args... args) {
+              return function(argument, std::forward<Args>(args)...);
+          }) {}
+
+    R call(Args... args) const { return _function(std::forward<Args>(args)...); }
+    R operator()(Args... args) const { return _function(std::forward<Args>(args)...); }
+
+    explicit operator bool() const { return static_cast<bool>(_function); }
+    friend bool operator==(const Callback& callback, std::nullptr_t) {
+        return !callback;
+    }
+    friend bool operator!=(const Callback& callback, std::nullptr_t) {
+        return static_cast<bool>(callback);
+    }
+
+   private:
+    host::InplaceFunction<R(Args...), kStorageSize> _function;
+};
+
+template <typename R, typename... Args>
+Callback<R(Args...)> callback(R (*function)(Args...)) {
+    return Callback<R(Args...)>(function);
+}
+
+template <typename R, typename... Args>
+Callback<R(Args...)> callback(const Callback<R(Args...)>& function) {
+    return function;
+}
+
+template <typename T, typename U, typename R, typename... Args>
+Callback<R(Args...)> callback(U* object, R (T::*method)(Args...)) {
+    return Callback<R(Args...)>(object, method);
+}
+
+template <typename T, typename U, typename R, typename... Args>
+Callback<R(Args...)> callback(const U* object, R (T::*method)(Args...) const) {
+    return Callback<R(Args...)>(object, method);
+}
+
+template <typename T, typename U, typename R, typename... Args>
+Callback<R(Args...)> callback(R (*function)(T*, Args...), U* argument) {
+    return Callback<R(Args...)>(function, argument);
+}
+
+}  // namespace mbed
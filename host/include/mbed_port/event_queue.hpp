@@ -0,0 +1,160 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file event_queue.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief events::EventQueue and events::Event for the host port layer
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <list>
+#include <mutex>
+
+#include "callback.hpp"
+#include "inplace_function.hpp"
+
+// default queue size in bytes (not enforced on the host: the queue grows beyond
+// size / EVENTS_EVENT_SIZE events), the function of each event being limited to
+// EVENTS_EVENT_SIZE bytes
+#define EVENTS_EVENT_SIZE 64
+#define EVENTS_QUEUE_SIZE (32 * EVENTS_EVENT_SIZE)
+
+namespace events {
+
+// EventQueue dispatching posted functions in the thread calling dispatch: as with
+// equeue, periodic events are released at a fixed rate relative to their first
+// release and break_dispatch() stops the current (or the next) dispatch. The events
+// are allocated upon construction and recycled, so that the queue only allocates when
+// it grows beyond its size.
+class EventQueue {
+   public:
+    typedef host::InplaceFunction<void(), EVENTS_EVENT_SIZE> Function;
+
+    explicit EventQueue(unsigned size          = EVENTS_QUEUE_SIZE,
+                        unsigned char* buffer = nullptr);
+
+    // make the class non copyable
+    EventQueue(EventQueue&)            = delete;
+    EventQueue& operator=(EventQueue&) = delete;
+
+    // methods for dispatching events
+    void dispatch_forever();
+    void dispatch_for(const std::chrono::milliseconds& duration);
+    void break_dispatch();
+
+    // methods for posting functions (the arguments are copied), returning the id of
+    // the posted event
+    template <typename F, typename... Args>
+    int call(F function, Args... args) {
+        return call_in(std::chrono::milliseconds::zero(), function, args...);
+    }
+    template <typename F, typename... Args>
+    int call_in(const std::chrono::milliseconds& delay, F function, Args... args) {
+        return post([function, args...]() { function(args...); }, delay, kNoPeriod);
+    }
+    template <typename F, typename... Args>
+    int call_every(const std::chrono::milliseconds& period, F function, Args... args) {
+        return post([function, args...]() { function(args...); }, period, period);
+    }
+
+    // method for cancelling a posted event, returns false if the event was already
+    // dispatched (or is being dispatched, for a non periodic event)
+    bool cancel(int id);
+
+    // method for getting the time before the release of a posted event
+    std::chrono::milliseconds time_left(int id);
+
+    // method called by Event for posting a function, a negative period meaning that
+    // the event is not periodic
+    int post(Function function,
+             const std::chrono::milliseconds& delay,
+             const std::chrono::milliseconds& period);
+
+    static constexpr std::chrono::milliseconds kNoPeriod = std::chrono::milliseconds(-1);
+
+   private:
+    using Clock = std::chrono::steady_clock;
+
+    struct PostedEvent {
+        int id;
+        Clock::time_point releaseTime;
+        std::chrono::milliseconds period;
+        Function function;
+    };
+    typedef std::list<PostedEvent>::iterator EventIterator;
+
+    // private methods
+    void dispatch(bool isForever, const Clock::time_point& deadline);
+    // must be called with the mutex locked, moves the event from the source list to the
+    // posted events
+    void insert(EventIterator event, std::list<PostedEvent>& source);
+    // must be called with the mutex locked
+    void recycle(EventIterator event, std::list<PostedEvent>& source);
+
+    // data members
+    std::mutex _mutex;
+    std::condition_variable _condition;
+    // posted events sorted by release time, events being dispatched and free events
+    std::list<PostedEvent> _postedEvents;
+    std::list<PostedEvent> _dispatchedEvents;
+    std::list<PostedEvent> _freeEvents;
+    int _lastId                   = 0;
+    int _dispatchedId             = 0;
+    bool _isDispatchedIdCancelled = false;
+    bool _isBreakRequested        = false;
+};
+
+template <typename F>
+class Event;
+
+// Event bound to a queue and a function: each post copies the function and the
+// arguments in the queue, the event may thus be destroyed once posted
+template <typename... Args>
+class Event<void(Args...)> {
+   public:
+    template <typename F>
+    Event(EventQueue* queue, F function) : _queue(queue), _function(function) {}
+
+    void delay(const std::chrono::milliseconds& delay) { _delay = delay; }
+    void period(const std::chrono::milliseconds& period) { _period = period; }
+
+    int post(Args... args) {
+        mbed::Callback<void(Args...)> function = _function;
+        _id = _queue->post([function, args...]() { function(args...); }, _delay, _period);
+        return _id;
+    }
+    void call(Args... args) { post(args...); }
+    void operator()(Args... args) { post(args...); }
+
+    // cancel the last posted event
+    void cancel() const { _queue->cancel(_id); }
+
+   private:
+    // data members
+    EventQueue* _queue;
+    mbed::Callback<void(Args...)> _function;
+    std::chrono::milliseconds _delay  = std::chrono::milliseconds::zero();
+    std::chrono::milliseconds _period = EventQueue::kNoPeriod;
+    int _id                           = 0;
+};
+
+}  // namespace events
@@ -0,0 +1,62 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file i2c.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief mbed::I2C master on the simulated I2C bus (host port layer)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+
+#include "pin_names.hpp"
+
+namespace mbed {
+
+// I2C master whose transfers are served by the devices attached to the simulated bus
+// (see host::SimulatedI2CBus). As on the target, transfers are blocking and last the
+// time needed for clocking the bytes at the selected frequency. Addresses are 8-bit
+// addresses (7-bit address shifted left by one).
+class I2C {
+   public:
+    I2C(PinName sda, PinName scl);
+
+    // make the class non copyable
+    I2C(I2C&)            = delete;
+    I2C& operator=(I2C&) = delete;
+
+    void frequency(int hz);
+
+    // return 0 on success (acknowledged transfer), non-zero otherwise
+    int read(int address, char* data, int length, bool repeated = false);
+    int write(int address, const char* data, int length, bool repeated = false);
+
+    void lock();
+    void unlock();
+
+   private:
+    // default frequency of the mbed I2C master
+    static constexpr int kDefaultFrequency = 100000;
+
+    // data members
+    int _frequency = kDefaultFrequency;
+};
+
+}  // namespace mbed
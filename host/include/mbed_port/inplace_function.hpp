@@ -0,0 +1,142 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file inplace_function.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Function stored in place, for the host port layer
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace host {
+
+template <typename Signature, size_t kSize>
+class InplaceFunction;
+
+// Type-erased function whose functor is stored in place, without any allocation, as
+// mbed::Callback and the events of equeue on the target: the size of the functor is
+// checked at compile time
+template <typename R, typename... Args, size_t kSize>
+class InplaceFunction<R(Args...), kSize> {
+   public:
+    InplaceFunction() = default;
+    InplaceFunction(std::nullptr_t) {}  // NOLINT(runtime/explicit)
+
+    template <typename F,
+              typename = typename std::enable_if<!std::is_same<
+                  typename std::decay<F>::type,
+                  InplaceFunction>::value>::type>
+    InplaceFunction(F&& function) {  // NOLINT(runtime/explicit)
+        typedef typename std::decay<F>::type Functor;
+        static_assert(sizeof(Functor) <= kSize, "the functor does not fit in place");
+        static_assert(alignof(Functor) <= alignof(Storage),
+                      "the functor is not aligned in place");
+        new (&_storage) Functor(std::forward<F>(function));
+        _operations = &getOperations<Functor>();
+    }
+
+    InplaceFunction(const InplaceFunction& other) : _operations(other._operations) {
+        if (_operations != nullptr) {
+            _operations->copy(&_storage, &other._storage);
+        }
+    }
+
+    InplaceFunction(InplaceFunction&& other) : _operations(other._operations) {
+        if (_operations != nullptr) {
+            _operations->move(&_storage, &other._storage);
+        }
+    }
+
+    ~InplaceFunction() { reset(); }
+
+    InplaceFunction& operator=(const InplaceFunction& other) {
+        if (this != &other) {
+            reset();
+            if (other._operations != nullptr) {
+                other._operations->copy(&_storage, &other._storage);
+                _operations = other._operations;
+            }
+        }
+        return *this;
+    }
+
+    InplaceFunction& operator=(InplaceFunction&& other) {
+        if (this != &other) {
+            reset();
+            if (other._operations != nullptr) {
+                other._operations->move(&_storage, &other._storage);
+                _operations = other._operations;
+            }
+        }
+        return *this;
+    }
+
+    R operator()(Args... args) const {
+        return _operations->call(&_storage, std::forward<Args>(args)...);
+    }
+
+    explicit operator bool() const { return _operations != nullptr; }
+
+    void reset() {
+        if (_operations != nullptr) {
+            _operations->destroy(&_storage);
+            _operations = nullptr;
+        }
+    }
+
+   private:
+    typedef typename std::aligned_storage<kSize, alignof(std::max_align_t)>::type Storage;
+
+    // operations on the functor stored in place
+    struct Operations {
+        R (*call)(const void* storage, Args&&... args);
+        void (*copy)(void* destination, const void* source);
+        void (*move)(void* destination, void* source);
+        void (*destroy)(void* storage);
+    };
+
+    template <typename Functor>
+    static const Operations& getOperations() {
+        // as with std::function, the functor is called through a const function
+        static const Operations operations = {
+            [](const void* storage, Args&&... args) -> R {
+                return (*static_cast<Functor*>(const_cast<void*>(storage)))(
+                    std::forward<Args>(args)...);
+            },
+            [](void* destination, const void* source) {
+                new (destination) Functor(*static_cast<const Functor*>(source));
+            },
+            [](void* destination, void* source) {
+                new (destination) Functor(std::move(*static_cast<Functor*>(source)));
+            },
+            [](void* storage) { static_cast<Functor*>(storage)->~Functor(); }};
+        return operations;
+    }
+
+    // data members
+    Storage _storage;
+    const Operations* _operations = nullptr;
+};
+
+}  // namespace host
@@ -0,0 +1,70 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file interrupt_in.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief mbed::InterruptIn for the host port layer
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include "callback.hpp"
+#include "pin_names.hpp"
+
+namespace host {
+class SimulatedPins;
+}  // namespace host
+
+namespace mbed {
+
+// InterruptIn connected to a simulated pin: the rise and fall handlers are called
+// from the thread driving the pin (see host::SimulatedPins)
+class InterruptIn {
+   public:
+    explicit InterruptIn(PinName pin);
+    InterruptIn(PinName pin, PinMode mode);
+    ~InterruptIn();
+
+    // make the class non copyable
+    InterruptIn(InterruptIn&)            = delete;
+    InterruptIn& operator=(InterruptIn&) = delete;
+
+    int read();
+    operator int();  // NOLINT(runtime/explicit)
+
+    void rise(Callback<void()> function);
+    void fall(Callback<void()> function);
+    void mode(PinMode pull);
+    void enable_irq();
+    void disable_irq();
+
+   private:
+    friend class host::SimulatedPins;
+
+    // method called by the simulated pins upon an edge
+    void onEdge(bool isRising);
+
+    // data members
+    const PinName _pin;
+    Callback<void()> _rise;
+    Callback<void()> _fall;
+    bool _isIrqEnabled = true;
+};
+
+}  // namespace mbed
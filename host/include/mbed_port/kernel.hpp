@@ -0,0 +1,64 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file kernel.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief rtos::Kernel clock definitions for the host port layer
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+
+namespace rtos {
+
+namespace Kernel {
+
+// the kernel clock counts milliseconds, as with the default tick rate of mbed OS
+struct Clock {
+    using duration_u32 = std::chrono::duration<uint32_t, std::milli>;
+};
+
+// timeout value meaning that a wait never times out
+constexpr Clock::duration_u32 wait_for_u32_forever{UINT32_MAX};
+
+}  // namespace Kernel
+
+}  // namespace rtos
+
+namespace host {
+
+// wait on a condition with a kernel timeout, returns false if the predicate is still
+// false once the timeout elapsed
+template <typename Predicate>
+bool waitFor(std::unique_lock<std::mutex>& lock,  // NOLINT(runtime/references)
+             std::condition_variable& condition,  // NOLINT(runtime/references)
+             const rtos::Kernel::Clock::duration_u32& timeout,
+             Predicate predicate) {
+    if (timeout == rtos::Kernel::wait_for_u32_forever) {
+        condition.wait(lock, predicate);
+        return true;
+    }
+    return condition.wait_for(lock, timeout, predicate);
+}
+
+}  // namespace host
@@ -0,0 +1,77 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file mail.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief rtos::Mail for the host port layer
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+
+#include "kernel.hpp"
+#include "memory_pool.hpp"
+#include "platform.hpp"
+#include "queue.hpp"
+
+namespace rtos {
+
+// queue of messages allocated from a pool, as the mbed one: the pool has as many blocks
+// as the queue has slots, putting an allocated message thus never blocks
+template <typename T, uint32_t queue_sz>
+class Mail {
+   public:
+    Mail() = default;
+
+    // make the class non copyable
+    Mail(Mail&)            = delete;
+    Mail& operator=(Mail&) = delete;
+
+    bool empty() const { return _queue.empty(); }
+    bool full() const { return _queue.full(); }
+    uint32_t count() const { return _queue.count(); }
+
+    T* try_alloc() { return _pool.try_alloc(); }
+    T* try_alloc_for(Kernel::Clock::duration_u32 rel_time) {
+        return _pool.try_alloc_for(rel_time);
+    }
+    T* try_calloc() { return _pool.try_calloc(); }
+    T* try_calloc_for(Kernel::Clock::duration_u32 rel_time) {
+        return _pool.try_calloc_for(rel_time);
+    }
+
+    osStatus put(T* mptr) { return _queue.try_put(mptr) ? osOK : osErrorResource; }
+
+    T* try_get() { return try_get_for(Kernel::Clock::duration_u32::zero()); }
+    T* try_get_for(Kernel::Clock::duration_u32 rel_time) {
+        T* mptr = nullptr;
+        _queue.try_get_for(rel_time, &mptr);
+        return mptr;
+    }
+
+    osStatus free(T* mptr) { return _pool.free(mptr); }
+
+   private:
+    // data members
+    Queue<T, queue_sz> _queue;
+    MemoryPool<T, queue_sz> _pool;
+};
+
+}  // namespace rtos
@@ -0,0 +1,45 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file mem_trace.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Memory tracing hook for the host port layer
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+
+// memory tracing as defined by mbed OS (platform/mbed_mem_trace.h): the callback is
+// called after each allocation and free with the operation, the result, the return
+// address of the caller and the arguments of the operation (size for malloc, pointer
+// for free)
+enum {
+    MBED_MEM_TRACE_MALLOC,
+    MBED_MEM_TRACE_REALLOC,
+    MBED_MEM_TRACE_CALLOC,
+    MBED_MEM_TRACE_FREE
+};
+
+typedef void (*mbed_mem_trace_cb_t)(uint8_t op, void* res, void* caller, ...);
+
+// the operators new and delete of the process are traced (the allocations made by the
+// C library are not), the callback being called without nesting: the allocations made
+// by the callback are not traced
+void mbed_mem_trace_set_callback(mbed_mem_trace_cb_t callback);
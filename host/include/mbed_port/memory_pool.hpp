@@ -0,0 +1,100 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file memory_pool.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief rtos::MemoryPool for the host port layer
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <type_traits>
+
+#include "kernel.hpp"
+#include "platform.hpp"
+
+namespace rtos {
+
+// pool of fixed size blocks, as the mbed one: the blocks are neither constructed nor
+// destroyed and the last freed block is the first one allocated again
+template <typename T, uint32_t pool_sz>
+class MemoryPool {
+   public:
+    MemoryPool() {
+        for (uint32_t index = 0; index < pool_sz; index++) {
+            _freeBlocks[index] = pool_sz - 1 - index;
+        }
+    }
+
+    // make the class non copyable
+    MemoryPool(MemoryPool&)            = delete;
+    MemoryPool& operator=(MemoryPool&) = delete;
+
+    T* try_alloc() { return try_alloc_for(Kernel::Clock::duration_u32::zero()); }
+    T* try_alloc_for(Kernel::Clock::duration_u32 rel_time) {
+        std::unique_lock<std::mutex> lock(_mutex);
+        if (!host::waitFor(lock, _notEmpty, rel_time, [this]() {
+                return _nbrOfFreeBlocks > 0;
+            })) {
+            return nullptr;
+        }
+        _nbrOfFreeBlocks--;
+        return reinterpret_cast<T*>(&_blocks[_freeBlocks[_nbrOfFreeBlocks]]);
+    }
+    T* try_calloc() { return try_calloc_for(Kernel::Clock::duration_u32::zero()); }
+    T* try_calloc_for(Kernel::Clock::duration_u32 rel_time) {
+        T* block = try_alloc_for(rel_time);
+        if (block != nullptr) {
+            memset(block, 0, sizeof(T));
+        }
+        return block;
+    }
+
+    osStatus free(T* block) {
+        const Block* blockPtr = reinterpret_cast<const Block*>(block);
+        if (blockPtr < &_blocks[0] || blockPtr >= &_blocks[pool_sz]) {
+            return osErrorParameter;
+        }
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_nbrOfFreeBlocks == pool_sz) {
+            return osErrorResource;
+        }
+        _freeBlocks[_nbrOfFreeBlocks] = static_cast<uint32_t>(blockPtr - &_blocks[0]);
+        _nbrOfFreeBlocks++;
+        _notEmpty.notify_one();
+        return osOK;
+    }
+
+   private:
+    using Block = typename std::aligned_storage<sizeof(T), alignof(T)>::type;
+
+    // data members
+    std::mutex _mutex;
+    std::condition_variable _notEmpty;
+    Block _blocks[pool_sz];
+    // indices of the free blocks, used as a stack
+    uint32_t _freeBlocks[pool_sz];
+    uint32_t _nbrOfFreeBlocks = pool_sz;
+};
+
+}  // namespace rtos
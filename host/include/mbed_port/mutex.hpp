@@ -0,0 +1,56 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file mutex.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief rtos::Mutex for the host port layer
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include <chrono>
+#include <mutex>
+
+namespace rtos {
+
+// recursive mutex, as the mbed one
+class Mutex {
+   public:
+    Mutex() = default;
+    explicit Mutex(const char* name) : _name(name) {}
+
+    // make the class non copyable
+    Mutex(Mutex&)            = delete;
+    Mutex& operator=(Mutex&) = delete;
+
+    void lock() { _mutex.lock(); }
+    void unlock() { _mutex.unlock(); }
+    bool trylock() { return _mutex.try_lock(); }
+    bool trylock_for(const std::chrono::milliseconds& timeout) {
+        return _mutex.try_lock_for(timeout);
+    }
+    const char* get_name() const { return _name; }
+
+   private:
+    // data members
+    std::recursive_timed_mutex _mutex;
+    const char* _name = nullptr;
+};
+
+}  // namespace rtos
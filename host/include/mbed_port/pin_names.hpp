@@ -0,0 +1,38 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file pin_names.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Pin names of the simulated DISCO_H747I board (host port layer)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+// only the pins used by the bike computer are simulated
+enum PinName {
+    BUTTON1 = 0,
+    PD_12,
+    PD_13,
+    PC_6,
+    // number of simulated pins
+    kNbrOfPins,
+    NC = -1
+};
+
+enum PinMode { PullNone = 0, PullUp, PullDown, PullDefault = PullNone };
@@ -0,0 +1,135 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file platform.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Atomics, critical sections, statistics and waits (host port layer)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+
+// status codes and priorities as defined by CMSIS-RTOS2
+typedef int32_t osStatus;
+static constexpr osStatus osOK             = 0;
+static constexpr osStatus osError          = -1;
+static constexpr osStatus osErrorTimeout   = -2;
+static constexpr osStatus osErrorResource  = -3;
+static constexpr osStatus osErrorParameter = -4;
+static constexpr osStatus osErrorNoMemory  = -5;
+
+enum osPriority {
+    osPriorityIdle         = 1,
+    osPriorityLow          = 8,
+    osPriorityBelowNormal  = 16,
+    osPriorityNormal       = 24,
+    osPriorityAboveNormal  = 32,
+    osPriorityHigh         = 40,
+    osPriorityRealtime     = 48,
+    osPriorityISR          = 56
+};
+
+#define OS_STACK_SIZE 4096
+
+// atomic operations are implemented with the compiler builtins (sequential
+// consistency, as with the exclusive accesses used by mbed)
+#define HOST_ATOMIC_FUNCTIONS(T, N)                                                   \
+    inline T core_util_atomic_load_##N(const volatile T* valuePtr) {                  \
+        return __atomic_load_n(valuePtr, __ATOMIC_SEQ_CST);                           \
+    }                                                                                 \
+    inline void core_util_atomic_store_##N(volatile T* valuePtr, T desiredValue) {    \
+        __atomic_store_n(valuePtr, desiredValue, __ATOMIC_SEQ_CST);                   \
+    }                                                                                 \
+    inline T core_util_atomic_exchange_##N(volatile T* valuePtr, T desiredValue) {    \
+        return __atomic_exchange_n(valuePtr, desiredValue, __ATOMIC_SEQ_CST);         \
+    }                                                                                 \
+    inline bool core_util_atomic_cas_##N(                                             \
+        volatile T* valuePtr, T* expectedCurrentValue, T desiredValue) {              \
+        return __atomic_compare_exchange_n(valuePtr,                                  \
+                                           expectedCurrentValue,                      \
+                                           desiredValue,                              \
+                                           false,                                     \
+                                           __ATOMIC_SEQ_CST,                          \
+                                           __ATOMIC_SEQ_CST);                         \
+    }                                                                                 \
+    inline T core_util_atomic_incr_##N(volatile T* valuePtr, T delta) {               \
+        return __atomic_add_fetch(valuePtr, delta, __ATOMIC_SEQ_CST);                 \
+    }                                                                                 \
+    inline T core_util_atomic_decr_##N(volatile T* valuePtr, T delta) {               \
+        return __atomic_sub_fetch(valuePtr, delta, __ATOMIC_SEQ_CST);                 \
+    }                                                                                 \
+    inline T core_util_atomic_fetch_add_##N(volatile T* valuePtr, T arg) {            \
+        return __atomic_fetch_add(valuePtr, arg, __ATOMIC_SEQ_CST);                   \
+    }                                                                                 \
+    inline T core_util_atomic_fetch_sub_##N(volatile T* valuePtr, T arg) {            \
+        return __atomic_fetch_sub(valuePtr, arg, __ATOMIC_SEQ_CST);                   \
+    }
+
+HOST_ATOMIC_FUNCTIONS(uint8_t, u8)
+HOST_ATOMIC_FUNCTIONS(uint16_t, u16)
+HOST_ATOMIC_FUNCTIONS(uint32_t, u32)
+HOST_ATOMIC_FUNCTIONS(uint64_t, u64)
+
+#undef HOST_ATOMIC_FUNCTIONS
+
+inline bool core_util_atomic_load_bool(const volatile bool* valuePtr) {
+    return __atomic_load_n(valuePtr, __ATOMIC_SEQ_CST);
+}
+inline void core_util_atomic_store_bool(volatile bool* valuePtr, bool desiredValue) {
+    __atomic_store_n(valuePtr, desiredValue, __ATOMIC_SEQ_CST);
+}
+inline bool core_util_atomic_exchange_bool(volatile bool* valuePtr, bool desiredValue) {
+    return __atomic_exchange_n(valuePtr, desiredValue, __ATOMIC_SEQ_CST);
+}
+inline bool core_util_atomic_cas_bool(volatile bool* valuePtr,
+                                      bool* expectedCurrentValue,
+                                      bool desiredValue) {
+    return __atomic_compare_exchange_n(valuePtr,
+                                       expectedCurrentValue,
+                                       desiredValue,
+                                       false,
+                                       __ATOMIC_SEQ_CST,
+                                       __ATOMIC_SEQ_CST);
+}
+
+// critical sections are emulated with a single process-wide recursive lock: they
+// exclude other critical sections, not all other threads
+void core_util_critical_section_enter();
+void core_util_critical_section_exit();
+
+// cpu statistics: the idle time is the part of the uptime during which the process
+// did not use any cpu (expressed in us)
+struct mbed_stats_cpu_t {
+    uint64_t uptime;
+    uint64_t idle_time;
+    uint64_t sleep_time;
+    uint64_t deep_sleep_time;
+};
+void mbed_stats_cpu_get(mbed_stats_cpu_t* stats);
+
+// busy waits
+void wait_us(int us);
+void wait_ns(unsigned int ns);
+
+#define MBED_ASSERT(expr) assert(expr)
+
+// toolchain attributes (mbed_toolchain.h)
+#define MBED_NOINLINE __attribute__((noinline))
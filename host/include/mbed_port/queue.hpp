@@ -0,0 +1,100 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file queue.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief rtos::Queue for the host port layer
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+
+#include "kernel.hpp"
+
+namespace rtos {
+
+// queue of pointers to messages, as the mbed one: the messages are not copied and the
+// priorities are accepted but ignored, messages are retrieved in the order of posting
+template <typename T, uint32_t queue_sz>
+class Queue {
+   public:
+    Queue() = default;
+
+    // make the class non copyable
+    Queue(Queue&)            = delete;
+    Queue& operator=(Queue&) = delete;
+
+    bool empty() const {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _count == 0;
+    }
+    bool full() const {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _count == queue_sz;
+    }
+    uint32_t count() const {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _count;
+    }
+
+    bool try_put(T* data, uint8_t prio = 0) {
+        return try_put_for(Kernel::Clock::duration_u32::zero(), data, prio);
+    }
+    bool try_put_for(Kernel::Clock::duration_u32 rel_time, T* data, uint8_t prio = 0) {
+        std::unique_lock<std::mutex> lock(_mutex);
+        if (!host::waitFor(lock, _notFull, rel_time, [this]() {
+                return _count < queue_sz;
+            })) {
+            return false;
+        }
+        _messages[(_first + _count) % queue_sz] = data;
+        _count++;
+        _notEmpty.notify_one();
+        return true;
+    }
+
+    bool try_get(T** data_out) {
+        return try_get_for(Kernel::Clock::duration_u32::zero(), data_out);
+    }
+    bool try_get_for(Kernel::Clock::duration_u32 rel_time, T** data_out) {
+        std::unique_lock<std::mutex> lock(_mutex);
+        if (!host::waitFor(lock, _notEmpty, rel_time, [this]() { return _count > 0; })) {
+            return false;
+        }
+        *data_out = _messages[_first];
+        _first    = (_first + 1) % queue_sz;
+        _count--;
+        _notFull.notify_one();
+        return true;
+    }
+
+   private:
+    // data members
+    mutable std::mutex _mutex;
+    std::condition_variable _notEmpty;
+    std::condition_variable _notFull;
+    T* _messages[queue_sz] = {nullptr};
+    uint32_t _first        = 0;
+    uint32_t _count        = 0;
+};
+
+}  // namespace rtos
@@ -0,0 +1,82 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file semaphore.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief rtos::Semaphore for the host port layer
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+
+#include "platform.hpp"
+
+namespace rtos {
+
+// counting semaphore, as the mbed one
+class Semaphore {
+   public:
+    explicit Semaphore(int32_t count = 0) : _count(count) {}
+
+    // make the class non copyable
+    Semaphore(Semaphore&)            = delete;
+    Semaphore& operator=(Semaphore&) = delete;
+
+    void acquire() {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _condition.wait(lock, [this]() { return _count > 0; });
+        _count--;
+    }
+    bool try_acquire() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_count == 0) {
+            return false;
+        }
+        _count--;
+        return true;
+    }
+    bool try_acquire_for(const std::chrono::milliseconds& timeout) {
+        std::unique_lock<std::mutex> lock(_mutex);
+        if (!_condition.wait_for(lock, timeout, [this]() { return _count > 0; })) {
+            return false;
+        }
+        _count--;
+        return true;
+    }
+    // the waiting thread is notified with the lock held, so that it may destroy the
+    // semaphore as soon as it acquired it
+    osStatus release() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _count++;
+        _condition.notify_one();
+        return osOK;
+    }
+
+   private:
+    // data members
+    std::mutex _mutex;
+    std::condition_variable _condition;
+    int32_t _count;
+};
+
+}  // namespace rtos
@@ -0,0 +1,78 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file simulated_heap.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Heap of the simulated target (host port layer)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+#include "callback.hpp"
+
+namespace host {
+
+// Heap of the simulated target: a first-fit allocator with a free list sorted by
+// address and coalesced upon free, as the newlib-nano allocator. The free list of the
+// host allocator cannot be walked, the fragmentation of the heap is thus analyzed on
+// this heap, which is used by the tests (the application does not allocate)
+class SimulatedHeap {
+   public:
+    static constexpr size_t kSize = 64 * 1024;
+
+    static SimulatedHeap& getInstance();
+
+    // make the class non copyable
+    SimulatedHeap(SimulatedHeap&)            = delete;
+    SimulatedHeap& operator=(SimulatedHeap&) = delete;
+
+    // returns nullptr if no free block is large enough
+    void* allocate(size_t size);
+    void free(void* block);
+
+    // calls function with the usable size of each free block, in the order of the
+    // addresses (the function must not use the simulated heap)
+    void forEachFreeBlock(mbed::Callback<void(size_t)> function);
+
+   private:
+    SimulatedHeap();
+
+    // header of the chunks, the next field being used by the free chunks only
+    struct Chunk {
+        // size of the chunk, header included
+        size_t size;
+        Chunk* next;
+    };
+    static constexpr size_t kHeaderSize = offsetof(Chunk, next);
+    static constexpr size_t kAlignment  = 8;
+
+    // data members
+    std::mutex _mutex;
+    alignas(kAlignment) uint8_t _arena[kSize];
+    Chunk* _freeChunks = nullptr;
+};
+
+// calls function with the usable size of each free block of the simulated heap
+void forEachFreeHeapBlock(mbed::Callback<void(size_t)> function);
+
+}  // namespace host
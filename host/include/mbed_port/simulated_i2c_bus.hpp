@@ -0,0 +1,86 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file simulated_i2c_bus.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Simulated I2C bus serving the mbed::I2C transfers (host port layer)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+
+namespace host {
+
+// Interface of the devices attached to the simulated bus: each method serves a
+// complete transfer and returns false if the device does not acknowledge it
+class SimulatedI2CDevice {
+   public:
+    virtual ~SimulatedI2CDevice() = default;
+
+    virtual bool onWrite(const char* data, int length) = 0;
+    virtual bool onRead(char* data, int length)        = 0;
+};
+
+// Simulated I2C bus: transfers are serialized and dispatched to the device attached
+// at the given (8-bit) address
+class SimulatedI2CBus {
+   public:
+    static SimulatedI2CBus& getInstance();
+
+    // make the class non copyable
+    SimulatedI2CBus(SimulatedI2CBus&)            = delete;
+    SimulatedI2CBus& operator=(SimulatedI2CBus&) = delete;
+
+    bool attach(int address, SimulatedI2CDevice* device);
+    void detach(SimulatedI2CDevice* device);
+
+    // called by mbed::I2C, return false if the transfer is not acknowledged
+    bool write(int address, const char* data, int length);
+    bool read(int address, char* data, int length);
+
+    // statistics of the bus
+    uint32_t getNbrOfTransfers();
+    uint32_t getNbrOfNacks();
+    uint32_t getNbrOfBytes();
+
+    // held by mbed::I2C::lock()
+    std::recursive_mutex& getMutex();
+
+   private:
+    SimulatedI2CBus() = default;
+
+    // private methods
+    SimulatedI2CDevice* findDevice(int address);
+
+    // data members
+    static constexpr int kMaxNbrOfDevices = 8;
+    struct Slot {
+        int address                = 0;
+        SimulatedI2CDevice* device = nullptr;
+    };
+    std::recursive_mutex _mutex;
+    Slot _slots[kMaxNbrOfDevices];
+    uint32_t _nbrOfTransfers = 0;
+    uint32_t _nbrOfNacks     = 0;
+    uint32_t _nbrOfBytes     = 0;
+};
+
+}  // namespace host
@@ -0,0 +1,63 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file simulated_pins.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Simulated input pins driving the InterruptIn instances (host port layer)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include <mutex>
+
+#include "interrupt_in.hpp"
+#include "pin_names.hpp"
+
+namespace host {
+
+// Levels of the simulated pins: writing a pin calls the edge handlers of the
+// InterruptIn instances connected to it, from the calling thread
+class SimulatedPins {
+   public:
+    static SimulatedPins& getInstance();
+
+    // make the class non copyable
+    SimulatedPins(SimulatedPins&)            = delete;
+    SimulatedPins& operator=(SimulatedPins&) = delete;
+
+    void write(PinName pin, int level);
+    int read(PinName pin);
+
+   private:
+    SimulatedPins() = default;
+
+    // methods called by InterruptIn
+    friend class mbed::InterruptIn;
+    void connect(mbed::InterruptIn* interruptIn);
+    void disconnect(mbed::InterruptIn* interruptIn);
+
+    // data members
+    static constexpr int kMaxNbrOfInterruptIns = 8;
+    // recursive since the edge handlers may read the pins
+    std::recursive_mutex _mutex;
+    int _levels[kNbrOfPins]                                 = {0};
+    mbed::InterruptIn* _interruptIns[kMaxNbrOfInterruptIns] = {nullptr};
+};
+
+}  // namespace host
@@ -0,0 +1,127 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file thread.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief rtos::Thread and rtos::ThisThread for the host port layer
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+#include "callback.hpp"
+#include "platform.hpp"
+
+namespace rtos {
+
+// Thread running on a native thread: priorities and stack sizes are recorded but not
+// enforced, threads may thus run in parallel on a multi-core host (the process may be
+// pinned to a single core with taskset for a behavior closer to the target)
+class Thread {
+   public:
+    explicit Thread(osPriority priority        = osPriorityNormal,
+                    uint32_t stackSize         = OS_STACK_SIZE,
+                    unsigned char* stackMemory = nullptr,
+                    const char* name           = nullptr);
+    // a thread that was not joined is detached, since it cannot be terminated
+    ~Thread();
+
+    // make the class non copyable
+    Thread(Thread&)            = delete;
+    Thread& operator=(Thread&) = delete;
+
+    osStatus start(mbed::Callback<void()> task);
+    osStatus join();
+    // native threads cannot be terminated
+    osStatus terminate();
+
+    osPriority get_priority() const;
+    osStatus set_priority(osPriority priority);
+    uint32_t stack_size() const;
+    const char* get_name() const;
+
+   private:
+    // data members
+    osPriority _priority;
+    const uint32_t _stackSize;
+    const char* _name;
+    std::thread _thread;
+};
+
+namespace ThisThread {
+
+void sleep_for(const std::chrono::milliseconds& duration);
+void yield();
+
+}  // namespace ThisThread
+
+}  // namespace rtos
+
+namespace host {
+
+// cpu time accounting in place of the RTX thread switch hook of the target: the cpu
+// time of the threads started by rtos::Thread and of the main thread is read from
+// their native cpu clock, the time spent in simulated interrupt handlers (InterruptIn
+// and Ticker) being accounted separately
+typedef mbed::Callback<void(const void* threadId, const char* name, uint64_t cpuTime)>
+    ThreadCpuTimeFunction;
+
+// calls function for each thread with its cpu time (in us, interrupt handlers
+// excluded), terminated threads being reported until their Thread is destroyed
+void forEachThreadCpuTime(ThreadCpuTimeFunction function);
+
+// cpu time spent in simulated interrupt handlers (in us)
+uint64_t getIsrCpuTime();
+
+// identifier and name of the calling thread, in place of ThisThread::get_id() and
+// osThreadGetName() of the target (nullptr for the threads not started by
+// rtos::Thread), the thread registry not being locked
+const void* getCurrentThreadId();
+const char* getCurrentThreadName();
+
+// stack watermarking in place of the RTX stack watermarking of the target: upon start,
+// the unused part of the native stack of the threads started by rtos::Thread is filled
+// with the fill pattern (over kStackFillSize bytes, the native stack being larger than
+// the stack size of the Thread), the stack of the main thread being not filled
+static constexpr uint32_t kStackFillPattern = 0xCCCCCCCCU;
+static constexpr uint32_t kStackFillSize    = 256 * 1024;
+
+// stackMemory is the lowest address of the filled part of the native stack, the
+// stackMemorySize bytes from stackMemory covering the used part of the stack as well
+typedef mbed::Callback<void(const void* threadId,
+                            const char* name,
+                            const uint32_t* stackMemory,
+                            uint32_t stackMemorySize,
+                            uint32_t stackSize)>
+    ThreadStackFunction;
+
+// calls function for each running thread whose stack was filled, with the thread
+// registry locked so that the stacks cannot be released meanwhile (the function must
+// not call the functions of the port layer)
+void forEachThreadStack(ThreadStackFunction function);
+
+// called around simulated interrupt handlers (calls may be nested, only the outermost
+// call being accounted)
+void isrEnter();
+void isrExit();
+
+}  // namespace host
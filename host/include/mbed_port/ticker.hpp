@@ -0,0 +1,98 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file ticker.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief mbed::Ticker, mbed::LowPowerTicker and mbed::Timeout for the host port layer
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+#include "callback.hpp"
+
+namespace mbed {
+
+// ticker running the attached function from its own thread (the interrupt context
+// of the target), the thread being created upon the first attach
+class TickerBase {
+   public:
+    // make the class non copyable
+    TickerBase(TickerBase&)            = delete;
+    TickerBase& operator=(TickerBase&) = delete;
+
+    // detaching from the attached function itself is allowed
+    void detach();
+
+   protected:
+    TickerBase() = default;
+    ~TickerBase();
+
+    void setup(Callback<void()> function,
+               const std::chrono::microseconds& interval,
+               bool isPeriodic);
+
+   private:
+    using Clock = std::chrono::steady_clock;
+
+    // private methods
+    void run();
+
+    // data members
+    std::mutex _mutex;
+    std::condition_variable _condition;
+    Callback<void()> _function;
+    std::chrono::microseconds _interval = std::chrono::microseconds::zero();
+    Clock::time_point _attachTime       = Clock::time_point();
+    bool _isPeriodic                    = true;
+    bool _isAttached                    = false;
+    bool _isTerminated                  = false;
+    // incremented upon each attach, for restarting a running ticker
+    uint32_t _generation = 0;
+    std::thread _thread;
+};
+
+class Ticker : public TickerBase {
+   public:
+    Ticker() = default;
+
+    void attach(Callback<void()> function, const std::chrono::microseconds& interval) {
+        setup(function, interval, true);
+    }
+};
+
+// there is no low power timer on the host
+class LowPowerTicker : public Ticker {};
+
+// one-shot ticker
+class Timeout : public TickerBase {
+   public:
+    Timeout() = default;
+
+    void attach(Callback<void()> function, const std::chrono::microseconds& delay) {
+        setup(function, delay, false);
+    }
+};
+
+}  // namespace mbed
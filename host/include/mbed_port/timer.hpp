@@ -0,0 +1,56 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file timer.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief mbed::Timer for the host port layer
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include <chrono>
+#include <mutex>
+
+namespace mbed {
+
+// Timer based on the monotonic clock of the host
+class Timer {
+   public:
+    Timer() = default;
+
+    // make the class non copyable
+    Timer(Timer&)            = delete;
+    Timer& operator=(Timer&) = delete;
+
+    void start();
+    void stop();
+    void reset();
+    std::chrono::microseconds elapsed_time() const;
+
+   private:
+    using Clock = std::chrono::steady_clock;
+
+    // data members
+    mutable std::mutex _mutex;
+    bool _isRunning                        = false;
+    Clock::time_point _startTime           = Clock::time_point();
+    std::chrono::microseconds _elapsedTime = std::chrono::microseconds::zero();
+};
+
+}  // namespace mbed
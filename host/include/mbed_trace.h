@@ -0,0 +1,57 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file mbed_trace.h
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief mbed trace library for the host port layer
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+
+// trace levels and active level masks, as defined by mbed-trace
+#define TRACE_LEVEL_DEBUG 0x10
+#define TRACE_LEVEL_INFO 0x08
+#define TRACE_LEVEL_WARN 0x04
+#define TRACE_LEVEL_ERROR 0x02
+#define TRACE_LEVEL_CMD 0x01
+
+#define TRACE_ACTIVE_LEVEL_ALL 0x1F
+#define TRACE_ACTIVE_LEVEL_DEBUG 0x1F
+#define TRACE_ACTIVE_LEVEL_INFO 0x0F
+#define TRACE_ACTIVE_LEVEL_WARN 0x07
+#define TRACE_ACTIVE_LEVEL_ERROR 0x03
+#define TRACE_ACTIVE_LEVEL_CMD 0x01
+#define TRACE_ACTIVE_LEVEL_NONE 0x00
+
+// traces are printed on stdout, one line per trace
+void mbed_trace_init();
+// only the active level mask of the configuration is used on the host
+void mbed_trace_config_set(uint8_t config);
+uint8_t mbed_trace_config_get();
+void mbed_tracef(uint8_t level, const char* group, const char* format, ...)
+    __attribute__((format(printf, 3, 4)));
+
+#define tr_debug(...) mbed_tracef(TRACE_LEVEL_DEBUG, TRACE_GROUP, __VA_ARGS__)
+#define tr_info(...) mbed_tracef(TRACE_LEVEL_INFO, TRACE_GROUP, __VA_ARGS__)
+#define tr_warn(...) mbed_tracef(TRACE_LEVEL_WARN, TRACE_GROUP, __VA_ARGS__)
+#define tr_warning(...) mbed_tracef(TRACE_LEVEL_WARN, TRACE_GROUP, __VA_ARGS__)
+#define tr_error(...) mbed_tracef(TRACE_LEVEL_ERROR, TRACE_GROUP, __VA_ARGS__)
+#define tr_err(...) mbed_tracef(TRACE_LEVEL_ERROR, TRACE_GROUP, __VA_ARGS__)
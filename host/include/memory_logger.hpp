@@ -0,0 +1,44 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file memory_logger.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Memory logger of the advembsof library (host port layer)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include "mbed.h"
+
+namespace advembsof {
+
+// memory statistics are collected by the RTOS on the target: they are not available
+// on the host
+class MemoryLogger {
+   public:
+    MemoryLogger() = default;
+
+    // make the class non copyable
+    MemoryLogger(MemoryLogger&)            = delete;
+    MemoryLogger& operator=(MemoryLogger&) = delete;
+
+    void getAndPrintThreadStatistics();
+};
+
+}  // namespace advembsof
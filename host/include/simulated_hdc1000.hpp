@@ -0,0 +1,85 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file simulated_hdc1000.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Register model of the HDC1000 sensor on the simulated I2C bus (host port layer)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+
+#include "mbed.h"
+#include "mbed_port/simulated_i2c_bus.hpp"
+
+namespace host {
+
+// HDC1000 temperature and humidity sensor attached to the simulated I2C bus. As the
+// real device, a measurement is triggered by writing the pointer of the temperature
+// or humidity register and reading the result is not acknowledged before the end of
+// the conversion. In acquisition mode (configuration MODE bit set), triggering the
+// temperature measures both values that are then read in a single 4 byte read.
+class SimulatedHDC1000 : public SimulatedI2CDevice {
+   public:
+    static SimulatedHDC1000& getInstance();
+
+    // make the class non copyable
+    SimulatedHDC1000(SimulatedHDC1000&)            = delete;
+    SimulatedHDC1000& operator=(SimulatedHDC1000&) = delete;
+
+    // simulated environment
+    void setTemperature(float temperature);
+    void setHumidity(float humidity);
+    // conversion time of a single measurement (an acquisition takes twice as long)
+    void setConversionTime(const std::chrono::microseconds& conversionTime);
+    std::chrono::microseconds getConversionTime();
+    uint32_t getNbrOfConversions();
+
+    // SimulatedI2CDevice
+    bool onWrite(const char* data, int length) override;
+    bool onRead(char* data, int length) override;
+
+    // 8-bit address of the device (ADR0 and ADR1 pins tied low)
+    static constexpr int kAddress = 0x40 << 1;
+    // conversion time of a 14 bit measurement
+    static constexpr std::chrono::microseconds kDefaultConversionTime = 6500us;
+
+   private:
+    using Clock = std::chrono::steady_clock;
+
+    SimulatedHDC1000();
+
+    // data members
+    std::mutex _mutex;
+    float _temperature                        = 22.0f;
+    float _humidity                           = 45.0f;
+    std::chrono::microseconds _conversionTime = kDefaultConversionTime;
+    uint8_t _pointer                          = 0x00;
+    uint16_t _configuration;
+    // pointer of the measurement being converted and end of its conversion
+    uint8_t _measurementPointer = 0x00;
+    bool _isMeasurementPending  = false;
+    Clock::time_point _conversionEndTime;
+    uint32_t _nbrOfConversions = 0;
+};
+
+}  // namespace host
@@ -0,0 +1,62 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file stm32h747i_discovery_lcd.h
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief LCD BSP of the DISCO_H747I board for the host port layer
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+
+// return codes, as defined by the BSP
+#define BSP_ERROR_NONE 0
+#define BSP_ERROR_NO_INIT -1
+#define BSP_ERROR_WRONG_PARAM -2
+
+#define LCD_ORIENTATION_PORTRAIT 0U
+#define LCD_ORIENTATION_LANDSCAPE 1U
+
+#define LCD_PIXEL_FORMAT_ARGB8888 0U
+#define LCD_PIXEL_FORMAT_RGB565 2U
+
+// the simulated LCD is the 800 x 480 ARGB8888 panel of the board (instance 0, landscape
+// orientation only), whose pixels are kept in memory
+int32_t BSP_LCD_Init(uint32_t instance, uint32_t orientation);
+int32_t BSP_LCD_DeInit(uint32_t instance);
+int32_t BSP_LCD_GetXSize(uint32_t instance, uint32_t* xSize);
+int32_t BSP_LCD_GetYSize(uint32_t instance, uint32_t* ySize);
+int32_t BSP_LCD_GetFormat(uint32_t instance, uint32_t* format);
+// the pixels of the rectangle are in the format of the LCD, row after row
+int32_t BSP_LCD_FillRGBRect(uint32_t instance,
+                            uint32_t x,
+                            uint32_t y,
+                            uint8_t* data,
+                            uint32_t width,
+                            uint32_t height);
+// the color is an ARGB8888 color
+int32_t BSP_LCD_FillRect(uint32_t instance,
+                         uint32_t x,
+                         uint32_t y,
+                         uint32_t width,
+                         uint32_t height,
+                         uint32_t color);
+int32_t BSP_LCD_WritePixel(uint32_t instance, uint32_t x, uint32_t y, uint32_t color);
+int32_t BSP_LCD_ReadPixel(uint32_t instance, uint32_t x, uint32_t y, uint32_t* color);
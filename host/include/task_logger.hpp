@@ -0,0 +1,70 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file task_logger.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Task logger of the advembsof library (host port layer)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include <chrono>
+
+#include "mbed.h"
+
+namespace advembsof {
+
+class TaskLogger {
+   public:
+    // task indices
+    static constexpr uint8_t kGearTaskIndex        = 0;
+    static constexpr uint8_t kSpeedTaskIndex       = 1;
+    static constexpr uint8_t kTemperatureTaskIndex = 2;
+    static constexpr uint8_t kResetTaskIndex       = 3;
+    static constexpr uint8_t kDisplayTask1Index    = 4;
+    static constexpr uint8_t kDisplayTask2Index    = 5;
+    static constexpr uint8_t kNbrOfTasks           = 6;
+
+    TaskLogger();
+
+    // make the class non copyable
+    TaskLogger(TaskLogger&)            = delete;
+    TaskLogger& operator=(TaskLogger&) = delete;
+
+    void enable(bool enable);
+
+    // method called at the end of each task instance: the period is measured between
+    // successive start times
+    void logPeriodAndExecutionTime(
+        Timer& timer,  // NOLINT(runtime/references)
+        int taskIndex,
+        const std::chrono::microseconds& taskStartTime);
+
+    std::chrono::microseconds getPeriod(int taskIndex) const;
+    std::chrono::microseconds getComputationTime(int taskIndex) const;
+
+   private:
+    // data members
+    bool _isEnabled = false;
+    std::chrono::microseconds _lastStartTime[kNbrOfTasks];
+    std::chrono::microseconds _period[kNbrOfTasks];
+    std::chrono::microseconds _computationTime[kNbrOfTasks];
+};
+
+}  // namespace advembsof
@@ -0,0 +1,105 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file unity.h
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief unity assertions of the host test harness (host port layer)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+namespace utest {
+namespace v1 {
+
+// called upon a failed assertion, does not return (the running case is aborted)
+[[noreturn]] void fail(const char* file, int line, const char* message);
+
+// as with unity, the arguments of the assertions are evaluated once
+template <typename T>
+bool isWithin(T delta, T expected, T actual) {
+    return ((actual >= expected) ? (actual - expected) : (expected - actual)) <= delta;
+}
+
+inline bool isEqualString(const char* expected, const char* actual) {
+    return std::strcmp(expected, actual) == 0;
+}
+
+// same relative precision as unity
+inline bool isEqualFloat(float expected, float actual) {
+    return isWithin(std::fabs(expected) * 0.00001f, expected, actual);
+}
+
+}  // namespace v1
+}  // namespace utest
+
+#define UTEST_HOST_CHECK(condition, message)                \
+    do {                                                    \
+        if (!(condition)) {                                 \
+            utest::v1::fail(__FILE__, __LINE__, (message)); \
+        }                                                   \
+    } while (0)
+
+#define UTEST_HOST_CHECK_EQUAL(type, expected, actual)                         \
+    UTEST_HOST_CHECK(static_cast<type>(expected) == static_cast<type>(actual), \
+                     "Expected " #expected " was " #actual)
+
+#define UTEST_HOST_CHECK_WITHIN(type, delta, expected, actual)             \
+    UTEST_HOST_CHECK(utest::v1::isWithin<type>(static_cast<type>(delta),    \
+                                               static_cast<type>(expected), \
+                                               static_cast<type>(actual)),  \
+                     "Values " #expected " and " #actual " not within delta " #delta)
+
+#define TEST_ASSERT(condition) UTEST_HOST_CHECK((condition), #condition)
+#define TEST_ASSERT_TRUE(condition) \
+    UTEST_HOST_CHECK((condition), "Expected TRUE " #condition)
+#define TEST_ASSERT_FALSE(condition) \
+    UTEST_HOST_CHECK(!(condition), "Expected FALSE " #condition)
+
+#define TEST_ASSERT_EQUAL(expected, actual) \
+    UTEST_HOST_CHECK_EQUAL(int64_t, expected, actual)
+#define TEST_ASSERT_EQUAL_INT(expected, actual) \
+    UTEST_HOST_CHECK_EQUAL(int, expected, actual)
+#define TEST_ASSERT_EQUAL_INT64(expected, actual) \
+    UTEST_HOST_CHECK_EQUAL(int64_t, expected, actual)
+#define TEST_ASSERT_EQUAL_UINT8(expected, actual) \
+    UTEST_HOST_CHECK_EQUAL(uint8_t, expected, actual)
+#define TEST_ASSERT_EQUAL_UINT16(expected, actual) \
+    UTEST_HOST_CHECK_EQUAL(uint16_t, expected, actual)
+#define TEST_ASSERT_EQUAL_UINT32(expected, actual) \
+    UTEST_HOST_CHECK_EQUAL(uint32_t, expected, actual)
+
+#define TEST_ASSERT_INT_WITHIN(delta, expected, actual) \
+    UTEST_HOST_CHECK_WITHIN(int64_t, delta, expected, actual)
+#define TEST_ASSERT_UINT32_WITHIN(delta, expected, actual) \
+    UTEST_HOST_CHECK_WITHIN(uint32_t, delta, expected, actual)
+#define TEST_ASSERT_UINT64_WITHIN(delta, expected, actual) \
+    UTEST_HOST_CHECK_WITHIN(uint64_t, delta, expected, actual)
+#define TEST_ASSERT_FLOAT_WITHIN(delta, expected, actual) \
+    UTEST_HOST_CHECK_WITHIN(float, delta, expected, actual)
+#define TEST_ASSERT_EQUAL_FLOAT(expected, actual)                          \
+    UTEST_HOST_CHECK(utest::v1::isEqualFloat(static_cast<float>(expected), \
+                                             static_cast<float>(actual)),  \
+                     "Expected " #expected " was " #actual)
+#define TEST_ASSERT_EQUAL_STRING(expected, actual)                   \
+    UTEST_HOST_CHECK(utest::v1::isEqualString((expected), (actual)), \
+                     "Expected " #expected " was " #actual)
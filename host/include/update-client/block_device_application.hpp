@@ -0,0 +1,83 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file block_device_application.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief update_client::BlockDeviceApplication (host port layer)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+
+#include "mbed.h"
+#include "mbed_port/block_device.hpp"
+
+namespace update_client {
+
+// application stored on a block device and preceded by its header: the host port only
+// implements the header part of the update-client library (the application binary is
+// not verified)
+class BlockDeviceApplication {
+   public:
+    BlockDeviceApplication(BlockDevice& blockDevice,  // NOLINT(runtime/references)
+                           mbed::bd_addr_t applicationHeaderAddress,
+                           mbed::bd_addr_t applicationAddress);
+
+    // make the class non copyable
+    BlockDeviceApplication(BlockDeviceApplication&)            = delete;
+    BlockDeviceApplication& operator=(BlockDeviceApplication&) = delete;
+
+    // the header is read from the block device at each call, so that an application
+    // stored after the construction is seen (as after a download)
+    bool isValid();
+    uint64_t getFirmwareVersion();
+    uint64_t getFirmwareSize();
+    mbed::bd_addr_t getApplicationAddress() const;
+
+    // method used for storing the header of a simulated application, an erased header
+    // makes the application invalid
+    int writeHeader(uint64_t firmwareVersion, uint64_t firmwareSize);
+    int eraseHeader();
+
+   private:
+    struct ApplicationHeader {
+        uint32_t magic;
+        uint32_t headerVersion;
+        uint64_t firmwareVersion;
+        uint64_t firmwareSize;
+        // CRC-32 of the fields above
+        uint32_t checksum;
+        uint32_t reserved;
+    };
+
+    // private methods
+    bool readHeader(ApplicationHeader& header);  // NOLINT(runtime/references)
+    static uint32_t computeChecksum(const ApplicationHeader& header);
+
+    static constexpr uint32_t kHeaderMagic   = 0x5A51AE55;
+    static constexpr uint32_t kHeaderVersion = 1;
+
+    // data members
+    BlockDevice& _blockDevice;
+    const mbed::bd_addr_t _applicationHeaderAddress;
+    const mbed::bd_addr_t _applicationAddress;
+};
+
+}  // namespace update_client
@@ -0,0 +1,71 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file candidate_applications.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief update_client::CandidateApplications (host port layer)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "block_device_application.hpp"
+#include "mbed.h"
+#include "mbed_port/block_device.hpp"
+
+namespace update_client {
+
+// candidate applications stored in equally sized slots of a block device, each slot
+// starting with the application header
+class CandidateApplications {
+   public:
+    CandidateApplications(BlockDevice& blockDevice,  // NOLINT(runtime/references)
+                          mbed::bd_addr_t storageAddress,
+                          mbed::bd_size_t storageSize,
+                          uint32_t headerSize,
+                          uint32_t nbrOfSlots);
+    virtual ~CandidateApplications() = default;
+
+    // make the class non copyable
+    CandidateApplications(CandidateApplications&)            = delete;
+    CandidateApplications& operator=(CandidateApplications&) = delete;
+
+    uint32_t getNbrOfSlots() const;
+    BlockDeviceApplication& getBlockDeviceApplication(uint32_t slotIndex);
+    int32_t getCandidateAddress(
+        uint32_t slotIndex,
+        mbed::bd_addr_t& candidateAddress,  // NOLINT(runtime/references)
+        mbed::bd_size_t& slotSize) const;   // NOLINT(runtime/references)
+
+    // method returning the slot where a downloaded candidate is stored, the library
+    // uses the first slot (applications override it)
+    virtual uint32_t getSlotForCandidate();
+
+   private:
+    // data members
+    const mbed::bd_addr_t _storageAddress;
+    const mbed::bd_size_t _slotSize;
+    const uint32_t _nbrOfSlots;
+    std::vector<std::unique_ptr<BlockDeviceApplication>> _blockDeviceApplications;
+};
+
+}  // namespace update_client
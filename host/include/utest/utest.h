@@ -0,0 +1,81 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file utest.h
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief utest cases, specification and harness (host port layer)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+
+namespace utest {
+namespace v1 {
+
+enum status_t { STATUS_CONTINUE = 0, STATUS_ABORT = -1 };
+
+// only moving to the next case is supported
+struct control_t {};
+static const control_t CaseNext = control_t();
+
+using case_handler_t            = void (*)();
+using case_call_count_handler_t = control_t (*)(const size_t);
+using test_setup_handler_t      = status_t (*)(const size_t);
+
+class Case {
+   public:
+    Case(const char* description, case_handler_t handler);
+    Case(const char* description, case_call_count_handler_t handler);
+
+    const char* getDescription() const;
+    void run() const;
+
+   private:
+    const char* _description;
+    case_handler_t _handler                     = nullptr;
+    case_call_count_handler_t _callCountHandler = nullptr;
+};
+
+class Specification {
+   public:
+    template <size_t N>
+    Specification(test_setup_handler_t setupHandler, Case (&cases)[N])
+        : _setupHandler(setupHandler), _cases(cases), _nbrOfCases(N) {}
+
+   private:
+    friend class Harness;
+
+    test_setup_handler_t _setupHandler;
+    const Case* _cases;
+    size_t _nbrOfCases;
+};
+
+// runs the cases in sequence, a failed assertion aborting the running case
+class Harness {
+   public:
+    static bool run(const Specification& specification);
+};
+
+status_t greentea_test_setup_handler(const size_t numberOfCases);
+
+}  // namespace v1
+}  // namespace utest
+
+using utest::v1::greentea_test_setup_handler;
@@ -0,0 +1,205 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file input_script.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Scripted simulated inputs of the host bike computer
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include "input_script.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <thread>
+
+#include "mbed_port/simulated_pins.hpp"
+#include "scope_profiler.hpp"
+#include "simulated_hdc1000.hpp"
+
+#include "mbed_trace.h"
+#if MBED_CONF_MBED_TRACE_ENABLE
+#define TRACE_GROUP "InputScript"
+#endif  // MBED_CONF_MBED_TRACE_ENABLE
+
+namespace host {
+
+// the reset button of the board
+static constexpr PinName kResetButtonPin = BUTTON1;
+
+struct JoystickStateName {
+    const char* name;
+    disco::Joystick::State state;
+};
+
+static const JoystickStateName kJoystickStateNames[] = {
+    {"none", disco::Joystick::State::NotPressed},
+    {"up", disco::Joystick::State::UpPressed},
+    {"down", disco::Joystick::State::DownPressed},
+    {"left", disco::Joystick::State::LeftPressed},
+    {"right", disco::Joystick::State::RightPressed},
+    {"sel", disco::Joystick::State::SelPressed}};
+
+InputScript::InputScript(bike_computer::TaskTable& taskTable) : _taskTable(taskTable) {}
+
+bool InputScript::load(const char* fileName) {
+    FILE* file = fopen(fileName, "r");
+    if (file == nullptr) {
+        tr_error("Cannot open script %s", fileName);
+        return false;
+    }
+    static constexpr uint16_t kMaxLineSize = 128;
+    char line[kMaxLineSize];
+    uint32_t lineNumber = 0;
+    bool isValid        = true;
+    while (isValid && fgets(line, sizeof(line), file) != nullptr) {
+        lineNumber++;
+        // skip comments and empty lines
+        char* comment = strchr(line, '#');
+        if (comment != nullptr) {
+            *comment = '\0';
+        }
+        if (strspn(line, " \t\r\n") == strlen(line)) {
+            continue;
+        }
+        Step step;
+        isValid = parseLine(line, step);
+        if (!isValid) {
+            tr_error("Invalid line %" PRIu32 " in script %s", lineNumber, fileName);
+            break;
+        }
+        // steps are executed in the order of their time
+        auto it = _steps.end();
+        while (it != _steps.begin() && (it - 1)->time > step.time) {
+            --it;
+        }
+        _steps.insert(it, step);
+    }
+    fclose(file);
+    return isValid;
+}
+
+void InputScript::run(const std::chrono::milliseconds& duration) {
+    const auto startTime = std::chrono::steady_clock::now();
+    for (const Step& step : _steps) {
+        if (duration != std::chrono::milliseconds::zero() && step.time > duration) {
+            break;
+        }
+        std::this_thread::sleep_until(startTime + step.time);
+        if (!execute(step)) {
+            return;
+        }
+    }
+    if (duration == std::chrono::milliseconds::zero()) {
+        // run until the process is terminated
+        while (true) {
+            std::this_thread::sleep_for(std::chrono::hours(1));
+        }
+    }
+    std::this_thread::sleep_until(startTime + duration);
+}
+
+bool InputScript::parseLine(const char* line, Step& step) {
+    uint32_t time                   = 0;
+    char command[16]                = {0};
+    char argument[kMaxArgumentSize] = {0};
+    // the offset is not set when the line holds no argument
+    int argumentOffset    = static_cast<int>(strlen(line));
+    const int nbrOfTokens = sscanf(
+        line, "%" SCNu32 " %15s %n", &time, command, &argumentOffset);
+    if (nbrOfTokens != 2) {
+        return false;
+    }
+    step.time = std::chrono::milliseconds(time);
+    // the argument is the rest of the line
+    strncpy(argument, line + argumentOffset, sizeof(argument) - 1);
+    argument[strcspn(argument, "\r\n")] = '\0';
+
+    if (strcmp(command, "joystick") == 0) {
+        step.command = Command::Joystick;
+        for (const JoystickStateName& stateName : kJoystickStateNames) {
+            if (strcmp(argument, stateName.name) == 0) {
+                step.state = stateName.state;
+                return true;
+            }
+        }
+        return false;
+    }
+    if (strcmp(command, "stop") == 0) {
+        step.command = Command::Stop;
+        return true;
+    }
+    if (strcmp(command, "command") == 0) {
+        step.command = Command::Task;
+        strncpy(step.argument, argument, sizeof(step.argument) - 1);
+        return strlen(argument) > 0;
+    }
+
+    // the remaining commands take a numerical argument
+    if (strcmp(command, "button") == 0) {
+        step.command = Command::Button;
+    } else if (strcmp(command, "temperature") == 0) {
+        step.command = Command::Temperature;
+    } else if (strcmp(command, "humidity") == 0) {
+        step.command = Command::Humidity;
+    } else if (strcmp(command, "conversion") == 0) {
+        step.command = Command::Conversion;
+    } else {
+        return false;
+    }
+    return sscanf(argument, "%f", &step.value) == 1;
+}
+
+bool InputScript::execute(const Step& step) {
+    switch (step.command) {
+        case Command::Joystick:
+            disco::Joystick::getInstance().setSimulatedState(step.state);
+            break;
+
+        case Command::Button:
+            SimulatedPins::getInstance().write(kResetButtonPin,
+                                               static_cast<int>(step.value));
+            break;
+
+        case Command::Temperature:
+            SimulatedHDC1000::getInstance().setTemperature(step.value);
+            break;
+
+        case Command::Humidity:
+            SimulatedHDC1000::getInstance().setHumidity(step.value);
+            break;
+
+        case Command::Conversion:
+            SimulatedHDC1000::getInstance().setConversionTime(
+                std::chrono::microseconds(static_cast<int64_t>(step.value)));
+            break;
+
+        case Command::Task:
+            if (!bike_computer::ScopeProfiler::getInstance().executeCommand(
+                    step.argument)) {
+                _taskTable.executeCommand(step.argument);
+            }
+            break;
+
+        case Command::Stop:
+            return false;
+    }
+    return true;
+}
+
+}  // namespace host
@@ -0,0 +1,92 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file input_script.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Scripted simulated inputs of the host bike computer
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include <chrono>
+#include <vector>
+
+#include "joystick.hpp"
+#include "mbed.h"
+#include "task_table.hpp"
+
+namespace host {
+
+// Script of timed input changes, one per line as "<time in ms> <command> [<argument>]"
+// ('#' starts a comment), with the following commands:
+// - joystick up|down|left|right|sel|none: change the joystick state
+// - button 0|1: change the level of the reset button
+// - temperature <value>, humidity <value>: change the simulated environment
+// - conversion <time in us>: change the conversion time of a sensor measurement
+// - command <task table command>: execute a task table command (see TaskTable) or
+//   a profiler command (see ScopeProfiler)
+// - stop: stop the run
+class InputScript {
+   public:
+    // NOLINTNEXTLINE(runtime/references)
+    explicit InputScript(bike_computer::TaskTable& taskTable);
+
+    // make the class non copyable
+    InputScript(InputScript&)            = delete;
+    InputScript& operator=(InputScript&) = delete;
+
+    // returns false if the file cannot be read or contains an invalid line
+    bool load(const char* fileName);
+
+    // method running the script from the calling thread, returns at the end of the
+    // duration or upon stop (a zero duration meaning no limit)
+    void run(const std::chrono::milliseconds& duration);
+
+   private:
+    enum class Command {
+        Joystick,
+        Button,
+        Temperature,
+        Humidity,
+        Conversion,
+        Task,
+        Stop
+    };
+
+    static constexpr uint8_t kMaxArgumentSize = 64;
+
+    struct Step {
+        std::chrono::milliseconds time  = std::chrono::milliseconds::zero();
+        Command command                 = Command::Stop;
+        disco::Joystick::State state    = disco::Joystick::State::NotPressed;
+        float value                     = 0.0f;
+        char argument[kMaxArgumentSize] = {0};
+    };
+
+    // private methods
+    bool parseLine(const char* line, Step& step);
+    // returns false upon stop
+    bool execute(const Step& step);
+
+    // data members
+    bike_computer::TaskTable& _taskTable;
+    std::vector<Step> _steps;
+};
+
+}  // namespace host
@@ -0,0 +1,244 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file main.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief main function for the bike computer running as a host process
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "allocation_guard.hpp"
+#include "deferred_log.hpp"
+#include "deferred_log_decoder.hpp"
+#include "input_script.hpp"
+#include "mbed.h"
+#include "metrics_decoder.hpp"
+#include "metrics_exporter.hpp"
+#include "multi_tasking/bike_system.hpp"
+#include "scope_profiler.hpp"
+#include "static_scheduling/bike_system.hpp"
+#include "static_scheduling_with_event/bike_system.hpp"
+#include "task_console.hpp"
+
+#include "mbed_trace.h"
+#if MBED_CONF_MBED_TRACE_ENABLE
+#define TRACE_GROUP "main"
+#endif  // MBED_CONF_MBED_TRACE_ENABLE
+
+struct Options {
+    const char* variant     = "static_scheduling";
+    const char* script      = nullptr;
+    const char* logFile     = nullptr;
+    const char* metricsFile = nullptr;
+    uint32_t duration       = 0;
+    bool isConsoleEnabled   = false;
+    bool isQuiet            = false;
+};
+
+static void printUsage(const char* program) {
+    printf("Usage: %s [-v <variant>] [-s <script>] [-d <duration in s>] [-l <log file>]"
+           " [-m <metrics file>] [-c] [-q]\n"
+           "  -v: static_scheduling (default), static_scheduling_event_queue,\n"
+           "      static_scheduling_with_event or multi_tasking\n"
+           "  -s: script of simulated inputs (see host/input_script.hpp)\n"
+           "  -d: duration of the run, unlimited by default\n"
+           "  -l: binary file of the deferred log (see tools/decode_deferred_log.cpp),\n"
+           "      the deferred log records being decoded to the console by default\n"
+           "  -m: binary file of the metrics (see tools/decode_metrics.cpp), the final\n"
+           "      values of the metrics being printed to the console by default\n"
+           "  -c: read task table and profiler commands from the console\n"
+           "  -q: print info, warning and error traces only (and no profiler table)\n",
+           program);
+}
+
+// the deferred log records are printed as traces, when not written to a file
+static void traceDeferredLogRecord(const host::DeferredLogDecoder::Record& record) {
+    char text[256];
+    host::DeferredLogDecoder::format(record, text, sizeof(text));
+    const bike_computer::LogFormat& format = host::DeferredLogDecoder::getFormat(record);
+    mbed_tracef(format.level, format.group, "%s", text);
+}
+
+static host::DeferredLogDecoder gDeferredLogDecoder(callback(traceDeferredLogRecord));
+static FILE* gDeferredLogFile = nullptr;
+
+static void decodeDeferredLog(const uint8_t* data, size_t size) {
+    gDeferredLogDecoder.decode(data, size);
+}
+
+static void writeDeferredLog(const uint8_t* data, size_t size) {
+    fwrite(data, 1, size, gDeferredLogFile);
+}
+
+// the metrics are decoded for printing their final values, when not written to a file
+static void ignoreMetricsFrame(const host::MetricsDecoder& decoder) {}
+
+static host::MetricsDecoder gMetricsDecoder(callback(ignoreMetricsFrame));
+static FILE* gMetricsFile = nullptr;
+
+static void decodeMetrics(const uint8_t* data, size_t size) {
+    gMetricsDecoder.decode(data, size);
+}
+
+static void writeMetrics(const uint8_t* data, size_t size) {
+    fwrite(data, 1, size, gMetricsFile);
+}
+
+template <typename System>
+static int runBikeSystem(const Options& options) {
+    System bikeSystem;
+
+    // subscribe before starting for reporting the final ride state
+    bike_computer::RideStateBus& rideStateBus = bikeSystem.getRideStateBus();
+    auto gearSubscriber                       = rideStateBus.subscribeGear();
+    auto speedSubscriber                      = rideStateBus.subscribeSpeed();
+
+    host::InputScript inputScript(bikeSystem.getTaskTable());
+    if (options.script != nullptr && !inputScript.load(options.script)) {
+        return EXIT_FAILURE;
+    }
+
+    bike_computer::TaskConsole taskConsole(bikeSystem.getTaskTable());
+    if (options.isConsoleEnabled) {
+        taskConsole.start();
+    }
+
+    // the bike system runs in its own thread, while the inputs are simulated from
+    // the main thread
+    Thread bikeSystemThread(osPriorityNormal, OS_STACK_SIZE, nullptr, "BikeSystem");
+    bikeSystemThread.start(callback(&bikeSystem, &System::start));
+    inputScript.run(std::chrono::seconds(options.duration));
+    bikeSystem.stop();
+    bikeSystemThread.join();
+
+    // the pending records of the deferred log are sent when the log is stopped
+    bike_computer::DeferredLog::getInstance().stop();
+    if (gDeferredLogFile != nullptr) {
+        fclose(gDeferredLogFile);
+    }
+    // the last deltas are exported when the exporter is stopped
+    bike_computer::MetricsExporter::getInstance().stop();
+    if (gMetricsFile != nullptr) {
+        fclose(gMetricsFile);
+    } else {
+        char header[1024];
+        char row[1024];
+        host::MetricsDecoder::formatCsvHeader(header, sizeof(header));
+        gMetricsDecoder.formatCsvRow(row, sizeof(row));
+        printf("Final metrics:\n%s\n%s\n", header, row);
+    }
+
+    if (!options.isQuiet) {
+        bike_computer::ScopeProfiler::getInstance().print();
+    }
+    // reports the allocations made in the steady state of the bike system, if any
+    bike_computer::AllocationGuard::printStats();
+
+    gearSubscriber.update();
+    speedSubscriber.update();
+    printf("Final ride state: gear %d, speed %.1f km/h, distance %.3f km\n",
+           gearSubscriber.getValue().gear,
+           speedSubscriber.getValue().speed,
+           speedSubscriber.getValue().distance);
+    return EXIT_SUCCESS;
+}
+
+int main(int argc, char* argv[]) {
+    Options options;
+    int option = 0;
+    while ((option = getopt(argc, argv, "v:s:d:l:m:cqh")) != -1) {
+        switch (option) {
+            case 'v':
+                options.variant = optarg;
+                break;
+            case 's':
+                options.script = optarg;
+                break;
+            case 'l':
+                options.logFile = optarg;
+                break;
+            case 'm':
+                options.metricsFile = optarg;
+                break;
+            case 'd':
+                options.duration = static_cast<uint32_t>(strtoul(optarg, nullptr, 10));
+                break;
+            case 'c':
+                options.isConsoleEnabled = true;
+                break;
+            case 'q':
+                options.isQuiet = true;
+                break;
+            default:
+                printUsage(argv[0]);
+                return EXIT_FAILURE;
+        }
+    }
+    mbed_trace_init();
+    if (options.isQuiet) {
+        mbed_trace_config_set(TRACE_ACTIVE_LEVEL_INFO);
+    }
+    tr_info("Running the %s bike system", options.variant);
+
+    bike_computer::DeferredLog& deferredLog = bike_computer::DeferredLog::getInstance();
+    if (options.logFile != nullptr) {
+        gDeferredLogFile = fopen(options.logFile, "wb");
+        if (gDeferredLogFile == nullptr) {
+            printf("Cannot open %s\n", options.logFile);
+            return EXIT_FAILURE;
+        }
+        deferredLog.setSink(callback(writeDeferredLog));
+    } else {
+        deferredLog.setSink(callback(decodeDeferredLog));
+    }
+
+    bike_computer::MetricsExporter& metricsExporter =
+        bike_computer::MetricsExporter::getInstance();
+    if (options.metricsFile != nullptr) {
+        gMetricsFile = fopen(options.metricsFile, "wb");
+        if (gMetricsFile == nullptr) {
+            printf("Cannot open %s\n", options.metricsFile);
+            return EXIT_FAILURE;
+        }
+        metricsExporter.setSink(callback(writeMetrics));
+    } else {
+        metricsExporter.setSink(callback(decodeMetrics));
+    }
+
+    if (strcmp(options.variant, "static_scheduling") == 0) {
+        return runBikeSystem<static_scheduling::BikeSystem>(options);
+    }
+    if (strcmp(options.variant, "static_scheduling_event_queue") == 0) {
+        return runBikeSystem<static_scheduling::BikeSystemWithEventQueue>(options);
+    }
+    if (strcmp(options.variant, "static_scheduling_with_event") == 0) {
+        return runBikeSystem<static_scheduling_with_event::BikeSystem>(options);
+    }
+    if (strcmp(options.variant, "multi_tasking") == 0) {
+        return runBikeSystem<multi_tasking::BikeSystem>(options);
+    }
+    printUsage(argv[0]);
+    return EXIT_FAILURE;
+}
@@ -0,0 +1,109 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file block_device_application.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief update_client::BlockDeviceApplication implementation (host port layer)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include "update-client/block_device_application.hpp"
+
+#include <cstddef>
+
+#include "mbed_trace.h"
+#if MBED_CONF_MBED_TRACE_ENABLE
+#define TRACE_GROUP "BlockDeviceApplication"
+#endif  // MBED_CONF_MBED_TRACE_ENABLE
+
+namespace update_client {
+
+// definitions required when the constants are odr-used (C++14)
+constexpr uint32_t BlockDeviceApplication::kHeaderMagic;
+constexpr uint32_t BlockDeviceApplication::kHeaderVersion;
+
+BlockDeviceApplication::BlockDeviceApplication(BlockDevice& blockDevice,
+                                               mbed::bd_addr_t applicationHeaderAddress,
+                                               mbed::bd_addr_t applicationAddress)
+    : _blockDevice(blockDevice),
+      _applicationHeaderAddress(applicationHeaderAddress),
+      _applicationAddress(applicationAddress) {}
+
+bool BlockDeviceApplication::isValid() {
+    ApplicationHeader header;
+    return readHeader(header);
+}
+
+uint64_t BlockDeviceApplication::getFirmwareVersion() {
+    ApplicationHeader header;
+    return readHeader(header) ? header.firmwareVersion : 0;
+}
+
+uint64_t BlockDeviceApplication::getFirmwareSize() {
+    ApplicationHeader header;
+    return readHeader(header) ? header.firmwareSize : 0;
+}
+
+mbed::bd_addr_t BlockDeviceApplication::getApplicationAddress() const {
+    return _applicationAddress;
+}
+
+int BlockDeviceApplication::writeHeader(uint64_t firmwareVersion, uint64_t firmwareSize) {
+    ApplicationHeader header = {};
+    header.magic             = kHeaderMagic;
+    header.headerVersion     = kHeaderVersion;
+    header.firmwareVersion   = firmwareVersion;
+    header.firmwareSize      = firmwareSize;
+    header.checksum          = computeChecksum(header);
+    int result               = eraseHeader();
+    if (result != mbed::BD_ERROR_OK) {
+        return result;
+    }
+    return _blockDevice.program(&header, _applicationHeaderAddress, sizeof(header));
+}
+
+int BlockDeviceApplication::eraseHeader() {
+    return _blockDevice.erase(_applicationHeaderAddress, _blockDevice.get_erase_size());
+}
+
+bool BlockDeviceApplication::readHeader(ApplicationHeader& header) {
+    int result = _blockDevice.read(&header, _applicationHeaderAddress, sizeof(header));
+    if (result != mbed::BD_ERROR_OK) {
+        tr_error("Cannot read header at address 0x%" PRIx64 ": %d",
+                 _applicationHeaderAddress,
+                 result);
+        return false;
+    }
+    return header.magic == kHeaderMagic && header.headerVersion == kHeaderVersion &&
+           header.checksum == computeChecksum(header);
+}
+
+uint32_t BlockDeviceApplication::computeChecksum(const ApplicationHeader& header) {
+    // bitwise CRC-32 (IEEE 802.3), the header is small
+    const uint8_t* data = reinterpret_cast<const uint8_t*>(&header);
+    uint32_t crc        = 0xFFFFFFFF;
+    for (size_t index = 0; index < offsetof(ApplicationHeader, checksum); index++) {
+        crc ^= data[index];
+        for (uint8_t bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+        }
+    }
+    return ~crc;
+}
+
+}  // namespace update_client
@@ -0,0 +1,70 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file candidate_applications.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief update_client::CandidateApplications implementation (host port layer)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include "update-client/candidate_applications.hpp"
+
+#include "mbed_trace.h"
+#if MBED_CONF_MBED_TRACE_ENABLE
+#define TRACE_GROUP "CandidateApplications"
+#endif  // MBED_CONF_MBED_TRACE_ENABLE
+
+namespace update_client {
+
+CandidateApplications::CandidateApplications(BlockDevice& blockDevice,
+                                             mbed::bd_addr_t storageAddress,
+                                             mbed::bd_size_t storageSize,
+                                             uint32_t headerSize,
+                                             uint32_t nbrOfSlots)
+    : _storageAddress(storageAddress),
+      _slotSize(storageSize / nbrOfSlots),
+      _nbrOfSlots(nbrOfSlots) {
+    for (uint32_t slotIndex = 0; slotIndex < _nbrOfSlots; slotIndex++) {
+        const mbed::bd_addr_t candidateAddress = _storageAddress + slotIndex * _slotSize;
+        _blockDeviceApplications.emplace_back(new BlockDeviceApplication(
+            blockDevice, candidateAddress, candidateAddress + headerSize));
+    }
+}
+
+uint32_t CandidateApplications::getNbrOfSlots() const { return _nbrOfSlots; }
+
+BlockDeviceApplication& CandidateApplications::getBlockDeviceApplication(
+    uint32_t slotIndex) {
+    return *_blockDeviceApplications[slotIndex];
+}
+
+int32_t CandidateApplications::getCandidateAddress(uint32_t slotIndex,
+                                                   mbed::bd_addr_t& candidateAddress,
+                                                   mbed::bd_size_t& slotSize) const {
+    if (slotIndex >= _nbrOfSlots) {
+        tr_error("Invalid slot index %" PRIu32, slotIndex);
+        return -1;
+    }
+    candidateAddress = _storageAddress + slotIndex * _slotSize;
+    slotSize         = _slotSize;
+    return 0;
+}
+
+uint32_t CandidateApplications::getSlotForCandidate() { return 0; }
+
+}  // namespace update_client
@@ -0,0 +1,56 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file cpu_logger.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief CPU logger implementation (host port layer)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include "cpu_logger.hpp"
+
+#include "mbed_trace.h"
+#if MBED_CONF_MBED_TRACE_ENABLE
+#define TRACE_GROUP "CPULogger"
+#endif  // MBED_CONF_MBED_TRACE_ENABLE
+
+namespace advembsof {
+
+CPULogger::CPULogger(Timer& timer) : _timer(timer) {
+    mbed_stats_cpu_t stats;
+    mbed_stats_cpu_get(&stats);
+    _lastUptime   = stats.uptime;
+    _lastIdleTime = stats.idle_time;
+}
+
+void CPULogger::printStats() {
+    mbed_stats_cpu_t stats;
+    mbed_stats_cpu_get(&stats);
+    const uint64_t uptimeDiff = stats.uptime - _lastUptime;
+    const uint64_t idleDiff   = stats.idle_time - _lastIdleTime;
+    _lastUptime               = stats.uptime;
+    _lastIdleTime             = stats.idle_time;
+    if (uptimeDiff == 0 || idleDiff > uptimeDiff) {
+        return;
+    }
+    const uint8_t idle  = static_cast<uint8_t>((idleDiff * 100) / uptimeDiff);
+    const uint8_t usage = 100 - idle;
+    tr_info("Idle: %d%% Usage: %d%%", idle, usage);
+}
+
+}  // namespace advembsof
@@ -0,0 +1,67 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file display_device.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Simulated display device implementation (host port layer)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include "display_device.hpp"
+
+#include "mbed_trace.h"
+#if MBED_CONF_MBED_TRACE_ENABLE
+#define TRACE_GROUP "DisplayDevice"
+#endif  // MBED_CONF_MBED_TRACE_ENABLE
+
+namespace advembsof {
+
+disco::ReturnCode DisplayDevice::init() {
+    _isInitialized = true;
+    return disco::ReturnCode::Ok;
+}
+
+void DisplayDevice::displayGear(uint8_t gear) {
+    _gear = gear;
+    tr_debug("Gear: %d", gear);
+}
+
+void DisplayDevice::displaySpeed(float speed) {
+    _speed = speed;
+    tr_debug("Speed: %.1f km/h", speed);
+}
+
+void DisplayDevice::displayDistance(float distance) {
+    _distance = distance;
+    tr_debug("Distance: %.2f km", distance);
+}
+
+void DisplayDevice::displayTemperature(float temperature) {
+    _temperature = temperature;
+    tr_debug("Temperature: %.1f C", temperature);
+}
+
+uint8_t DisplayDevice::getDisplayedGear() const { return _gear; }
+
+float DisplayDevice::getDisplayedSpeed() const { return _speed; }
+
+float DisplayDevice::getDisplayedDistance() const { return _distance; }
+
+float DisplayDevice::getDisplayedTemperature() const { return _temperature; }
+
+}  // namespace advembsof
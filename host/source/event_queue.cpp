@@ -0,0 +1,161 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file event_queue.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief events::EventQueue implementation (host port layer)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include "mbed_port/event_queue.hpp"
+
+#include <limits>
+
+namespace events {
+
+// definition required when the constant is odr-used (C++14)
+constexpr std::chrono::milliseconds EventQueue::kNoPeriod;
+
+EventQueue::EventQueue(unsigned size, unsigned char* buffer)
+    // as the buffer of equeue, the events are allocated upon construction
+    : _freeEvents(size / EVENTS_EVENT_SIZE) {}
+
+void EventQueue::dispatch_forever() { dispatch(true, Clock::time_point()); }
+
+void EventQueue::dispatch_for(const std::chrono::milliseconds& duration) {
+    dispatch(false, Clock::now() + duration);
+}
+
+void EventQueue::break_dispatch() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _isBreakRequested = true;
+    _condition.notify_all();
+}
+
+bool EventQueue::cancel(int id) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (auto it = _postedEvents.begin(); it != _postedEvents.end(); ++it) {
+        if (it->id == id) {
+            recycle(it, _postedEvents);
+            return true;
+        }
+    }
+    // a periodic event may be cancelled while it is dispatched
+    if (id != 0 && id == _dispatchedId) {
+        _isDispatchedIdCancelled = true;
+        return true;
+    }
+    return false;
+}
+
+std::chrono::milliseconds EventQueue::time_left(int id) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (const PostedEvent& postedEvent : _postedEvents) {
+        if (postedEvent.id == id) {
+            const auto timeLeft = std::chrono::duration_cast<std::chrono::milliseconds>(
+                postedEvent.releaseTime - Clock::now());
+            return (timeLeft.count() > 0) ? timeLeft : std::chrono::milliseconds::zero();
+        }
+    }
+    return std::chrono::milliseconds(-1);
+}
+
+int EventQueue::post(Function function,
+                     const std::chrono::milliseconds& delay,
+                     const std::chrono::milliseconds& period) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_freeEvents.empty()) {
+        _freeEvents.emplace_back();
+    }
+    // ids are never 0, which is the error value
+    _lastId = (_lastId == std::numeric_limits<int>::max()) ? 1 : _lastId + 1;
+
+    const EventIterator event = _freeEvents.begin();
+    event->id                 = _lastId;
+    event->releaseTime        = Clock::now() + delay;
+    event->period             = period;
+    event->function           = std::move(function);
+    insert(event, _freeEvents);
+    _condition.notify_all();
+    return _lastId;
+}
+
+void EventQueue::dispatch(bool isForever, const Clock::time_point& deadline) {
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (true) {
+        if (_isBreakRequested) {
+            _isBreakRequested = false;
+            return;
+        }
+        const Clock::time_point now = Clock::now();
+        if (!isForever && now >= deadline) {
+            return;
+        }
+
+        // wait for the release of the first event
+        if (_postedEvents.empty() || _postedEvents.front().releaseTime > now) {
+            Clock::time_point wakeUpTime = deadline;
+            if (!_postedEvents.empty() &&
+                (isForever || _postedEvents.front().releaseTime < deadline)) {
+                wakeUpTime = _postedEvents.front().releaseTime;
+            }
+            if (isForever && _postedEvents.empty()) {
+                _condition.wait(lock);
+            } else {
+                _condition.wait_until(lock, wakeUpTime);
+            }
+            continue;
+        }
+
+        // dispatch the event without holding the lock
+        const EventIterator event = _postedEvents.begin();
+        _dispatchedEvents.splice(_dispatchedEvents.end(), _postedEvents, event);
+        _dispatchedId            = event->id;
+        _isDispatchedIdCancelled = false;
+        lock.unlock();
+        event->function();
+        lock.lock();
+        _dispatchedId = 0;
+
+        // periodic events are released at a fixed rate
+        if (event->period >= std::chrono::milliseconds::zero() &&
+            !_isDispatchedIdCancelled) {
+            event->releaseTime += event->period;
+            insert(event, _dispatchedEvents);
+        } else {
+            recycle(event, _dispatchedEvents);
+        }
+    }
+}
+
+void EventQueue::insert(EventIterator event, std::list<PostedEvent>& source) {
+    // events with the same release time are dispatched in the order of posting
+    auto it = _postedEvents.begin();
+    while (it != _postedEvents.end() && it->releaseTime <= event->releaseTime) {
+        ++it;
+    }
+    _postedEvents.splice(it, source, event);
+}
+
+void EventQueue::recycle(EventIterator event, std::list<PostedEvent>& source) {
+    // the arguments bound to the function are released
+    event->function.reset();
+    _freeEvents.splice(_freeEvents.begin(), source, event);
+}
+
+}  // namespace events
@@ -0,0 +1,106 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file hdc1000.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief HDC1000 sensor driver implementation (host port layer)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include "hdc1000.hpp"
+
+#include <thread>
+
+#include "simulated_hdc1000.hpp"
+
+namespace advembsof {
+
+namespace {
+
+constexpr uint8_t kTemperatureRegister    = 0x00;
+constexpr uint8_t kHumidityRegister       = 0x01;
+constexpr uint8_t kConfigurationRegister  = 0x02;
+constexpr uint8_t kManufacturerIdRegister = 0xFE;
+constexpr uint8_t kDeviceIdRegister       = 0xFF;
+constexpr uint16_t kManufacturerId        = 0x5449;
+constexpr uint16_t kDeviceId              = 0x1000;
+// single measurements with 14 bit resolution
+constexpr uint16_t kConfiguration = 0x0000;
+// conversion time of a 14 bit measurement (datasheet)
+constexpr std::chrono::microseconds kConversionTime = 6500us;
+// polling period and maximum number of attempts when the conversion lasts longer
+constexpr std::chrono::milliseconds kPollingPeriod = 1ms;
+constexpr int kMaxNbrOfAttempts                    = 100;
+
+}  // namespace
+
+HDC1000::HDC1000(PinName sda, PinName scl, PinName dataReady) : _i2c(sda, scl) {
+    // the simulated sensor is attached to the bus upon first use
+    host::SimulatedHDC1000::getInstance();
+}
+
+bool HDC1000::probe() {
+    uint16_t manufacturerId = 0;
+    uint16_t deviceId       = 0;
+    return readRegister(kManufacturerIdRegister, manufacturerId) &&
+           manufacturerId == kManufacturerId &&
+           readRegister(kDeviceIdRegister, deviceId) && deviceId == kDeviceId;
+}
+
+float HDC1000::getTemperature() {
+    return measure(kTemperatureRegister) * 165.0f / 65536.0f - 40.0f;
+}
+
+float HDC1000::getHumidity() { return measure(kHumidityRegister) * 100.0f / 65536.0f; }
+
+bool HDC1000::readRegister(uint8_t pointer, uint16_t& value) {
+    const char command = static_cast<char>(pointer);
+    char data[2]       = {0};
+    if (_i2c.write(host::SimulatedHDC1000::kAddress, &command, 1) != 0 ||
+        _i2c.read(host::SimulatedHDC1000::kAddress, data, 2) != 0) {
+        return false;
+    }
+    value = (static_cast<uint8_t>(data[0]) << 8) | static_cast<uint8_t>(data[1]);
+    return true;
+}
+
+uint16_t HDC1000::measure(uint8_t pointer) {
+    const char configuration[3] = {static_cast<char>(kConfigurationRegister),
+                                   static_cast<char>(kConfiguration >> 8),
+                                   static_cast<char>(kConfiguration & 0xFF)};
+    const char command          = static_cast<char>(pointer);
+    if (_i2c.write(host::SimulatedHDC1000::kAddress, configuration, 3) != 0 ||
+        _i2c.write(host::SimulatedHDC1000::kAddress, &command, 1) != 0) {
+        return 0;
+    }
+
+    // the calling thread is blocked during the conversion
+    std::this_thread::sleep_for(kConversionTime);
+
+    // the read is not acknowledged until the conversion is completed
+    char data[2] = {0};
+    for (int attempt = 0; attempt < kMaxNbrOfAttempts; attempt++) {
+        if (_i2c.read(host::SimulatedHDC1000::kAddress, data, 2) == 0) {
+            return (static_cast<uint8_t>(data[0]) << 8) | static_cast<uint8_t>(data[1]);
+        }
+        std::this_thread::sleep_for(kPollingPeriod);
+    }
+    return 0;
+}
+
+}  // namespace advembsof
@@ -0,0 +1,77 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file heap_block_device.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief mbed::HeapBlockDevice implementation (host port layer)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include "mbed_port/block_device.hpp"
+
+#include <cstring>
+
+namespace mbed {
+
+// definition required when the constant is odr-used (C++14)
+constexpr uint8_t HeapBlockDevice::kErasedValue;
+
+HeapBlockDevice::HeapBlockDevice(bd_size_t size, bd_size_t block)
+    : HeapBlockDevice(size, block, block, block) {}
+
+HeapBlockDevice::HeapBlockDevice(bd_size_t size,
+                                 bd_size_t read,
+                                 bd_size_t program,
+                                 bd_size_t erase)
+    : _size(size), _readSize(read), _programSize(program), _eraseSize(erase) {}
+
+int HeapBlockDevice::init() {
+    if (_data == nullptr) {
+        _data.reset(new uint8_t[_size]);
+        memset(_data.get(), kErasedValue, _size);
+    }
+    return BD_ERROR_OK;
+}
+
+int HeapBlockDevice::deinit() { return BD_ERROR_OK; }
+
+int HeapBlockDevice::read(void* buffer, bd_addr_t addr, bd_size_t size) {
+    if (_data == nullptr || !is_valid_read(addr, size)) {
+        return BD_ERROR_DEVICE_ERROR;
+    }
+    memcpy(buffer, &_data[addr], size);
+    return BD_ERROR_OK;
+}
+
+int HeapBlockDevice::program(const void* buffer, bd_addr_t addr, bd_size_t size) {
+    if (_data == nullptr || !is_valid_program(addr, size)) {
+        return BD_ERROR_DEVICE_ERROR;
+    }
+    memcpy(&_data[addr], buffer, size);
+    return BD_ERROR_OK;
+}
+
+int HeapBlockDevice::erase(bd_addr_t addr, bd_size_t size) {
+    if (_data == nullptr || !is_valid_erase(addr, size)) {
+        return BD_ERROR_DEVICE_ERROR;
+    }
+    memset(&_data[addr], kErasedValue, size);
+    return BD_ERROR_OK;
+}
+
+}  // namespace mbed
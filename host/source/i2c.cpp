@@ -0,0 +1,162 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file i2c.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief mbed::I2C and simulated I2C bus implementation (host port layer)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include "mbed_port/i2c.hpp"
+
+#include "mbed_port/platform.hpp"
+#include "mbed_port/simulated_i2c_bus.hpp"
+
+namespace mbed {
+
+// definition required when the constant is odr-used (C++14)
+constexpr int I2C::kDefaultFrequency;
+
+namespace {
+
+// time for clocking the address byte and the data bytes (9 clock cycles per byte,
+// including the acknowledge bit)
+int getTransferTime(int length, int frequency) {
+    static constexpr int kNbrOfClocksPerByte = 9;
+    return static_cast<int>((static_cast<int64_t>(length + 1) * kNbrOfClocksPerByte *
+                             1000000) /
+                            frequency);
+}
+
+}  // namespace
+
+I2C::I2C(PinName sda, PinName scl) {}
+
+void I2C::frequency(int hz) {
+    if (hz > 0) {
+        _frequency = hz;
+    }
+}
+
+int I2C::read(int address, char* data, int length, bool repeated) {
+    lock();
+    const bool isAcknowledged =
+        host::SimulatedI2CBus::getInstance().read(address, data, length);
+    // a not acknowledged transfer stops after the address byte
+    wait_us(getTransferTime(isAcknowledged ? length : 0, _frequency));
+    unlock();
+    return isAcknowledged ? 0 : -1;
+}
+
+int I2C::write(int address, const char* data, int length, bool repeated) {
+    lock();
+    const bool isAcknowledged =
+        host::SimulatedI2CBus::getInstance().write(address, data, length);
+    wait_us(getTransferTime(isAcknowledged ? length : 0, _frequency));
+    unlock();
+    return isAcknowledged ? 0 : -1;
+}
+
+void I2C::lock() { host::SimulatedI2CBus::getInstance().getMutex().lock(); }
+
+void I2C::unlock() { host::SimulatedI2CBus::getInstance().getMutex().unlock(); }
+
+}  // namespace mbed
+
+namespace host {
+
+SimulatedI2CBus& SimulatedI2CBus::getInstance() {
+    static SimulatedI2CBus simulatedI2CBus;
+    return simulatedI2CBus;
+}
+
+bool SimulatedI2CBus::attach(int address, SimulatedI2CDevice* device) {
+    std::lock_guard<std::recursive_mutex> lock(_mutex);
+    if (findDevice(address) != nullptr) {
+        return false;
+    }
+    for (Slot& slot : _slots) {
+        if (slot.device == nullptr) {
+            slot.address = address;
+            slot.device  = device;
+            return true;
+        }
+    }
+    return false;
+}
+
+void SimulatedI2CBus::detach(SimulatedI2CDevice* device) {
+    std::lock_guard<std::recursive_mutex> lock(_mutex);
+    for (Slot& slot : _slots) {
+        if (slot.device == device) {
+            slot.device = nullptr;
+        }
+    }
+}
+
+bool SimulatedI2CBus::write(int address, const char* data, int length) {
+    std::lock_guard<std::recursive_mutex> lock(_mutex);
+    _nbrOfTransfers++;
+    SimulatedI2CDevice* device = findDevice(address);
+    if (device == nullptr || !device->onWrite(data, length)) {
+        _nbrOfNacks++;
+        return false;
+    }
+    _nbrOfBytes += length;
+    return true;
+}
+
+bool SimulatedI2CBus::read(int address, char* data, int length) {
+    std::lock_guard<std::recursive_mutex> lock(_mutex);
+    _nbrOfTransfers++;
+    SimulatedI2CDevice* device = findDevice(address);
+    if (device == nullptr || !device->onRead(data, length)) {
+        _nbrOfNacks++;
+        return false;
+    }
+    _nbrOfBytes += length;
+    return true;
+}
+
+uint32_t SimulatedI2CBus::getNbrOfTransfers() {
+    std::lock_guard<std::recursive_mutex> lock(_mutex);
+    return _nbrOfTransfers;
+}
+
+uint32_t SimulatedI2CBus::getNbrOfNacks() {
+    std::lock_guard<std::recursive_mutex> lock(_mutex);
+    return _nbrOfNacks;
+}
+
+uint32_t SimulatedI2CBus::getNbrOfBytes() {
+    std::lock_guard<std::recursive_mutex> lock(_mutex);
+    return _nbrOfBytes;
+}
+
+std::recursive_mutex& SimulatedI2CBus::getMutex() { return _mutex; }
+
+SimulatedI2CDevice* SimulatedI2CBus::findDevice(int address) {
+    for (Slot& slot : _slots) {
+        if (slot.device != nullptr && slot.address == address) {
+            return slot.device;
+        }
+    }
+    return nullptr;
+}
+
+}  // namespace host
@@ -0,0 +1,132 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file interrupt_in.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief mbed::InterruptIn and simulated pins implementation (host port layer)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include "mbed_port/interrupt_in.hpp"
+
+#include "mbed_port/platform.hpp"
+#include "mbed_port/simulated_pins.hpp"
+#include "mbed_port/thread.hpp"
+
+namespace mbed {
+
+InterruptIn::InterruptIn(PinName pin) : _pin(pin) {
+    host::SimulatedPins::getInstance().connect(this);
+}
+
+InterruptIn::InterruptIn(PinName pin, PinMode mode) : InterruptIn(pin) {}
+
+InterruptIn::~InterruptIn() { host::SimulatedPins::getInstance().disconnect(this); }
+
+int InterruptIn::read() { return host::SimulatedPins::getInstance().read(_pin); }
+
+InterruptIn::operator int() { return read(); }
+
+void InterruptIn::rise(Callback<void()> function) {
+    core_util_critical_section_enter();
+    _rise = function;
+    core_util_critical_section_exit();
+}
+
+void InterruptIn::fall(Callback<void()> function) {
+    core_util_critical_section_enter();
+    _fall = function;
+    core_util_critical_section_exit();
+}
+
+void InterruptIn::mode(PinMode pull) {}
+
+void InterruptIn::enable_irq() { _isIrqEnabled = true; }
+
+void InterruptIn::disable_irq() { _isIrqEnabled = false; }
+
+void InterruptIn::onEdge(bool isRising) {
+    if (!_isIrqEnabled) {
+        return;
+    }
+    core_util_critical_section_enter();
+    Callback<void()> handler = isRising ? _rise : _fall;
+    core_util_critical_section_exit();
+    if (handler) {
+        host::isrEnter();
+        handler();
+        host::isrExit();
+    }
+}
+
+}  // namespace mbed
+
+namespace host {
+
+SimulatedPins& SimulatedPins::getInstance() {
+    static SimulatedPins simulatedPins;
+    return simulatedPins;
+}
+
+void SimulatedPins::write(PinName pin, int level) {
+    if (pin < 0 || pin >= kNbrOfPins) {
+        return;
+    }
+    std::lock_guard<std::recursive_mutex> lock(_mutex);
+    const int previousLevel = _levels[pin];
+    _levels[pin]            = (level != 0) ? 1 : 0;
+    if (_levels[pin] == previousLevel) {
+        return;
+    }
+    // the handlers run with the lock held, so that no InterruptIn is destroyed while
+    // its handlers are called
+    for (mbed::InterruptIn* interruptIn : _interruptIns) {
+        if (interruptIn != nullptr && interruptIn->_pin == pin) {
+            interruptIn->onEdge(_levels[pin] == 1);
+        }
+    }
+}
+
+int SimulatedPins::read(PinName pin) {
+    if (pin < 0 || pin >= kNbrOfPins) {
+        return 0;
+    }
+    std::lock_guard<std::recursive_mutex> lock(_mutex);
+    return _levels[pin];
+}
+
+void SimulatedPins::connect(mbed::InterruptIn* interruptIn) {
+    std::lock_guard<std::recursive_mutex> lock(_mutex);
+    for (mbed::InterruptIn*& slot : _interruptIns) {
+        if (slot == nullptr) {
+            slot = interruptIn;
+            return;
+        }
+    }
+}
+
+void SimulatedPins::disconnect(mbed::InterruptIn* interruptIn) {
+    std::lock_guard<std::recursive_mutex> lock(_mutex);
+    for (mbed::InterruptIn*& slot : _interruptIns) {
+        if (slot == interruptIn) {
+            slot = nullptr;
+        }
+    }
+}
+
+}  // namespace host
@@ -0,0 +1,85 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file joystick.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Simulated joystick implementation (host port layer)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include "joystick.hpp"
+
+namespace disco {
+
+Joystick& Joystick::getInstance() {
+    static Joystick joystick;
+    return joystick;
+}
+
+ReturnCode Joystick::init() { return ReturnCode::Ok; }
+
+Joystick::State Joystick::getState() {
+    return static_cast<State>(core_util_atomic_load_u8(&_state));
+}
+
+void Joystick::setUpCallback(mbed::Callback<void()> callback) {
+    _mutex.lock();
+    _callbacks[static_cast<uint8_t>(State::UpPressed)] = callback;
+    _mutex.unlock();
+}
+
+void Joystick::setDownCallback(mbed::Callback<void()> callback) {
+    _mutex.lock();
+    _callbacks[static_cast<uint8_t>(State::DownPressed)] = callback;
+    _mutex.unlock();
+}
+
+void Joystick::setLeftCallback(mbed::Callback<void()> callback) {
+    _mutex.lock();
+    _callbacks[static_cast<uint8_t>(State::LeftPressed)] = callback;
+    _mutex.unlock();
+}
+
+void Joystick::setRightCallback(mbed::Callback<void()> callback) {
+    _mutex.lock();
+    _callbacks[static_cast<uint8_t>(State::RightPressed)] = callback;
+    _mutex.unlock();
+}
+
+void Joystick::setSelCallback(mbed::Callback<void()> callback) {
+    _mutex.lock();
+    _callbacks[static_cast<uint8_t>(State::SelPressed)] = callback;
+    _mutex.unlock();
+}
+
+void Joystick::setSimulatedState(State state) {
+    const uint8_t previousState =
+        core_util_atomic_exchange_u8(&_state, static_cast<uint8_t>(state));
+    if (state == State::NotPressed || previousState == static_cast<uint8_t>(state)) {
+        return;
+    }
+    // the callback is called upon a press only
+    _mutex.lock();
+    mbed::Callback<void()> callback = _callbacks[static_cast<uint8_t>(state)];
+    _mutex.unlock();
+    if (callback) {
+        callback();
+    }
+}
+
+}  // namespace disco
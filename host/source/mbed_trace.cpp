@@ -0,0 +1,78 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file mbed_trace.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief mbed trace library implementation (host port layer)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include "mbed_trace.h"
+
+#include <cstdarg>
+#include <cstdio>
+#include <mutex>
+
+namespace {
+
+std::mutex traceMutex;
+uint8_t activeLevels = TRACE_ACTIVE_LEVEL_ALL;
+
+const char* getLevelName(uint8_t level) {
+    switch (level) {
+        case TRACE_LEVEL_DEBUG:
+            return "DBG ";
+        case TRACE_LEVEL_INFO:
+            return "INFO";
+        case TRACE_LEVEL_WARN:
+            return "WARN";
+        case TRACE_LEVEL_ERROR:
+            return "ERR ";
+        default:
+            return "CMD ";
+    }
+}
+
+}  // namespace
+
+void mbed_trace_init() {}
+
+void mbed_trace_config_set(uint8_t config) {
+    std::lock_guard<std::mutex> lock(traceMutex);
+    activeLevels = config & TRACE_ACTIVE_LEVEL_ALL;
+}
+
+uint8_t mbed_trace_config_get() {
+    std::lock_guard<std::mutex> lock(traceMutex);
+    return activeLevels;
+}
+
+void mbed_tracef(uint8_t level, const char* group, const char* format, ...) {
+    std::lock_guard<std::mutex> lock(traceMutex);
+    if ((activeLevels & level) == 0) {
+        return;
+    }
+    // same layout as the mbed-trace default output
+    printf("[%s][%-4s]: ", getLevelName(level), group);
+    va_list arguments;
+    va_start(arguments, format);
+    vprintf(format, arguments);
+    va_end(arguments);
+    printf("\n");
+    fflush(stdout);
+}
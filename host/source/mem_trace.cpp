@@ -0,0 +1,105 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file mem_trace.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Memory tracing hook implementation (host port layer)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include "mbed_port/mem_trace.hpp"
+
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+// the callback may be set while other threads allocate
+mbed_mem_trace_cb_t gCallback = nullptr;
+// set while the callback of the calling thread runs
+thread_local bool tIsTracing = false;
+
+void* allocate(std::size_t size, void* caller) {
+    void* block                        = malloc((size == 0) ? 1 : size);
+    const mbed_mem_trace_cb_t callback = __atomic_load_n(&gCallback, __ATOMIC_ACQUIRE);
+    if (callback != nullptr && !tIsTracing) {
+        tIsTracing = true;
+        callback(MBED_MEM_TRACE_MALLOC, block, caller, size);
+        tIsTracing = false;
+    }
+    return block;
+}
+
+void deallocate(void* block, void* caller) {
+    // traced before the block is freed, for not using a dangling pointer
+    const mbed_mem_trace_cb_t callback = __atomic_load_n(&gCallback, __ATOMIC_ACQUIRE);
+    if (callback != nullptr && !tIsTracing) {
+        tIsTracing = true;
+        callback(MBED_MEM_TRACE_FREE, nullptr, caller, block);
+        tIsTracing = false;
+    }
+    free(block);
+}
+
+}  // namespace
+
+void mbed_mem_trace_set_callback(mbed_mem_trace_cb_t callback) {
+    __atomic_store_n(&gCallback, callback, __ATOMIC_RELEASE);
+}
+
+// replacements of the global operators new and delete, the sized and aligned
+// versions calling these ones by default
+void* operator new(std::size_t size) {
+    void* block = allocate(size, __builtin_return_address(0));
+    if (block == nullptr) {
+        throw std::bad_alloc();
+    }
+    return block;
+}
+
+void* operator new[](std::size_t size) {
+    void* block = allocate(size, __builtin_return_address(0));
+    if (block == nullptr) {
+        throw std::bad_alloc();
+    }
+    return block;
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    return allocate(size, __builtin_return_address(0));
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    return allocate(size, __builtin_return_address(0));
+}
+
+void operator delete(void* block) noexcept {
+    deallocate(block, __builtin_return_address(0));
+}
+
+void operator delete[](void* block) noexcept {
+    deallocate(block, __builtin_return_address(0));
+}
+
+void operator delete(void* block, const std::nothrow_t&) noexcept {
+    deallocate(block, __builtin_return_address(0));
+}
+
+void operator delete[](void* block, const std::nothrow_t&) noexcept {
+    deallocate(block, __builtin_return_address(0));
+}
@@ -0,0 +1,38 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file memory_logger.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Memory logger implementation (host port layer)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include "memory_logger.hpp"
+
+#include "mbed_trace.h"
+#if MBED_CONF_MBED_TRACE_ENABLE
+#define TRACE_GROUP "MemoryLogger"
+#endif  // MBED_CONF_MBED_TRACE_ENABLE
+
+namespace advembsof {
+
+void MemoryLogger::getAndPrintThreadStatistics() {
+    tr_info("Thread statistics are not available on the host");
+}
+
+}  // namespace advembsof
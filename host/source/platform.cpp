@@ -0,0 +1,78 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file platform.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Critical sections, statistics and waits implementation (host port layer)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include "mbed_port/platform.hpp"
+
+#include <time.h>
+
+#include <chrono>
+#include <mutex>
+
+namespace {
+
+std::recursive_mutex& getCriticalSectionMutex() {
+    static std::recursive_mutex criticalSectionMutex;
+    return criticalSectionMutex;
+}
+
+// the uptime is measured from the start of the process
+const std::chrono::steady_clock::time_point kStartTime = std::chrono::steady_clock::now();
+
+uint64_t getProcessCpuTime() {
+    timespec cpuTime;
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &cpuTime);
+    return static_cast<uint64_t>(cpuTime.tv_sec) * 1000000 +
+           static_cast<uint64_t>(cpuTime.tv_nsec) / 1000;
+}
+
+}  // namespace
+
+void core_util_critical_section_enter() { getCriticalSectionMutex().lock(); }
+
+void core_util_critical_section_exit() { getCriticalSectionMutex().unlock(); }
+
+void mbed_stats_cpu_get(mbed_stats_cpu_t* stats) {
+    const uint64_t uptime = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - kStartTime)
+            .count());
+    // with several threads running in parallel, the cpu time may exceed the uptime
+    const uint64_t cpuTime = getProcessCpuTime();
+    stats->uptime          = uptime;
+    stats->idle_time       = (cpuTime < uptime) ? uptime - cpuTime : 0;
+    stats->sleep_time      = stats->idle_time;
+    stats->deep_sleep_time = 0;
+}
+
+void wait_us(int us) {
+    const auto endTime = std::chrono::steady_clock::now() + std::chrono::microseconds(us);
+    while (std::chrono::steady_clock::now() < endTime) {
+    }
+}
+
+void wait_ns(unsigned int ns) {
+    const auto endTime = std::chrono::steady_clock::now() + std::chrono::nanoseconds(ns);
+    while (std::chrono::steady_clock::now() < endTime) {
+    }
+}
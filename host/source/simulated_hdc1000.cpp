@@ -0,0 +1,193 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file simulated_hdc1000.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Register model of the HDC1000 sensor implementation (host port layer)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include "simulated_hdc1000.hpp"
+
+namespace host {
+
+// definition required when the constant is odr-used (C++14)
+constexpr int SimulatedHDC1000::kAddress;
+constexpr std::chrono::microseconds SimulatedHDC1000::kDefaultConversionTime;
+
+namespace {
+
+// registers of the HDC1000
+constexpr uint8_t kTemperatureRegister    = 0x00;
+constexpr uint8_t kHumidityRegister       = 0x01;
+constexpr uint8_t kConfigurationRegister  = 0x02;
+constexpr uint8_t kManufacturerIdRegister = 0xFE;
+constexpr uint8_t kDeviceIdRegister       = 0xFF;
+constexpr uint16_t kManufacturerId        = 0x5449;
+constexpr uint16_t kDeviceId              = 0x1000;
+// configuration bits
+constexpr uint16_t kResetConfiguration = 0x1000;
+constexpr uint16_t kSoftwareResetBit   = 0x8000;
+constexpr uint16_t kModeBit            = 0x1000;
+// 14 bit measurements are left aligned in the 16 bit registers
+constexpr uint16_t kMeasurementMask = 0xFFFC;
+
+uint16_t toRegisterValue(float value, float offset, float range) {
+    float raw = (value + offset) / range * 65536.0f;
+    if (raw < 0.0f) {
+        raw = 0.0f;
+    } else if (raw > 65535.0f) {
+        raw = 65535.0f;
+    }
+    return static_cast<uint16_t>(raw) & kMeasurementMask;
+}
+
+uint16_t toTemperatureRegister(float temperature) {
+    return toRegisterValue(temperature, 40.0f, 165.0f);
+}
+
+uint16_t toHumidityRegister(float humidity) {
+    return toRegisterValue(humidity, 0.0f, 100.0f);
+}
+
+}  // namespace
+
+SimulatedHDC1000& SimulatedHDC1000::getInstance() {
+    static SimulatedHDC1000 simulatedHDC1000;
+    return simulatedHDC1000;
+}
+
+SimulatedHDC1000::SimulatedHDC1000() : _configuration(kResetConfiguration) {
+    SimulatedI2CBus::getInstance().attach(kAddress, this);
+}
+
+void SimulatedHDC1000::setTemperature(float temperature) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _temperature = temperature;
+}
+
+void SimulatedHDC1000::setHumidity(float humidity) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _humidity = humidity;
+}
+
+void SimulatedHDC1000::setConversionTime(
+    const std::chrono::microseconds& conversionTime) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _conversionTime = conversionTime;
+}
+
+std::chrono::microseconds SimulatedHDC1000::getConversionTime() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _conversionTime;
+}
+
+uint32_t SimulatedHDC1000::getNbrOfConversions() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _nbrOfConversions;
+}
+
+bool SimulatedHDC1000::onWrite(const char* data, int length) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (length < 1) {
+        return true;
+    }
+    _pointer = static_cast<uint8_t>(data[0]);
+    switch (_pointer) {
+        case kTemperatureRegister:
+        case kHumidityRegister: {
+            if (length != 1) {
+                return false;
+            }
+            // trigger a measurement (a new trigger restarts the conversion)
+            const bool isAcquisition =
+                (_configuration & kModeBit) != 0 && _pointer == kTemperatureRegister;
+            _measurementPointer   = _pointer;
+            _isMeasurementPending = true;
+            _conversionEndTime =
+                Clock::now() + (isAcquisition ? 2 * _conversionTime : _conversionTime);
+            _nbrOfConversions++;
+            return true;
+        }
+
+        case kConfigurationRegister:
+            if (length == 3) {
+                const uint16_t configuration =
+                    (static_cast<uint8_t>(data[1]) << 8) | static_cast<uint8_t>(data[2]);
+                _configuration = ((configuration & kSoftwareResetBit) != 0)
+                                     ? kResetConfiguration
+                                     : configuration;
+            }
+            return length == 1 || length == 3;
+
+        case kManufacturerIdRegister:
+        case kDeviceIdRegister:
+            return length == 1;
+
+        default:
+            return false;
+    }
+}
+
+bool SimulatedHDC1000::onRead(char* data, int length) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    uint16_t values[2] = {0};
+    int nbrOfValues    = 1;
+    switch (_pointer) {
+        case kTemperatureRegister:
+        case kHumidityRegister:
+            // the measurement must be triggered and converted
+            if (!_isMeasurementPending || Clock::now() < _conversionEndTime) {
+                return false;
+            }
+            _isMeasurementPending = false;
+            if (_measurementPointer == kHumidityRegister) {
+                values[0] = toHumidityRegister(_humidity);
+            } else {
+                values[0] = toTemperatureRegister(_temperature);
+                if ((_configuration & kModeBit) != 0) {
+                    values[1]   = toHumidityRegister(_humidity);
+                    nbrOfValues = 2;
+                }
+            }
+            break;
+
+        case kConfigurationRegister:
+            values[0] = _configuration;
+            break;
+
+        case kManufacturerIdRegister:
+            values[0] = kManufacturerId;
+            break;
+
+        case kDeviceIdRegister:
+            values[0] = kDeviceId;
+            break;
+
+        default:
+            return false;
+    }
+    // registers are read MSB first
+    for (int index = 0; index < length && index < 2 * nbrOfValues; index++) {
+        const uint16_t value = values[index / 2];
+        data[index] = static_cast<char>((index % 2 == 0) ? (value >> 8) : (value & 0xFF));
+    }
+    return true;
+}
+
+}  // namespace host
@@ -0,0 +1,114 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file simulated_heap.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Heap of the simulated target implementation (host port layer)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include "mbed_port/simulated_heap.hpp"
+
+namespace host {
+
+// definitions required when the constants are odr-used (C++14)
+constexpr size_t SimulatedHeap::kSize;
+constexpr size_t SimulatedHeap::kHeaderSize;
+constexpr size_t SimulatedHeap::kAlignment;
+
+SimulatedHeap& SimulatedHeap::getInstance() {
+    static SimulatedHeap simulatedHeap;
+    return simulatedHeap;
+}
+
+SimulatedHeap::SimulatedHeap() {
+    _freeChunks       = reinterpret_cast<Chunk*>(_arena);
+    _freeChunks->size = kSize;
+    _freeChunks->next = nullptr;
+}
+
+void* SimulatedHeap::allocate(size_t size) {
+    // the chunk must be able to hold the header of a free chunk once freed
+    size_t chunkSize = (kHeaderSize + size + kAlignment - 1) & ~(kAlignment - 1);
+    if (chunkSize < sizeof(Chunk)) {
+        chunkSize = sizeof(Chunk);
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    Chunk** previousNext = &_freeChunks;
+    for (Chunk* chunk = _freeChunks; chunk != nullptr; chunk = chunk->next) {
+        if (chunk->size >= chunkSize) {
+            if (chunk->size - chunkSize >= sizeof(Chunk)) {
+                // the end of the chunk is allocated, the free chunk keeps its place
+                chunk->size -= chunkSize;
+                chunk = reinterpret_cast<Chunk*>(reinterpret_cast<uint8_t*>(chunk) +
+                                                 chunk->size);
+                chunk->size = chunkSize;
+            } else {
+                *previousNext = chunk->next;
+            }
+            return reinterpret_cast<uint8_t*>(chunk) + kHeaderSize;
+        }
+        previousNext = &chunk->next;
+    }
+    return nullptr;
+}
+
+void SimulatedHeap::free(void* block) {
+    if (block == nullptr) {
+        return;
+    }
+    Chunk* chunk = reinterpret_cast<Chunk*>(static_cast<uint8_t*>(block) - kHeaderSize);
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    Chunk* previous = nullptr;
+    Chunk* next     = _freeChunks;
+    while (next != nullptr && next < chunk) {
+        previous = next;
+        next     = next->next;
+    }
+    // coalesce with the following and with the preceding free chunks
+    chunk->next                   = next;
+    const uint8_t* const chunkEnd = reinterpret_cast<uint8_t*>(chunk) + chunk->size;
+    if (next != nullptr && chunkEnd == reinterpret_cast<uint8_t*>(next)) {
+        chunk->size += next->size;
+        chunk->next = next->next;
+    }
+    if (previous == nullptr) {
+        _freeChunks = chunk;
+    } else if (reinterpret_cast<uint8_t*>(previous) + previous->size ==
+               reinterpret_cast<uint8_t*>(chunk)) {
+        previous->size += chunk->size;
+        previous->next = chunk->next;
+    } else {
+        previous->next = chunk;
+    }
+}
+
+void SimulatedHeap::forEachFreeBlock(mbed::Callback<void(size_t)> function) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (const Chunk* chunk = _freeChunks; chunk != nullptr; chunk = chunk->next) {
+        function(chunk->size - kHeaderSize);
+    }
+}
+
+void forEachFreeHeapBlock(mbed::Callback<void(size_t)> function) {
+    SimulatedHeap::getInstance().forEachFreeBlock(function);
+}
+
+}  // namespace host
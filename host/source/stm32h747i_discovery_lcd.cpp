@@ -0,0 +1,143 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file stm32h747i_discovery_lcd.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief LCD BSP of the DISCO_H747I board implementation (host port layer)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include "stm32h747i_discovery_lcd.h"
+
+#include <cstring>
+
+namespace {
+
+constexpr uint32_t kLcdWidth  = 800;
+constexpr uint32_t kLcdHeight = 480;
+
+uint32_t gLcdPixels[kLcdWidth * kLcdHeight];
+bool gIsInitialized = false;
+
+bool isInRange(uint32_t x, uint32_t y, uint32_t width, uint32_t height) {
+    return x <= kLcdWidth && y <= kLcdHeight && width <= kLcdWidth - x &&
+           height <= kLcdHeight - y;
+}
+
+}  // namespace
+
+int32_t BSP_LCD_Init(uint32_t instance, uint32_t orientation) {
+    if (instance != 0 || orientation != LCD_ORIENTATION_LANDSCAPE) {
+        return BSP_ERROR_WRONG_PARAM;
+    }
+    memset(gLcdPixels, 0, sizeof(gLcdPixels));
+    gIsInitialized = true;
+    return BSP_ERROR_NONE;
+}
+
+int32_t BSP_LCD_DeInit(uint32_t instance) {
+    if (instance != 0) {
+        return BSP_ERROR_WRONG_PARAM;
+    }
+    gIsInitialized = false;
+    return BSP_ERROR_NONE;
+}
+
+int32_t BSP_LCD_GetXSize(uint32_t instance, uint32_t* xSize) {
+    if (instance != 0) {
+        return BSP_ERROR_WRONG_PARAM;
+    }
+    *xSize = kLcdWidth;
+    return BSP_ERROR_NONE;
+}
+
+int32_t BSP_LCD_GetYSize(uint32_t instance, uint32_t* ySize) {
+    if (instance != 0) {
+        return BSP_ERROR_WRONG_PARAM;
+    }
+    *ySize = kLcdHeight;
+    return BSP_ERROR_NONE;
+}
+
+int32_t BSP_LCD_GetFormat(uint32_t instance, uint32_t* format) {
+    if (instance != 0) {
+        return BSP_ERROR_WRONG_PARAM;
+    }
+    *format = LCD_PIXEL_FORMAT_ARGB8888;
+    return BSP_ERROR_NONE;
+}
+
+int32_t BSP_LCD_FillRGBRect(uint32_t instance,
+                            uint32_t x,
+                            uint32_t y,
+                            uint8_t* data,
+                            uint32_t width,
+                            uint32_t height) {
+    if (instance != 0 || !isInRange(x, y, width, height)) {
+        return BSP_ERROR_WRONG_PARAM;
+    }
+    if (!gIsInitialized) {
+        return BSP_ERROR_NO_INIT;
+    }
+    // the pixels are stored in little endian order, as read by the BSP
+    for (uint32_t row = 0; row < height; row++) {
+        for (uint32_t column = 0; column < width; column++) {
+            gLcdPixels[(y + row) * kLcdWidth + x + column] =
+                static_cast<uint32_t>(data[0]) | (static_cast<uint32_t>(data[1]) << 8) |
+                (static_cast<uint32_t>(data[2]) << 16) |
+                (static_cast<uint32_t>(data[3]) << 24);
+            data += 4;
+        }
+    }
+    return BSP_ERROR_NONE;
+}
+
+int32_t BSP_LCD_FillRect(uint32_t instance,
+                         uint32_t x,
+                         uint32_t y,
+                         uint32_t width,
+                         uint32_t height,
+                         uint32_t color) {
+    if (instance != 0 || !isInRange(x, y, width, height)) {
+        return BSP_ERROR_WRONG_PARAM;
+    }
+    if (!gIsInitialized) {
+        return BSP_ERROR_NO_INIT;
+    }
+    for (uint32_t row = 0; row < height; row++) {
+        for (uint32_t column = 0; column < width; column++) {
+            gLcdPixels[(y + row) * kLcdWidth + x + column] = color;
+        }
+    }
+    return BSP_ERROR_NONE;
+}
+
+int32_t BSP_LCD_WritePixel(uint32_t instance, uint32_t x, uint32_t y, uint32_t color) {
+    return BSP_LCD_FillRect(instance, x, y, 1, 1, color);
+}
+
+int32_t BSP_LCD_ReadPixel(uint32_t instance, uint32_t x, uint32_t y, uint32_t* color) {
+    if (instance != 0 || !isInRange(x, y, 1, 1)) {
+        return BSP_ERROR_WRONG_PARAM;
+    }
+    if (!gIsInitialized) {
+        return BSP_ERROR_NO_INIT;
+    }
+    *color = gLcdPixels[y * kLcdWidth + x];
+    return BSP_ERROR_NONE;
+}
@@ -0,0 +1,76 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file task_logger.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Task logger implementation (host port layer)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include "task_logger.hpp"
+
+#include "mbed_trace.h"
+#if MBED_CONF_MBED_TRACE_ENABLE
+#define TRACE_GROUP "TaskLogger"
+#endif  // MBED_CONF_MBED_TRACE_ENABLE
+
+namespace advembsof {
+
+static const char* const kTaskNames[TaskLogger::kNbrOfTasks] = {
+    "gear", "speed", "temperature", "reset", "display(1)", "display(2)"};
+
+TaskLogger::TaskLogger() {
+    for (uint8_t taskIndex = 0; taskIndex < kNbrOfTasks; taskIndex++) {
+        _lastStartTime[taskIndex]   = std::chrono::microseconds::zero();
+        _period[taskIndex]          = std::chrono::microseconds::zero();
+        _computationTime[taskIndex] = std::chrono::microseconds::zero();
+    }
+}
+
+void TaskLogger::enable(bool enable) { _isEnabled = enable; }
+
+void TaskLogger::logPeriodAndExecutionTime(
+    Timer& timer, int taskIndex, const std::chrono::microseconds& taskStartTime) {
+    if (taskIndex < 0 || taskIndex >= kNbrOfTasks) {
+        return;
+    }
+    const std::chrono::microseconds now = timer.elapsed_time();
+    if (_lastStartTime[taskIndex] != std::chrono::microseconds::zero()) {
+        _period[taskIndex] = taskStartTime - _lastStartTime[taskIndex];
+    }
+    _lastStartTime[taskIndex]   = taskStartTime;
+    _computationTime[taskIndex] = now - taskStartTime;
+    if (_isEnabled) {
+        tr_debug("%s task: period %" PRIu64 " usecs execution time %" PRIu64
+                 " usecs start time %" PRIu64 " usecs",
+                 kTaskNames[taskIndex],
+                 _period[taskIndex].count(),
+                 _computationTime[taskIndex].count(),
+                 taskStartTime.count());
+    }
+}
+
+std::chrono::microseconds TaskLogger::getPeriod(int taskIndex) const {
+    return _period[taskIndex];
+}
+
+std::chrono::microseconds TaskLogger::getComputationTime(int taskIndex) const {
+    return _computationTime[taskIndex];
+}
+
+}  // namespace advembsof
@@ -0,0 +1,334 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file thread.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief rtos::Thread and rtos::ThisThread implementation (host port layer)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include "mbed_port/thread.hpp"
+
+#include <pthread.h>
+#include <time.h>
+
+#include <cstring>
+#include <list>
+#include <memory>
+#include <mutex>
+
+namespace host {
+namespace {
+
+// cpu time and stack record of a thread, shared by the registry and the running thread
+// (a detached thread may outlive its Thread)
+struct ThreadRecord {
+    const void* id   = nullptr;
+    const char* name = nullptr;
+    pthread_t handle;
+    bool isRunning = false;
+    // cpu time of the thread once terminated
+    uint64_t cpuTime = 0;
+    // cpu time spent in interrupt handlers by the thread
+    uint64_t isrCpuTime = 0;
+    // stack size of the Thread and filled part of the native stack
+    uint32_t stackSize          = 0;
+    const uint32_t* stackMemory = nullptr;
+    uint32_t stackMemorySize    = 0;
+};
+
+struct ThreadRegistry {
+    std::mutex mutex;
+    std::list<std::shared_ptr<ThreadRecord>> records;
+    uint64_t isrCpuTime = 0;
+};
+
+ThreadRegistry& getThreadRegistry() {
+    static ThreadRegistry threadRegistry;
+    return threadRegistry;
+}
+
+uint64_t toMicroseconds(const timespec& time) {
+    return static_cast<uint64_t>(time.tv_sec) * 1000000 +
+           static_cast<uint64_t>(time.tv_nsec) / 1000;
+}
+
+uint64_t getCurrentThreadCpuTime() {
+    timespec cpuTime;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpuTime);
+    return toMicroseconds(cpuTime);
+}
+
+// record of the calling thread (nullptr for threads not started by rtos::Thread)
+thread_local ThreadRecord* tThreadRecord = nullptr;
+// interrupt handler nesting of the calling thread
+thread_local uint32_t tIsrNesting   = 0;
+thread_local uint64_t tIsrStartTime = 0;
+
+void registerThread(const std::shared_ptr<ThreadRecord>& record) {
+    ThreadRegistry& registry = getThreadRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.records.push_back(record);
+}
+
+void unregisterThread(const void* id) {
+    ThreadRegistry& registry = getThreadRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.records.remove_if(
+        [id](const std::shared_ptr<ThreadRecord>& record) { return record->id == id; });
+}
+
+// gap left below the frame of fillCurrentStack() for its locals and its red zone
+constexpr uintptr_t kStackFillGap = 512;
+
+// fills the unused part of the native stack of the calling thread with the fill
+// pattern, the words being written one by one (sanitizers would check a memset against
+// the frames that were popped): the stack is accounted from stackTop, the frame of the
+// entry function of the thread, since the native stack block also holds the thread
+// local storage
+__attribute__((noinline, no_sanitize("address", "thread"))) void fillCurrentStack(
+    const void* stackTop, const uint32_t** stackMemory, uint32_t* stackMemorySize) {
+    pthread_attr_t attributes;
+    if (pthread_getattr_np(pthread_self(), &attributes) != 0) {
+        return;
+    }
+    void* stackAddress = nullptr;
+    size_t stackSize   = 0;
+    const int result   = pthread_attr_getstack(&attributes, &stackAddress, &stackSize);
+    pthread_attr_destroy(&attributes);
+    if (result != 0) {
+        return;
+    }
+    const uintptr_t stackBottom = reinterpret_cast<uintptr_t>(stackAddress);
+    const uintptr_t fillTop =
+        (reinterpret_cast<uintptr_t>(__builtin_frame_address(0)) - kStackFillGap) &
+        ~static_cast<uintptr_t>(sizeof(uint32_t) - 1);
+    if (fillTop <= stackBottom + sizeof(uint32_t)) {
+        return;
+    }
+    const uintptr_t fillBottom =
+        (fillTop - stackBottom > kStackFillSize) ? fillTop - kStackFillSize : stackBottom;
+    for (volatile uint32_t* word = reinterpret_cast<uint32_t*>(fillBottom);
+         word < reinterpret_cast<uint32_t*>(fillTop);
+         word++) {
+        *word = kStackFillPattern;
+    }
+    *stackMemory     = reinterpret_cast<const uint32_t*>(fillBottom);
+    *stackMemorySize =
+        static_cast<uint32_t>(reinterpret_cast<uintptr_t>(stackTop) - fillBottom);
+}
+
+// called by a thread when it starts (with the frame of its entry function, nullptr
+// for a stack that is not filled) and when it terminates
+void onThreadStarted(ThreadRecord* record, const void* stackTop) {
+    // the stack is filled before locking the registry
+    const uint32_t* stackMemory = nullptr;
+    uint32_t stackMemorySize    = 0;
+    if (stackTop != nullptr) {
+        fillCurrentStack(stackTop, &stackMemory, &stackMemorySize);
+    }
+    ThreadRegistry& registry = getThreadRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    record->handle          = pthread_self();
+    record->isRunning       = true;
+    record->stackMemory     = stackMemory;
+    record->stackMemorySize = stackMemorySize;
+    tThreadRecord           = record;
+}
+
+void onThreadTerminated(ThreadRecord* record) {
+    ThreadRegistry& registry = getThreadRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    record->cpuTime   = getCurrentThreadCpuTime();
+    record->isRunning = false;
+    tThreadRecord     = nullptr;
+}
+
+// the main thread is registered upon static initialization
+struct MainThreadRegistration {
+    MainThreadRegistration() {
+        static char mainThreadId = 0;
+
+        std::shared_ptr<ThreadRecord> record = std::make_shared<ThreadRecord>();
+        record->id                           = &mainThreadId;
+        record->name                         = "main";
+        registerThread(record);
+        onThreadStarted(record.get(), nullptr);
+    }
+};
+const MainThreadRegistration kMainThreadRegistration;
+
+}  // namespace
+
+void forEachThreadCpuTime(ThreadCpuTimeFunction function) {
+    struct ThreadCpuTime {
+        const void* id;
+        const char* name;
+        uint64_t cpuTime;
+    };
+    // the cpu times are copied without allocating, as the function is called at each
+    // major cycle
+    static constexpr size_t kMaxNbrOfThreads = 32;
+    ThreadCpuTime cpuTimes[kMaxNbrOfThreads];
+    size_t nbrOfThreads      = 0;
+    ThreadRegistry& registry = getThreadRegistry();
+    std::unique_lock<std::mutex> lock(registry.mutex);
+    for (const std::shared_ptr<ThreadRecord>& record : registry.records) {
+        uint64_t cpuTime = record->cpuTime;
+        // a running thread cannot terminate while the registry is locked
+        clockid_t clockId;
+        if (record->isRunning && pthread_getcpuclockid(record->handle, &clockId) == 0) {
+            timespec time;
+            clock_gettime(clockId, &time);
+            cpuTime = toMicroseconds(time);
+        }
+        cpuTime = (cpuTime > record->isrCpuTime) ? cpuTime - record->isrCpuTime : 0;
+        if (nbrOfThreads < kMaxNbrOfThreads) {
+            cpuTimes[nbrOfThreads++] = {record->id, record->name, cpuTime};
+        }
+    }
+    lock.unlock();
+    // the function is called without the registry locked
+    for (size_t index = 0; index < nbrOfThreads; index++) {
+        function(cpuTimes[index].id, cpuTimes[index].name, cpuTimes[index].cpuTime);
+    }
+}
+
+void forEachThreadStack(ThreadStackFunction function) {
+    ThreadRegistry& registry = getThreadRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    // a thread terminates (releasing its native stack) only once marked as not running
+    for (const std::shared_ptr<ThreadRecord>& record : registry.records) {
+        if (record->isRunning && record->stackMemory != nullptr) {
+            function(record->id,
+                     record->name,
+                     record->stackMemory,
+                     record->stackMemorySize,
+                     record->stackSize);
+        }
+    }
+}
+
+uint64_t getIsrCpuTime() {
+    ThreadRegistry& registry = getThreadRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    return registry.isrCpuTime;
+}
+
+const void* getCurrentThreadId() {
+    return (tThreadRecord != nullptr) ? tThreadRecord->id : nullptr;
+}
+
+const char* getCurrentThreadName() {
+    return (tThreadRecord != nullptr) ? tThreadRecord->name : nullptr;
+}
+
+void isrEnter() {
+    if (tIsrNesting++ == 0) {
+        tIsrStartTime = getCurrentThreadCpuTime();
+    }
+}
+
+void isrExit() {
+    if (tIsrNesting == 0 || --tIsrNesting != 0) {
+        return;
+    }
+    const uint64_t isrTime   = getCurrentThreadCpuTime() - tIsrStartTime;
+    ThreadRegistry& registry = getThreadRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.isrCpuTime += isrTime;
+    if (tThreadRecord != nullptr) {
+        tThreadRecord->isrCpuTime += isrTime;
+    }
+}
+
+}  // namespace host
+
+namespace rtos {
+
+Thread::Thread(osPriority priority,
+               uint32_t stackSize,
+               unsigned char* stackMemory,
+               const char* name)
+    : _priority(priority), _stackSize(stackSize), _name(name) {}
+
+Thread::~Thread() {
+    host::unregisterThread(this);
+    if (_thread.joinable()) {
+        _thread.detach();
+    }
+}
+
+osStatus Thread::start(mbed::Callback<void()> task) {
+    if (_thread.joinable() || !task) {
+        return osErrorParameter;
+    }
+    std::shared_ptr<host::ThreadRecord> record = std::make_shared<host::ThreadRecord>();
+    record->id                                 = this;
+    record->name                               = _name;
+    record->stackSize                          = _stackSize;
+    host::registerThread(record);
+    _thread = std::thread([task, record]() {
+        host::onThreadStarted(record.get(), __builtin_frame_address(0));
+        task();
+        host::onThreadTerminated(record.get());
+    });
+    if (_name != nullptr) {
+        // thread names are limited to 15 characters on Linux
+        char name[16] = {0};
+        strncpy(name, _name, sizeof(name) - 1);
+        pthread_setname_np(_thread.native_handle(), name);
+    }
+    return osOK;
+}
+
+osStatus Thread::join() {
+    if (!_thread.joinable()) {
+        return osErrorResource;
+    }
+    if (_thread.get_id() == std::this_thread::get_id()) {
+        return osErrorResource;
+    }
+    _thread.join();
+    return osOK;
+}
+
+osStatus Thread::terminate() { return osErrorResource; }
+
+osPriority Thread::get_priority() const { return _priority; }
+
+osStatus Thread::set_priority(osPriority priority) {
+    _priority = priority;
+    return osOK;
+}
+
+uint32_t Thread::stack_size() const { return _stackSize; }
+
+const char* Thread::get_name() const { return _name; }
+
+namespace ThisThread {
+
+void sleep_for(const std::chrono::milliseconds& duration) {
+    std::this_thread::sleep_for(duration);
+}
+
+void yield() { std::this_thread::yield(); }
+
+}  // namespace ThisThread
+
+}  // namespace rtos
@@ -0,0 +1,96 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file ticker.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief mbed::TickerBase implementation (host port layer)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include "mbed_port/ticker.hpp"
+
+#include "mbed_port/thread.hpp"
+
+namespace mbed {
+
+TickerBase::~TickerBase() {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _isTerminated = true;
+    _condition.notify_all();
+    lock.unlock();
+    if (_thread.joinable()) {
+        _thread.join();
+    }
+}
+
+void TickerBase::detach() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _isAttached = false;
+    _condition.notify_all();
+}
+
+void TickerBase::setup(Callback<void()> function,
+                       const std::chrono::microseconds& interval,
+                       bool isPeriodic) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _function   = function;
+    _interval   = interval;
+    _attachTime = Clock::now();
+    _isPeriodic = isPeriodic;
+    _isAttached = true;
+    _generation++;
+    // the thread is kept for subsequent attaches
+    if (!_thread.joinable()) {
+        _thread = std::thread(&TickerBase::run, this);
+    }
+    _condition.notify_all();
+}
+
+void TickerBase::run() {
+    std::unique_lock<std::mutex> lock(_mutex);
+    uint32_t generation          = 0;
+    Clock::time_point expiryTime = Clock::time_point();
+    while (!_isTerminated) {
+        if (!_isAttached) {
+            _condition.wait(lock);
+            continue;
+        }
+        // the expiry time is computed from the last attach
+        if (generation != _generation) {
+            generation = _generation;
+            expiryTime = _attachTime + _interval;
+        }
+        if (Clock::now() < expiryTime) {
+            _condition.wait_until(lock, expiryTime);
+            continue;
+        }
+        Callback<void()> function = _function;
+        if (_isPeriodic) {
+            expiryTime += _interval;
+        } else {
+            _isAttached = false;
+        }
+        lock.unlock();
+        host::isrEnter();
+        function();
+        host::isrExit();
+        lock.lock();
+    }
+}
+
+}  // namespace mbed
@@ -0,0 +1,61 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file timer.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief mbed::Timer implementation (host port layer)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include "mbed_port/timer.hpp"
+
+namespace mbed {
+
+void Timer::start() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (!_isRunning) {
+        _startTime = Clock::now();
+        _isRunning = true;
+    }
+}
+
+void Timer::stop() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_isRunning) {
+        _elapsedTime += std::chrono::duration_cast<std::chrono::microseconds>(
+            Clock::now() - _startTime);
+        _isRunning = false;
+    }
+}
+
+void Timer::reset() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _startTime   = Clock::now();
+    _elapsedTime = std::chrono::microseconds::zero();
+}
+
+std::chrono::microseconds Timer::elapsed_time() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (!_isRunning) {
+        return _elapsedTime;
+    }
+    return _elapsedTime + std::chrono::duration_cast<std::chrono::microseconds>(
+                              Clock::now() - _startTime);
+}
+
+}  // namespace mbed
@@ -0,0 +1,97 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file utest.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Host test harness implementation (host port layer)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include "utest/utest.h"
+
+#include <cstdio>
+#include <stdexcept>
+
+#include "unity/unity.h"
+
+namespace utest {
+namespace v1 {
+
+namespace {
+
+// thrown by a failed assertion and caught by the harness
+class AssertionFailure : public std::runtime_error {
+   public:
+    explicit AssertionFailure(const char* message) : std::runtime_error(message) {}
+};
+
+}  // namespace
+
+void fail(const char* file, int line, const char* message) {
+    printf("%s:%d: %s\n", file, line, message);
+    throw AssertionFailure(message);
+}
+
+Case::Case(const char* description, case_handler_t handler)
+    : _description(description), _handler(handler) {}
+
+Case::Case(const char* description, case_call_count_handler_t handler)
+    : _description(description), _callCountHandler(handler) {}
+
+const char* Case::getDescription() const { return _description; }
+
+void Case::run() const {
+    if (_handler != nullptr) {
+        _handler();
+    } else {
+        _callCountHandler(0);
+    }
+}
+
+bool Harness::run(const Specification& specification) {
+    if (specification._setupHandler(specification._nbrOfCases) != STATUS_CONTINUE) {
+        printf(">>> Test setup failed\n");
+        return false;
+    }
+    size_t nbrOfFailures = 0;
+    for (size_t index = 0; index < specification._nbrOfCases; index++) {
+        const Case& testCase = specification._cases[index];
+        printf(">>> Running case #%zu: '%s'...\n", index + 1, testCase.getDescription());
+        bool isPassed = true;
+        try {
+            testCase.run();
+        } catch (const AssertionFailure&) {
+            isPassed = false;
+            nbrOfFailures++;
+        }
+        printf("<<< Case #%zu: %s\n", index + 1, isPassed ? "PASS" : "FAIL");
+        fflush(stdout);
+    }
+    printf(">>> Test cases: %zu passed, %zu failed\n",
+           specification._nbrOfCases - nbrOfFailures,
+           nbrOfFailures);
+    return nbrOfFailures == 0;
+}
+
+status_t greentea_test_setup_handler(const size_t numberOfCases) {
+    printf(">>> Running %zu test cases...\n", numberOfCases);
+    return STATUS_CONTINUE;
+}
+
+}  // namespace v1
+}  // namespace utest
@@ -0,0 +1,73 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file decode_deferred_log.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Command line decoder of the deferred log frames (host tool)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+
+#include "deferred_log_decoder.hpp"
+
+// prints each record as "<timestamp in us> [<level>][<group>]: <text>"
+static void printRecord(const host::DeferredLogDecoder::Record& record) {
+    char text[256];
+    host::DeferredLogDecoder::format(record, text, sizeof(text));
+    const bike_computer::LogFormat& format = host::DeferredLogDecoder::getFormat(record);
+    printf("%10" PRIu32 " [%s][%s]: %s\n",
+           record.timestamp,
+           host::DeferredLogDecoder::getLevelName(format.level),
+           format.group,
+           text);
+}
+
+int main(int argc, char* argv[]) {
+    if (argc > 2) {
+        printf("Usage: %s [<binary log file>]\n"
+               "  decodes the deferred log frames read from the file (or from stdin)\n",
+               argv[0]);
+        return EXIT_FAILURE;
+    }
+    FILE* file = (argc == 2) ? fopen(argv[1], "rb") : stdin;
+    if (file == nullptr) {
+        printf("Cannot open %s\n", argv[1]);
+        return EXIT_FAILURE;
+    }
+
+    host::DeferredLogDecoder decoder(callback(printRecord));
+    uint8_t chunk[256];
+    size_t size = 0;
+    while ((size = fread(chunk, 1, sizeof(chunk), file)) > 0) {
+        decoder.decode(chunk, size);
+    }
+    if (file != stdin) {
+        fclose(file);
+    }
+
+    fprintf(stderr,
+            "%" PRIu32 " records, %" PRIu32 " bytes skipped, %" PRIu32
+            " checksum errors\n",
+            decoder.getNbrOfRecords(),
+            decoder.getNbrOfSkippedBytes(),
+            decoder.getNbrOfChecksumErrors());
+    return EXIT_SUCCESS;
+}
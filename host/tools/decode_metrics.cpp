@@ -0,0 +1,74 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file decode_metrics.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Command line decoder of the metrics frames to csv (host tool)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+
+#include "metrics_decoder.hpp"
+
+// prints one csv row per decoded frame
+static void printRow(const host::MetricsDecoder& decoder) {
+    char text[1024];
+    decoder.formatCsvRow(text, sizeof(text));
+    printf("%s\n", text);
+}
+
+int main(int argc, char* argv[]) {
+    if (argc > 2) {
+        printf("Usage: %s [<binary metrics file>]\n"
+               "  decodes the metrics frames read from the file (or from stdin) to a\n"
+               "  csv time series\n",
+               argv[0]);
+        return EXIT_FAILURE;
+    }
+    FILE* file = (argc == 2) ? fopen(argv[1], "rb") : stdin;
+    if (file == nullptr) {
+        printf("Cannot open %s\n", argv[1]);
+        return EXIT_FAILURE;
+    }
+
+    char header[1024];
+    host::MetricsDecoder::formatCsvHeader(header, sizeof(header));
+    printf("%s\n", header);
+
+    host::MetricsDecoder decoder(callback(printRow));
+    uint8_t chunk[256];
+    size_t size = 0;
+    while ((size = fread(chunk, 1, sizeof(chunk), file)) > 0) {
+        decoder.decode(chunk, size);
+    }
+    if (file != stdin) {
+        fclose(file);
+    }
+
+    fprintf(stderr,
+            "%" PRIu32 " frames, %" PRIu32 " lost, %" PRIu32 " bytes skipped, %" PRIu32
+            " checksum errors\n",
+            decoder.getNbrOfFrames(),
+            decoder.getNbrOfLostFrames(),
+            decoder.getNbrOfSkippedBytes(),
+            decoder.getNbrOfChecksumErrors());
+    return EXIT_SUCCESS;
+}
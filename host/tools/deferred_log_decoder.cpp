@@ -0,0 +1,192 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file deferred_log_decoder.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Decoder of the binary frames of the deferred log (host tool)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include "deferred_log_decoder.hpp"
+
+#include <cstdio>
+#include <cstring>
+
+namespace host {
+
+using bike_computer::DeferredLog;
+using bike_computer::LogFormat;
+using bike_computer::LogFormatId;
+using bike_computer::LogFormats;
+
+static uint32_t readUint32(const uint8_t* data) {
+    uint32_t value = 0;
+    for (uint8_t index = 0; index < 4; index++) {
+        value |= static_cast<uint32_t>(data[index]) << (8 * index);
+    }
+    return value;
+}
+
+DeferredLogDecoder::DeferredLogDecoder(RecordHandler handler) : _handler(handler) {}
+
+void DeferredLogDecoder::decode(const uint8_t* data, size_t size) {
+    for (size_t index = 0; index < size; index++) {
+        _buffer[_bufferSize++] = data[index];
+        parse();
+    }
+}
+
+size_t DeferredLogDecoder::format(const Record& record, char* text, size_t size) {
+    if (size == 0) {
+        return 0;
+    }
+    const char* character = getFormat(record).format;
+    uint8_t argumentIndex = 0;
+    size_t length         = 0;
+    while (*character != '\0' && length + 1 < size) {
+        if (*character != '%') {
+            text[length++] = *character++;
+            continue;
+        }
+        if (character[1] == '%') {
+            text[length++] = '%';
+            character += 2;
+            continue;
+        }
+        // copy the conversion specification for formatting the argument
+        char specification[16]               = {0};
+        size_t specificationLength           = 0;
+        specification[specificationLength++] = *character++;
+        while (LogFormats::isModifier(*character) &&
+               specificationLength + 2 < sizeof(specification)) {
+            specification[specificationLength++] = *character++;
+        }
+        const char conversion                = *character++;
+        specification[specificationLength++] = conversion;
+        const uint32_t argument =
+            (argumentIndex < record.nbrOfArguments) ? record.arguments[argumentIndex] : 0;
+        argumentIndex++;
+        int written = 0;
+        if (conversion == 'f' || conversion == 'e' || conversion == 'g') {
+            float value = 0.0f;
+            memcpy(&value, &argument, sizeof(value));
+            written = snprintf(text + length, size - length, specification, value);
+        } else if (conversion == 'd' || conversion == 'i') {
+            written = snprintf(text + length,
+                               size - length,
+                               specification,
+                               static_cast<int32_t>(argument));
+        } else {
+            written = snprintf(text + length, size - length, specification, argument);
+        }
+        if (written < 0) {
+            break;
+        }
+        length += static_cast<size_t>(written);
+        if (length >= size) {
+            length = size - 1;
+        }
+    }
+    text[length] = '\0';
+    return length;
+}
+
+const LogFormat& DeferredLogDecoder::getFormat(const Record& record) {
+    return LogFormats::kFormats[static_cast<uint16_t>(record.formatId)];
+}
+
+const char* DeferredLogDecoder::getLevelName(uint8_t level) {
+    switch (level) {
+        case TRACE_LEVEL_DEBUG:
+            return "DBG ";
+        case TRACE_LEVEL_INFO:
+            return "INFO";
+        case TRACE_LEVEL_WARN:
+            return "WARN";
+        case TRACE_LEVEL_ERROR:
+            return "ERR ";
+        default:
+            return "CMD ";
+    }
+}
+
+uint32_t DeferredLogDecoder::getNbrOfRecords() const { return _nbrOfRecords; }
+
+uint32_t DeferredLogDecoder::getNbrOfSkippedBytes() const { return _nbrOfSkippedBytes; }
+
+uint32_t DeferredLogDecoder::getNbrOfChecksumErrors() const {
+    return _nbrOfChecksumErrors;
+}
+
+void DeferredLogDecoder::parse() {
+    while (_bufferSize > 0) {
+        // resynchronize on the next sync byte
+        if (_buffer[0] != DeferredLog::kSyncByte) {
+            skip(1);
+            continue;
+        }
+        if (_bufferSize < DeferredLog::kFrameHeaderSize) {
+            return;
+        }
+        // a header with an unknown format or an invalid payload size is not a frame
+        const uint16_t formatId =
+            static_cast<uint16_t>(_buffer[1] | (static_cast<uint16_t>(_buffer[2]) << 8));
+        const uint8_t payloadSize = _buffer[DeferredLog::kFrameHeaderSize - 1];
+        if (formatId >= LogFormats::kNbrOfFormats ||
+            payloadSize != 4 * LogFormats::getNbrOfArguments(
+                                   LogFormats::kFormats[formatId].format)) {
+            skip(1);
+            continue;
+        }
+        const size_t frameSize = DeferredLog::kFrameHeaderSize + payloadSize + 1;
+        if (_bufferSize < frameSize) {
+            return;
+        }
+        uint8_t checksum = 0;
+        for (size_t index = 1; index < frameSize - 1; index++) {
+            checksum += _buffer[index];
+        }
+        if (checksum != _buffer[frameSize - 1]) {
+            _nbrOfChecksumErrors++;
+            skip(1);
+            continue;
+        }
+
+        Record record;
+        record.formatId       = static_cast<LogFormatId>(formatId);
+        record.timestamp      = readUint32(&_buffer[3]);
+        record.nbrOfArguments = payloadSize / 4;
+        for (uint8_t index = 0; index < record.nbrOfArguments; index++) {
+            record.arguments[index] =
+                readUint32(&_buffer[DeferredLog::kFrameHeaderSize + 4 * index]);
+        }
+        _nbrOfRecords++;
+        // the frame is removed before calling the handler
+        memmove(_buffer, _buffer + frameSize, _bufferSize - frameSize);
+        _bufferSize -= frameSize;
+        _handler(record);
+    }
+}
+
+void DeferredLogDecoder::skip(size_t nbrOfBytes) {
+    _nbrOfSkippedBytes += nbrOfBytes;
+    memmove(_buffer, _buffer + nbrOfBytes, _bufferSize - nbrOfBytes);
+    _bufferSize -= nbrOfBytes;
+}
+
+}  // namespace host
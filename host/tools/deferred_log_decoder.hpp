@@ -0,0 +1,84 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file deferred_log_decoder.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Decoder of the binary frames of the deferred log (host tool)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "deferred_log.hpp"
+#include "log_formats.hpp"
+#include "mbed.h"
+
+namespace host {
+
+// Decoder of the frames sent by bike_computer::DeferredLog: the stream is decoded by
+// chunks (frames may be split across chunks), the bytes that do not belong to a valid
+// frame (text traces sent on the same console, corrupted frames) being skipped
+class DeferredLogDecoder {
+   public:
+    struct Record {
+        bike_computer::LogFormatId formatId;
+        uint32_t timestamp;
+        uint8_t nbrOfArguments;
+        uint32_t arguments[bike_computer::DeferredLog::kMaxNbrOfArguments];
+    };
+
+    typedef mbed::Callback<void(const Record&)> RecordHandler;
+
+    explicit DeferredLogDecoder(RecordHandler handler);
+
+    // make the class non copyable
+    DeferredLogDecoder(DeferredLogDecoder&)            = delete;
+    DeferredLogDecoder& operator=(DeferredLogDecoder&) = delete;
+
+    // decode a chunk of the stream, the handler being called for each decoded record
+    void decode(const uint8_t* data, size_t size);
+
+    // format the text of a record (without level and group), returns the text length
+    static size_t format(const Record& record, char* text, size_t size);
+    static const bike_computer::LogFormat& getFormat(const Record& record);
+    // name of a trace level as printed by mbed-trace ("DBG ", "INFO", ...)
+    static const char* getLevelName(uint8_t level);
+
+    // methods for getting the decoding statistics
+    uint32_t getNbrOfRecords() const;
+    uint32_t getNbrOfSkippedBytes() const;
+    uint32_t getNbrOfChecksumErrors() const;
+
+   private:
+    // private methods
+    void parse();
+    void skip(size_t nbrOfBytes);
+
+    // data members
+    RecordHandler _handler;
+    uint8_t _buffer[bike_computer::DeferredLog::kMaxFrameSize];
+    size_t _bufferSize            = 0;
+    uint32_t _nbrOfRecords        = 0;
+    uint32_t _nbrOfSkippedBytes   = 0;
+    uint32_t _nbrOfChecksumErrors = 0;
+};
+
+}  // namespace host
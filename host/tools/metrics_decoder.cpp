@@ -0,0 +1,217 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file metrics_decoder.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Decoder of the binary frames of the metrics exporter (host tool)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include "metrics_decoder.hpp"
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+
+namespace host {
+
+using bike_computer::MetricDefinition;
+using bike_computer::MetricDefinitions;
+using bike_computer::MetricsExporter;
+using bike_computer::MetricType;
+
+// definition required when the constant is odr-used (C++14)
+constexpr uint8_t MetricsDecoder::kNbrOfSlots;
+
+// returns the index of the metric stored in a slot
+static uint8_t findMetric(uint8_t slot) {
+    uint8_t index = 0;
+    while (index + 1 < MetricDefinitions::kNbrOfMetrics &&
+           MetricDefinitions::getFirstSlot(static_cast<uint8_t>(index + 1)) <= slot) {
+        index++;
+    }
+    return index;
+}
+
+// returns the length of a text after appending the characters written by snprintf,
+// the text being truncated to its size
+static size_t advance(size_t length, int written, size_t size) {
+    if (written < 0) {
+        return length;
+    }
+    length += static_cast<size_t>(written);
+    return (length >= size) ? size - 1 : length;
+}
+
+MetricsDecoder::MetricsDecoder(FrameHandler handler) : _handler(handler) {}
+
+void MetricsDecoder::decode(const uint8_t* data, size_t size) {
+    for (size_t index = 0; index < size; index++) {
+        _buffer[_bufferSize++] = data[index];
+        parse();
+    }
+}
+
+uint32_t MetricsDecoder::getTimestamp() const { return _timestamp; }
+
+int64_t MetricsDecoder::getValue(uint8_t slot) const {
+    if (MetricDefinitions::kDefinitions[findMetric(slot)].type == MetricType::Gauge) {
+        return static_cast<int32_t>(_values[slot]);
+    }
+    return _values[slot];
+}
+
+size_t MetricsDecoder::formatCsvHeader(char* text, size_t size) {
+    if (size == 0) {
+        return 0;
+    }
+    size_t length = advance(0, snprintf(text, size, "time_ms"), size);
+    for (uint8_t slot = 0; slot < kNbrOfSlots; slot++) {
+        const uint8_t index                = findMetric(slot);
+        const MetricDefinition& definition = MetricDefinitions::kDefinitions[index];
+        int written                        = 0;
+        if (definition.type != MetricType::Histogram) {
+            written = snprintf(text + length, size - length, ",%s", definition.name);
+        } else {
+            // buckets are named after their bound: <name>_lt<bound> and <name>_ge<bound>
+            // for the last bucket
+            const uint8_t bucket = slot - MetricDefinitions::getFirstSlot(index);
+            const bool isLast    = (bucket == MetricDefinitions::kNbrOfBuckets - 1);
+            const uint32_t bound = MetricDefinitions::getBucketBound(
+                definition, isLast ? bucket - 1 : bucket);
+            written = snprintf(text + length,
+                               size - length,
+                               ",%s_%s%" PRIu32,
+                               definition.name,
+                               isLast ? "ge" : "lt",
+                               bound);
+        }
+        length = advance(length, written, size);
+    }
+    return length;
+}
+
+size_t MetricsDecoder::formatCsvRow(char* text, size_t size) const {
+    if (size == 0) {
+        return 0;
+    }
+    size_t length = advance(0, snprintf(text, size, "%" PRIu32, _timestamp), size);
+    for (uint8_t slot = 0; slot < kNbrOfSlots; slot++) {
+        const int written =
+            snprintf(text + length, size - length, ",%" PRId64, getValue(slot));
+        length = advance(length, written, size);
+    }
+    return length;
+}
+
+uint32_t MetricsDecoder::getNbrOfFrames() const { return _nbrOfFrames; }
+
+uint32_t MetricsDecoder::getNbrOfLostFrames() const { return _nbrOfLostFrames; }
+
+uint32_t MetricsDecoder::getNbrOfSkippedBytes() const { return _nbrOfSkippedBytes; }
+
+uint32_t MetricsDecoder::getNbrOfChecksumErrors() const { return _nbrOfChecksumErrors; }
+
+void MetricsDecoder::parse() {
+    while (_bufferSize > 0) {
+        // resynchronize on the next sync byte
+        if (_buffer[0] != MetricsExporter::kSyncByte) {
+            skip(1);
+            continue;
+        }
+        if (_bufferSize < MetricsExporter::kFrameHeaderSize) {
+            return;
+        }
+        const uint8_t payloadSize = _buffer[MetricsExporter::kFrameHeaderSize - 1];
+        if (payloadSize > MetricsExporter::kMaxPayloadSize) {
+            skip(1);
+            continue;
+        }
+        const size_t frameSize = MetricsExporter::kFrameHeaderSize + payloadSize + 1;
+        if (_bufferSize < frameSize) {
+            return;
+        }
+        uint8_t checksum = 0;
+        for (size_t index = 1; index < frameSize - 1; index++) {
+            checksum += _buffer[index];
+        }
+        // a payload that cannot be decoded is handled as a checksum error
+        if (checksum != _buffer[frameSize - 1] ||
+            !applyPayload(&_buffer[MetricsExporter::kFrameHeaderSize], payloadSize)) {
+            _nbrOfChecksumErrors++;
+            skip(1);
+            continue;
+        }
+
+        const uint16_t sequence =
+            static_cast<uint16_t>(_buffer[1] | (static_cast<uint16_t>(_buffer[2]) << 8));
+        if (_nbrOfFrames > 0) {
+            _nbrOfLostFrames += static_cast<uint16_t>(sequence - _nextSequence);
+        }
+        _nextSequence = sequence + 1;
+        _timestamp    = 0;
+        for (uint8_t index = 0; index < 4; index++) {
+            _timestamp |= static_cast<uint32_t>(_buffer[3 + index]) << (8 * index);
+        }
+        _nbrOfFrames++;
+        // the frame is removed before calling the handler
+        memmove(_buffer, _buffer + frameSize, _bufferSize - frameSize);
+        _bufferSize -= frameSize;
+        _handler(*this);
+    }
+}
+
+bool MetricsDecoder::applyPayload(const uint8_t* payload, uint8_t payloadSize) {
+    // the deltas are applied only once the whole payload is decoded
+    uint32_t values[kNbrOfSlots];
+    memcpy(values, _values, sizeof(values));
+    uint8_t offset = 0;
+    while (offset < payloadSize) {
+        const uint8_t slot = payload[offset++];
+        if (slot >= kNbrOfSlots) {
+            return false;
+        }
+        uint32_t delta = 0;
+        uint8_t shift  = 0;
+        bool isLast    = false;
+        while (!isLast) {
+            if (offset >= payloadSize || shift >= 7 * MetricsExporter::kMaxDeltaSize) {
+                return false;
+            }
+            const uint8_t byte = payload[offset++];
+            delta |= static_cast<uint32_t>(byte & 0x7F) << shift;
+            shift += 7;
+            isLast = (byte & 0x80) == 0;
+        }
+        if (MetricDefinitions::kDefinitions[findMetric(slot)].type == MetricType::Gauge) {
+            // zigzag decoding
+            delta = (delta >> 1) ^ (0U - (delta & 1));
+        }
+        values[slot] += delta;
+    }
+    memcpy(_values, values, sizeof(values));
+    return true;
+}
+
+void MetricsDecoder::skip(size_t nbrOfBytes) {
+    _nbrOfSkippedBytes += nbrOfBytes;
+    memmove(_buffer, _buffer + nbrOfBytes, _bufferSize - nbrOfBytes);
+    _bufferSize -= nbrOfBytes;
+}
+
+}  // namespace host
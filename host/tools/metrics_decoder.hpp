@@ -0,0 +1,92 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file metrics_decoder.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Decoder of the binary frames of the metrics exporter (host tool)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "mbed.h"
+#include "metric_definitions.hpp"
+#include "metrics_exporter.hpp"
+
+namespace host {
+
+// Decoder of the frames sent by bike_computer::MetricsExporter: the deltas of each
+// frame are accumulated for rebuilding the values of the metrics, the handler being
+// called once per frame (one row of the time series). As for the deferred log, the
+// stream is decoded by chunks and the bytes that do not belong to a valid frame are
+// skipped. Frames lost in the stream are detected from the sequence numbers, the
+// values of the metrics being wrong from that point on.
+class MetricsDecoder {
+   public:
+    static constexpr uint8_t kNbrOfSlots = bike_computer::MetricsRegistry::kNbrOfSlots;
+
+    typedef mbed::Callback<void(const MetricsDecoder&)> FrameHandler;
+
+    explicit MetricsDecoder(FrameHandler handler);
+
+    // make the class non copyable
+    MetricsDecoder(MetricsDecoder&)            = delete;
+    MetricsDecoder& operator=(MetricsDecoder&) = delete;
+
+    // decode a chunk of the stream, the handler being called for each decoded frame
+    void decode(const uint8_t* data, size_t size);
+
+    // methods for getting the values rebuilt upon the last decoded frame
+    uint32_t getTimestamp() const;
+    // counters and histogram buckets are unsigned, gauges are signed
+    int64_t getValue(uint8_t slot) const;
+
+    // format the time series as csv: one column per slot, histograms having one
+    // column per bucket (named after the bucket bound), returns the text length
+    static size_t formatCsvHeader(char* text, size_t size);
+    size_t formatCsvRow(char* text, size_t size) const;
+
+    // methods for getting the decoding statistics
+    uint32_t getNbrOfFrames() const;
+    uint32_t getNbrOfLostFrames() const;
+    uint32_t getNbrOfSkippedBytes() const;
+    uint32_t getNbrOfChecksumErrors() const;
+
+   private:
+    // private methods
+    void parse();
+    bool applyPayload(const uint8_t* payload, uint8_t payloadSize);
+    void skip(size_t nbrOfBytes);
+
+    // data members
+    FrameHandler _handler;
+    uint8_t _buffer[bike_computer::MetricsExporter::kMaxFrameSize];
+    size_t _bufferSize            = 0;
+    uint32_t _values[kNbrOfSlots] = {0};
+    uint32_t _timestamp           = 0;
+    uint16_t _nextSequence        = 0;
+    uint32_t _nbrOfFrames         = 0;
+    uint32_t _nbrOfLostFrames     = 0;
+    uint32_t _nbrOfSkippedBytes   = 0;
+    uint32_t _nbrOfChecksumErrors = 0;
+};
+
+}  // namespace host
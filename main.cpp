@@ -29,10 +29,10 @@
 #endif  //  MBED_CONF_MBED_TRACE_ENABLE
 
 #include "FlashIAPBlockDevice.h"
-// #include "multi_tasking/bike_system.hpp"
-// #include "multi_threading/bike_system.hpp"
+#include "multi_tasking/bike_system.hpp"
 #include "static_scheduling/bike_system.hpp"
-// #include "static_scheduling_with_event/bike_system.hpp"
+#include "static_scheduling_with_event/bike_system.hpp"
+#include "task_console.hpp"
 #include "update-client/usb_serial_uc.hpp"
 
 // main() runs in its own thread in the OS
@@ -58,11 +58,14 @@ int main() {
     }
 #endif
 
-    // declare the BikeSystem instance
+    // declare the BikeSystem instance, all variants being built side by side
+    // (static_scheduling::BikeSystemWithEventQueue,
+    // static_scheduling_with_event::BikeSystem or multi_tasking::BikeSystem)
     static_scheduling::BikeSystem bikeSystem;
-    // static_scheduling_with_event::BikeSystem bikeSystem;
-    // multi_threading::BikeSystem bikeSystem;
-    // multi_tasking::BikeSystem bikeSystem;
+
+    // start the console used for changing task periods at runtime
+    bike_computer::TaskConsole taskConsole(bikeSystem.getTaskTable());
+    taskConsole.start();
 
     // will start the BikeSystem and never return
     tr_debug("Starting the bike system (2)");
@@ -24,97 +24,21 @@
 
 #pragma once
 
-// from advembsof
-#include "cpu_logger.hpp"
-#include "display_device.hpp"
-#include "memory_logger.hpp"
-#include "task_logger.hpp"
-
 // from common
-#include "sensor_device.hpp"
-#include "speedometer.hpp"
+#include "bike_system_template.hpp"
 
 // local
-#include "gear_device.hpp"
-#include "pedal_device.hpp"
-#include "reset_device.hpp"
-
-namespace multi_tasking {
-
-class BikeSystem {
-   public:
-    // constructor
-    BikeSystem();
-
-    // make the class non copyable
-    BikeSystem(BikeSystem&)            = delete;
-    BikeSystem& operator=(BikeSystem&) = delete;
-
-    // method called in main() for starting the system
-    void start();
-
-    // method called for stopping the system
-    void stop();
+#include "event_input.hpp"
 
-#if defined(MBED_TEST_MODE)
-    const advembsof::TaskLogger& getTaskLogger() const;
-    bike_computer::Speedometer& getSpeedometer();
-    GearDevice& getGearDevice();
-    uint8_t getCurrentGear() const;
-#endif  // defined(MBED_TEST_MODE)
+// from static_scheduling_with_event
+#include "static_scheduling_with_event/event_queue_scheduling.hpp"
 
-    // these methods must be made public for test purposes only
-#if defined(MBED_TEST_MODE)
-
-   public:
-#else
-
-   private:
-#endif
-    void onReset();
-
-   private:
-    // private methods
-    void init();
-    void onGearChanged(uint8_t currentGear, uint8_t currentGearSize);
-    void onRotationSpeedChanged(const std::chrono::milliseconds& pedalRotationTime);
-    void temperatureTask();
-    void resetTask();
-    void displayTask();
-
-    // EventQueue used by the thread calling start()
-    EventQueue _eventQueue;
-    // EventQueue used for serving deferred ISRs
-    EventQueue _eventQueueForISRs;
-    Thread _deferredISRThread;
-    // used for computing the reset response time
-    std::chrono::microseconds _resetTime = std::chrono::microseconds::zero();
-    // timer instance used for loggint task time and used by ResetDevice
-    Timer _timer;
-    // data member that represents the device for manipulating the gear
-    GearDevice _gearDevice;
-    uint8_t _currentGear = bike_computer::kMinGear;
-    // data member that represents the device for manipulating the pedal rotation
-    // speed/time
-    PedalDevice _pedalDevice;
-    // data member that represents the device used for resetting
-    ResetDevice _resetDevice;
-    // data member that represents the device display
-    advembsof::DisplayDevice _displayDevice;
-    // data member that represents the device for counting wheel rotations
-    bike_computer::Speedometer _speedometer;
-    // data member that represents the sensor device
-    bike_computer::SensorDevice _sensorDevice;
-    float _currentTemperature = 0.0f;
-
-    // used for logging task info
-    advembsof::TaskLogger _taskLogger;
-
-    // used for logging cpu usage
-    advembsof::CPULogger _cpuLogger;
+namespace multi_tasking {
 
-    // used for logging thread and memory usage
-    advembsof::MemoryLogger _memoryLogger;
-};
+// tasks released as periodic events on an EventQueue, input changes posted as
+// events and reset served by a deferred ISR thread
+using BikeSystem =
+    bike_computer::BikeSystem<static_scheduling_with_event::EventQueueScheduling,
+                              EventInput>;
 
 }  // namespace multi_tasking
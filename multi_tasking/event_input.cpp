@@ -0,0 +1,83 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file event_input.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Event-driven input policy implementation (multi-tasking)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include "event_input.hpp"
+
+namespace multi_tasking {
+
+EventInput::EventInput(Timer& timer,
+                       EventQueue* eventQueue,
+                       mbed::Callback<void()> onReset,
+                       mbed::Callback<void()> onInputChanged)
+    : _deferredISRThread(osPriorityNormal, OS_STACK_SIZE, nullptr, "deferredISRThread"),
+      _onInputChanged(onInputChanged),
+      _gearDevice(*eventQueue, callback(this, &EventInput::onGearChanged)),
+      _pedalDevice(*eventQueue, callback(this, &EventInput::onRotationSpeedChanged)),
+      _resetDevice(onReset) {
+    // start the thread for serving deferred ISRs
+    _deferredISRThread.start(
+        callback(&_eventQueueForISRs, &EventQueue::dispatch_forever));
+
+    // print thread statistics
+    _memoryLogger.getAndPrintThreadStatistics();
+}
+
+EventInput::~EventInput() {
+    _eventQueueForISRs.break_dispatch();
+    _deferredISRThread.join();
+}
+
+uint8_t EventInput::getCurrentGear() { return _currentGear; }
+
+uint8_t EventInput::getCurrentGearSize() const { return _currentGearSize; }
+
+std::chrono::milliseconds EventInput::getCurrentRotationTime() {
+    return _currentRotationTime;
+}
+
+bool EventInput::checkReset() { return false; }
+
+std::chrono::microseconds EventInput::getPressTime() {
+    return std::chrono::microseconds::zero();
+}
+
+void EventInput::serveReset(mbed::Callback<void()> resetHandler) {
+    _eventQueueForISRs.call(resetHandler);
+}
+
+EventInput::GearDevice& EventInput::getGearDevice() { return _gearDevice; }
+
+void EventInput::onGearChanged(uint8_t currentGear, uint8_t currentGearSize) {
+    _currentGear     = currentGear;
+    _currentGearSize = currentGearSize;
+    _onInputChanged();
+}
+
+void EventInput::onRotationSpeedChanged(
+    const std::chrono::milliseconds& pedalRotationTime) {
+    _currentRotationTime = pedalRotationTime;
+    _onInputChanged();
+}
+
+}  // namespace multi_tasking
@@ -0,0 +1,98 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file event_input.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Event-driven input policy header file (multi-tasking)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include <chrono>
+
+#include "constants.hpp"
+#include "mbed.h"
+
+// from advembsof
+#include "memory_logger.hpp"
+
+// local
+#include "gear_device.hpp"
+#include "pedal_device.hpp"
+#include "reset_device.hpp"
+
+namespace multi_tasking {
+
+// input policy where gear and pedal changes are posted as events on the event queue
+// of the scheduling policy and where the reset is served by a deferred ISR thread
+class EventInput {
+   public:
+    using GearDevice = multi_tasking::GearDevice;
+
+    // inputs are not read by periodic tasks
+    static constexpr bool kIsEventDriven = true;
+
+    // the event queue must be provided by the scheduling policy, onInputChanged is
+    // called from the event queue and onReset in ISR context
+    EventInput(Timer& timer,  // NOLINT(runtime/references)
+               EventQueue* eventQueue,
+               mbed::Callback<void()> onReset,
+               mbed::Callback<void()> onInputChanged);
+    ~EventInput();
+
+    // make the class non copyable
+    EventInput(EventInput&)            = delete;
+    EventInput& operator=(EventInput&) = delete;
+
+    // methods called for reading the last input values
+    uint8_t getCurrentGear();
+    uint8_t getCurrentGearSize() const;
+    std::chrono::milliseconds getCurrentRotationTime();
+    // the reset is signaled through onReset()
+    bool checkReset();
+    std::chrono::microseconds getPressTime();
+
+    // method called in ISR context for serving the reset in the deferred ISR thread
+    void serveReset(mbed::Callback<void()> resetHandler);
+
+    GearDevice& getGearDevice();
+
+   private:
+    // private methods
+    void onGearChanged(uint8_t currentGear, uint8_t currentGearSize);
+    void onRotationSpeedChanged(const std::chrono::milliseconds& pedalRotationTime);
+
+    // data members
+    // EventQueue used for serving deferred ISRs
+    EventQueue _eventQueueForISRs;
+    Thread _deferredISRThread;
+    mbed::Callback<void()> _onInputChanged;
+    // last values posted by the devices
+    uint8_t _currentGear     = bike_computer::kMinGear;
+    uint8_t _currentGearSize = bike_computer::kMinGearSize;
+    std::chrono::milliseconds _currentRotationTime =
+        bike_computer::kInitialPedalRotationTime;
+    GearDevice _gearDevice;
+    PedalDevice _pedalDevice;
+    ResetDevice _resetDevice;
+    // used for logging thread and memory usage
+    advembsof::MemoryLogger _memoryLogger;
+};
+
+}  // namespace multi_tasking
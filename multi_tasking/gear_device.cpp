@@ -29,6 +29,8 @@
 
 #include "joystick.hpp"
 #include "mbed_trace.h"
+#include "scope_profiler.hpp"
+#include "thread_cpu_monitor.hpp"
 
 #if MBED_CONF_MBED_TRACE_ENABLE
 #define TRACE_GROUP "GearDevice"
@@ -44,6 +46,8 @@ GearDevice::GearDevice(EventQueue& eventQueue, mbed::Callback<void(uint8_t, uint
 }
 
 void GearDevice::onUp() {
+    bike_computer::ThreadCpuMonitor::IsrScope isrScope;
+    PROFILE_SCOPE("GearDevice::onUp");
     if (_currentGear < bike_computer::kMaxGear) {
         _currentGear++;
         postEvent();
@@ -51,6 +55,8 @@ void GearDevice::onUp() {
 }
 
 void GearDevice::onDown() {
+    bike_computer::ThreadCpuMonitor::IsrScope isrScope;
+    PROFILE_SCOPE("GearDevice::onDown");
     if (_currentGear > bike_computer::kMinGear) {
         _currentGear--;
         postEvent();
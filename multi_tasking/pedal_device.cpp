@@ -27,6 +27,8 @@
 // from disco_h747i/wrappers
 #include "joystick.hpp"
 #include "mbed_trace.h"
+#include "scope_profiler.hpp"
+#include "thread_cpu_monitor.hpp"
 
 #if MBED_CONF_MBED_TRACE_ENABLE
 #define TRACE_GROUP "PedalDevice"
@@ -44,6 +46,8 @@ PedalDevice::PedalDevice(EventQueue& eventQueue,
 }
 
 void PedalDevice::onLeft() {
+    bike_computer::ThreadCpuMonitor::IsrScope isrScope;
+    PROFILE_SCOPE("PedalDevice::onLeft");
     if (_currentStep < kNbrOfSteps) {
         _currentStep++;
         postEvent();
@@ -51,6 +55,8 @@ void PedalDevice::onLeft() {
 }
 
 void PedalDevice::onRight() {
+    bike_computer::ThreadCpuMonitor::IsrScope isrScope;
+    PROFILE_SCOPE("PedalDevice::onRight");
     if (_currentStep > 0) {
         _currentStep--;
         postEvent();
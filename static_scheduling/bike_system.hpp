@@ -24,80 +24,35 @@
 
 #pragma once
 
-// from advembsof
-#include "cpu_logger.hpp"
-#include "display_device.hpp"
-#include "task_logger.hpp"
-
 // from common
-#include "sensor_device.hpp"
-#include "speedometer.hpp"
+#include "bike_system_template.hpp"
 
 // local
-#include "gear_device.hpp"
-#include "pedal_device.hpp"
-#include "reset_device.hpp"
-
-namespace static_scheduling {
-
-class BikeSystem {
-   public:
-    // constructor
-    BikeSystem();
+#include "polling_input.hpp"
+#include "super_loop_scheduling.hpp"
 
-    // make the class non copyable
-    BikeSystem(BikeSystem&)            = delete;
-    BikeSystem& operator=(BikeSystem&) = delete;
+// from static_scheduling_with_event
+#include "static_scheduling_with_event/event_queue_scheduling.hpp"
 
-    // method called in main() for starting the system
-    void start();
-    void startWithEventQueue();
-
-    // method called for stopping the system
-    void stop();
+namespace static_scheduling {
 
-#if defined(MBED_TEST_MODE)
-    const advembsof::TaskLogger& getTaskLogger();
-#endif  // defined(MBED_TEST_MODE)
+// tasks executed in a super-loop, inputs polled by the tasks
+using BikeSystem = bike_computer::BikeSystem<SuperLoopScheduling, PollingInput>;
 
-   private:
-    // private methods
-    void init();
-    void gearTask();
-    void speedDistanceTask();
-    void temperatureTask();
-    void resetTask();
-    void displayTask1();
-    void displayTask2();
+// same tasks released as periodic events on an EventQueue
+using BikeSystemWithEventQueue =
+    bike_computer::BikeSystem<static_scheduling_with_event::EventQueueScheduling,
+                              PollingInput>;
 
-    // stop flag, used for stopping the super-loop (set in stop())
-    bool _stopFlag = false;
-    // timer instance used for loggint task time and used by ResetDevice
-    Timer _timer;
-    // data member that represents the device for manipulating the gear
-    GearDevice _gearDevice;
-    uint8_t _currentGear     = bike_computer::kMinGear;
-    uint8_t _currentGearSize = bike_computer::kMinGearSize;
-    // data member that represents the device for manipulating the pedal rotation
-    // speed/time
-    PedalDevice _pedalDevice;
-    float _currentSpeed     = 0.0f;
-    float _traveledDistance = 0.0f;
-    // data member that represents the device used for resetting
-    ResetDevice _resetDevice;
-    // data member that represents the device display
-    advembsof::DisplayDevice _displayDevice;
-    // data member that represents the device for counting wheel rotations
-    bike_computer::Speedometer _speedometer;
-    // data member that represents the sensor device
-    bike_computer::SensorDevice _sensorDevice;
-    float _currentTemperature = 0.0f;
+}  // namespace static_scheduling
 
-    // used for logging task info
-    advembsof::TaskLogger _taskLogger;
+namespace bike_computer {
 
-    // used for logging cpu usage
-    advembsof::CPULogger _cpuLogger;
+// the static scheduling variants simulate the computation time of their tasks, with
+// the super-loop as with the EventQueue, so that both variants can be compared
+template <typename SchedulingPolicy>
+struct ComputationPolicy<SchedulingPolicy, static_scheduling::PollingInput> {
+    static constexpr bool kSimulateComputationTime = true;
 };
 
-}  // namespace static_scheduling
+}  // namespace bike_computer
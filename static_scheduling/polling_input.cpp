@@ -0,0 +1,55 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file polling_input.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Polling input policy implementation (static scheduling)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include "polling_input.hpp"
+
+namespace static_scheduling {
+
+PollingInput::PollingInput(Timer& timer,
+                           EventQueue* eventQueue,
+                           mbed::Callback<void()> onReset,
+                           mbed::Callback<void()> onInputChanged)
+    : _gearDevice(timer), _pedalDevice(timer), _resetDevice(timer) {}
+
+uint8_t PollingInput::getCurrentGear() { return _gearDevice.getCurrentGear(); }
+
+uint8_t PollingInput::getCurrentGearSize() const {
+    return _gearDevice.getCurrentGearSize();
+}
+
+std::chrono::milliseconds PollingInput::getCurrentRotationTime() {
+    return _pedalDevice.getCurrentRotationTime();
+}
+
+bool PollingInput::checkReset() { return _resetDevice.checkReset(); }
+
+std::chrono::microseconds PollingInput::getPressTime() {
+    return _resetDevice.getPressTime();
+}
+
+void PollingInput::serveReset(mbed::Callback<void()> resetHandler) {}
+
+PollingInput::GearDevice& PollingInput::getGearDevice() { return _gearDevice; }
+
+}  // namespace static_scheduling
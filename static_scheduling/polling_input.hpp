@@ -0,0 +1,75 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file polling_input.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Polling input policy header file (static scheduling)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include <chrono>
+
+#include "mbed.h"
+
+// local
+#include "gear_device.hpp"
+#include "pedal_device.hpp"
+#include "reset_device.hpp"
+
+namespace static_scheduling {
+
+// input policy polling the gear, pedal and reset devices from periodic tasks
+class PollingInput {
+   public:
+    using GearDevice = static_scheduling::GearDevice;
+
+    // inputs are read by the gear, speed and reset tasks
+    static constexpr bool kIsEventDriven = false;
+
+    // the event queue and the callbacks are not used with polling
+    PollingInput(Timer& timer,  // NOLINT(runtime/references)
+                 EventQueue* eventQueue,
+                 mbed::Callback<void()> onReset,
+                 mbed::Callback<void()> onInputChanged);
+
+    // make the class non copyable
+    PollingInput(PollingInput&)            = delete;
+    PollingInput& operator=(PollingInput&) = delete;
+
+    // methods called by the tasks for reading the inputs
+    uint8_t getCurrentGear();
+    uint8_t getCurrentGearSize() const;
+    std::chrono::milliseconds getCurrentRotationTime();
+    bool checkReset();
+    std::chrono::microseconds getPressTime();
+
+    // the reset is always served by the reset task
+    void serveReset(mbed::Callback<void()> resetHandler);
+
+    GearDevice& getGearDevice();
+
+   private:
+    // data members
+    GearDevice _gearDevice;
+    PedalDevice _pedalDevice;
+    ResetDevice _resetDevice;
+};
+
+}  // namespace static_scheduling
@@ -0,0 +1,95 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file super_loop_scheduling.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Super-loop scheduling policy implementation (static scheduling)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include "super_loop_scheduling.hpp"
+
+#include <chrono>
+
+#include "bike_system.hpp"
+
+#include "mbed_trace.h"
+#if MBED_CONF_MBED_TRACE_ENABLE
+#define TRACE_GROUP "SuperLoopScheduling"
+#endif  // MBED_CONF_MBED_TRACE_ENABLE
+
+namespace static_scheduling {
+
+template <typename System>
+void SuperLoopScheduling::start(System& system) {
+    tr_info("Starting Super-Loop without event handling");
+
+    system.init();
+
+    // the cyclic schedule is built from the task table
+    bike_computer::TaskTable::Job jobs[bike_computer::TaskTable::kMaxNbrOfJobs];
+    uint8_t nbrOfJobs                    = system._taskTable.buildCyclicSchedule(jobs);
+    std::chrono::milliseconds majorCycle = system._taskTable.getMajorCycle();
+
+    while (true) {
+        auto startTime = system._timer.elapsed_time();
+
+        // schedule tasks, each job being released at its release time at the earliest
+        for (uint8_t jobIndex = 0; jobIndex < nbrOfJobs; jobIndex++) {
+            waitUntil(system, startTime + jobs[jobIndex].releaseTime);
+            system.runTask(jobs[jobIndex].taskIndex);
+        }
+        waitUntil(system, startTime + majorCycle);
+
+        // register the time at the end of the cyclic schedule period and print the
+        // elapsed time for the period
+        std::chrono::microseconds endTime = system._timer.elapsed_time();
+        const auto cycle =
+            std::chrono::duration_cast<std::chrono::milliseconds>(endTime - startTime);
+        tr_debug("Repeating cycle time is %" PRIu64 " milliseconds", cycle.count());
+
+        // apply task table changes at the major cycle boundary
+        if (system.onMajorCycle(cycle > majorCycle + bike_computer::kDeadlineTolerance)) {
+            nbrOfJobs  = system._taskTable.buildCyclicSchedule(jobs);
+            majorCycle = system._taskTable.getMajorCycle();
+        }
+
+        if (core_util_atomic_load_bool(&_stopFlag)) {
+            break;
+        }
+    }
+}
+
+void SuperLoopScheduling::stop() { core_util_atomic_store_bool(&_stopFlag, true); }
+
+EventQueue* SuperLoopScheduling::getEventQueue() { return nullptr; }
+
+template <typename System>
+void SuperLoopScheduling::waitUntil(System& system,
+                                    const std::chrono::microseconds& time) {
+    const std::chrono::microseconds now = system._timer.elapsed_time();
+    if (time > now) {
+        ThisThread::sleep_for(
+            std::chrono::duration_cast<std::chrono::milliseconds>(time - now));
+    }
+}
+
+// explicit instantiation for the variants using this policy
+template void SuperLoopScheduling::start(BikeSystem& system);
+
+}  // namespace static_scheduling
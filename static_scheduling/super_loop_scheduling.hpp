@@ -0,0 +1,62 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file super_loop_scheduling.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Super-loop scheduling policy header file (static scheduling)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include "mbed.h"
+
+namespace static_scheduling {
+
+// scheduling policy executing the cyclic schedule built from the task table in a
+// super-loop (no preemption, no event queue)
+class SuperLoopScheduling {
+   public:
+    SuperLoopScheduling() = default;
+
+    // make the class non copyable
+    SuperLoopScheduling(SuperLoopScheduling&)            = delete;
+    SuperLoopScheduling& operator=(SuperLoopScheduling&) = delete;
+
+    // method called by the BikeSystem for running the super-loop (returns when
+    // stopped)
+    template <typename System>
+    void start(System& system);  // NOLINT(runtime/references)
+
+    // method called for stopping the super-loop (at the end of the major cycle)
+    void stop();
+
+    // no event queue is used by this policy
+    EventQueue* getEventQueue();
+
+   private:
+    // private methods
+    template <typename System>
+    void waitUntil(System& system,  // NOLINT(runtime/references)
+                   const std::chrono::microseconds& time);
+
+    // stop flag, used for stopping the super-loop (set in stop())
+    volatile bool _stopFlag = false;
+};
+
+}  // namespace static_scheduling
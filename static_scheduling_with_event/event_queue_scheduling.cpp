@@ -0,0 +1,140 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file event_queue_scheduling.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief EventQueue scheduling policy implementation (static scheduling with event)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include "event_queue_scheduling.hpp"
+
+#include "bike_system.hpp"
+#include "multi_tasking/bike_system.hpp"
+#include "static_scheduling/bike_system.hpp"
+
+#include "mbed_trace.h"
+#if MBED_CONF_MBED_TRACE_ENABLE
+#define TRACE_GROUP "EventQueueScheduling"
+#endif  // MBED_CONF_MBED_TRACE_ENABLE
+
+namespace static_scheduling_with_event {
+
+template <typename System>
+void EventQueueScheduling::start(System& system) {
+    tr_info("Starting EventQueue with event handling");
+
+    system.init();
+
+    // task periods and phases are taken from the task table
+    Event<void()> gearEvent(&_eventQueue, callback(&system, &System::gearTask));
+    _taskEvents[advembsof::TaskLogger::kGearTaskIndex] = &gearEvent;
+
+    Event<void()> speedDistanceEvent(&_eventQueue,
+                                     callback(&system, &System::speedDistanceTask));
+    _taskEvents[advembsof::TaskLogger::kSpeedTaskIndex] = &speedDistanceEvent;
+
+    Event<void()> display1Event(&_eventQueue, callback(&system, &System::displayTask1));
+    _taskEvents[advembsof::TaskLogger::kDisplayTask1Index] = &display1Event;
+
+    Event<void()> resetEvent(&_eventQueue, callback(&system, &System::resetTask));
+    _taskEvents[advembsof::TaskLogger::kResetTaskIndex] = &resetEvent;
+
+    Event<void()> temperatureEvent(&_eventQueue,
+                                   callback(&system, &System::temperatureTask));
+    _taskEvents[advembsof::TaskLogger::kTemperatureTaskIndex] = &temperatureEvent;
+
+    Event<void()> display2Event(&_eventQueue, callback(&system, &System::displayTask2));
+    _taskEvents[advembsof::TaskLogger::kDisplayTask2Index] = &display2Event;
+
+    postTaskEvents(system);
+
+    // the monitor task is released at each major cycle boundary
+    _monitorPeriod   = system._taskTable.getMajorCycle();
+    _lastMonitorTime = system._timer.elapsed_time();
+    Event<void()> monitorEvent(&_eventQueue,
+                               [this, &system]() { monitorTask(system); });
+    _monitorEvent = &monitorEvent;
+    monitorEvent.delay(_monitorPeriod);
+    monitorEvent.period(_monitorPeriod);
+    monitorEvent.post();
+
+    _eventQueue.dispatch_forever();
+
+    _monitorEvent = nullptr;
+
+    // the events are destroyed when leaving this method
+    for (uint8_t taskIndex = 0; taskIndex < bike_computer::TaskTable::kMaxNbrOfTasks;
+         taskIndex++) {
+        _taskEvents[taskIndex] = nullptr;
+    }
+}
+
+void EventQueueScheduling::stop() { _eventQueue.break_dispatch(); }
+
+EventQueue* EventQueueScheduling::getEventQueue() { return &_eventQueue; }
+
+template <typename System>
+void EventQueueScheduling::monitorTask(System& system) {
+    // a late release of the monitor task means that the event queue is overloaded
+    const std::chrono::microseconds now = system._timer.elapsed_time();
+    const bool deadlineMissed =
+        (now - _lastMonitorTime) > (_monitorPeriod + bike_computer::kDeadlineTolerance);
+
+    _lastMonitorTime = now;
+
+    // the monitor task runs at major cycle boundaries: safe point for re-posting
+    if (system.onMajorCycle(deadlineMissed)) {
+        postTaskEvents(system);
+        // a period change may change the major cycle: the monitor task is re-armed
+        // relative to the current time, as are the tasks
+        const std::chrono::milliseconds majorCycle = system._taskTable.getMajorCycle();
+        if (majorCycle != _monitorPeriod) {
+            _monitorPeriod = majorCycle;
+            _monitorEvent->cancel();
+            _monitorEvent->delay(_monitorPeriod);
+            _monitorEvent->period(_monitorPeriod);
+            _monitorEvent->post();
+        }
+    }
+}
+
+template <typename System>
+void EventQueueScheduling::postTaskEvents(System& system) {
+    for (uint8_t taskIndex = 0; taskIndex < bike_computer::TaskTable::kMaxNbrOfTasks;
+         taskIndex++) {
+        Event<void()>* taskEvent = _taskEvents[taskIndex];
+        if (taskEvent == nullptr || !system._taskTable.isTaskDefined(taskIndex)) {
+            continue;
+        }
+        // (re-)post the event with the phase relative to the current time
+        const bike_computer::TaskTable::Task& task = system._taskTable.getTask(taskIndex);
+        taskEvent->cancel();
+        taskEvent->delay(task.phase);
+        taskEvent->period(task.period);
+        taskEvent->post();
+    }
+}
+
+// explicit instantiation for the variants using this policy
+template void EventQueueScheduling::start(BikeSystem& system);
+template void EventQueueScheduling::start(
+    static_scheduling::BikeSystemWithEventQueue& system);
+template void EventQueueScheduling::start(multi_tasking::BikeSystem& system);
+
+}  // namespace static_scheduling_with_event
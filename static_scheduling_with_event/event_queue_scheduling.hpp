@@ -0,0 +1,73 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file event_queue_scheduling.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief EventQueue scheduling policy header file (static scheduling with event)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include <chrono>
+
+#include "mbed.h"
+#include "task_table.hpp"
+
+namespace static_scheduling_with_event {
+
+// scheduling policy posting each task of the task table as a periodic event on an
+// EventQueue dispatched by the thread calling start()
+class EventQueueScheduling {
+   public:
+    EventQueueScheduling() = default;
+
+    // make the class non copyable
+    EventQueueScheduling(EventQueueScheduling&)            = delete;
+    EventQueueScheduling& operator=(EventQueueScheduling&) = delete;
+
+    // method called by the BikeSystem for dispatching events (returns when stopped)
+    template <typename System>
+    void start(System& system);  // NOLINT(runtime/references)
+
+    // method called for stopping the dispatch of events
+    void stop();
+
+    // EventQueue used for all tasks and input events
+    EventQueue* getEventQueue();
+
+   private:
+    // private methods
+    template <typename System>
+    void monitorTask(System& system);  // NOLINT(runtime/references)
+    template <typename System>
+    void postTaskEvents(System& system);  // NOLINT(runtime/references)
+
+    // EventQueue used by the thread calling start()
+    EventQueue _eventQueue;
+    // events posted for each task of the task table
+    Event<void()>* _taskEvents[bike_computer::TaskTable::kMaxNbrOfTasks] = {nullptr};
+    // event of the monitor task, re-armed when the major cycle changes
+    Event<void()>* _monitorEvent = nullptr;
+    // period and time of the last monitor task activation (for detecting late
+    // releases)
+    std::chrono::milliseconds _monitorPeriod   = std::chrono::milliseconds::zero();
+    std::chrono::microseconds _lastMonitorTime = std::chrono::microseconds::zero();
+};
+
+}  // namespace static_scheduling_with_event
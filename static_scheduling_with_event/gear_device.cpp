@@ -29,6 +29,8 @@
 
 #include "joystick.hpp"
 #include "mbed_trace.h"
+#include "scope_profiler.hpp"
+#include "thread_cpu_monitor.hpp"
 
 #if MBED_CONF_MBED_TRACE_ENABLE
 #define TRACE_GROUP "GearDevice"
@@ -44,12 +46,16 @@ GearDevice::GearDevice() {
 uint8_t GearDevice::getCurrentGear() { return core_util_atomic_load_u8(&_currentGear); }
 
 void GearDevice::onUp() {
+    bike_computer::ThreadCpuMonitor::IsrScope isrScope;
+    PROFILE_SCOPE("GearDevice::onUp");
     if (_currentGear < bike_computer::kMaxGear) {
         core_util_atomic_incr_u8(&_currentGear, 1);
     }
 }
 
 void GearDevice::onDown() {
+    bike_computer::ThreadCpuMonitor::IsrScope isrScope;
+    PROFILE_SCOPE("GearDevice::onDown");
     if (_currentGear > bike_computer::kMinGear) {
         core_util_atomic_decr_u8(&_currentGear, 1);
     }
@@ -0,0 +1,55 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file interrupt_input.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Interrupt-based input policy implementation (static scheduling with event)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#include "interrupt_input.hpp"
+
+namespace static_scheduling_with_event {
+
+InterruptInput::InterruptInput(Timer& timer,
+                               EventQueue* eventQueue,
+                               mbed::Callback<void()> onReset,
+                               mbed::Callback<void()> onInputChanged)
+    : _resetDevice(onReset) {}
+
+uint8_t InterruptInput::getCurrentGear() { return _gearDevice.getCurrentGear(); }
+
+uint8_t InterruptInput::getCurrentGearSize() const {
+    return _gearDevice.getCurrentGearSize();
+}
+
+std::chrono::milliseconds InterruptInput::getCurrentRotationTime() {
+    return _pedalDevice.getCurrentRotationTime();
+}
+
+bool InterruptInput::checkReset() { return false; }
+
+std::chrono::microseconds InterruptInput::getPressTime() {
+    return std::chrono::microseconds::zero();
+}
+
+void InterruptInput::serveReset(mbed::Callback<void()> resetHandler) {}
+
+InterruptInput::GearDevice& InterruptInput::getGearDevice() { return _gearDevice; }
+
+}  // namespace static_scheduling_with_event
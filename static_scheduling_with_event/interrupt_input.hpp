@@ -0,0 +1,78 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file interrupt_input.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Interrupt-based input policy header file (static scheduling with event)
+ *
+ * @date 2026-10-19
+ * @version 1.0.0
+ ***************************************************************************/
+
+#pragma once
+
+#include <chrono>
+
+#include "mbed.h"
+
+// local
+#include "gear_device.hpp"
+#include "pedal_device.hpp"
+#include "reset_device.hpp"
+
+namespace static_scheduling_with_event {
+
+// input policy updating the gear and pedal devices upon interrupts, the values being
+// read by periodic tasks and the reset being signaled through a flag
+class InterruptInput {
+   public:
+    using GearDevice = static_scheduling_with_event::GearDevice;
+
+    // inputs are read by the gear, speed and reset tasks
+    static constexpr bool kIsEventDriven = false;
+
+    // onReset is called in ISR context, the event queue and onInputChanged are not
+    // used
+    InterruptInput(Timer& timer,  // NOLINT(runtime/references)
+                   EventQueue* eventQueue,
+                   mbed::Callback<void()> onReset,
+                   mbed::Callback<void()> onInputChanged);
+
+    // make the class non copyable
+    InterruptInput(InterruptInput&)            = delete;
+    InterruptInput& operator=(InterruptInput&) = delete;
+
+    // methods called by the tasks for reading the inputs
+    uint8_t getCurrentGear();
+    uint8_t getCurrentGearSize() const;
+    std::chrono::milliseconds getCurrentRotationTime();
+    // the reset is signaled through onReset()
+    bool checkReset();
+    std::chrono::microseconds getPressTime();
+
+    // the reset flag is checked by the reset task
+    void serveReset(mbed::Callback<void()> resetHandler);
+
+    GearDevice& getGearDevice();
+
+   private:
+    // data members
+    GearDevice _gearDevice;
+    PedalDevice _pedalDevice;
+    ResetDevice _resetDevice;
+};
+
+}  // namespace static_scheduling_with_event
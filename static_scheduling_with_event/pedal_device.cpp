@@ -27,6 +27,8 @@
 // from disco_h747i/wrappers
 #include "joystick.hpp"
 #include "mbed_trace.h"
+#include "scope_profiler.hpp"
+#include "thread_cpu_monitor.hpp"
 
 #if MBED_CONF_MBED_TRACE_ENABLE
 #define TRACE_GROUP "PedalDevice"
@@ -40,9 +42,17 @@ PedalDevice::PedalDevice() {
         callback(this, &PedalDevice::onRight));
 }
 
-void PedalDevice::onLeft() { decreaseRotationSpeed(); }
+void PedalDevice::onLeft() {
+    bike_computer::ThreadCpuMonitor::IsrScope isrScope;
+    PROFILE_SCOPE("PedalDevice::onLeft");
+    decreaseRotationSpeed();
+}
 
-void PedalDevice::onRight() { increaseRotationSpeed(); }
+void PedalDevice::onRight() {
+    bike_computer::ThreadCpuMonitor::IsrScope isrScope;
+    PROFILE_SCOPE("PedalDevice::onRight");
+    increaseRotationSpeed();
+}
 
 std::chrono::milliseconds PedalDevice::getCurrentRotationTime() {
     uint32_t currentStep = core_util_atomic_load_u32(&_currentStep);